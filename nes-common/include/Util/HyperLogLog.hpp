@@ -0,0 +1,76 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace NES
+{
+/// Estimates the number of distinct values in a stream of hashes with a standard error of about 1.6% in 4 KiB, c.f.,
+/// Flajolet et al. "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm".
+/// The hashes must be uniformly distributed over all 64 bits, e.g., the hashes that our hash maps store for their keys.
+/// Merging two sketches yields the sketch of the union of both streams. Thus, each worker thread can build a sketch of its own.
+/// IMPORTANT: This class is NOT thread-safe
+class HyperLogLog
+{
+public:
+    static constexpr uint8_t PRECISION = 12;
+    static constexpr uint64_t NUMBER_OF_REGISTERS = 1UL << PRECISION;
+
+    void add(const uint64_t hash)
+    {
+        const auto registerIndex = hash >> (64 - PRECISION);
+        /// The rank is the position of the first set bit after the register index. The sentinel bit limits it, if no bit is set.
+        const auto remainingBits = (hash << PRECISION) | (1UL << (PRECISION - 1));
+        const auto rank = static_cast<uint8_t>(std::countl_zero(remainingBits) + 1);
+        registers[registerIndex] = std::max(registers[registerIndex], rank);
+    }
+
+    void merge(const HyperLogLog& other)
+    {
+        std::ranges::transform(
+            registers, other.registers, registers.begin(), [](const uint8_t lhs, const uint8_t rhs) { return std::max(lhs, rhs); });
+    }
+
+    [[nodiscard]] double estimate() const
+    {
+        constexpr auto numberOfRegisters = static_cast<double>(NUMBER_OF_REGISTERS);
+        constexpr auto alpha = 0.7213 / (1.0 + (1.079 / numberOfRegisters));
+        double sum = 0;
+        uint64_t numberOfEmptyRegisters = 0;
+        for (const auto rank : registers)
+        {
+            sum += std::ldexp(1.0, -rank);
+            numberOfEmptyRegisters += static_cast<uint64_t>(rank == 0);
+        }
+
+        const auto rawEstimate = alpha * numberOfRegisters * numberOfRegisters / sum;
+        /// For small cardinalities, counting the empty registers is more accurate. A 64-bit hash requires no large range correction.
+        if (rawEstimate <= 2.5 * numberOfRegisters and numberOfEmptyRegisters > 0)
+        {
+            return numberOfRegisters * std::log(numberOfRegisters / static_cast<double>(numberOfEmptyRegisters));
+        }
+        return rawEstimate;
+    }
+
+private:
+    std::array<uint8_t, NUMBER_OF_REGISTERS> registers{};
+};
+
+}
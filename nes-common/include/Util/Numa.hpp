@@ -0,0 +1,36 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/// Minimal NUMA topology helpers based on sysfs and plain syscalls, so that we do not depend on libnuma.
+/// Machines or containers without NUMA information are reported as a single node 0 that contains all cpus.
+namespace NES
+{
+using NumaNode = size_t;
+
+///Returns the online NUMA nodes in ascending order. Never empty.
+std::vector<NumaNode> getNumaNodes();
+
+///Returns the cpus that belong to the NUMA node.
+std::vector<size_t> getCpusOfNumaNode(NumaNode node);
+
+///Returns the NUMA node of the cpu the calling thread is currently running on.
+NumaNode getCurrentNumaNode();
+
+///Restricts the calling thread to the cpus of the NUMA node. Returns false if the affinity could not be changed.
+bool pinCurrentThreadToNumaNode(NumaNode node);
+}
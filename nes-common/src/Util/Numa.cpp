@@ -0,0 +1,135 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/Numa.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Strings.hpp>
+#include <fmt/format.h>
+
+namespace NES
+{
+namespace
+{
+constexpr std::string_view SYSFS_NODE_PATH = "/sys/devices/system/node";
+
+///Parses the sysfs list format, e.g., "0-3,8,10-11".
+std::vector<size_t> parseSysfsList(std::string_view list)
+{
+    std::vector<size_t> result;
+    for (const auto& range : Util::splitWithStringDelimiter<std::string_view>(list, ","))
+    {
+        const auto dash = range.find('-');
+        const auto first = Util::from_chars<size_t>(range.substr(0, dash));
+        const auto last = dash == std::string_view::npos ? first : Util::from_chars<size_t>(range.substr(dash + 1));
+        if (!first || !last)
+        {
+            continue;
+        }
+        for (size_t value = *first; value <= *last; ++value)
+        {
+            result.push_back(value);
+        }
+    }
+    return result;
+}
+
+std::vector<size_t> readSysfsList(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    if (!file || !std::getline(file, line))
+    {
+        return {};
+    }
+    return parseSysfsList(Util::trimWhiteSpaces(line));
+}
+
+std::vector<size_t> allCpus()
+{
+    std::vector<size_t> cpus(std::max(1U, std::thread::hardware_concurrency()));
+    std::ranges::generate(cpus, [cpu = size_t{0}]() mutable { return cpu++; });
+    return cpus;
+}
+}
+
+std::vector<NumaNode> getNumaNodes()
+{
+    static const std::vector<NumaNode> nodes = []
+    {
+        auto online = readSysfsList(fmt::format("{}/online", SYSFS_NODE_PATH));
+        if (online.empty())
+        {
+            NES_DEBUG("No NUMA topology information found. Assuming a single NUMA node.");
+            return std::vector<NumaNode>{0};
+        }
+        return online;
+    }();
+    return nodes;
+}
+
+std::vector<size_t> getCpusOfNumaNode(const NumaNode node)
+{
+    auto cpus = readSysfsList(fmt::format("{}/node{}/cpulist", SYSFS_NODE_PATH, node));
+    if (cpus.empty() && getNumaNodes().size() == 1)
+    {
+        return allCpus();
+    }
+    return cpus;
+}
+
+NumaNode getCurrentNumaNode()
+{
+    /// getcpu is served via the vDSO and does not require a context switch.
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (getcpu(&cpu, &node) != 0)
+    {
+        return getNumaNodes().front();
+    }
+    return node;
+}
+
+bool pinCurrentThreadToNumaNode(const NumaNode node)
+{
+    const auto cpus = getCpusOfNumaNode(node);
+    if (cpus.empty())
+    {
+        NES_WARNING("Cannot pin thread to NUMA node {}, as it has no cpus", node);
+        return false;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const auto cpu : cpus)
+    {
+        CPU_SET(cpu, &cpuSet);
+    }
+    if (const auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet); result != 0)
+    {
+        NES_WARNING("Cannot pin thread to NUMA node {}: error code {}", node, result);
+        return false;
+    }
+    return true;
+}
+}
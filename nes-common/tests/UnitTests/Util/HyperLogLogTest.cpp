@@ -0,0 +1,80 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <Util/HyperLogLog.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class HyperLogLogTest : public ::testing::Test
+{
+protected:
+    /// Finalizer of splitmix64, which spreads consecutive values uniformly over all 64 bits
+    static uint64_t hash(uint64_t value)
+    {
+        value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9UL;
+        value = (value ^ (value >> 27U)) * 0x94d049bb133111ebUL;
+        return value ^ (value >> 31U);
+    }
+
+    static HyperLogLog createSketch(const uint64_t firstValue, const uint64_t numberOfValues)
+    {
+        HyperLogLog sketch;
+        for (uint64_t value = firstValue; value < firstValue + numberOfValues; ++value)
+        {
+            sketch.add(hash(value));
+        }
+        return sketch;
+    }
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(HyperLogLogTest, emptySketchEstimatesZero)
+{
+    EXPECT_DOUBLE_EQ(HyperLogLog{}.estimate(), 0.0);
+}
+
+TEST_F(HyperLogLogTest, estimatesSmallAndLargeCardinalities)
+{
+    for (const uint64_t numberOfValues : {10UL, 1000UL, 100000UL, 10000000UL})
+    {
+        const auto estimate = createSketch(0, numberOfValues).estimate();
+        EXPECT_NEAR(estimate, static_cast<double>(numberOfValues), 0.05 * static_cast<double>(numberOfValues)) << numberOfValues;
+    }
+}
+
+TEST_F(HyperLogLogTest, duplicatesDoNotChangeTheEstimate)
+{
+    auto sketch = createSketch(0, 10000);
+    const auto estimate = sketch.estimate();
+    for (uint64_t value = 0; value < 10000; ++value)
+    {
+        sketch.add(hash(value));
+    }
+    EXPECT_DOUBLE_EQ(sketch.estimate(), estimate);
+}
+
+TEST_F(HyperLogLogTest, mergeEstimatesTheUnion)
+{
+    /// Both sketches share half of their values
+    auto sketch = createSketch(0, 100000);
+    sketch.merge(createSketch(50000, 100000));
+    EXPECT_NEAR(sketch.estimate(), 150000.0, 0.05 * 150000.0);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
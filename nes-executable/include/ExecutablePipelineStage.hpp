@@ -22,6 +22,15 @@
 namespace NES
 {
 
+/// Describes where a pipeline stage took its compiled code from during `start`
+enum class CompilationCacheResult : uint8_t
+{
+    /// The stage did not look up its code in a cache, e.g., as it is interpreted or the cache is disabled
+    NOT_CACHED,
+    HIT,
+    MISS
+};
+
 /// The ExecutablePipelineStage is the interface that describes a processing step within a stream processing query.
 class ExecutablePipelineStage
 {
@@ -41,6 +50,9 @@ public:
     /// `stop` may throw to indicate an error.
     virtual void stop(PipelineExecutionContext& pipelineExecutionContext) = 0;
 
+    /// Returns whether the last `start` found the compiled code of the stage in a cache.
+    [[nodiscard]] virtual CompilationCacheResult getCompilationCacheResult() const { return CompilationCacheResult::NOT_CACHED; }
+
     friend std::ostream& operator<<(std::ostream& os, const ExecutablePipelineStage& eps) { return eps.toString(os); }
 
 protected:
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -54,5 +55,12 @@ public:
     /// TODO #30 Remove OperatorHandler from the pipeline execution context
     virtual std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() = 0;
     virtual void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>&) = 0;
+
+    /// Keeps the resource alive until this context gets destroyed. The query engine creates a context per task. Thus, a resource that an
+    /// operator acquires in open() and releases in close(), e.g., a lock, also gets released if the task fails in between.
+    void keepAliveUntilTaskEnds(std::shared_ptr<void> resource) { taskResources.emplace_back(std::move(resource)); }
+
+private:
+    std::vector<std::shared_ptr<void>> taskResources;
 };
 }
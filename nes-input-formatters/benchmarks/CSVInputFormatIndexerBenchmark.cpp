@@ -0,0 +1,93 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <benchmark/benchmark.h>
+#include <CSVInputFormatIndexer.hpp>
+#include <FieldOffsets.hpp>
+#include <RawTupleBuffer.hpp>
+
+/// This Benchmark measures how many bytes of raw CSV data per second the CSVInputFormatIndexer indexes. The argument is the number of
+/// fields per tuple, which covers narrow and wide schemas. Single byte delimiters use the structural indexer that classifies the buffer
+/// in blocks of 64 bytes. Multi-byte delimiters use the search based indexer, which serves as the baseline.
+
+namespace
+{
+constexpr uint32_t BUFFER_SIZE = 64 * 1024;
+constexpr uint32_t NUMBER_OF_BUFFERS = 64;
+
+/// Fills a raw buffer with tuples of random integers. The buffer starts with the end of a spanning tuple, like most raw buffers do.
+std::string createRawData(const size_t numberOfFields, const std::string& tupleDelimiter, const std::string& fieldDelimiter)
+{
+    std::mt19937 randomGenerator(42); ///NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_int_distribution<uint32_t> values(0, 1000 * 1000);
+    std::string rawData = "123";
+    while (rawData.size() < BUFFER_SIZE)
+    {
+        rawData += tupleDelimiter;
+        for (size_t field = 0; field < numberOfFields; ++field)
+        {
+            rawData += (field == 0 ? "" : fieldDelimiter) + std::to_string(values(randomGenerator));
+        }
+    }
+    rawData.resize(BUFFER_SIZE);
+    return rawData;
+}
+
+void indexRawBuffers(benchmark::State& state, const std::string& tupleDelimiter, const std::string& fieldDelimiter)
+{
+    const auto numberOfFields = static_cast<size_t>(state.range(0));
+    const auto bufferManager = NES::BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const NES::ParserConfig config{.parserType = "CSV", .tupleDelimiter = tupleDelimiter, .fieldDelimiter = fieldDelimiter};
+    const NES::CSVInputFormatIndexer indexer(config, numberOfFields);
+    const NES::CSVMetaData metaData(config, NES::Schema{});
+
+    auto tupleBuffer = bufferManager->getBufferBlocking();
+    const auto rawData = createRawData(numberOfFields, tupleDelimiter, fieldDelimiter);
+    std::memcpy(tupleBuffer.getBuffer<char>(), rawData.data(), rawData.size());
+    tupleBuffer.setNumberOfTuples(rawData.size());
+    const NES::RawTupleBuffer rawBuffer(tupleBuffer);
+
+    for (auto _ : state)
+    {
+        NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD> fieldOffsets(*bufferManager);
+        indexer.indexRawBuffer(fieldOffsets, rawBuffer, metaData);
+        benchmark::DoNotOptimize(fieldOffsets.getTotalNumberOfTuples());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * rawData.size()));
+}
+}
+
+static void BM_IndexSingleByteDelimiters(benchmark::State& state)
+{
+    indexRawBuffers(state, "\n", ",");
+}
+
+static void BM_IndexMultiByteDelimiters(benchmark::State& state)
+{
+    indexRawBuffers(state, "\r\n", ",");
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_IndexSingleByteDelimiters)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK(BM_IndexMultiByteDelimiters)->Arg(4)->Arg(16)->Arg(64);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
@@ -25,5 +27,10 @@ namespace NES
 {
 std::unique_ptr<InputFormatterTaskPipeline> provideInputFormatterTask(const Schema& schema, const ParserConfig& config);
 
+/// Creates an InputFormatterTask that only parses the fields in 'fieldsToParse'. The formatted buffers keep the layout of the schema, but
+/// the values of all other fields are undefined. Thus, successors must not read fields that are not in 'fieldsToParse'.
+std::unique_ptr<InputFormatterTaskPipeline>
+provideInputFormatterTask(const Schema& schema, const ParserConfig& config, const std::vector<std::string>& fieldsToParse);
+
 bool contains(const std::string& parserType);
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <string_view>
 
@@ -29,6 +30,43 @@ namespace NES
 
 constexpr auto CSV_NUM_OFFSETS_PER_FIELD = NumRequiredOffsetsPerField::ONE;
 
+/// Instruction sets that the structural indexer may use to classify blocks of 64 bytes into bitmasks of delimiters.
+enum class CSVBlockClassifier : uint8_t
+{
+    SCALAR,
+    SSE2,
+    AVX2,
+};
+
+/// The two ways in which the CSVInputFormatIndexer indexes raw buffers. Exposed (privately), so that tests can check that all block
+/// classifiers of the structural indexer produce the same offsets as searching for the delimiters.
+namespace CSVIndexing
+{
+[[nodiscard]] bool isSupportedByCPU(CSVBlockClassifier blockClassifier);
+
+/// Returns the fastest block classifier that the CPU supports. The CSVInputFormatIndexer calls this function once at runtime.
+[[nodiscard]] CSVBlockClassifier selectBlockClassifier();
+
+/// Returns a bitmask over the 64 bytes starting at 'block'. Bit i is set, if the i-th byte equals 'byte'.
+[[nodiscard]] uint64_t matchByte(CSVBlockClassifier blockClassifier, const char* block, char byte);
+
+/// Indexes a buffer whose tuple and field delimiters are single bytes in blocks of 64 bytes.
+void indexWithSingleByteDelimiters(
+    CSVBlockClassifier blockClassifier,
+    FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    std::string_view bufferView,
+    char tupleDelimiter,
+    char fieldDelimiter,
+    size_t numberOfFieldsInSchema);
+
+/// Indexes a buffer by searching for the (multi-byte) tuple and field delimiters.
+void indexBySearchingDelimiters(
+    FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    std::string_view bufferView,
+    const ParserConfig& config,
+    size_t numberOfFieldsInSchema);
+}
+
 struct CSVMetaData
 {
     explicit CSVMetaData(const ParserConfig& config, const Schema&) : tupleDelimiter(config.tupleDelimiter) { };
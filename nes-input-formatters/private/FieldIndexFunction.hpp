@@ -70,7 +70,7 @@ public:
         size_t numTuplesReadFromRawBuffer,
         TupleBuffer& formattedBuffer,
         const SchemaInfo& schemaInfo,
-        const std::vector<ParseFunctionSignature>& parseFunctions,
+        const std::vector<FieldParser>& fieldParsers,
         AbstractBufferProvider& bufferProvider);
 
     friend Derived;
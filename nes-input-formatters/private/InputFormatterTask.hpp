@@ -72,8 +72,31 @@ inline size_t calculateNumberOfRequiredFormattedBuffers(
     return numberOfBuffersToFill;
 }
 
+/// Creates a parser for each field in 'fieldsToParse' in the order of the schema. The formatted buffer keeps the layout of the full schema,
+/// but the InputFormatterTask neither parses nor writes fields that no successor reads. This saves the conversion of unused fields and,
+/// for unused VARSIZED fields, the allocation of a child buffer.
+inline std::vector<FieldParser>
+createFieldParsers(const Schema& schema, const QuotationType quotationType, const std::vector<std::string>& fieldsToParse)
+{
+    std::vector<FieldParser> fieldParsers;
+    size_t offsetInTupleInBytes = 0;
+    for (size_t fieldIndex = 0; fieldIndex < schema.getNumberOfFields(); ++fieldIndex)
+    {
+        const auto& field = schema.getFieldAt(fieldIndex);
+        if (std::ranges::contains(fieldsToParse, field.name))
+        {
+            fieldParsers.push_back(
+                {.fieldIndex = fieldIndex,
+                 .offsetInTupleInBytes = offsetInTupleInBytes,
+                 .parseFunction = getParseFunction(field.dataType.type, quotationType)});
+        }
+        offsetInTupleInBytes += field.dataType.getSizeInBytes();
+    }
+    return fieldParsers;
+}
+
 /// Takes a view over the raw bytes of a tuple, and a fieldIndexFunction that knows the field offsets in the raw bytes of the tuple.
-/// Iterates over all fields of the tuple and parses each field using the corresponding 'parse function'.
+/// Iterates over the fields that the fieldParsers select and parses each field using the corresponding 'parse function'.
 template <typename FieldIndexFunctionType>
 void processTuple(
     const std::string_view tupleView,
@@ -81,27 +104,21 @@ void processTuple(
     const size_t numTuplesReadFromRawBuffer,
     TupleBuffer& formattedBuffer,
     const SchemaInfo& schemaInfo,
-    const std::vector<ParseFunctionSignature>& parseFunctions,
+    const std::vector<FieldParser>& fieldParsers,
     AbstractBufferProvider& bufferProvider /// for getting unpooled buffers for varsized data
 )
 {
     const size_t currentTupleIdx = formattedBuffer.getNumberOfTuples();
     const size_t offsetOfCurrentTupleInBytes = currentTupleIdx * schemaInfo.getSizeOfTupleInBytes();
-    size_t offsetOfCurrentFieldInBytes = 0;
 
     /// Currently, we still allow only row-wise writing to the formatted buffer
     /// This will will change with #496, which implements the InputFormatterTask in Nautilus
     /// The InputFormatterTask then becomes part of a pipeline with a scan/emit phase and has access to the MemoryProvider
-    for (size_t fieldIndex = 0; fieldIndex < schemaInfo.getFieldSizesInBytes().size(); ++fieldIndex)
+    for (const auto& [fieldIndex, offsetInTupleInBytes, parseFunction] : fieldParsers)
     {
         /// Get the current field, parse it, and write it to the correct position in the formatted buffer
         const auto currentFieldSV = fieldIndexFunction.readFieldAt(tupleView, numTuplesReadFromRawBuffer, fieldIndex);
-        const auto writeOffsetInBytes = offsetOfCurrentTupleInBytes + offsetOfCurrentFieldInBytes;
-        parseFunctions[fieldIndex](currentFieldSV, writeOffsetInBytes, bufferProvider, formattedBuffer);
-
-        /// Add the size of the current field to the running offset to get the offset of the next field
-        const auto sizeOfCurrentFieldInBytes = schemaInfo.getFieldSizesInBytes().at(fieldIndex);
-        offsetOfCurrentFieldInBytes += sizeOfCurrentFieldInBytes;
+        parseFunction(currentFieldSV, offsetOfCurrentTupleInBytes + offsetInTupleInBytes, bufferProvider, formattedBuffer);
     }
 }
 
@@ -118,7 +135,7 @@ void processSpanningTuple(
     const SchemaInfo& schemaInfo,
     const typename FormatterType::IndexerMetaData& indexerMetaData,
     const FormatterType& inputFormatIndexer,
-    const std::vector<ParseFunctionSignature>& parseFunctions)
+    const std::vector<FieldParser>& fieldParsers)
 {
     INVARIANT(stagedBuffersSpan.size() >= 2, "A spanning tuple must span across at least two buffers");
     /// If the buffers are not empty, there are at least three buffers
@@ -149,7 +166,7 @@ void processSpanningTuple(
         lastBuffer.setSpanningTuple(completeSpanningTuple);
         inputFormatIndexer.indexRawBuffer(fieldIndexFunction, lastBuffer.getRawTupleBuffer(), indexerMetaData);
         processTuple<typename FormatterType::FieldIndexFunctionType>(
-            completeSpanningTuple, fieldIndexFunction, 0, formattedBuffer, schemaInfo, parseFunctions, bufferProvider);
+            completeSpanningTuple, fieldIndexFunction, 0, formattedBuffer, schemaInfo, fieldParsers, bufferProvider);
         formattedBuffer.setNumberOfTuples(formattedBuffer.getNumberOfTuples() + 1);
     }
 }
@@ -169,7 +186,11 @@ public:
     static constexpr bool hasSpanningTuple() { return FormatterType::HasSpanningTuple; }
 
     explicit InputFormatterTask(
-        FormatterType inputFormatIndexer, const Schema& schema, const QuotationType quotationType, const ParserConfig& parserConfig)
+        FormatterType inputFormatIndexer,
+        const Schema& schema,
+        const QuotationType quotationType,
+        const ParserConfig& parserConfig,
+        const std::vector<std::string>& fieldsToParse)
 
         : inputFormatIndexer(std::move(inputFormatIndexer))
         , schemaInfo(schema)
@@ -177,12 +198,9 @@ public:
         /// Only if we need to resolve spanning tuples, we need the SequenceShredder
         , sequenceShredder(hasSpanningTuple() ? std::make_unique<SequenceShredder>(parserConfig.tupleDelimiter.size()) : nullptr)
         /// Since we know the schema, we can create a vector that contains a function that converts the string representation of a field value
-        /// to our internal representation in the correct order. During parsing, we iterate over the fields in each tuple, and, using the current
-        /// field number, load the correct function for parsing from the vector.
-        , parseFunctions(
-              schema.getFields()
-              | std::views::transform([quotationType](const auto& field) { return getParseFunction(field.dataType.type, quotationType); })
-              | std::ranges::to<std::vector>())
+        /// to our internal representation in the correct order. During parsing, we iterate over the parsers of the fields that the query
+        /// accesses, which know the index of their field in the raw tuple and the offset of their field in the formatted tuple.
+        , fieldParsers(createFieldParsers(schema, quotationType, fieldsToParse))
     {
     }
 
@@ -281,7 +299,7 @@ private:
     SchemaInfo schemaInfo;
     typename FormatterType::IndexerMetaData indexerMetaData;
     std::unique_ptr<SequenceShredder> sequenceShredder; /// unique_ptr, because mutex is not copiable
-    std::vector<ParseFunctionSignature> parseFunctions;
+    std::vector<FieldParser> fieldParsers;
 
     /// Called by processRawBufferWithTupleDelimiter if the raw buffer contains at least one full tuple.
     /// Iterates over all full tuples, using the indexes in FieldOffsets and parses the tuples into formatted data.
@@ -330,7 +348,7 @@ private:
                     numTuplesReadFromRawBuffer,
                     formattedBuffer,
                     this->schemaInfo,
-                    this->parseFunctions,
+                    this->fieldParsers,
                     *bufferProvider);
                 formattedBuffer.setNumberOfTuples(formattedBuffer.getNumberOfTuples() + 1);
                 ++numTuplesReadFromRawBuffer;
@@ -370,7 +388,7 @@ private:
                 this->schemaInfo,
                 this->indexerMetaData,
                 this->inputFormatIndexer,
-                this->parseFunctions);
+                this->fieldParsers);
         }
 
         /// 2. process tuples in buffer
@@ -400,7 +418,7 @@ private:
                 this->schemaInfo,
                 this->indexerMetaData,
                 this->inputFormatIndexer,
-                this->parseFunctions);
+                this->fieldParsers);
         }
         /// If a raw buffer contains exactly one delimiter, but does not complete a spanning tuple, the formatted buffer does not contain a tuple
         if (formattedBuffer.getNumberOfTuples() != 0)
@@ -439,7 +457,7 @@ private:
             this->schemaInfo,
             this->indexerMetaData,
             this->inputFormatIndexer,
-            this->parseFunctions);
+            this->fieldParsers);
 
         formattedBuffer.setSequenceNumber(rawBuffer.getSequenceNumber());
         formattedBuffer.setChunkNumber(ChunkNumber(runningChunkNumber++));
@@ -15,7 +15,6 @@
 #pragma once
 
 #include <cstddef>
-#include <functional>
 #include <string_view>
 
 #include <DataTypes/DataType.hpp>
@@ -32,8 +31,17 @@ enum class QuotationType : uint8_t
     DOUBLE_QUOTE
 };
 
-using ParseFunctionSignature = std::function<void(
-    std::string_view inputString, size_t writeOffsetInBytes, AbstractBufferProvider& bufferProvider, TupleBuffer& tupleBufferFormatted)>;
+/// All parse functions are stateless. Thus, we call them through a plain function pointer instead of a std::function.
+using ParseFunctionSignature = void (*)(
+    std::string_view inputString, size_t writeOffsetInBytes, AbstractBufferProvider& bufferProvider, TupleBuffer& tupleBufferFormatted);
+
+/// Parses the field with the index 'fieldIndex' of a raw tuple and writes it at 'offsetInTupleInBytes' into the formatted tuple.
+struct FieldParser
+{
+    size_t fieldIndex;
+    size_t offsetInTupleInBytes;
+    ParseFunctionSignature parseFunction;
+};
 
 /// Takes a target integer type and an integer value represented as a string. Attempts to parse the string to a C++ integer of the target type.
 /// @Note throws CannotFormatMalformedStringValue if the parsing fails.
@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
@@ -37,8 +38,8 @@ using InputFormatIndexerRegistryReturnType = std::unique_ptr<InputFormatterTaskP
 /// Calls constructor of specific InputFormatter and exposes public members to it.
 struct InputFormatIndexerRegistryArguments
 {
-    InputFormatIndexerRegistryArguments(ParserConfig config, const Schema& schema)
-        : inputFormatIndexerConfig(std::move(config)), schema(schema)
+    InputFormatIndexerRegistryArguments(ParserConfig config, const Schema& schema, std::vector<std::string> fieldsToParse)
+        : inputFormatIndexerConfig(std::move(config)), schema(schema), fieldsToParse(std::move(fieldsToParse))
     {
     }
 
@@ -49,7 +50,7 @@ struct InputFormatIndexerRegistryArguments
     InputFormatIndexerRegistryReturnType createInputFormatterTaskPipeline(FormatterType inputFormatter, const QuotationType quotationType)
     {
         auto inputFormatterTask
-            = InputFormatterTask<FormatterType>(std::move(inputFormatter), schema, quotationType, inputFormatIndexerConfig);
+            = InputFormatterTask<FormatterType>(std::move(inputFormatter), schema, quotationType, inputFormatIndexerConfig, fieldsToParse);
         return std::make_unique<InputFormatterTaskPipeline>(std::move(inputFormatterTask));
     }
 
@@ -59,6 +60,8 @@ struct InputFormatIndexerRegistryArguments
 
 private:
     Schema schema;
+    /// Names of the fields that successors of the InputFormatterTask read. The InputFormatterTask skips all other fields.
+    std::vector<std::string> fieldsToParse;
 };
 
 class InputFormatIndexerRegistry : public BaseRegistry<
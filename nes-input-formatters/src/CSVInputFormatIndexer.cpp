@@ -14,7 +14,13 @@
 
 #include <CSVInputFormatIndexer.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -28,9 +34,181 @@
 #include <InputFormatIndexerRegistry.hpp>
 #include <InputFormatterTask.hpp>
 
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
 namespace
 {
 
+/// The structural indexer classifies the raw buffer in blocks of 64 bytes, one bit per byte
+constexpr size_t BLOCK_SIZE = 64;
+
+/// Returns a bitmask over the BLOCK_SIZE bytes starting at 'block'. Bit i is set, if the i-th byte equals 'byte'.
+uint64_t matchByteScalar(const char* block, const char byte)
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+        mask |= static_cast<uint64_t>(block[i] == byte) << i; ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return mask;
+}
+
+#if defined(__x86_64__)
+/// SSE2 is part of the x86-64 baseline, thus it does not require a target attribute
+uint64_t matchByteSSE2(const char* block, const char byte)
+{
+    const auto needle = _mm_set1_epi8(byte);
+    const auto* const quarters = reinterpret_cast<const __m128i*>(block); ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    uint64_t mask = 0;
+    for (size_t quarter = 0; quarter < 4; ++quarter)
+    {
+        const auto bytes = _mm_loadu_si128(quarters + quarter); ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle)))) << (quarter * 16);
+    }
+    return mask;
+}
+
+/// Compiled for AVX2 independent of the target of the build, must only be called if the CPU supports AVX2
+[[gnu::target("avx2")]] uint64_t matchByteAVX2(const char* block, const char byte)
+{
+    const auto needle = _mm256_set1_epi8(byte);
+    const auto* const halves = reinterpret_cast<const __m256i*>(block); ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto lowerHalf = _mm256_loadu_si256(halves);
+    const auto upperHalf = _mm256_loadu_si256(halves + 1); ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto lowerMask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lowerHalf, needle)));
+    const auto upperMask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(upperHalf, needle)));
+    return lowerMask | (static_cast<uint64_t>(upperMask) << 32);
+}
+#endif
+
+/// Indexes a raw buffer whose tuple and field delimiters are single bytes, similar to the structural indexing of simdjson.
+/// Instead of searching for the next delimiter in each tuple, we classify whole blocks of the raw buffer into bitmasks of tuple and field
+/// delimiters and iterate over the set bits of the bitmasks. The bytes of the buffer are thus only touched once, by the comparisons.
+/// Always inlined into one function per block classifier, so that the (target specific) 'MatchByte' is inlined into the loop.
+template <uint64_t (*MatchByte)(const char*, char)>
+[[gnu::always_inline]] inline void indexBlocks(
+    NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    const std::string_view bufferView,
+    const char tupleDelimiter,
+    const char fieldDelimiter,
+    const size_t numberOfFieldsInSchema)
+{
+    bool foundFirstTupleDelimiter = false;
+    NES::FieldIndex offsetOfFirstTupleDelimiter = 0;
+    NES::FieldIndex offsetOfLastTupleDelimiter = 0;
+    size_t fieldIdx = 0;
+
+    for (size_t startOfBlock = 0; startOfBlock < bufferView.size(); startOfBlock += BLOCK_SIZE)
+    {
+        const auto sizeOfBlock = std::min(BLOCK_SIZE, bufferView.size() - startOfBlock);
+        const auto* const block = bufferView.data() + startOfBlock; ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        uint64_t tupleDelimiters = 0;
+        uint64_t fieldDelimiters = 0;
+        if (sizeOfBlock == BLOCK_SIZE)
+        {
+            tupleDelimiters = MatchByte(block, tupleDelimiter);
+            fieldDelimiters = MatchByte(block, fieldDelimiter);
+        }
+        else
+        {
+            /// The last block of the buffer is shorter, thus we copy it and ignore the bytes after the end of the buffer
+            std::array<char, BLOCK_SIZE> lastBlock{};
+            std::memcpy(lastBlock.data(), block, sizeOfBlock);
+            const auto bytesInBlock = (uint64_t{1} << sizeOfBlock) - 1;
+            tupleDelimiters = MatchByte(lastBlock.data(), tupleDelimiter) & bytesInBlock;
+            fieldDelimiters = MatchByte(lastBlock.data(), fieldDelimiter) & bytesInBlock;
+        }
+        /// Same as the search based indexing, tuple delimiters take precedence over field delimiters
+        fieldDelimiters &= ~tupleDelimiters;
+
+        for (auto delimiters = tupleDelimiters | fieldDelimiters; delimiters != 0; delimiters &= delimiters - 1)
+        {
+            const auto positionInBlock = std::countr_zero(delimiters);
+            const auto offset = static_cast<NES::FieldIndex>(startOfBlock + positionInBlock);
+            const auto isTupleDelimiter = ((tupleDelimiters >> positionInBlock) & 1U) != 0;
+            if (not foundFirstTupleDelimiter)
+            {
+                /// All bytes before the first tuple delimiter belong to a spanning tuple
+                if (not isTupleDelimiter)
+                {
+                    continue;
+                }
+                foundFirstTupleDelimiter = true;
+                offsetOfFirstTupleDelimiter = offset;
+            }
+            else if (not isTupleDelimiter)
+            {
+                /// The position after the field delimiter is the beginning of the next field. We count surplus fields, but only write the
+                /// offsets that fit into the offsets of the tuple.
+                if (fieldIdx < numberOfFieldsInSchema)
+                {
+                    fieldOffsets.writeOffsetAt(offset + 1, fieldIdx);
+                }
+                ++fieldIdx;
+                continue;
+            }
+            else
+            {
+                /// The tuple delimiter completes a tuple. Its offset is the end of the last field.
+                if (fieldIdx != numberOfFieldsInSchema)
+                {
+                    throw NES::CannotFormatSourceData(
+                        "Number of parsed fields does not match number of fields in schema (parsed {} vs {} schema",
+                        fieldIdx,
+                        numberOfFieldsInSchema);
+                }
+                fieldOffsets.writeOffsetAt(offset, numberOfFieldsInSchema);
+                fieldOffsets.writeOffsetsOfNextTuple();
+            }
+            /// The tuple delimiter starts the next tuple, whose first field starts directly after the tuple delimiter
+            offsetOfLastTupleDelimiter = offset;
+            fieldOffsets.writeOffsetAt(offset + 1, 0);
+            fieldIdx = 1;
+        }
+    }
+
+    if (not foundFirstTupleDelimiter)
+    {
+        fieldOffsets.markNoTupleDelimiters();
+        return;
+    }
+    fieldOffsets.markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
+}
+
+void indexWithScalar(
+    NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    const std::string_view bufferView,
+    const char tupleDelimiter,
+    const char fieldDelimiter,
+    const size_t numberOfFieldsInSchema)
+{
+    indexBlocks<matchByteScalar>(fieldOffsets, bufferView, tupleDelimiter, fieldDelimiter, numberOfFieldsInSchema);
+}
+
+#if defined(__x86_64__)
+void indexWithSSE2(
+    NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    const std::string_view bufferView,
+    const char tupleDelimiter,
+    const char fieldDelimiter,
+    const size_t numberOfFieldsInSchema)
+{
+    indexBlocks<matchByteSSE2>(fieldOffsets, bufferView, tupleDelimiter, fieldDelimiter, numberOfFieldsInSchema);
+}
+
+[[gnu::target("avx2")]] void indexWithAVX2(
+    NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    const std::string_view bufferView,
+    const char tupleDelimiter,
+    const char fieldDelimiter,
+    const size_t numberOfFieldsInSchema)
+{
+    indexBlocks<matchByteAVX2>(fieldOffsets, bufferView, tupleDelimiter, fieldDelimiter, numberOfFieldsInSchema);
+}
+#endif
+
 void initializeIndexFunctionForTuple(
     NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
     const std::string_view tuple,
@@ -68,13 +246,100 @@ CSVInputFormatIndexer::CSVInputFormatIndexer(ParserConfig config, const size_t n
 {
 }
 
-void CSVInputFormatIndexer::indexRawBuffer(
-    FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const CSVMetaData&) const
+namespace CSVIndexing
 {
-    fieldOffsets.startSetup(numberOfFieldsInSchema, this->config.fieldDelimiter.size());
 
-    const auto sizeOfTupleDelimiter = this->config.tupleDelimiter.size();
-    const auto offsetOfFirstTupleDelimiter = static_cast<FieldIndex>(rawBuffer.getBufferView().find(this->config.tupleDelimiter));
+bool isSupportedByCPU(const CSVBlockClassifier blockClassifier)
+{
+    switch (blockClassifier)
+    {
+        case CSVBlockClassifier::SCALAR:
+            return true;
+#if defined(__x86_64__)
+        case CSVBlockClassifier::SSE2:
+            return true;
+        case CSVBlockClassifier::AVX2:
+            return __builtin_cpu_supports("avx2") != 0;
+#else
+        case CSVBlockClassifier::SSE2:
+        case CSVBlockClassifier::AVX2:
+            return false;
+#endif
+    }
+    std::unreachable();
+}
+
+CSVBlockClassifier selectBlockClassifier()
+{
+    for (const auto blockClassifier : {CSVBlockClassifier::AVX2, CSVBlockClassifier::SSE2})
+    {
+        if (isSupportedByCPU(blockClassifier))
+        {
+            return blockClassifier;
+        }
+    }
+    return CSVBlockClassifier::SCALAR;
+}
+
+uint64_t matchByte(const CSVBlockClassifier blockClassifier, const char* block, const char byte)
+{
+    PRECONDITION(isSupportedByCPU(blockClassifier), "The CPU does not support the requested block classifier.");
+    switch (blockClassifier)
+    {
+        case CSVBlockClassifier::SCALAR:
+            return matchByteScalar(block, byte);
+#if defined(__x86_64__)
+        case CSVBlockClassifier::SSE2:
+            return matchByteSSE2(block, byte);
+        case CSVBlockClassifier::AVX2:
+            return matchByteAVX2(block, byte);
+#else
+        case CSVBlockClassifier::SSE2:
+        case CSVBlockClassifier::AVX2:
+            break;
+#endif
+    }
+    std::unreachable();
+}
+
+void indexWithSingleByteDelimiters(
+    const CSVBlockClassifier blockClassifier,
+    FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    const std::string_view bufferView,
+    const char tupleDelimiter,
+    const char fieldDelimiter,
+    const size_t numberOfFieldsInSchema)
+{
+    PRECONDITION(isSupportedByCPU(blockClassifier), "The CPU does not support the requested block classifier.");
+    switch (blockClassifier)
+    {
+        case CSVBlockClassifier::SCALAR:
+            indexWithScalar(fieldOffsets, bufferView, tupleDelimiter, fieldDelimiter, numberOfFieldsInSchema);
+            return;
+#if defined(__x86_64__)
+        case CSVBlockClassifier::SSE2:
+            indexWithSSE2(fieldOffsets, bufferView, tupleDelimiter, fieldDelimiter, numberOfFieldsInSchema);
+            return;
+        case CSVBlockClassifier::AVX2:
+            indexWithAVX2(fieldOffsets, bufferView, tupleDelimiter, fieldDelimiter, numberOfFieldsInSchema);
+            return;
+#else
+        case CSVBlockClassifier::SSE2:
+        case CSVBlockClassifier::AVX2:
+            break;
+#endif
+    }
+    std::unreachable();
+}
+
+void indexBySearchingDelimiters(
+    FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets,
+    const std::string_view bufferView,
+    const ParserConfig& config,
+    const size_t numberOfFieldsInSchema)
+{
+    const auto sizeOfTupleDelimiter = config.tupleDelimiter.size();
+    const auto offsetOfFirstTupleDelimiter = static_cast<FieldIndex>(bufferView.find(config.tupleDelimiter));
 
     /// If the buffer does not contain a delimiter, set the 'offsetOfFirstTupleDelimiter' to a value larger than the buffer size to tell
     /// the InputFormatIndexerTask that there was no tuple delimiter in the buffer and return
@@ -86,28 +351,52 @@ void CSVInputFormatIndexer::indexRawBuffer(
 
     /// If the buffer contains at least one delimiter, check if it contains more and index all tuples between the tuple delimiters
     auto startIdxOfNextTuple = offsetOfFirstTupleDelimiter + sizeOfTupleDelimiter;
-    size_t endIdxOfNextTuple = rawBuffer.getBufferView().find(this->config.tupleDelimiter, startIdxOfNextTuple);
+    size_t endIdxOfNextTuple = bufferView.find(config.tupleDelimiter, startIdxOfNextTuple);
 
     while (endIdxOfNextTuple != std::string::npos)
     {
         /// Get a string_view for the next tuple, by using the start and the size of the next tuple
         INVARIANT(startIdxOfNextTuple <= endIdxOfNextTuple, "The start index of a tuple cannot be larger than the end index.");
         const auto sizeOfNextTuple = endIdxOfNextTuple - startIdxOfNextTuple;
-        const auto nextTuple = rawBuffer.getBufferView().substr(startIdxOfNextTuple, sizeOfNextTuple);
+        const auto nextTuple = bufferView.substr(startIdxOfNextTuple, sizeOfNextTuple);
 
         /// Determine the offsets to the individual fields of the next tuple, including the start of the first and the end of the last field
-        initializeIndexFunctionForTuple(fieldOffsets, nextTuple, startIdxOfNextTuple, this->config, this->numberOfFieldsInSchema);
+        initializeIndexFunctionForTuple(fieldOffsets, nextTuple, startIdxOfNextTuple, config, numberOfFieldsInSchema);
         fieldOffsets.writeOffsetsOfNextTuple(); ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
         /// Update the start and the end index for the next tuple (if no more tuples in buffer, endIdx is 'std::string::npos')
         startIdxOfNextTuple = endIdxOfNextTuple + sizeOfTupleDelimiter;
-        endIdxOfNextTuple = rawBuffer.getBufferView().find(this->config.tupleDelimiter, startIdxOfNextTuple);
+        endIdxOfNextTuple = bufferView.find(config.tupleDelimiter, startIdxOfNextTuple);
     }
     /// Since 'endIdxOfNextTuple == std::string::npos', we use the startIdx to determine the offset of the last tuple
     const auto offsetOfLastTupleDelimiter = static_cast<FieldIndex>(startIdxOfNextTuple - sizeOfTupleDelimiter);
     fieldOffsets.markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
 }
 
+}
+
+void CSVInputFormatIndexer::indexRawBuffer(
+    FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const CSVMetaData&) const
+{
+    fieldOffsets.startSetup(numberOfFieldsInSchema, this->config.fieldDelimiter.size());
+
+    /// Most formats delimit tuples and fields with a single byte, which allows us to use the (SIMD) structural indexer.
+    /// We select the block classifier once at runtime, so that builds for the x86-64 baseline still use AVX2 if the CPU supports it.
+    if (this->config.tupleDelimiter.size() == 1 and this->config.fieldDelimiter.size() == 1)
+    {
+        static const auto blockClassifier = CSVIndexing::selectBlockClassifier();
+        CSVIndexing::indexWithSingleByteDelimiters(
+            blockClassifier,
+            fieldOffsets,
+            rawBuffer.getBufferView(),
+            this->config.tupleDelimiter.front(),
+            this->config.fieldDelimiter.front(),
+            this->numberOfFieldsInSchema);
+        return;
+    }
+    CSVIndexing::indexBySearchingDelimiters(fieldOffsets, rawBuffer.getBufferView(), this->config, this->numberOfFieldsInSchema);
+}
+
 InputFormatIndexerRegistryReturnType
 RegisterCSVInputFormatIndexer(InputFormatIndexerRegistryArguments arguments) ///NOLINT(performance-unnecessary-value-param)
 {
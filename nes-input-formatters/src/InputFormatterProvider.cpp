@@ -15,7 +15,9 @@
 #include <InputFormatters/InputFormatterProvider.hpp>
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
@@ -29,8 +31,14 @@ namespace NES
 
 std::unique_ptr<InputFormatterTaskPipeline> provideInputFormatterTask(const Schema& schema, const ParserConfig& config)
 {
-    if (auto inputFormatter
-        = InputFormatIndexerRegistry::instance().create(config.parserType, InputFormatIndexerRegistryArguments(config, schema)))
+    return provideInputFormatterTask(schema, config, schema.getFieldNames());
+}
+
+std::unique_ptr<InputFormatterTaskPipeline>
+provideInputFormatterTask(const Schema& schema, const ParserConfig& config, const std::vector<std::string>& fieldsToParse)
+{
+    if (auto inputFormatter = InputFormatIndexerRegistry::instance().create(
+            config.parserType, InputFormatIndexerRegistryArguments(config, schema, fieldsToParse)))
     {
         return std::move(inputFormatter.value());
     }
@@ -18,6 +18,7 @@
 #include <cstring>
 #include <string_view>
 #include <DataTypes/DataType.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <ErrorHandling.hpp>
@@ -25,6 +26,26 @@
 namespace NES
 {
 
+namespace
+{
+/// All strings of a formatted buffer share its variable sized data heap, which avoids allocating a child buffer per string
+void storeString(
+    const std::string_view value,
+    const size_t writeOffsetInBytes,
+    AbstractBufferProvider& bufferProvider,
+    TupleBuffer& tupleBufferFormatted)
+{
+    const auto indexToChildBuffer = writeVarSizedData(tupleBufferFormatted, value, bufferProvider);
+    if (not indexToChildBuffer.has_value())
+    {
+        throw CannotAllocateBuffer("Could not store string, because we cannot allocate a child buffer.");
+    }
+    auto* childBufferIndexPointer = reinterpret_cast<uint32_t*>( ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        tupleBufferFormatted.getBuffer() + writeOffsetInBytes); ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    *childBufferIndexPointer = indexToChildBuffer.value();
+}
+}
+
 ParseFunctionSignature getQuotedStringParseFunction()
 {
     return [](const std::string_view inputString,
@@ -34,23 +55,7 @@ ParseFunctionSignature getQuotedStringParseFunction()
     {
         INVARIANT(inputString.length() >= 2, "Input string must be at least 2 characters long.");
         const auto inputStringWithoutQuotes = inputString.substr(1, inputString.length() - 2);
-        const auto valueLength = inputStringWithoutQuotes.length();
-        auto childBuffer = bufferProvider.getUnpooledBuffer(valueLength + sizeof(uint32_t));
-        if (not childBuffer.has_value())
-        {
-            throw CannotAllocateBuffer("Could not store string, because we cannot allocate a child buffer.");
-        }
-
-        auto& childBufferVal = childBuffer.value();
-        *childBufferVal.getBuffer<uint32_t>() = valueLength;
-        std::memcpy(
-            childBufferVal.getBuffer<char>() + sizeof(uint32_t), ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            inputStringWithoutQuotes.data(),
-            valueLength);
-        const auto indexToChildBuffer = tupleBufferFormatted.storeChildBuffer(childBufferVal);
-        auto* childBufferIndexPointer = reinterpret_cast<uint32_t*>( ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-            tupleBufferFormatted.getBuffer() + writeOffsetInBytes); ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        *childBufferIndexPointer = indexToChildBuffer;
+        storeString(inputStringWithoutQuotes, writeOffsetInBytes, bufferProvider, tupleBufferFormatted);
     };
 }
 
@@ -59,26 +64,7 @@ ParseFunctionSignature getBasicStringParseFunction()
     return [](const std::string_view inputString,
               const size_t writeOffsetInBytes,
               AbstractBufferProvider& bufferProvider,
-              TupleBuffer& tupleBufferFormatted)
-    {
-        const auto valueLength = inputString.length();
-        auto childBuffer = bufferProvider.getUnpooledBuffer(valueLength + sizeof(uint32_t));
-        if (not childBuffer.has_value())
-        {
-            throw CannotAllocateBuffer("Could not store string, because we cannot allocate a child buffer.");
-        }
-
-        auto& childBufferVal = childBuffer.value();
-        *childBufferVal.getBuffer<uint32_t>() = valueLength;
-        std::memcpy(
-            childBufferVal.getBuffer<char>() + sizeof(uint32_t), ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            inputString.data(),
-            valueLength);
-        const auto indexToChildBuffer = tupleBufferFormatted.storeChildBuffer(childBufferVal);
-        auto* childBufferIndexPointer = reinterpret_cast<uint32_t*>( ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-            tupleBufferFormatted.getBuffer() + writeOffsetInBytes); ///NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        *childBufferIndexPointer = indexToChildBuffer;
-    };
+              TupleBuffer& tupleBufferFormatted) { storeString(inputString, writeOffsetInBytes, bufferProvider, tupleBufferFormatted); };
 }
 
 ParseFunctionSignature getStringParseFunction(const QuotationType quotationType)
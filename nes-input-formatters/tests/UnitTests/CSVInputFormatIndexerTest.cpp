@@ -0,0 +1,286 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Runtime/BufferManager.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <CSVInputFormatIndexer.hpp>
+#include <ErrorHandling.hpp>
+#include <FieldOffsets.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+
+/// Tests that the structural indexer of the CSVInputFormatIndexer produces the same offsets for all block classifiers as searching for
+/// the delimiters, particularly for delimiters at the boundaries of the 64 byte blocks.
+class CSVInputFormatIndexerTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("CSVInputFormatIndexerTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup CSVInputFormatIndexerTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create(4096, 64);
+    }
+
+    void TearDown() override { BaseUnitTest::TearDown(); }
+
+    /// The offsets of the tuple delimiters and all fields of all complete tuples in a buffer, or the error code if indexing failed
+    struct IndexedBuffer
+    {
+        FieldIndex offsetOfFirstTupleDelimiter{};
+        FieldIndex offsetOfLastTupleDelimiter{};
+        std::vector<std::vector<std::string>> tuples;
+        std::optional<ErrorCode> error;
+        bool operator==(const IndexedBuffer& other) const = default;
+    };
+
+    /// Indexes the buffer with the structural indexer if a block classifier is given and by searching for the delimiters otherwise
+    IndexedBuffer index(
+        const std::string_view bufferView, const size_t numberOfFields, const std::optional<CSVBlockClassifier> blockClassifier) const
+    {
+        FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD> fieldOffsets(*bufferManager);
+        fieldOffsets.startSetup(numberOfFields, 1);
+        try
+        {
+            if (blockClassifier.has_value())
+            {
+                CSVIndexing::indexWithSingleByteDelimiters(blockClassifier.value(), fieldOffsets, bufferView, '\n', ',', numberOfFields);
+            }
+            else
+            {
+                const ParserConfig config{.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+                CSVIndexing::indexBySearchingDelimiters(fieldOffsets, bufferView, config, numberOfFields);
+            }
+        }
+        catch (const Exception& exception)
+        {
+            return IndexedBuffer{.error = exception.code()};
+        }
+
+        IndexedBuffer indexedBuffer{
+            .offsetOfFirstTupleDelimiter = fieldOffsets.getOffsetOfFirstTupleDelimiter(),
+            .offsetOfLastTupleDelimiter = fieldOffsets.getOffsetOfLastTupleDelimiter()};
+        if (indexedBuffer.offsetOfFirstTupleDelimiter == std::numeric_limits<FieldIndex>::max())
+        {
+            return indexedBuffer;
+        }
+        for (size_t tupleIdx = 0; tupleIdx < fieldOffsets.getTotalNumberOfTuples(); ++tupleIdx)
+        {
+            auto& tuple = indexedBuffer.tuples.emplace_back();
+            for (size_t fieldIdx = 0; fieldIdx < numberOfFields; ++fieldIdx)
+            {
+                tuple.emplace_back(fieldOffsets.readFieldAt(bufferView, tupleIdx, fieldIdx));
+            }
+        }
+        return indexedBuffer;
+    }
+
+    /// Checks that all block classifiers that the CPU supports index the buffer like the search based indexing and returns the result
+    IndexedBuffer indexWithAllClassifiers(const std::string_view bufferView, const size_t numberOfFields) const
+    {
+        const auto expected = index(bufferView, numberOfFields, std::nullopt);
+        for (const auto blockClassifier : supportedBlockClassifiers())
+        {
+            EXPECT_EQ(index(bufferView, numberOfFields, blockClassifier), expected)
+                << "Block classifier " << static_cast<int>(blockClassifier) << " differs for buffer: " << bufferView;
+        }
+        return expected;
+    }
+
+    static std::vector<CSVBlockClassifier> supportedBlockClassifiers()
+    {
+        std::vector<CSVBlockClassifier> blockClassifiers;
+        for (const auto blockClassifier : {CSVBlockClassifier::SCALAR, CSVBlockClassifier::SSE2, CSVBlockClassifier::AVX2})
+        {
+            if (CSVIndexing::isSupportedByCPU(blockClassifier))
+            {
+                blockClassifiers.push_back(blockClassifier);
+            }
+        }
+        return blockClassifiers;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+TEST_F(CSVInputFormatIndexerTest, selectsSupportedBlockClassifier)
+{
+    EXPECT_TRUE(CSVIndexing::isSupportedByCPU(CSVBlockClassifier::SCALAR));
+    EXPECT_TRUE(CSVIndexing::isSupportedByCPU(CSVIndexing::selectBlockClassifier()));
+#if defined(__x86_64__)
+    EXPECT_NE(CSVIndexing::selectBlockClassifier(), CSVBlockClassifier::SCALAR);
+#endif
+}
+
+TEST_F(CSVInputFormatIndexerTest, matchByteSetsBitOfEveryPosition)
+{
+    for (const auto blockClassifier : supportedBlockClassifiers())
+    {
+        for (size_t position = 0; position < 64; ++position)
+        {
+            std::string block(64, 'a');
+            block[position] = '\n';
+            EXPECT_EQ(CSVIndexing::matchByte(blockClassifier, block.data(), '\n'), uint64_t{1} << position);
+            EXPECT_EQ(CSVIndexing::matchByte(blockClassifier, block.data(), 'a'), ~(uint64_t{1} << position));
+            EXPECT_EQ(CSVIndexing::matchByte(blockClassifier, block.data(), ','), 0U);
+        }
+    }
+}
+
+TEST_F(CSVInputFormatIndexerTest, matchByteEqualsScalarForRandomBlocks)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> byteDistribution(std::numeric_limits<char>::min(), std::numeric_limits<char>::max());
+    for (size_t iteration = 0; iteration < 1000; ++iteration)
+    {
+        std::string block(64, '\0');
+        for (auto& byte : block)
+        {
+            byte = static_cast<char>(byteDistribution(rng));
+        }
+        const auto needle = static_cast<char>(byteDistribution(rng));
+        const auto expected = CSVIndexing::matchByte(CSVBlockClassifier::SCALAR, block.data(), needle);
+        for (const auto blockClassifier : supportedBlockClassifiers())
+        {
+            EXPECT_EQ(CSVIndexing::matchByte(blockClassifier, block.data(), needle), expected);
+        }
+    }
+}
+
+TEST_F(CSVInputFormatIndexerTest, fieldAndTupleDelimiterAtEndAndStartOfBlock)
+{
+    /// The field delimiter is the last byte (63) of the first block and the tuple delimiter is the first byte (64) of the second block
+    const auto buffer = "\n" + std::string(62, 'x') + ",\n" + "y,z\n";
+    const auto indexedBuffer = indexWithAllClassifiers(buffer, 2);
+    ASSERT_FALSE(indexedBuffer.error.has_value());
+    EXPECT_EQ(indexedBuffer.offsetOfFirstTupleDelimiter, 0U);
+    EXPECT_EQ(indexedBuffer.offsetOfLastTupleDelimiter, 68U);
+    const std::vector<std::vector<std::string>> expectedTuples{{std::string(62, 'x'), ""}, {"y", "z"}};
+    EXPECT_EQ(indexedBuffer.tuples, expectedTuples);
+}
+
+TEST_F(CSVInputFormatIndexerTest, tupleDelimitersAtEndAndStartOfBlock)
+{
+    /// Tuple delimiters at offsets 63 and 64 enclose an empty tuple
+    const auto buffer = "\n" + std::string(62, 'x') + "\n\n" + "yz\n";
+    const auto indexedBuffer = indexWithAllClassifiers(buffer, 1);
+    ASSERT_FALSE(indexedBuffer.error.has_value());
+    EXPECT_EQ(indexedBuffer.offsetOfFirstTupleDelimiter, 0U);
+    EXPECT_EQ(indexedBuffer.offsetOfLastTupleDelimiter, 67U);
+    const std::vector<std::vector<std::string>> expectedTuples{{std::string(62, 'x')}, {""}, {"yz"}};
+    EXPECT_EQ(indexedBuffer.tuples, expectedTuples);
+}
+
+TEST_F(CSVInputFormatIndexerTest, shortLastBlockIgnoresBytesAfterTheBuffer)
+{
+    /// The buffer ends 10 bytes into the second block, directly followed by delimiters that do not belong to the buffer anymore
+    const auto bytes = "spanning\n" + std::string(61, 'a') + ",b\nc" + "\n,\n";
+    const auto buffer = std::string_view(bytes).substr(0, 74);
+    const auto indexedBuffer = indexWithAllClassifiers(buffer, 2);
+    ASSERT_FALSE(indexedBuffer.error.has_value());
+    EXPECT_EQ(indexedBuffer.offsetOfFirstTupleDelimiter, 8U);
+    EXPECT_EQ(indexedBuffer.offsetOfLastTupleDelimiter, 72U);
+    const std::vector<std::vector<std::string>> expectedTuples{{std::string(61, 'a'), "b"}};
+    EXPECT_EQ(indexedBuffer.tuples, expectedTuples);
+}
+
+TEST_F(CSVInputFormatIndexerTest, bufferWithoutTupleDelimiter)
+{
+    /// The whole buffer belongs to a single spanning tuple, thus the indexer must ignore the field delimiters
+    std::string buffer;
+    for (size_t field = 0; field < 20; ++field)
+    {
+        buffer += "123456,";
+    }
+    const auto indexedBuffer = indexWithAllClassifiers(buffer, 3);
+    ASSERT_FALSE(indexedBuffer.error.has_value());
+    EXPECT_EQ(indexedBuffer.offsetOfFirstTupleDelimiter, std::numeric_limits<FieldIndex>::max());
+    EXPECT_EQ(indexedBuffer.offsetOfLastTupleDelimiter, std::numeric_limits<FieldIndex>::max());
+    EXPECT_TRUE(indexedBuffer.tuples.empty());
+}
+
+TEST_F(CSVInputFormatIndexerTest, fieldCountMismatch)
+{
+    /// The mismatching tuples span the boundary between the first and the second block
+    const auto prefix = "\n" + std::string(60, 'x') + ",";
+    const auto tooFewFields = indexWithAllClassifiers(prefix + "1\n", 3);
+    EXPECT_EQ(tooFewFields.error, ErrorCode::CannotFormatSourceData);
+    const auto tooManyFields = indexWithAllClassifiers(prefix + "1,2,3\n", 3);
+    EXPECT_EQ(tooManyFields.error, ErrorCode::CannotFormatSourceData);
+    /// A mismatch in the trailing spanning tuple is not an error, since the tuple continues in the next buffer
+    const auto trailingTuple = indexWithAllClassifiers(prefix + "1,2\n1,2,3,4,5", 3);
+    EXPECT_FALSE(trailingTuple.error.has_value());
+    EXPECT_EQ(trailingTuple.tuples.size(), 1U);
+}
+
+TEST_F(CSVInputFormatIndexerTest, randomBuffersEqualSearchBasedIndexing)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> numberOfFieldsDistribution(1, 8);
+    std::uniform_int_distribution<size_t> numberOfTuplesDistribution(0, 30);
+    std::uniform_int_distribution<size_t> sizeOfFieldDistribution(0, 20);
+    std::uniform_int_distribution<int> characterDistribution('a', 'z');
+    const auto randomField = [&]
+    {
+        std::string field(sizeOfFieldDistribution(rng), '\0');
+        for (auto& character : field)
+        {
+            character = static_cast<char>(characterDistribution(rng));
+        }
+        return field;
+    };
+
+    for (size_t iteration = 0; iteration < 500; ++iteration)
+    {
+        const auto numberOfFields = numberOfFieldsDistribution(rng);
+        const auto numberOfTuples = numberOfTuplesDistribution(rng);
+        /// Starts and ends with a spanning tuple
+        std::string buffer = randomField() + "," + randomField();
+        for (size_t tuple = 0; tuple < numberOfTuples; ++tuple)
+        {
+            buffer += "\n" + randomField();
+            for (size_t field = 1; field < numberOfFields; ++field)
+            {
+                buffer += "," + randomField();
+            }
+        }
+        buffer += "\n" + randomField() + ",";
+        const auto indexedBuffer = indexWithAllClassifiers(buffer, numberOfFields);
+        ASSERT_FALSE(indexedBuffer.error.has_value());
+        ASSERT_EQ(indexedBuffer.tuples.size(), numberOfTuples);
+    }
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
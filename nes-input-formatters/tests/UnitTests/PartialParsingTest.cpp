@@ -0,0 +1,268 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/InputFormatterProvider.hpp>
+#include <InputFormatters/InputFormatterTaskPipeline.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Util/TestTupleBuffer.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <InputFormatterTask.hpp>
+#include <InputFormatterTestUtil.hpp>
+#include <RawValueParser.hpp>
+#include <TestTaskQueue.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+namespace
+{
+constexpr size_t SIZE_OF_RAW_BUFFERS = 32;
+constexpr size_t SIZE_OF_FORMATTED_BUFFERS = 4096;
+constexpr size_t NUMBER_OF_BUFFERS = 64;
+/// The InputFormatterTask must not write to the bytes of fields that it does not parse. Thus, these bytes keep the pattern.
+constexpr std::byte UNTOUCHED_PATTERN{0xAB};
+}
+
+/// Tests that the InputFormatterTask parses only the projected fields of a schema, i.e., the fields that the successors of a source read.
+class PartialParsingTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PartialParsingTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup PartialParsingTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        using enum InputFormatterTestUtil::TestDataTypes;
+        /// Field_0: INT32, Field_1: VARSIZED, Field_2: FLOAT64, Field_3: VARSIZED, Field_4: UINT8
+        schema = InputFormatterTestUtil::createSchema({INT32, VARSIZED, FLOAT64, VARSIZED, UINT8});
+        rawBufferManager = BufferManager::create(SIZE_OF_RAW_BUFFERS, NUMBER_OF_BUFFERS);
+        formattedBufferManager = BufferManager::create(SIZE_OF_FORMATTED_BUFFERS, NUMBER_OF_BUFFERS);
+        resultBuffers = std::make_shared<std::vector<std::vector<TupleBuffer>>>(1);
+        fillFormattedBuffersWithPattern();
+    }
+
+    void TearDown() override
+    {
+        resultBuffers->clear();
+        rawBufferManager->destroy();
+        formattedBufferManager->destroy();
+        BaseUnitTest::TearDown();
+    }
+
+    /// Splits the raw input into raw buffers with consecutive sequence numbers, formats them, and returns the formatted buffers in order.
+    /// Tuples that span raw buffers go through the same field parsers as tuples within a raw buffer.
+    std::vector<TupleBuffer>
+    formatWithProjection(const ParserConfig& parserConfig, const std::vector<std::string>& fieldsToParse, const std::string_view rawInput)
+    {
+        const std::shared_ptr<InputFormatterTaskPipeline> inputFormatterTask
+            = provideInputFormatterTask(schema, parserConfig, fieldsToParse);
+        std::vector<TestPipelineTask> tasks;
+        for (size_t offset = 0; offset < rawInput.size(); offset += SIZE_OF_RAW_BUFFERS)
+        {
+            const auto rawBytes = rawInput.substr(offset, SIZE_OF_RAW_BUFFERS);
+            tasks.emplace_back(InputFormatterTestUtil::createInputFormatterTask(
+                SequenceNumber(tasks.size() + 1),
+                WorkerThreadId(0),
+                InputFormatterTestUtil::copyStringDataToTupleBuffer(rawBytes, rawBufferManager->getBufferBlocking()),
+                inputFormatterTask));
+        }
+        SingleThreadedTestTaskQueue taskQueue(formattedBufferManager, resultBuffers);
+        taskQueue.processTasks(std::move(tasks));
+
+        auto formattedBuffers = resultBuffers->front();
+        InputFormatterTestUtil::sortTupleBuffers(formattedBuffers);
+        return formattedBuffers;
+    }
+
+    /// Collects the tuples of all formatted buffers in order
+    std::vector<DynamicTuple> getTuples(const std::vector<TupleBuffer>& formattedBuffers) const
+    {
+        std::vector<DynamicTuple> tuples;
+        for (const auto& formattedBuffer : formattedBuffers)
+        {
+            auto testTupleBuffer = TestTupleBuffer::createTestTupleBuffer(formattedBuffer, schema);
+            for (size_t tupleIdx = 0; tupleIdx < testTupleBuffer.getNumberOfTuples(); ++tupleIdx)
+            {
+                tuples.emplace_back(testTupleBuffer[tupleIdx]);
+            }
+        }
+        return tuples;
+    }
+
+    /// Returns true if the InputFormatterTask did not write any byte of the field in any tuple of the formatted buffers
+    bool isFieldUntouched(const std::vector<TupleBuffer>& formattedBuffers, const size_t fieldIndex) const
+    {
+        size_t offsetOfField = 0;
+        for (size_t idx = 0; idx < fieldIndex; ++idx)
+        {
+            offsetOfField += schema.getFieldAt(idx).dataType.getSizeInBytes();
+        }
+        const auto sizeOfField = schema.getFieldAt(fieldIndex).dataType.getSizeInBytes();
+        for (const auto& formattedBuffer : formattedBuffers)
+        {
+            for (size_t tupleIdx = 0; tupleIdx < formattedBuffer.getNumberOfTuples(); ++tupleIdx)
+            {
+                const auto fieldBytes = std::span(
+                    formattedBuffer.getBuffer<std::byte>() + (tupleIdx * schema.getSizeOfSchemaInBytes()) + offsetOfField, sizeOfField);
+                if (not std::ranges::all_of(fieldBytes, [](const std::byte byte) { return byte == UNTOUCHED_PATTERN; }))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    Schema schema;
+    std::shared_ptr<BufferManager> rawBufferManager;
+    std::shared_ptr<BufferManager> formattedBufferManager;
+    std::shared_ptr<std::vector<std::vector<TupleBuffer>>> resultBuffers;
+
+private:
+    /// The buffer manager recycles buffers without clearing them. Thus, the formatted buffers start with the pattern.
+    void fillFormattedBuffersWithPattern() const
+    {
+        std::vector<TupleBuffer> allBuffers;
+        while (auto buffer = formattedBufferManager->getBufferNoBlocking())
+        {
+            std::memset(buffer->getBuffer(), std::to_integer<int>(UNTOUCHED_PATTERN), buffer->getBufferSize());
+            allBuffers.emplace_back(std::move(buffer.value()));
+        }
+        ASSERT_EQ(allBuffers.size(), NUMBER_OF_BUFFERS);
+    }
+};
+
+TEST_F(PartialParsingTest, createFieldParsersSelectsProjectedFieldsInSchemaOrder)
+{
+    /// The order of 'fieldsToParse' does not matter, the parsers follow the order of the fields in the raw tuple
+    const auto fieldParsers = createFieldParsers(schema, QuotationType::NONE, {"Field_3", "Field_0", "Field_4", "NotInSchema"});
+    ASSERT_EQ(fieldParsers.size(), 3U);
+
+    /// The formatted tuple keeps the layout of the full schema: INT32 (4B), VARSIZED (4B), FLOAT64 (8B), VARSIZED (4B), UINT8 (1B)
+    EXPECT_EQ(fieldParsers[0].fieldIndex, 0U);
+    EXPECT_EQ(fieldParsers[0].offsetInTupleInBytes, 0U);
+    EXPECT_EQ(fieldParsers[1].fieldIndex, 3U);
+    EXPECT_EQ(fieldParsers[1].offsetInTupleInBytes, 16U);
+    EXPECT_EQ(fieldParsers[2].fieldIndex, 4U);
+    EXPECT_EQ(fieldParsers[2].offsetInTupleInBytes, 20U);
+    EXPECT_EQ(fieldParsers[0].parseFunction, getParseFunction(DataType::Type::INT32, QuotationType::NONE));
+    EXPECT_EQ(fieldParsers[1].parseFunction, getParseFunction(DataType::Type::VARSIZED, QuotationType::NONE));
+    EXPECT_EQ(fieldParsers[2].parseFunction, getParseFunction(DataType::Type::UINT8, QuotationType::NONE));
+
+    /// Quoted formats strip the quotes of strings
+    const auto quotedFieldParsers = createFieldParsers(schema, QuotationType::DOUBLE_QUOTE, {"Field_1"});
+    ASSERT_EQ(quotedFieldParsers.size(), 1U);
+    EXPECT_EQ(quotedFieldParsers[0].fieldIndex, 1U);
+    EXPECT_EQ(quotedFieldParsers[0].offsetInTupleInBytes, 4U);
+    EXPECT_EQ(quotedFieldParsers[0].parseFunction, getParseFunction(DataType::Type::VARSIZED, QuotationType::DOUBLE_QUOTE));
+
+    EXPECT_EQ(createFieldParsers(schema, QuotationType::NONE, schema.getFieldNames()).size(), schema.getNumberOfFields());
+    EXPECT_TRUE(createFieldParsers(schema, QuotationType::NONE, {}).empty());
+}
+
+TEST_F(PartialParsingTest, csvParsesOnlyProjectedFields)
+{
+    /// The skipped fields contain values that do not parse as their type, e.g., a quoted string for a FLOAT64. Parsing them would throw.
+    const ParserConfig parserConfig{.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    const auto formattedBuffers = formatWithProjection(
+        parserConfig,
+        {"Field_0", "Field_3"},
+        "1,skipped text,not a number,first projected string,999\n"
+        "-2,,,second projected string,-1\n"
+        "3,\"quoted skipped string\",\"2.5\",,7\n");
+
+    auto tuples = getTuples(formattedBuffers);
+    ASSERT_EQ(tuples.size(), 3U);
+    EXPECT_EQ(tuples[0]["Field_0"].read<int32_t>(), 1);
+    EXPECT_EQ(tuples[0].readVarSized("Field_3"), "first projected string");
+    EXPECT_EQ(tuples[1]["Field_0"].read<int32_t>(), -2);
+    EXPECT_EQ(tuples[1].readVarSized("Field_3"), "second projected string");
+    EXPECT_EQ(tuples[2]["Field_0"].read<int32_t>(), 3);
+    EXPECT_EQ(tuples[2].readVarSized("Field_3"), "");
+
+    for (const size_t skippedFieldIndex : {1, 2, 4})
+    {
+        EXPECT_TRUE(isFieldUntouched(formattedBuffers, skippedFieldIndex)) << "Field_" << skippedFieldIndex;
+    }
+}
+
+TEST_F(PartialParsingTest, jsonParsesOnlyProjectedQuotedFields)
+{
+    /// JSON strings are quoted and the keys determine the index of a field. Thus, the order of the fields may differ between tuples.
+    const ParserConfig parserConfig{.parserType = "JSON", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    const auto formattedBuffers = formatWithProjection(
+        parserConfig,
+        {"Field_1", "Field_4"},
+        "{\"Field_0\":\"skipped\",\"Field_1\":\"first\",\"Field_2\":1.5,\"Field_3\":\"skipped\",\"Field_4\":42}\n"
+        "{\"Field_4\":7,\"Field_3\":\"skipped quoted string\",\"Field_2\":\"skipped\",\"Field_1\":\"second string\",\"Field_0\":12}\n");
+
+    auto tuples = getTuples(formattedBuffers);
+    ASSERT_EQ(tuples.size(), 2U);
+    EXPECT_EQ(tuples[0].readVarSized("Field_1"), "first");
+    EXPECT_EQ(tuples[0]["Field_4"].read<uint8_t>(), 42);
+    EXPECT_EQ(tuples[1].readVarSized("Field_1"), "second string");
+    EXPECT_EQ(tuples[1]["Field_4"].read<uint8_t>(), 7);
+
+    for (const size_t skippedFieldIndex : {0, 2, 3})
+    {
+        EXPECT_TRUE(isFieldUntouched(formattedBuffers, skippedFieldIndex)) << "Field_" << skippedFieldIndex;
+    }
+}
+
+TEST_F(PartialParsingTest, skippedVarSizedFieldsDoNotAllocateChildBuffers)
+{
+    const ParserConfig parserConfig{.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    const auto formattedBuffers = formatWithProjection(
+        parserConfig, {"Field_2", "Field_4"}, "1,a long string that is not parsed,0.25,another string that is not parsed,8\n");
+
+    auto tuples = getTuples(formattedBuffers);
+    ASSERT_EQ(tuples.size(), 1U);
+    EXPECT_EQ(tuples[0]["Field_2"].read<double>(), 0.25);
+    EXPECT_EQ(tuples[0]["Field_4"].read<uint8_t>(), 8);
+    for (const auto& formattedBuffer : formattedBuffers)
+    {
+        EXPECT_EQ(formattedBuffer.getNumberOfChildBuffers(), 0U);
+    }
+    for (const size_t skippedFieldIndex : {0, 1, 3})
+    {
+        EXPECT_TRUE(isFieldUntouched(formattedBuffers, skippedFieldIndex)) << "Field_" << skippedFieldIndex;
+    }
+}
+
+}
+
+/// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,64 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Calculates the exact quantile, e.g., 0.9 for the 90th percentile, of a field over a window.
+/// If the quantile falls between two values, the result is linearly interpolated between them.
+class QuantileAggregationLogicalFunction : public WindowAggregationLogicalFunction
+{
+public:
+    QuantileAggregationLogicalFunction(const FieldAccessLogicalFunction& onField, FieldAccessLogicalFunction asField, double quantile);
+    QuantileAggregationLogicalFunction(const FieldAccessLogicalFunction& onField, double quantile);
+
+    /// Creates a new QuantileAggregationLogicalFunction
+    /// @param onField field on which the aggregation should be performed
+    /// @param quantile quantile in [0, 1] that should be calculated
+    static std::shared_ptr<WindowAggregationLogicalFunction> create(const FieldAccessLogicalFunction& onField, double quantile);
+
+    /// Creates a new QuantileAggregationLogicalFunction
+    /// @param onField field on which the aggregation should be performed
+    /// @param asField function describing how the aggregated field should be called
+    /// @param quantile quantile in [0, 1] that should be calculated
+    static std::shared_ptr<WindowAggregationLogicalFunction>
+    create(const FieldAccessLogicalFunction& onField, const FieldAccessLogicalFunction& asField, double quantile);
+
+    void inferStamp(const Schema& schema) override;
+
+    ~QuantileAggregationLogicalFunction() override = default;
+
+    [[nodiscard]] SerializableAggregationFunction serialize() const override;
+    [[nodiscard]] std::string_view getName() const noexcept override;
+    [[nodiscard]] double getQuantile() const;
+
+private:
+    static constexpr std::string_view NAME = "Quantile";
+    static constexpr DataType::Type partialAggregateStampType = DataType::Type::FLOAT64;
+    static constexpr DataType::Type finalAggregateStampType = DataType::Type::FLOAT64;
+
+    double quantile;
+};
+}
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include <Functions/FieldAccessLogicalFunction.hpp>
@@ -29,6 +30,7 @@ using AggregationLogicalFunctionRegistryReturnType = std::shared_ptr<WindowAggre
 struct AggregationLogicalFunctionRegistryArguments
 {
     std::vector<FieldAccessLogicalFunction> fields;
+    std::optional<double> quantile;
 };
 
 class AggregationLogicalFunctionRegistry : public BaseRegistry<
@@ -0,0 +1,137 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/QuantileAggregationLogicalFunction.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+QuantileAggregationLogicalFunction::QuantileAggregationLogicalFunction(const FieldAccessLogicalFunction& field, const double quantile)
+    : WindowAggregationLogicalFunction(
+          field.getDataType(),
+          DataTypeProvider::provideDataType(partialAggregateStampType),
+          DataTypeProvider::provideDataType(finalAggregateStampType),
+          field)
+    , quantile(quantile)
+{
+    PRECONDITION(0 <= quantile and quantile <= 1, "The quantile must be in [0, 1], but got {}", quantile);
+}
+
+QuantileAggregationLogicalFunction::QuantileAggregationLogicalFunction(
+    const FieldAccessLogicalFunction& field, FieldAccessLogicalFunction asField, const double quantile)
+    : WindowAggregationLogicalFunction(
+          field.getDataType(),
+          DataTypeProvider::provideDataType(partialAggregateStampType),
+          DataTypeProvider::provideDataType(finalAggregateStampType),
+          field,
+          std::move(asField))
+    , quantile(quantile)
+{
+    PRECONDITION(0 <= quantile and quantile <= 1, "The quantile must be in [0, 1], but got {}", quantile);
+}
+
+std::shared_ptr<WindowAggregationLogicalFunction> QuantileAggregationLogicalFunction::create(
+    const FieldAccessLogicalFunction& onField, const FieldAccessLogicalFunction& asField, const double quantile)
+{
+    return std::make_shared<QuantileAggregationLogicalFunction>(onField, asField, quantile);
+}
+
+std::shared_ptr<WindowAggregationLogicalFunction>
+QuantileAggregationLogicalFunction::create(const FieldAccessLogicalFunction& onField, const double quantile)
+{
+    return std::make_shared<QuantileAggregationLogicalFunction>(onField, quantile);
+}
+
+std::string_view QuantileAggregationLogicalFunction::getName() const noexcept
+{
+    return NAME;
+}
+
+double QuantileAggregationLogicalFunction::getQuantile() const
+{
+    return quantile;
+}
+
+void QuantileAggregationLogicalFunction::inferStamp(const Schema& schema)
+{
+    /// We first infer the dataType of the input field and set the output dataType as the same.
+    onField = onField.withInferredDataType(schema).get<FieldAccessLogicalFunction>();
+    if (not onField.getDataType().isNumeric())
+    {
+        throw CannotDeserialize("aggregations on non numeric fields is not supported, but got {}", onField.getDataType());
+    }
+
+    ///Set fully qualified name for the as Field
+    const auto onFieldName = onField.getFieldName();
+    const auto asFieldName = asField.getFieldName();
+
+    const auto attributeNameResolver = onFieldName.substr(0, onFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+    ///If on and as field name are different then append the attribute name resolver from on field to the as field
+    if (asFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) == std::string::npos)
+    {
+        asField = asField.withFieldName(attributeNameResolver + asFieldName).get<FieldAccessLogicalFunction>();
+    }
+    else
+    {
+        const auto fieldName = asFieldName.substr(asFieldName.find_last_of(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+        asField = asField.withFieldName(attributeNameResolver + fieldName).get<FieldAccessLogicalFunction>();
+    }
+    inputStamp = onField.getDataType();
+    finalAggregateStamp = DataTypeProvider::provideDataType(DataType::Type::FLOAT64);
+    asField = asField.withDataType(getFinalAggregateStamp()).get<FieldAccessLogicalFunction>();
+}
+
+SerializableAggregationFunction QuantileAggregationLogicalFunction::serialize() const
+{
+    SerializableAggregationFunction serializedAggregationFunction;
+    serializedAggregationFunction.set_type(NAME);
+
+    auto onFieldFuc = SerializableFunction();
+    onFieldFuc.CopyFrom(onField.serialize());
+
+    auto asFieldFuc = SerializableFunction();
+    asFieldFuc.CopyFrom(asField.serialize());
+
+    serializedAggregationFunction.mutable_as_field()->CopyFrom(asFieldFuc);
+    serializedAggregationFunction.mutable_on_field()->CopyFrom(onFieldFuc);
+    serializedAggregationFunction.set_quantile(quantile);
+    return serializedAggregationFunction;
+}
+
+AggregationLogicalFunctionRegistryReturnType AggregationLogicalFunctionGeneratedRegistrar::RegisterQuantileAggregationLogicalFunction(
+    AggregationLogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.fields.size() != 2)
+    {
+        throw CannotDeserialize("QuantileAggregationLogicalFunction requires exactly two fields, but got {}", arguments.fields.size());
+    }
+    if (not arguments.quantile.has_value() or not(0 <= *arguments.quantile and *arguments.quantile <= 1))
+    {
+        throw CannotDeserialize("QuantileAggregationLogicalFunction requires a quantile in [0, 1]");
+    }
+    return QuantileAggregationLogicalFunction::create(arguments.fields[0], arguments.fields[1], arguments.quantile.value());
+}
+}
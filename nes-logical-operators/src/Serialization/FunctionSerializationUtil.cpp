@@ -70,6 +70,10 @@ deserializeWindowAggregationFunction(const SerializableAggregationFunction& seri
         {
             AggregationLogicalFunctionRegistryArguments args;
             args.fields = {fieldAccess.value(), asFieldAccess.value()};
+            if (serializedFunction.has_quantile())
+            {
+                args.quantile = serializedFunction.quantile();
+            }
 
             if (auto function = AggregationLogicalFunctionRegistry::instance().create(type, args))
             {
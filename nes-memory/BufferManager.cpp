@@ -24,12 +24,21 @@
 #include <memory_resource>
 #include <mutex>
 #include <optional>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <unistd.h>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/Allocator/NumaMemoryAllocator.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/Numa.hpp>
 #include <folly/MPMCQueue.h>
+#include <folly/Synchronized.h>
 #include <ErrorHandling.hpp>
 #include <TupleBufferImpl.hpp>
 
@@ -41,14 +50,62 @@ BufferManager::BufferManager(
     const uint32_t bufferSize,
     const uint32_t numOfBuffers,
     std::shared_ptr<std::pmr::memory_resource> memoryResource,
-    const uint32_t withAlignment)
-    : availableBuffers(numOfBuffers)
-    , unpooledChunksManager(memoryResource)
-    , bufferSize(bufferSize)
-    , numOfBuffers(numOfBuffers)
-    , memoryResource(std::move(memoryResource))
+    const uint32_t withAlignment,
+    const uint32_t threadLocalCacheCapacity)
+    : BufferManager(
+          Private{},
+          bufferSize,
+          numOfBuffers,
+          {{getNumaNodes().front(), memoryResource}},
+          memoryResource,
+          withAlignment,
+          threadLocalCacheCapacity)
+{
+}
+
+BufferManager::BufferManager(
+    Private,
+    const uint32_t bufferSize,
+    const uint32_t numOfBuffers,
+    std::vector<std::pair<NumaNode, std::shared_ptr<std::pmr::memory_resource>>> poolMemoryResources,
+    std::shared_ptr<std::pmr::memory_resource> unpooledMemoryResource,
+    const uint32_t withAlignment,
+    const uint32_t threadLocalCacheCapacity)
+    : unpooledChunksManager(std::move(unpooledMemoryResource)), bufferSize(bufferSize), numOfBuffers(numOfBuffers)
 {
     ((void)withAlignment);
+    PRECONDITION(!poolMemoryResources.empty(), "BufferManager requires at least one pool");
+    PRECONDITION(numOfBuffers > 0, "BufferManager requires at least one buffer");
+
+    /// Every pool needs at least one buffer, as the MPMCQueue of an empty pool cannot be constructed.
+    const auto numberOfPools = std::min<size_t>(poolMemoryResources.size(), numOfBuffers);
+    size_t firstBuffer = 0;
+    for (size_t poolIndex = 0; poolIndex < numberOfPools; ++poolIndex)
+    {
+        auto& [node, memoryResource] = poolMemoryResources[poolIndex];
+        const auto numberOfBuffersInPool = (numOfBuffers / numberOfPools) + (poolIndex < numOfBuffers % numberOfPools ? 1 : 0);
+        pools.emplace_back(std::make_unique<BufferPool>(node, std::move(memoryResource), firstBuffer, numberOfBuffersInPool));
+        if (poolIndexOfNode.size() <= node)
+        {
+            poolIndexOfNode.resize(node + 1, 0);
+        }
+        poolIndexOfNode[node] = poolIndex;
+        firstBuffer += numberOfBuffersInPool;
+    }
+
+    /// We never allow more than half of all buffers to reside in caches. Otherwise, a few threads could hold most of the buffers
+    /// in their caches, while the others have to steal them on every request.
+    const auto numberOfCaches = static_cast<size_t>(std::max(1U, std::thread::hardware_concurrency()));
+    cacheCapacity = std::min<size_t>(threadLocalCacheCapacity, numOfBuffers / (2 * numberOfCaches));
+    if (cacheCapacity > 0)
+    {
+        cacheBatchSize = std::max<size_t>(1, cacheCapacity / 2);
+        caches = std::vector<BufferCache>(numberOfCaches);
+        for (auto& cache : caches)
+        {
+            cache.segments.reserve(cacheCapacity);
+        }
+    }
     initialize(DEFAULT_ALIGNMENT);
 }
 
@@ -57,6 +114,7 @@ void BufferManager::destroy()
     bool expected = false;
     if (isDestroyed.compare_exchange_strong(expected, true))
     {
+        flushCaches();
         bool success = true;
         if (allBuffers.size() != getNumberOfAvailableBuffers())
         {
@@ -81,16 +139,44 @@ void BufferManager::destroy()
         /// RAII takes care of deallocating memory here
         allBuffers.clear();
 
-        availableBuffers = decltype(availableBuffers)();
+        for (const auto& pool : pools)
+        {
+            pool->memoryResource->deallocate(pool->basePointer, pool->allocatedAreaSize);
+        }
+        pools.clear();
         NES_DEBUG("Shutting down Buffer Manager completed");
-        memoryResource->deallocate(basePointer, allocatedAreaSize);
     }
 }
 
 std::shared_ptr<BufferManager> BufferManager::create(
-    uint32_t bufferSize, uint32_t numOfBuffers, const std::shared_ptr<std::pmr::memory_resource>& memoryResource, uint32_t withAlignment)
+    uint32_t bufferSize,
+    uint32_t numOfBuffers,
+    const std::shared_ptr<std::pmr::memory_resource>& memoryResource,
+    uint32_t withAlignment,
+    uint32_t threadLocalCacheCapacity)
+{
+    return std::make_shared<BufferManager>(Private{}, bufferSize, numOfBuffers, memoryResource, withAlignment, threadLocalCacheCapacity);
+}
+
+std::shared_ptr<BufferManager>
+BufferManager::createNumaAware(uint32_t bufferSize, uint32_t numOfBuffers, uint32_t withAlignment, uint32_t threadLocalCacheCapacity)
 {
-    return std::make_shared<BufferManager>(Private{}, bufferSize, numOfBuffers, memoryResource, withAlignment);
+    std::vector<std::pair<NumaNode, std::shared_ptr<std::pmr::memory_resource>>> poolMemoryResources;
+    for (const auto node : getNumaNodes())
+    {
+        poolMemoryResources.emplace_back(node, std::make_shared<NumaMemoryAllocator>(node));
+    }
+    NES_INFO("Creating NUMA-aware BufferManager with {} pools", poolMemoryResources.size());
+    /// Unpooled buffers are allocated on demand by the requesting thread. The kernel's first-touch policy already places them on the
+    /// node of that thread.
+    return std::make_shared<BufferManager>(
+        Private{},
+        bufferSize,
+        numOfBuffers,
+        std::move(poolMemoryResources),
+        std::make_shared<NesDefaultMemoryAllocator>(),
+        withAlignment,
+        threadLocalCacheCapacity);
 }
 
 BufferManager::~BufferManager()
@@ -126,37 +212,42 @@ void BufferManager::initialize(uint32_t withAlignment)
         "Requested alignment is too small, must be at least {}",
         alignof(detail::BufferControlBlock));
 
+    /// allBuffers must not reallocate, as the pools hold pointers into it
     allBuffers.reserve(numOfBuffers);
     auto controlBlockSize = alignBufferSize(sizeof(detail::BufferControlBlock), withAlignment);
     auto alignedBufferSize = alignBufferSize(bufferSize, withAlignment);
-    allocatedAreaSize = alignBufferSize(controlBlockSize + alignedBufferSize, withAlignment);
-    const size_t offsetBetweenBuffers = allocatedAreaSize;
-    allocatedAreaSize *= numOfBuffers;
-    basePointer = static_cast<uint8_t*>(memoryResource->allocate(allocatedAreaSize, withAlignment));
-    NES_TRACE(
-        "Allocated {} bytes with alignment {} buffer size {} num buffer {} controlBlockSize {} {}",
-        allocatedAreaSize,
-        withAlignment,
-        alignedBufferSize,
-        numOfBuffers,
-        controlBlockSize,
-        alignof(detail::BufferControlBlock));
-    INVARIANT(basePointer, "memory allocation failed, because 'basePointer' was a nullptr");
-    uint8_t* ptr = basePointer;
-    for (size_t i = 0; i < numOfBuffers; ++i)
+    const size_t offsetBetweenBuffers = alignBufferSize(controlBlockSize + alignedBufferSize, withAlignment);
+    for (const auto& pool : pools)
     {
-        uint8_t* controlBlock = ptr;
-        uint8_t* payload = ptr + controlBlockSize;
-        allBuffers.emplace_back(
-            payload,
-            bufferSize,
-            [](detail::MemorySegment* segment, BufferRecycler* recycler) { recycler->recyclePooledBuffer(segment); },
-            controlBlock);
+        pool->allocatedAreaSize = offsetBetweenBuffers * pool->numberOfBuffers;
+        pool->basePointer = static_cast<uint8_t*>(pool->memoryResource->allocate(pool->allocatedAreaSize, withAlignment));
+        NES_TRACE(
+            "Allocated {} bytes on node {} with alignment {} buffer size {} num buffer {} controlBlockSize {} {}",
+            pool->allocatedAreaSize,
+            pool->node,
+            withAlignment,
+            alignedBufferSize,
+            pool->numberOfBuffers,
+            controlBlockSize,
+            alignof(detail::BufferControlBlock));
+        INVARIANT(pool->basePointer, "memory allocation failed, because 'basePointer' was a nullptr");
+        uint8_t* ptr = pool->basePointer;
+        for (size_t i = 0; i < pool->numberOfBuffers; ++i)
+        {
+            uint8_t* controlBlock = ptr;
+            uint8_t* payload = ptr + controlBlockSize;
+            allBuffers.emplace_back(
+                payload,
+                bufferSize,
+                [](detail::MemorySegment* segment, BufferRecycler* recycler) { recycler->recyclePooledBuffer(segment); },
+                controlBlock);
 
-        availableBuffers.write(&allBuffers.back());
-        ptr += offsetBetweenBuffers;
+            pool->availableBuffers.write(&allBuffers.back());
+            ptr += offsetBetweenBuffers;
+        }
     }
-    NES_DEBUG("BufferManager configuration bufferSize={} numOfBuffers={}", this->bufferSize, this->numOfBuffers);
+    NES_DEBUG(
+        "BufferManager configuration bufferSize={} numOfBuffers={} numberOfPools={}", this->bufferSize, this->numOfBuffers, pools.size());
 }
 
 TupleBuffer BufferManager::getBufferBlocking()
@@ -170,16 +261,159 @@ TupleBuffer BufferManager::getBufferBlocking()
     throw BufferAllocationFailure("Global buffer pool could not allocate buffer before timeout({})", GET_BUFFER_TIMEOUT);
 }
 
+BufferManager::BufferPool& BufferManager::getLocalPool()
+{
+    const auto node = getCurrentNumaNode();
+    return *pools[node < poolIndexOfNode.size() ? poolIndexOfNode[node] : 0];
+}
+
+BufferManager::BufferPool& BufferManager::getPoolOf(const detail::MemorySegment* segment)
+{
+    const auto bufferIndex = static_cast<size_t>(segment - allBuffers.data());
+    for (const auto& pool : pools)
+    {
+        if (bufferIndex < pool->firstBuffer + pool->numberOfBuffers)
+        {
+            return *pool;
+        }
+    }
+    INVARIANT(false, "Memory segment {} does not belong to any pool", bufferIndex);
+    return *pools.front();
+}
+
+bool BufferManager::tryReadSegment(detail::MemorySegment*& segment)
+{
+    if (pools.size() == 1)
+    {
+        return pools.front()->availableBuffers.read(segment);
+    }
+
+    auto& localPool = getLocalPool();
+    if (localPool.availableBuffers.read(segment))
+    {
+        return true;
+    }
+    for (const auto& pool : pools)
+    {
+        if (pool.get() != &localPool && pool->availableBuffers.read(segment))
+        {
+            numberOfRemoteNodeAllocations.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BufferManager::readSegmentUntil(const std::chrono::steady_clock::time_point deadline, detail::MemorySegment*& segment)
+{
+    if (pools.size() == 1)
+    {
+        return pools.front()->availableBuffers.tryReadUntil(deadline, segment);
+    }
+
+    auto& localPool = getLocalPool();
+    while (true)
+    {
+        if (tryReadSegment(segment))
+        {
+            return true;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return false;
+        }
+        /// Buffers might only be recycled into a remote pool, thus we only block on the local pool for a short interval.
+        if (localPool.availableBuffers.tryReadUntil(std::min(deadline, now + REMOTE_POOL_POLL_INTERVAL), segment))
+        {
+            return true;
+        }
+    }
+}
+
+BufferManager::BufferCache& BufferManager::getCacheOfCurrentThread()
+{
+    /// Threads are assigned round-robin to the caches, thus every thread has its own cache as long as there are fewer threads than
+    /// cpus. The assignment is shared between all BufferManagers.
+    static std::atomic<size_t> numberOfThreads{0};
+    thread_local const size_t threadIndex = numberOfThreads.fetch_add(1, std::memory_order_relaxed);
+    return caches[threadIndex % caches.size()];
+}
+
+bool BufferManager::tryReadCachedSegment(detail::MemorySegment*& segment)
+{
+    if (cacheCapacity == 0)
+    {
+        return tryReadSegment(segment);
+    }
+
+    auto& cache = getCacheOfCurrentThread();
+    const std::scoped_lock lock(cache.lock);
+    if (cache.segments.empty())
+    {
+        /// Refill the cache with a batch of segments from the pools. The cache may remain empty if the pools are drained.
+        detail::MemorySegment* refill = nullptr;
+        while (cache.segments.size() < cacheBatchSize && tryReadSegment(refill))
+        {
+            cache.segments.push_back(refill);
+        }
+        if (cache.segments.empty())
+        {
+            return false;
+        }
+    }
+    segment = cache.segments.back();
+    cache.segments.pop_back();
+    cache.numberOfSegments.store(cache.segments.size(), std::memory_order_relaxed);
+    return true;
+}
+
+bool BufferManager::stealCachedSegment(detail::MemorySegment*& segment)
+{
+    for (auto& cache : caches)
+    {
+        if (cache.numberOfSegments.load(std::memory_order_relaxed) == 0)
+        {
+            continue;
+        }
+        const std::scoped_lock lock(cache.lock);
+        if (!cache.segments.empty())
+        {
+            segment = cache.segments.back();
+            cache.segments.pop_back();
+            cache.numberOfSegments.store(cache.segments.size(), std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void BufferManager::flushCaches()
+{
+    for (auto& cache : caches)
+    {
+        const std::scoped_lock lock(cache.lock);
+        for (auto* segment : cache.segments)
+        {
+            getPoolOf(segment).availableBuffers.write(segment);
+        }
+        cache.segments.clear();
+        cache.numberOfSegments.store(0, std::memory_order_relaxed);
+    }
+}
+
 std::optional<TupleBuffer> BufferManager::getBufferNoBlocking()
 {
     detail::MemorySegment* memSegment = nullptr;
-    if (!availableBuffers.read(memSegment))
+    if (!tryReadCachedSegment(memSegment) && !stealCachedSegment(memSegment))
     {
         return std::nullopt;
     }
     if (memSegment->controlBlock->prepare(shared_from_this()))
     {
-        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        TupleBuffer buffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        QueryMemoryQuota::chargeToCurrentQuery(buffer, memSegment->size);
+        return buffer;
     }
     throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
 }
@@ -188,17 +422,61 @@ std::optional<TupleBuffer> BufferManager::getBufferWithTimeout(const std::chrono
 {
     detail::MemorySegment* memSegment = nullptr;
     const auto deadline = std::chrono::steady_clock::now() + timeoutMs;
-    if (!availableBuffers.tryReadUntil(deadline, memSegment))
+    if (cacheCapacity == 0)
     {
-        return std::nullopt;
+        if (!readSegmentUntil(deadline, memSegment))
+        {
+            return std::nullopt;
+        }
+    }
+    else if (!tryReadCachedSegment(memSegment))
+    {
+        /// The pools are empty, but free buffers might sit in the caches of other threads. While we are waiting, recycled buffers are
+        /// returned to the pools directly, and we periodically drain the other caches.
+        numberOfWaitingThreads.fetch_add(1);
+        bool success = false;
+        while (!success && std::chrono::steady_clock::now() < deadline)
+        {
+            success = stealCachedSegment(memSegment)
+                || readSegmentUntil(std::min(deadline, std::chrono::steady_clock::now() + REMOTE_POOL_POLL_INTERVAL), memSegment);
+        }
+        numberOfWaitingThreads.fetch_sub(1);
+        if (!success)
+        {
+            return std::nullopt;
+        }
     }
     if (memSegment->controlBlock->prepare(shared_from_this()))
     {
-        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        TupleBuffer buffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        QueryMemoryQuota::chargeToCurrentQuery(buffer, memSegment->size);
+        return buffer;
     }
     throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
 }
 
+std::shared_ptr<QueryMemoryQuota> BufferManager::createQueryMemoryQuota(const QueryId queryId, const QueryMemoryLimits limits)
+{
+    auto quota = std::make_shared<QueryMemoryQuota>(queryId, limits);
+    const auto lockedQuotas = queryMemoryQuotas.wlock();
+    std::erase_if(*lockedQuotas, [](const auto& entry) { return entry.second.expired(); });
+    (*lockedQuotas)[queryId] = quota;
+    return quota;
+}
+
+std::optional<QueryMemoryUsage> BufferManager::getQueryMemoryUsage(const QueryId queryId) const
+{
+    const auto lockedQuotas = queryMemoryQuotas.rlock();
+    if (const auto it = lockedQuotas->find(queryId); it != lockedQuotas->end())
+    {
+        if (const auto quota = it->second.lock())
+        {
+            return quota->getUsage();
+        }
+    }
+    return std::nullopt;
+}
+
 std::optional<TupleBuffer> BufferManager::getUnpooledBuffer(const size_t bufferSize)
 {
     return unpooledChunksManager.getUnpooledBuffer(bufferSize, DEFAULT_ALIGNMENT, shared_from_this());
@@ -209,7 +487,25 @@ void BufferManager::recyclePooledBuffer(detail::MemorySegment* segment)
     INVARIANT(segment->isAvailable(), "Recycling buffer callback invoked on used memory segment");
     INVARIANT(
         segment->controlBlock->owningBufferRecycler == nullptr, "Buffer should not retain a reference to its parent while not in use");
-    USED_IN_DEBUG const auto couldRecycleBuffer = availableBuffers.writeIfNotFull(segment);
+    if (cacheCapacity > 0 && numberOfWaitingThreads.load(std::memory_order_relaxed) == 0)
+    {
+        auto& cache = getCacheOfCurrentThread();
+        const std::scoped_lock lock(cache.lock);
+        if (cache.segments.size() == cacheCapacity)
+        {
+            /// Flush a batch of the least recently cached segments to keep the most recent ones, which are likely still in the cpu cache.
+            for (size_t i = 0; i < cacheBatchSize; ++i)
+            {
+                USED_IN_DEBUG const auto couldFlushBuffer = getPoolOf(cache.segments[i]).availableBuffers.writeIfNotFull(cache.segments[i]);
+                INVARIANT(couldFlushBuffer, "should always succeed");
+            }
+            cache.segments.erase(cache.segments.begin(), cache.segments.begin() + static_cast<ssize_t>(cacheBatchSize));
+        }
+        cache.segments.push_back(segment);
+        cache.numberOfSegments.store(cache.segments.size(), std::memory_order_relaxed);
+        return;
+    }
+    USED_IN_DEBUG const auto couldRecycleBuffer = getPoolOf(segment).availableBuffers.writeIfNotFull(segment);
     INVARIANT(couldRecycleBuffer, "should always succeed");
 }
 
@@ -235,8 +531,32 @@ size_t BufferManager::getNumOfUnpooledBuffers() const
 
 size_t BufferManager::getNumberOfAvailableBuffers() const
 {
-    /// If there are pending reads the queue may report negative values. This effectivly means its empty.
-    return static_cast<size_t>(std::max(availableBuffers.size(), static_cast<ssize_t>(0)));
+    size_t availableBuffers = 0;
+    for (const auto& pool : pools)
+    {
+        /// If there are pending reads the queue may report negative values. This effectivly means its empty.
+        availableBuffers += static_cast<size_t>(std::max(pool->availableBuffers.size(), static_cast<ssize_t>(0)));
+    }
+    for (const auto& cache : caches)
+    {
+        availableBuffers += cache.numberOfSegments.load(std::memory_order_relaxed);
+    }
+    return availableBuffers;
+}
+
+size_t BufferManager::getNumberOfPools() const
+{
+    return pools.size();
+}
+
+size_t BufferManager::getNumberOfRemoteNodeAllocations() const
+{
+    return numberOfRemoteNodeAllocations.load(std::memory_order_relaxed);
+}
+
+size_t BufferManager::getThreadLocalCacheCapacity() const
+{
+    return cacheCapacity;
 }
 
 BufferManagerType BufferManager::getBufferManagerType() const
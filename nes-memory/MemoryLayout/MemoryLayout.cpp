@@ -13,6 +13,8 @@
 */
 #include <MemoryLayout/MemoryLayout.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <optional>
@@ -25,6 +27,7 @@
 #include <DataTypes/Schema.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
 
 namespace NES
 {
@@ -40,16 +43,34 @@ std::string readVarSizedData(const TupleBuffer& buffer, const uint64_t childBuff
 
 std::optional<uint32_t> writeVarSizedData(const TupleBuffer& buffer, const std::string_view value, AbstractBufferProvider& bufferProvider)
 {
-    const auto valueLength = value.length();
-    auto childBuffer = bufferProvider.getUnpooledBuffer(valueLength + sizeof(uint32_t));
-    if (childBuffer.has_value())
+    const auto valueLength = static_cast<uint32_t>(value.length());
+    const auto totalSize = static_cast<uint32_t>(valueLength + sizeof(uint32_t));
+    auto reserved = buffer.reserveVariableSizedData(totalSize);
+    if (not reserved.has_value())
     {
+        /// Values that do not fit into a heap buffer get a child buffer of their own, which keeps the free space of the current heap buffer
+        const auto heapBufferSize = bufferProvider.getBufferSize();
+        auto childBuffer = bufferProvider.getUnpooledBuffer(std::max<size_t>(totalSize, heapBufferSize));
+        if (not childBuffer.has_value())
+        {
+            return {};
+        }
         auto& childBufferVal = childBuffer.value();
-        *childBufferVal.getBuffer<uint32_t>() = valueLength;
-        std::memcpy(childBufferVal.getBuffer<char>() + sizeof(uint32_t), value.data(), valueLength);
-        return buffer.storeChildBuffer(childBufferVal);
+        if (totalSize > heapBufferSize)
+        {
+            *childBufferVal.getBuffer<uint32_t>() = valueLength;
+            std::memcpy(childBufferVal.getBuffer<char>() + sizeof(uint32_t), value.data(), valueLength);
+            return buffer.storeChildBuffer(childBufferVal);
+        }
+        buffer.setVariableSizedDataHeap(childBufferVal);
+        reserved = buffer.reserveVariableSizedData(totalSize);
+        INVARIANT(reserved.has_value(), "A new heap buffer of {}B must fit a value of {}B", heapBufferSize, totalSize);
     }
-    return {};
+
+    const auto [childBufferIdx, valuePtr] = reserved.value();
+    std::memcpy(valuePtr, &valueLength, sizeof(uint32_t));
+    std::memcpy(valuePtr + sizeof(uint32_t), value.data(), valueLength);
+    return childBufferIdx;
 }
 
 uint64_t MemoryLayout::getTupleSize() const
@@ -0,0 +1,62 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/Allocator/NumaMemoryAllocator.hpp>
+
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+namespace
+{
+/// From linux/mempolicy.h. We issue the syscall directly to avoid a dependency on libnuma.
+constexpr int MPOL_PREFERRED_POLICY = 1;
+constexpr size_t MAX_NUMA_NODES = 1024;
+constexpr size_t BITS_PER_WORD = sizeof(unsigned long) * CHAR_BIT;
+}
+
+void* NumaMemoryAllocator::do_allocate(const size_t bytes, const size_t alignment)
+{
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+    PRECONDITION(alignment <= pageSize, "NumaMemoryAllocator supports alignments up to the page size, but got {}", alignment);
+    PRECONDITION(node < MAX_NUMA_NODES, "NUMA node {} exceeds the maximum of {} nodes", node, MAX_NUMA_NODES);
+
+    void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    INVARIANT(memory != MAP_FAILED, "memory allocation failed: {}", std::strerror(errno));
+
+    /// The policy is applied when the pages are first touched, i.e., when the BufferManager writes the control blocks.
+    std::array<unsigned long, MAX_NUMA_NODES / BITS_PER_WORD> nodeMask{};
+    nodeMask.at(node / BITS_PER_WORD) |= 1UL << (node % BITS_PER_WORD);
+    if (syscall(SYS_mbind, memory, bytes, MPOL_PREFERRED_POLICY, nodeMask.data(), MAX_NUMA_NODES, 0) != 0)
+    {
+        NES_WARNING("Could not bind {} bytes to NUMA node {}: {}. Falling back to the default policy", bytes, node, std::strerror(errno));
+    }
+    return memory;
+}
+
+void NumaMemoryAllocator::do_deallocate(void* p, const size_t bytes, size_t)
+{
+    munmap(p, bytes);
+}
+
+}
@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/QueryMemoryQuota.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <TupleBufferImpl.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Quota of the query whose task the calling thread is currently executing
+thread_local std::shared_ptr<QueryMemoryQuota> currentQuota;
+}
+
+QueryMemoryQuota::Scope::Scope(std::shared_ptr<QueryMemoryQuota> quota) : previousQuota(std::exchange(currentQuota, std::move(quota)))
+{
+}
+
+QueryMemoryQuota::Scope::~Scope()
+{
+    currentQuota = std::move(previousQuota);
+}
+
+QueryMemoryQuota::QueryMemoryQuota(const QueryId queryId, const QueryMemoryLimits limits) : queryId(queryId), limits(limits)
+{
+    PRECONDITION(
+        limits.softLimitInBytes == 0 or limits.hardLimitInBytes == 0 or limits.softLimitInBytes <= limits.hardLimitInBytes,
+        "The soft memory limit ({}B) must not exceed the hard memory limit ({}B)",
+        limits.softLimitInBytes,
+        limits.hardLimitInBytes);
+}
+
+void QueryMemoryQuota::chargeToCurrentQuery(const TupleBuffer& buffer, const size_t sizeInBytes)
+{
+    if (currentQuota)
+    {
+        currentQuota->charge(buffer, sizeInBytes, true);
+    }
+}
+
+void QueryMemoryQuota::adopt(const TupleBuffer& buffer)
+{
+    if (buffer.getControlBlock()->owningQuota == nullptr)
+    {
+        charge(buffer, buffer.getBufferSize(), false);
+    }
+}
+
+void QueryMemoryQuota::charge(const TupleBuffer& buffer, const size_t sizeInBytes, const bool enforceHardLimit)
+{
+    const auto used = usedBytes.fetch_add(sizeInBytes, std::memory_order_relaxed) + sizeInBytes;
+    if (enforceHardLimit and limits.hardLimitInBytes > 0 and used > limits.hardLimitInBytes)
+    {
+        usedBytes.fetch_sub(sizeInBytes, std::memory_order_relaxed);
+        throw QueryMemoryLimitExceeded(
+            "Query {} requested {}B while holding {}B, which exceeds its hard limit of {}B",
+            queryId,
+            sizeInBytes,
+            used - sizeInBytes,
+            limits.hardLimitInBytes);
+    }
+
+    auto peak = peakUsedBytes.load(std::memory_order_relaxed);
+    while (peak < used and not peakUsedBytes.compare_exchange_weak(peak, used, std::memory_order_relaxed))
+    {
+    }
+    if (limits.softLimitInBytes > 0 and used > limits.softLimitInBytes and not reportedSoftLimit.test_and_set(std::memory_order_relaxed))
+    {
+        NES_WARNING("Query {} holds {}B and exceeds its soft memory limit of {}B", queryId, used, limits.softLimitInBytes);
+    }
+
+    auto* controlBlock = buffer.getControlBlock();
+    controlBlock->owningQuota = shared_from_this();
+    controlBlock->chargedBytes = sizeInBytes;
+}
+
+void QueryMemoryQuota::release(const size_t sizeInBytes)
+{
+    const auto previouslyUsed = usedBytes.fetch_sub(sizeInBytes, std::memory_order_relaxed);
+    INVARIANT(previouslyUsed >= sizeInBytes, "Query {} released {}B, but only held {}B", queryId, sizeInBytes, previouslyUsed);
+}
+
+bool QueryMemoryQuota::exceedsSoftLimit() const
+{
+    return limits.softLimitInBytes > 0 and usedBytes.load(std::memory_order_relaxed) > limits.softLimitInBytes;
+}
+
+QueryMemoryUsage QueryMemoryQuota::getUsage() const
+{
+    return {
+        .usedBytes = usedBytes.load(std::memory_order_relaxed),
+        .peakUsedBytes = peakUsedBytes.load(std::memory_order_relaxed),
+        .limits = limits};
+}
+
+QueryId QueryMemoryQuota::getQueryId() const
+{
+    return queryId;
+}
+
+}
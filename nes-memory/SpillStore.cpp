@@ -0,0 +1,215 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/SpillStore.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <TupleBufferImpl.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename T>
+void append(std::vector<std::byte>& spilledState, const T& value)
+{
+    const auto* const bytes = reinterpret_cast<const std::byte*>(&value); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    spilledState.insert(spilledState.end(), bytes, bytes + sizeof(T));
+}
+
+void append(std::vector<std::byte>& spilledState, const std::byte* data, const size_t size)
+{
+    spilledState.insert(spilledState.end(), data, data + size);
+}
+
+template <typename T>
+T consume(std::span<const std::byte>& spilledState)
+{
+    PRECONDITION(spilledState.size() >= sizeof(T), "Spilled state ends within a value");
+    T value;
+    std::memcpy(&value, spilledState.data(), sizeof(T));
+    spilledState = spilledState.subspan(sizeof(T));
+    return value;
+}
+
+void consume(std::span<const std::byte>& spilledState, int8_t* destination, const size_t size)
+{
+    PRECONDITION(spilledState.size() >= size, "Spilled state ends within a buffer");
+    std::memcpy(destination, spilledState.data(), size);
+    spilledState = spilledState.subspan(size);
+}
+
+/// Pages of paged vectors are unpooled buffers. Thus, reloaded pages are unpooled, too, and do not take buffers from the pool.
+TupleBuffer allocate(AbstractBufferProvider& bufferProvider, const size_t size)
+{
+    if (auto buffer = bufferProvider.getUnpooledBuffer(size))
+    {
+        return std::move(buffer.value());
+    }
+    throw BufferAllocationFailure("No unpooled TupleBuffer available to reload spilled state!");
+}
+}
+
+SpillRegion SpillStore::spill(const std::span<const std::byte> data)
+{
+    const auto region = write(data);
+    spilledBytes.fetch_add(data.size(), std::memory_order::relaxed);
+    numberOfSpills.fetch_add(1, std::memory_order::relaxed);
+    return region;
+}
+
+std::vector<std::byte> SpillStore::reload(const SpillRegion& region)
+{
+    std::vector<std::byte> data(region.size);
+    read(region, data);
+    release(region);
+    reloadedBytes.fetch_add(region.size, std::memory_order::relaxed);
+    numberOfReloads.fetch_add(1, std::memory_order::relaxed);
+    return data;
+}
+
+SpillStore::Statistics SpillStore::getStatistics() const
+{
+    return {
+        .spilledBytes = spilledBytes.load(std::memory_order::relaxed),
+        .reloadedBytes = reloadedBytes.load(std::memory_order::relaxed),
+        .numberOfSpills = numberOfSpills.load(std::memory_order::relaxed),
+        .numberOfReloads = numberOfReloads.load(std::memory_order::relaxed)};
+}
+
+FileSpillStore::FileSpillStore(const std::filesystem::path& directory)
+{
+    auto pathTemplate = (directory / "nes-spill-XXXXXX").string();
+    fileDescriptor = mkstemp(pathTemplate.data());
+    if (fileDescriptor < 0)
+    {
+        throw CannotSpillState("Could not create spill file in {}: {}", directory.string(), std::strerror(errno));
+    }
+    /// The file stays accessible via the file descriptor, but the file system removes it once we close it or the process dies
+    unlink(pathTemplate.c_str());
+    NES_DEBUG("Spilling operator state to {}", pathTemplate);
+}
+
+FileSpillStore::~FileSpillStore()
+{
+    close(fileDescriptor);
+}
+
+SpillRegion FileSpillStore::write(const std::span<const std::byte> data)
+{
+    const SpillRegion region{.offset = endOfFile.fetch_add(data.size()), .size = data.size()};
+    for (size_t bytesWritten = 0; bytesWritten < data.size();)
+    {
+        const auto result = pwrite(
+            fileDescriptor, data.data() + bytesWritten, data.size() - bytesWritten, static_cast<off_t>(region.offset + bytesWritten));
+        if (result < 0 and errno != EINTR)
+        {
+            throw CannotSpillState("Could not write {} bytes to the spill file: {}", data.size(), std::strerror(errno));
+        }
+        bytesWritten += result < 0 ? 0 : static_cast<size_t>(result);
+    }
+    return region;
+}
+
+void FileSpillStore::read(const SpillRegion& region, const std::span<std::byte> data)
+{
+    PRECONDITION(data.size() == region.size, "Expected a destination of {} bytes, but got {} bytes", region.size, data.size());
+    for (size_t bytesRead = 0; bytesRead < data.size();)
+    {
+        const auto result
+            = pread(fileDescriptor, data.data() + bytesRead, data.size() - bytesRead, static_cast<off_t>(region.offset + bytesRead));
+        if (result == 0 or (result < 0 and errno != EINTR))
+        {
+            throw CannotSpillState("Could not read {} bytes from the spill file: {}", region.size, std::strerror(errno));
+        }
+        bytesRead += result < 0 ? 0 : static_cast<size_t>(result);
+    }
+}
+
+void FileSpillStore::release(const SpillRegion& region)
+{
+#ifdef FALLOC_FL_PUNCH_HOLE
+    /// Failing to free the disk space is not an error, as the file gets removed with the store anyway
+    fallocate(
+        fileDescriptor, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, static_cast<off_t>(region.offset), static_cast<off_t>(region.size));
+#else
+    (void)region;
+#endif
+}
+
+void serializeTupleBuffer(const TupleBuffer& buffer, std::vector<std::byte>& spilledState)
+{
+    const auto numberOfChildBuffers = buffer.getNumberOfChildBuffers();
+    append(spilledState, buffer.getBufferSize());
+    append(spilledState, buffer.getNumberOfTuples());
+    append(spilledState, numberOfChildBuffers);
+    append(spilledState, buffer.getBuffer<std::byte>(), buffer.getBufferSize());
+    for (uint32_t childIdx = 0; childIdx < numberOfChildBuffers; ++childIdx)
+    {
+        const auto childBuffer = buffer.loadChildBuffer(childIdx);
+        append(spilledState, childBuffer.getBufferSize());
+        append(spilledState, childBuffer.getBuffer<std::byte>(), childBuffer.getBufferSize());
+    }
+}
+
+TupleBuffer deserializeTupleBuffer(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider)
+{
+    const auto bufferSize = consume<uint64_t>(spilledState);
+    const auto numberOfTuples = consume<uint64_t>(spilledState);
+    const auto numberOfChildBuffers = consume<uint32_t>(spilledState);
+    auto buffer = allocate(bufferProvider, bufferSize);
+    consume(spilledState, buffer.getBuffer(), bufferSize);
+    buffer.setNumberOfTuples(numberOfTuples);
+    if (numberOfChildBuffers == 0)
+    {
+        return buffer;
+    }
+
+    /// We size the heap to hold all children, including the padding that aligns each of them
+    uint32_t heapSize = 0;
+    auto remainingState = spilledState;
+    for (uint32_t childIdx = 0; childIdx < numberOfChildBuffers; ++childIdx)
+    {
+        const auto childSize = consume<uint64_t>(remainingState);
+        remainingState = remainingState.subspan(childSize);
+        heapSize = alignBufferSize(heapSize, alignof(uint32_t)) + static_cast<uint32_t>(childSize);
+    }
+    buffer.setVariableSizedDataHeap(allocate(bufferProvider, heapSize));
+    for (uint32_t childIdx = 0; childIdx < numberOfChildBuffers; ++childIdx)
+    {
+        const auto childSize = consume<uint64_t>(spilledState);
+        const auto reserved = buffer.reserveVariableSizedData(static_cast<uint32_t>(childSize));
+        INVARIANT(reserved.has_value() and reserved->first == childIdx, "Could not restore child buffer {} of spilled buffer", childIdx);
+        consume(spilledState, reserved->second, childSize);
+    }
+    return buffer;
+}
+
+}
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -41,6 +42,25 @@ TupleBuffer TupleBuffer::reinterpretAsTupleBuffer(void* bufferPointer)
     return tb;
 }
 
+TupleBuffer TupleBuffer::wrapMemory(uint8_t* ptr, const uint32_t size, std::shared_ptr<void> owner)
+{
+    /// Similar to the memory segments of unpooled chunks, the memory segment is destroyed by its own recycle callback.
+    /// This is safe, as releasing the control block does not access it after calling the callback.
+    auto memorySegment = std::make_unique<detail::MemorySegment>(
+        ptr,
+        size,
+        [owner = std::move(owner)](detail::MemorySegment* memorySegment, BufferRecycler*)
+        {
+            delete memorySegment; /// NOLINT(cppcoreguidelines-owning-memory)
+        });
+    if (not memorySegment->controlBlock->prepare(nullptr))
+    {
+        throw InvalidRefCountForBuffer("[TupleBuffer] got wrapped memory with invalid reference counter");
+    }
+    auto* const leakedMemorySegment = memorySegment.release();
+    return TupleBuffer(leakedMemorySegment->controlBlock.get(), leakedMemorySegment->ptr, leakedMemorySegment->size);
+}
+
 TupleBuffer::TupleBuffer(const TupleBuffer& other) noexcept : controlBlock(other.controlBlock), ptr(other.ptr), size(other.size)
 {
     if (controlBlock != nullptr)
@@ -195,7 +215,7 @@ uint32_t TupleBuffer::storeChildBuffer(TupleBuffer& buffer) const noexcept
     TupleBuffer empty;
     auto* control = buffer.controlBlock;
     INVARIANT(controlBlock != control, "Cannot attach buffer to self");
-    auto index = controlBlock->storeChildBuffer(control);
+    auto index = controlBlock->storeChildBuffer(control, buffer.ptr, buffer.size);
     std::swap(empty, buffer);
     return index;
 }
@@ -208,6 +228,23 @@ TupleBuffer TupleBuffer::loadChildBuffer(NestedTupleBufferKey bufferIndex) const
     return childBuffer;
 }
 
+std::optional<std::pair<TupleBuffer::NestedTupleBufferKey, int8_t*>>
+TupleBuffer::reserveVariableSizedData(const uint32_t size) const noexcept
+{
+    if (const auto reserved = controlBlock->reserveInVariableSizedDataHeap(size))
+    {
+        auto* const valuePtr = reinterpret_cast<int8_t*>(reserved->second); ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return std::make_pair(reserved->first, valuePtr);
+    }
+    return std::nullopt;
+}
+
+void TupleBuffer::setVariableSizedDataHeap(const TupleBuffer& heapBuffer) const noexcept
+{
+    INVARIANT(controlBlock != heapBuffer.controlBlock, "Cannot use buffer as its own heap");
+    controlBlock->setVariableSizedDataHeap(heapBuffer.controlBlock, heapBuffer.ptr, heapBuffer.size);
+}
+
 bool recycleTupleBuffer(void* bufferPointer)
 {
     PRECONDITION(bufferPointer, "invalid bufferPointer");
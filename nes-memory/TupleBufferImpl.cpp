@@ -17,8 +17,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -182,17 +184,26 @@ bool BufferControlBlock::release()
     if (const uint32_t prevRefCnt = referenceCounter.fetch_sub(1); prevRefCnt == 1)
     {
         numberOfTuples = 0;
-        for (auto&& child : children)
+        for (const auto& child : children)
         {
-            child->controlBlock->release();
+            child.controlBlock->release();
         }
         children.clear();
+        if (variableSizedDataHeap.has_value())
+        {
+            variableSizedDataHeap->controlBlock->release();
+            variableSizedDataHeap.reset();
+        }
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
         {
             std::unique_lock lock(owningThreadsMutex);
             owningThreads.clear();
         }
 #endif
+        if (const auto quota = std::move(owningQuota))
+        {
+            quota->release(std::exchange(chargedBytes, 0));
+        }
         auto recycler = std::move(owningBufferRecycler);
         recycleCallback(owner, recycler.get());
         return true;
@@ -305,23 +316,49 @@ void BufferControlBlock::setOriginId(const OriginId originId)
 /// ------------------ VarLen fields support for TupleBuffer --------------------
 /// -----------------------------------------------------------------------------
 
-uint32_t BufferControlBlock::storeChildBuffer(BufferControlBlock* control)
+uint32_t BufferControlBlock::storeChildBuffer(BufferControlBlock* control, uint8_t* ptr, const uint32_t size)
 {
     control->retain();
-    children.emplace_back(control->owner);
+    children.push_back({.controlBlock = control, .ptr = ptr, .size = size});
     return children.size() - 1;
 }
 
-bool BufferControlBlock::loadChildBuffer(uint16_t index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const
+bool BufferControlBlock::loadChildBuffer(uint32_t index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const
 {
     PRECONDITION(index < children.size(), "Index={} is out of range={}", index, children.size());
 
-    auto* child = children[index];
-    control = child->controlBlock->retain();
-    ptr = child->ptr;
-    size = child->size;
+    const auto& child = children[index];
+    control = child.controlBlock->retain();
+    ptr = child.ptr;
+    size = child.size;
 
     return true;
 }
+
+std::optional<std::pair<uint32_t, uint8_t*>> BufferControlBlock::reserveInVariableSizedDataHeap(const uint32_t size)
+{
+    /// Values start with their uint32_t length, which we keep aligned
+    const auto startOfValue = alignBufferSize(usedBytesOfVariableSizedDataHeap, alignof(uint32_t));
+    if (not variableSizedDataHeap.has_value() or startOfValue + size > variableSizedDataHeap->size)
+    {
+        return std::nullopt;
+    }
+    usedBytesOfVariableSizedDataHeap = startOfValue + size;
+    auto* const valuePtr = variableSizedDataHeap->ptr + startOfValue;
+    children.push_back({.controlBlock = variableSizedDataHeap->controlBlock->retain(), .ptr = valuePtr, .size = size});
+    return std::make_pair(static_cast<uint32_t>(children.size() - 1), valuePtr);
+}
+
+void BufferControlBlock::setVariableSizedDataHeap(BufferControlBlock* control, uint8_t* ptr, const uint32_t size)
+{
+    control->retain();
+    if (variableSizedDataHeap.has_value())
+    {
+        /// Children that point into the previous heap keep it alive
+        variableSizedDataHeap->controlBlock->release();
+    }
+    variableSizedDataHeap = ChildBuffer{.controlBlock = control, .ptr = ptr, .size = size};
+    usedBytesOfVariableSizedDataHeap = 0;
+}
 }
 }
@@ -16,8 +16,11 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Time/Timestamp.hpp>
@@ -38,6 +41,7 @@ class UnpooledChunksManager;
 namespace NES
 {
 class BufferManager;
+class QueryMemoryQuota;
 class LocalBufferPool;
 class TupleBuffer;
 class FixedSizeBufferPool;
@@ -108,8 +112,12 @@ public:
     void setOriginId(OriginId originId);
     void setCreationTimestamp(Timestamp timestamp);
     [[nodiscard]] Timestamp getCreationTimestamp() const noexcept;
-    [[nodiscard]] uint32_t storeChildBuffer(BufferControlBlock* control);
-    [[nodiscard]] bool loadChildBuffer(uint16_t index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const;
+    /// Stores the slice [ptr, ptr + size) of the memory of the control block as a child, which may be a part of its memory segment
+    [[nodiscard]] uint32_t storeChildBuffer(BufferControlBlock* control, uint8_t* ptr, uint32_t size);
+    [[nodiscard]] bool loadChildBuffer(uint32_t index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const;
+    /// Reserves 'size' bytes in the variable sized data heap and attaches them as a child buffer. Returns nullopt if the heap is too small.
+    [[nodiscard]] std::optional<std::pair<uint32_t, uint8_t*>> reserveInVariableSizedDataHeap(uint32_t size);
+    void setVariableSizedDataHeap(BufferControlBlock* control, uint8_t* ptr, uint32_t size);
 
     [[nodiscard]] uint32_t getNumberOfChildBuffers() const noexcept { return children.size(); }
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
@@ -125,12 +133,27 @@ private:
     bool lastChunk = true;
     Timestamp creationTimestamp = Timestamp(Timestamp::INITIAL_VALUE);
     OriginId originId = INVALID_ORIGIN_ID;
-    std::vector<MemorySegment*> children;
+
+    /// A child buffer may be a slice of a buffer that other children share, e.g., the variable sized data heap
+    struct ChildBuffer
+    {
+        BufferControlBlock* controlBlock;
+        uint8_t* ptr;
+        uint32_t size;
+    };
+
+    std::vector<ChildBuffer> children;
+    /// Buffer that the variable sized data of the tuples is appended to. Each value is a child buffer that points into the heap.
+    std::optional<ChildBuffer> variableSizedDataHeap;
+    uint32_t usedBytesOfVariableSizedDataHeap = 0;
 
 public:
     MemorySegment* owner;
     std::shared_ptr<BufferRecycler> owningBufferRecycler = nullptr;
     std::function<void(MemorySegment*, BufferRecycler*)> recycleCallback;
+    /// Query that the buffer is charged to, see QueryMemoryQuota
+    std::shared_ptr<QueryMemoryQuota> owningQuota = nullptr;
+    size_t chargedBytes = 0;
 
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
 private:
@@ -24,6 +24,7 @@
 #include <ranges>
 #include <thread>
 #include <utility>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <fmt/format.h>
@@ -185,7 +186,10 @@ UnpooledChunksManager::getUnpooledBuffer(const size_t neededSize, size_t alignme
 
     if (leakedMemSegment->controlBlock->prepare(bufferRecycler))
     {
-        return TupleBuffer(leakedMemSegment->controlBlock.get(), leakedMemSegment->ptr, neededSize);
+        TupleBuffer buffer(leakedMemSegment->controlBlock.get(), leakedMemSegment->ptr, neededSize);
+        /// The buffer occupies its aligned size and its control block in the chunk
+        QueryMemoryQuota::chargeToCurrentQuery(buffer, alignedBufferSizePlusControlBlock);
+        return buffer;
     }
     throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
 }
@@ -0,0 +1,70 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark measures the alloc/recycle throughput of pooled buffers for 1..64 threads.
+/// The first argument is the capacity of the per-thread buffer caches (0 disables them), the second argument is the number of buffers
+/// each thread holds at the same time, which emulates operators that keep a few buffers alive, e.g., a scan and an emit buffer.
+
+namespace
+{
+constexpr size_t BUFFER_SIZE = 8 * 1024;
+constexpr size_t NUMBER_OF_BUFFERS = 64 * 1024;
+std::shared_ptr<NES::BufferManager> bufferManager;
+}
+
+static void BM_AllocateAndRecycle(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        bufferManager = NES::BufferManager::create(
+            BUFFER_SIZE,
+            NUMBER_OF_BUFFERS,
+            std::make_shared<NES::NesDefaultMemoryAllocator>(),
+            NES::BufferManager::DEFAULT_ALIGNMENT,
+            static_cast<uint32_t>(state.range(0)));
+    }
+
+    const auto buffersInUse = static_cast<size_t>(state.range(1));
+    std::vector<NES::TupleBuffer> buffers;
+    buffers.reserve(buffersInUse);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < buffersInUse; ++i)
+        {
+            buffers.emplace_back(bufferManager->getBufferBlocking());
+        }
+        benchmark::DoNotOptimize(buffers.data());
+        buffers.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(buffersInUse));
+
+    if (state.thread_index() == 0)
+    {
+        bufferManager.reset();
+    }
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_AllocateAndRecycle)->ArgsProduct({{0, 64}, {1, 8}})->ThreadRange(1, 64)->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
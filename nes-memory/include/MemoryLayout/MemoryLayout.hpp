@@ -31,7 +31,8 @@ class MemoryLayoutTupleBuffer;
 /// @return Variable sized data as a string
 std::string readVarSizedData(const TupleBuffer& buffer, uint64_t childBufferIdx);
 
-/// @brief Writes the variable sized data to the buffer
+/// @brief Writes the variable sized data to the buffer. Appends the value to the heap buffer that the values of the buffer share and
+/// allocates a new heap buffer of the size of the buffers of the bufferProvider, once the current one is full.
 /// @param buffer
 /// @param value
 /// @param bufferProvider
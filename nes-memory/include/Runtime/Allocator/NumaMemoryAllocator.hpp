@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <Util/Numa.hpp>
+
+namespace NES
+{
+/**
+ * @brief Memory resource that places its allocations on a specific NUMA node.
+ * Memory is mapped anonymously and bound to the node via mbind with a preferred policy, i.e., the kernel only falls back to other
+ * nodes if the node is out of memory. Alignments up to the page size are supported.
+ */
+class NumaMemoryAllocator : public std::pmr::memory_resource
+{
+public:
+    explicit NumaMemoryAllocator(NumaNode node) : node(node) { }
+    ~NumaMemoryAllocator() override = default;
+
+    [[nodiscard]] NumaNode getNode() const { return node; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    void do_deallocate(void* p, size_t bytes, size_t) override;
+
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+    NumaNode node;
+};
+}
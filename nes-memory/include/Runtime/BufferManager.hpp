@@ -15,18 +15,27 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <memory>
 #include <memory_resource>
 #include <mutex>
 #include <optional>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
 #include <Runtime/BufferRecycler.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/UnpooledChunksManager.hpp>
+#include <Util/Numa.hpp>
 #include <folly/MPMCQueue.h>
+#include <folly/SpinLock.h>
+#include <folly/Synchronized.h>
+#include <folly/lang/Align.h>
 
 namespace NES
 {
@@ -50,6 +59,17 @@ namespace NES
  * Unpooled buffers are either allocated on the spot or served via a previously allocated, unpooled buffer that has
  * been returned to the BufferManager by some component.
  *
+ * A NUMA-aware BufferManager (see createNumaAware) splits the pooled buffers into one pool per NUMA node. Each pool is
+ * allocated on its node. Pooled buffers are served from the pool of the calling thread's node first and only fall back
+ * to the pools of other nodes if the local pool is empty. Recycled buffers always return to the pool they originate from.
+ *
+ * Optionally, the pools are fronted by bounded caches of free buffers, which are striped across threads. Every thread is
+ * assigned to one cache on first use, takes and returns buffers there and only refills or flushes it in batches from or to
+ * the pools. To preserve the blocking semantics of getBufferBlocking, a blocked thread drains the caches of other threads
+ * and, as long as any thread is blocked, recycled buffers bypass the caches.
+ *
+ * Every buffer can be charged to the memory quota of a query (see QueryMemoryQuota), which limits the memory of the query and
+ * exposes its live usage.
  */
 class BufferManager final : public std::enable_shared_from_this<BufferManager>, public BufferRecycler, public AbstractBufferProvider
 {
@@ -63,28 +83,58 @@ class BufferManager final : public std::enable_shared_from_this<BufferManager>,
         explicit Private() = default;
     };
 
+    /// Interval after which a blocked thread rechecks the pools of other NUMA nodes and the caches of other threads
+    static constexpr auto REMOTE_POOL_POLL_INTERVAL = std::chrono::milliseconds(10);
+
+public:
     static constexpr auto DEFAULT_BUFFER_SIZE = 8 * 1024;
     static constexpr auto DEFAULT_NUMBER_OF_BUFFERS = 1024;
     static constexpr auto DEFAULT_ALIGNMENT = 64;
+    /// Caching is disabled by default
+    static constexpr auto DEFAULT_THREAD_LOCAL_CACHE_CAPACITY = 0;
 
-public:
     explicit BufferManager(
         Private,
         uint32_t bufferSize,
         uint32_t numOfBuffers,
         std::shared_ptr<std::pmr::memory_resource> memoryResource,
-        uint32_t withAlignment);
+        uint32_t withAlignment,
+        uint32_t threadLocalCacheCapacity);
+
+    explicit BufferManager(
+        Private,
+        uint32_t bufferSize,
+        uint32_t numOfBuffers,
+        std::vector<std::pair<NumaNode, std::shared_ptr<std::pmr::memory_resource>>> poolMemoryResources,
+        std::shared_ptr<std::pmr::memory_resource> unpooledMemoryResource,
+        uint32_t withAlignment,
+        uint32_t threadLocalCacheCapacity);
 
     /// Creates a new global buffer manager
     /// @param bufferSize the size of each buffer in bytes
     /// @param numOfBuffers the total number of buffers in the pool
     /// @param withAlignment the alignment of each buffer, default is 64 so ony cache line aligned buffers, This value must be a pow of two and smaller than page size
     /// @param memoryResource resource for allocating and deallocating memory
+    /// @param threadLocalCacheCapacity maximum number of free buffers in each per-thread cache, 0 disables the caches.
+    /// The capacity is reduced so that at most half of all buffers can reside in caches.
     static std::shared_ptr<BufferManager> create(
         uint32_t bufferSize = DEFAULT_BUFFER_SIZE,
         uint32_t numOfBuffers = DEFAULT_NUMBER_OF_BUFFERS,
         const std::shared_ptr<std::pmr::memory_resource>& memoryResource = std::make_shared<NesDefaultMemoryAllocator>(),
-        uint32_t withAlignment = DEFAULT_ALIGNMENT);
+        uint32_t withAlignment = DEFAULT_ALIGNMENT,
+        uint32_t threadLocalCacheCapacity = DEFAULT_THREAD_LOCAL_CACHE_CAPACITY);
+
+    /// Creates a new global buffer manager with one pool per NUMA node. The pooled buffers are evenly distributed across the pools.
+    /// On machines with a single NUMA node, this behaves like create() except that the pool is allocated via mmap.
+    /// @param bufferSize the size of each buffer in bytes
+    /// @param numOfBuffers the total number of buffers over all pools
+    /// @param withAlignment the alignment of each buffer, see create()
+    /// @param threadLocalCacheCapacity maximum number of free buffers in each per-thread cache, see create()
+    static std::shared_ptr<BufferManager> createNumaAware(
+        uint32_t bufferSize = DEFAULT_BUFFER_SIZE,
+        uint32_t numOfBuffers = DEFAULT_NUMBER_OF_BUFFERS,
+        uint32_t withAlignment = DEFAULT_ALIGNMENT,
+        uint32_t threadLocalCacheCapacity = DEFAULT_THREAD_LOCAL_CACHE_CAPACITY);
 
     BufferManager(const BufferManager&) = delete;
     BufferManager& operator=(const BufferManager&) = delete;
@@ -123,6 +173,21 @@ public:
     size_t getNumOfUnpooledBuffers() const override;
     size_t getNumberOfAvailableBuffers() const;
 
+    /// Number of pools, i.e., the number of NUMA nodes for a NUMA-aware BufferManager and one otherwise.
+    size_t getNumberOfPools() const;
+
+    /// Number of pooled buffers that had to be served from the pool of a different NUMA node than the requesting thread's one.
+    size_t getNumberOfRemoteNodeAllocations() const;
+
+    /// Effective capacity of each per-thread cache. 0 if caching is disabled.
+    size_t getThreadLocalCacheCapacity() const;
+
+    /// Creates the memory quota of a query. Buffers that are allocated within a QueryMemoryQuota::Scope of the quota are charged to it.
+    std::shared_ptr<QueryMemoryQuota> createQueryMemoryQuota(QueryId queryId, QueryMemoryLimits limits);
+
+    /// Memory usage of the query as long as its quota is alive, i.e., until the query terminated and released all of its buffers.
+    std::optional<QueryMemoryUsage> getQueryMemoryUsage(QueryId queryId) const;
+
     /**
      * @brief Recycle a pooled buffer by making it available to others
      * @param buffer
@@ -141,19 +206,74 @@ public:
     void destroy() override;
 
 private:
+    /// Contiguous allocation of pooled buffers that lives on a single NUMA node.
+    struct BufferPool
+    {
+        BufferPool(NumaNode node, std::shared_ptr<std::pmr::memory_resource> memoryResource, size_t firstBuffer, size_t numberOfBuffers)
+            : availableBuffers(numberOfBuffers)
+            , memoryResource(std::move(memoryResource))
+            , node(node)
+            , firstBuffer(firstBuffer)
+            , numberOfBuffers(numberOfBuffers)
+        {
+        }
+
+        folly::MPMCQueue<detail::MemorySegment*> availableBuffers;
+        std::shared_ptr<std::pmr::memory_resource> memoryResource;
+        NumaNode node;
+        /// The buffers of this pool are allBuffers[firstBuffer, firstBuffer + numberOfBuffers)
+        size_t firstBuffer;
+        size_t numberOfBuffers;
+        uint8_t* basePointer{nullptr};
+        size_t allocatedAreaSize{0};
+    };
+
+    /// Pool of the NUMA node the calling thread is running on. Falls back to the first pool for nodes without a pool.
+    BufferPool& getLocalPool();
+    BufferPool& getPoolOf(const detail::MemorySegment* segment);
+    /// Takes a segment from the local pool or, if it is empty, from any other pool without blocking.
+    bool tryReadSegment(detail::MemorySegment*& segment);
+    /// Same as tryReadSegment, but blocks until the deadline is reached.
+    bool readSegmentUntil(std::chrono::steady_clock::time_point deadline, detail::MemorySegment*& segment);
+
+    /// Bounded stack of free segments. Only the thread(s) assigned to the cache use it, unless a thread is blocked on an empty pool.
+    struct alignas(folly::hardware_destructive_interference_size) BufferCache
+    {
+        folly::SpinLock lock;
+        std::vector<detail::MemorySegment*> segments;
+        /// Allows counting the cached buffers without acquiring the lock
+        std::atomic<size_t> numberOfSegments{0};
+    };
+
+    BufferCache& getCacheOfCurrentThread();
+    /// Takes a segment from the calling thread's cache and refills the cache in a batch from the pools if it is empty.
+    bool tryReadCachedSegment(detail::MemorySegment*& segment);
+    /// Takes a segment from the cache of any thread. Used if all pools are empty.
+    bool stealCachedSegment(detail::MemorySegment*& segment);
+    /// Returns all cached segments to their pools
+    void flushCaches();
+
     std::vector<detail::MemorySegment> allBuffers;
 
-    folly::MPMCQueue<detail::MemorySegment*> availableBuffers;
+    std::vector<std::unique_ptr<BufferPool>> pools;
+    /// Maps a NUMA node to the index of its pool in pools
+    std::vector<size_t> poolIndexOfNode;
+
+    std::vector<BufferCache> caches;
+    size_t cacheCapacity{0};
+    size_t cacheBatchSize{0};
+    /// Number of threads that are blocked in getBufferWithTimeout. Recycled buffers bypass the caches while it is non-zero.
+    std::atomic<size_t> numberOfWaitingThreads{0};
 
     UnpooledChunksManager unpooledChunksManager;
 
     size_t bufferSize;
     size_t numOfBuffers;
 
-    uint8_t* basePointer{nullptr};
-    size_t allocatedAreaSize;
+    /// The quotas are owned by the running queries and their buffers
+    folly::Synchronized<std::unordered_map<QueryId, std::weak_ptr<QueryMemoryQuota>>> queryMemoryQuotas;
 
-    std::shared_ptr<std::pmr::memory_resource> memoryResource;
+    std::atomic<size_t> numberOfRemoteNodeAllocations{0};
     std::atomic<bool> isDestroyed{false};
 };
 
@@ -0,0 +1,91 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Limits of the pooled and unpooled buffers that a single query may hold at the same time. A limit of zero disables it.
+struct QueryMemoryLimits
+{
+    /// Once a query exceeds its soft limit, its sources emit fewer buffers until the usage of the query drops
+    size_t softLimitInBytes = 0;
+    /// An allocation that would exceed the hard limit throws, which fails the query
+    size_t hardLimitInBytes = 0;
+};
+
+struct QueryMemoryUsage
+{
+    size_t usedBytes;
+    size_t peakUsedBytes;
+    QueryMemoryLimits limits;
+};
+
+/// Accounts the buffers of a single query. A buffer is charged to at most one query and the charge is returned once the buffer is recycled.
+/// The BufferManager charges each buffer to the quota of the allocating thread. A worker thread sets the quota via a Scope while it executes
+/// a task of the query. Buffers that are allocated outside a scope, e.g., by a source, are adopted once they enter the query.
+/// IMPORTANT: The quota only sees memory that is allocated via the BufferManager, other allocations of operators are not accounted.
+class QueryMemoryQuota final : public std::enable_shared_from_this<QueryMemoryQuota>
+{
+public:
+    /// Charges all buffer allocations of the calling thread to the quota, as long as the scope is alive. Scopes may be nested.
+    class Scope
+    {
+    public:
+        explicit Scope(std::shared_ptr<QueryMemoryQuota> quota);
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+        ~Scope();
+
+    private:
+        std::shared_ptr<QueryMemoryQuota> previousQuota;
+    };
+
+    QueryMemoryQuota(QueryId queryId, QueryMemoryLimits limits);
+
+    /// Charges the buffer to the quota of the calling thread, if there is one.
+    /// Throws QueryMemoryLimitExceeded, if the buffer exceeds the hard limit of the query.
+    static void chargeToCurrentQuery(const TupleBuffer& buffer, size_t sizeInBytes);
+
+    /// Charges the buffer to this quota, unless it is charged to a query already. In contrast to an allocation within a scope, adopting
+    /// never throws as the memory is in use already. Only the next allocation of the query fails, if it exceeds the hard limit.
+    void adopt(const TupleBuffer& buffer);
+
+    /// Returns the charge of a buffer. Called once the buffer is recycled.
+    void release(size_t sizeInBytes);
+
+    [[nodiscard]] bool exceedsSoftLimit() const;
+    [[nodiscard]] QueryMemoryUsage getUsage() const;
+    [[nodiscard]] QueryId getQueryId() const;
+
+private:
+    void charge(const TupleBuffer& buffer, size_t sizeInBytes, bool enforceHardLimit);
+
+    QueryId queryId;
+    QueryMemoryLimits limits;
+    std::atomic<size_t> usedBytes{0};
+    std::atomic<size_t> peakUsedBytes{0};
+    std::atomic_flag reportedSoftLimit;
+};
+
+}
@@ -0,0 +1,104 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Location of spilled data in a SpillStore
+struct SpillRegion
+{
+    uint64_t offset;
+    uint64_t size;
+};
+
+/// Stores operator state that exceeds the memory budget of its operator on secondary storage, until the operator needs it again.
+/// Implementations decide where the data goes and have to be thread-safe, as multiple worker threads spill and reload concurrently.
+class SpillStore
+{
+public:
+    struct Statistics
+    {
+        uint64_t spilledBytes;
+        uint64_t reloadedBytes;
+        uint64_t numberOfSpills;
+        uint64_t numberOfReloads;
+    };
+
+    virtual ~SpillStore() = default;
+
+    /// Writes the data and returns the region to reload it from
+    [[nodiscard]] SpillRegion spill(std::span<const std::byte> data);
+
+    /// Reads the data of the region and releases the region afterward
+    [[nodiscard]] std::vector<std::byte> reload(const SpillRegion& region);
+
+    /// Releases the region without reading it, e.g., if the state got deleted while it was spilled
+    virtual void release(const SpillRegion& region) = 0;
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+protected:
+    virtual SpillRegion write(std::span<const std::byte> data) = 0;
+    virtual void read(const SpillRegion& region, std::span<std::byte> data) = 0;
+
+private:
+    std::atomic<uint64_t> spilledBytes{0};
+    std::atomic<uint64_t> reloadedBytes{0};
+    std::atomic<uint64_t> numberOfSpills{0};
+    std::atomic<uint64_t> numberOfReloads{0};
+};
+
+/// Appends the spilled data to an unnamed temporary file in the given directory. The file vanishes once the store gets destroyed.
+/// Released regions are punched out of the file, if the file system supports it, so that the file does not grow with the runtime.
+class FileSpillStore final : public SpillStore
+{
+public:
+    explicit FileSpillStore(const std::filesystem::path& directory);
+    ~FileSpillStore() override;
+
+    FileSpillStore(const FileSpillStore&) = delete;
+    FileSpillStore(FileSpillStore&&) = delete;
+    FileSpillStore& operator=(const FileSpillStore&) = delete;
+    FileSpillStore& operator=(FileSpillStore&&) = delete;
+
+    void release(const SpillRegion& region) override;
+
+protected:
+    SpillRegion write(std::span<const std::byte> data) override;
+    void read(const SpillRegion& region, std::span<std::byte> data) override;
+
+private:
+    int fileDescriptor;
+    std::atomic<uint64_t> endOfFile{0};
+};
+
+/// Appends the content, the number of tuples and the child buffers of the buffer to the spilled state.
+/// Child buffers of child buffers are not supported, as only pages with variable sized data have children.
+void serializeTupleBuffer(const TupleBuffer& buffer, std::vector<std::byte>& spilledState);
+
+/// Restores the buffer at the beginning of the spilled state and advances the spilled state past it.
+/// The child buffers keep their keys but share one heap buffer, instead of one allocation each.
+[[nodiscard]] TupleBuffer deserializeTupleBuffer(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider);
+}
@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -30,6 +31,7 @@
 namespace NES
 {
 class UnpooledChunksManager;
+class QueryMemoryQuota;
 }
 
 namespace NES
@@ -67,6 +69,7 @@ class TupleBuffer
     /// Utilize the wrapped-memory constructor
     friend class BufferManager;
     friend class UnpooledChunksManager;
+    friend class QueryMemoryQuota;
     friend class FixedSizeBufferPool;
     friend class LocalBufferPool;
     friend class detail::MemorySegment;
@@ -93,6 +96,10 @@ public:
      */
     [[maybe_unused]] static TupleBuffer reinterpretAsTupleBuffer(void* bufferPointer);
 
+    /// Wraps memory that no buffer manager manages, e.g., a region of a memory-mapped file, into a TupleBuffer without copying it.
+    /// The TupleBuffer keeps the owner of the memory alive, until the last TupleBuffer that references the memory is released.
+    [[nodiscard]] static TupleBuffer wrapMemory(uint8_t* ptr, uint32_t size, std::shared_ptr<void> owner);
+
 
     /// @brief Copy constructor: Increase the reference count associated to the control buffer.
     [[nodiscard]] TupleBuffer(const TupleBuffer& other) noexcept;
@@ -192,6 +199,14 @@ public:
     ///@brief retrieve a child tuple buffer via its NestedTupleBufferKey
     [[nodiscard]] TupleBuffer loadChildBuffer(NestedTupleBufferKey bufferIndex) const noexcept;
 
+    ///@brief reserve 'size' bytes in the heap buffer that stores the variable sized data of this buffer and attach them as a child buffer.
+    /// All values in the heap buffer share its allocation, instead of allocating one child buffer per value.
+    /// Returns the key of the child buffer and a pointer to the reserved bytes, or nullopt if there is no heap buffer or it is full.
+    [[nodiscard]] std::optional<std::pair<NestedTupleBufferKey, int8_t*>> reserveVariableSizedData(uint32_t size) const noexcept;
+
+    ///@brief replace the heap buffer that stores the variable sized data of this buffer. Children in the previous heap buffer stay valid.
+    void setVariableSizedDataHeap(const TupleBuffer& heapBuffer) const noexcept;
+
     [[nodiscard]] uint32_t getNumberOfChildBuffers() const noexcept;
 
     bool hasSpaceLeft(uint64_t used, uint64_t needed) const;
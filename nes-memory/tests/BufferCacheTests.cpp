@@ -0,0 +1,115 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+namespace
+{
+constexpr size_t CACHE_CAPACITY = 64;
+
+std::shared_ptr<BufferManager> createCachingBufferManager(const size_t numberOfBuffers)
+{
+    return BufferManager::create(
+        1024, numberOfBuffers, std::make_shared<NesDefaultMemoryAllocator>(), BufferManager::DEFAULT_ALIGNMENT, CACHE_CAPACITY);
+}
+
+/// Takes all buffers on a different thread and releases them again. Afterward, the buffers reside in the other thread's cache.
+void fillCacheOnOtherThread(BufferManager& bufferManager, const size_t numberOfBuffers)
+{
+    std::jthread(
+        [&]
+        {
+            std::vector<TupleBuffer> buffers;
+            for (size_t i = 0; i < numberOfBuffers; ++i)
+            {
+                buffers.emplace_back(bufferManager.getBufferBlocking());
+            }
+        });
+}
+}
+
+TEST(BufferCacheTests, CapacityIsBoundedByNumberOfBuffers)
+{
+    const auto bufferManager = createCachingBufferManager(4);
+    EXPECT_EQ(bufferManager->getThreadLocalCacheCapacity(), 0);
+
+    const auto disabled = BufferManager::create(1024, 100000);
+    EXPECT_EQ(disabled->getThreadLocalCacheCapacity(), 0);
+}
+
+TEST(BufferCacheTests, CachedBuffersAreAvailable)
+{
+    const size_t numberOfBuffers = 4 * CACHE_CAPACITY * std::max(1U, std::thread::hardware_concurrency());
+    const auto bufferManager = createCachingBufferManager(numberOfBuffers);
+    ASSERT_EQ(bufferManager->getThreadLocalCacheCapacity(), CACHE_CAPACITY);
+
+    fillCacheOnOtherThread(*bufferManager, numberOfBuffers);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), numberOfBuffers);
+}
+
+TEST(BufferCacheTests, BlockingRequestDrainsOtherCaches)
+{
+    /// All buffers have to be obtainable from a single thread, even if some of them reside in the cache of a different thread.
+    const size_t numberOfBuffers = 4 * CACHE_CAPACITY * std::max(1U, std::thread::hardware_concurrency());
+    const auto bufferManager = createCachingBufferManager(numberOfBuffers);
+    fillCacheOnOtherThread(*bufferManager, numberOfBuffers);
+
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < numberOfBuffers; ++i)
+    {
+        auto buffer = bufferManager->getBufferWithTimeout(std::chrono::milliseconds(100));
+        ASSERT_TRUE(buffer.has_value());
+        buffers.emplace_back(std::move(*buffer));
+    }
+    EXPECT_FALSE(bufferManager->getBufferNoBlocking().has_value());
+    buffers.clear();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), numberOfBuffers);
+}
+
+TEST(BufferCacheTests, BlockedThreadIsServedByRecyclingThread)
+{
+    const size_t numberOfBuffers = 4 * CACHE_CAPACITY * std::max(1U, std::thread::hardware_concurrency());
+    const auto bufferManager = createCachingBufferManager(numberOfBuffers);
+
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < numberOfBuffers; ++i)
+    {
+        buffers.emplace_back(bufferManager->getBufferBlocking());
+    }
+
+    std::jthread waiter(
+        [&]
+        {
+            auto buffer = bufferManager->getBufferWithTimeout(std::chrono::seconds(5));
+            EXPECT_TRUE(buffer.has_value());
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    buffers.pop_back();
+    waiter.join();
+    buffers.clear();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), numberOfBuffers);
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Numa.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+TEST(NumaBufferManagerTests, OnePoolPerNode)
+{
+    constexpr size_t numberOfBuffers = 1024;
+    const auto bufferManager = BufferManager::createNumaAware(1024, numberOfBuffers);
+    EXPECT_EQ(bufferManager->getNumberOfPools(), std::min(getNumaNodes().size(), numberOfBuffers));
+    EXPECT_EQ(bufferManager->getNumOfPooledBuffers(), numberOfBuffers);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), numberOfBuffers);
+}
+
+TEST(NumaBufferManagerTests, AllBuffersAreReachableFromEveryNode)
+{
+    /// A single thread has to be able to drain all pools, i.e., it falls back to the pools of the remote nodes.
+    constexpr size_t numberOfBuffers = 128;
+    const auto bufferManager = BufferManager::createNumaAware(1024, numberOfBuffers);
+
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < numberOfBuffers; ++i)
+    {
+        auto buffer = bufferManager->getBufferNoBlocking();
+        ASSERT_TRUE(buffer.has_value());
+        buffers.emplace_back(std::move(*buffer));
+    }
+    EXPECT_FALSE(bufferManager->getBufferNoBlocking().has_value());
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 0);
+
+    /// Without pinning the thread might migrate between nodes, thus we cannot tell exactly which allocations were remote
+    if (bufferManager->getNumberOfPools() == 1)
+    {
+        EXPECT_EQ(bufferManager->getNumberOfRemoteNodeAllocations(), 0);
+    }
+    else
+    {
+        EXPECT_GT(bufferManager->getNumberOfRemoteNodeAllocations(), 0);
+    }
+
+    buffers.clear();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), numberOfBuffers);
+}
+
+TEST(NumaBufferManagerTests, ConcurrentAllocationsFromPinnedThreads)
+{
+    constexpr size_t numberOfBuffers = 256;
+    constexpr size_t numberOfIterations = 10000;
+    const auto bufferManager = BufferManager::createNumaAware(1024, numberOfBuffers);
+
+    std::vector<std::jthread> threads;
+    const auto nodes = getNumaNodes();
+    for (size_t threadIndex = 0; threadIndex < 2 * nodes.size(); ++threadIndex)
+    {
+        threads.emplace_back(
+            [&, node = nodes[threadIndex % nodes.size()]]
+            {
+                pinCurrentThreadToNumaNode(node);
+                for (size_t i = 0; i < numberOfIterations; ++i)
+                {
+                    auto buffer = bufferManager->getBufferBlocking();
+                    buffer.getBuffer<size_t>()[0] = i;
+                }
+            });
+    }
+    threads.clear();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), numberOfBuffers);
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+class QueryMemoryQuotaTests : public ::testing::Test
+{
+protected:
+    static constexpr size_t BUFFER_SIZE = 1024;
+    static constexpr size_t NUMBER_OF_BUFFERS = 8;
+
+    void SetUp() override { bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS); }
+
+    void TearDown() override { bufferManager->destroy(); }
+
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(QueryMemoryQuotaTests, ChargesPooledAndUnpooledBuffersWithinScope)
+{
+    const auto quota = bufferManager->createQueryMemoryQuota(QueryId(1), {});
+    {
+        const QueryMemoryQuota::Scope scope(quota);
+        const auto pooledBuffer = bufferManager->getBufferBlocking();
+        EXPECT_EQ(quota->getUsage().usedBytes, BUFFER_SIZE);
+
+        /// An unpooled buffer occupies at least its size and its control block
+        const auto unpooledBuffer = bufferManager->getUnpooledBuffer(100);
+        ASSERT_TRUE(unpooledBuffer.has_value());
+        EXPECT_GT(quota->getUsage().usedBytes, BUFFER_SIZE + 100);
+    }
+    EXPECT_EQ(quota->getUsage().usedBytes, 0);
+    EXPECT_GT(quota->getUsage().peakUsedBytes, BUFFER_SIZE + 100);
+
+    /// Outside the scope buffers are not charged
+    const auto buffer = bufferManager->getBufferBlocking();
+    EXPECT_EQ(quota->getUsage().usedBytes, 0);
+}
+
+TEST_F(QueryMemoryQuotaTests, ChildBuffersAreChargedSeparately)
+{
+    const auto quota = bufferManager->createQueryMemoryQuota(QueryId(1), {});
+    const QueryMemoryQuota::Scope scope(quota);
+    auto parent = bufferManager->getBufferBlocking();
+    auto child = bufferManager->getUnpooledBuffer(64);
+    ASSERT_TRUE(child.has_value());
+    const auto childIndex = parent.storeChildBuffer(*child);
+    const auto usedWithChild = quota->getUsage().usedBytes;
+    EXPECT_GT(usedWithChild, BUFFER_SIZE);
+    EXPECT_EQ(parent.loadChildBuffer(childIndex).getBufferSize(), 64);
+
+    parent.release();
+    EXPECT_EQ(quota->getUsage().usedBytes, 0);
+}
+
+TEST_F(QueryMemoryQuotaTests, AdoptsBuffersOnlyOnce)
+{
+    const auto firstQuota = bufferManager->createQueryMemoryQuota(QueryId(1), {});
+    const auto secondQuota = bufferManager->createQueryMemoryQuota(QueryId(2), {});
+    auto buffer = bufferManager->getBufferBlocking();
+    firstQuota->adopt(buffer);
+    secondQuota->adopt(buffer);
+    EXPECT_EQ(firstQuota->getUsage().usedBytes, BUFFER_SIZE);
+    EXPECT_EQ(secondQuota->getUsage().usedBytes, 0);
+
+    buffer.release();
+    EXPECT_EQ(firstQuota->getUsage().usedBytes, 0);
+}
+
+TEST_F(QueryMemoryQuotaTests, HardLimitFailsAllocationAndReturnsBuffer)
+{
+    const auto quota
+        = bufferManager->createQueryMemoryQuota(QueryId(1), {.softLimitInBytes = BUFFER_SIZE, .hardLimitInBytes = 2 * BUFFER_SIZE});
+    const QueryMemoryQuota::Scope scope(quota);
+    const auto firstBuffer = bufferManager->getBufferBlocking();
+    EXPECT_FALSE(quota->exceedsSoftLimit());
+    const auto secondBuffer = bufferManager->getBufferBlocking();
+    EXPECT_TRUE(quota->exceedsSoftLimit());
+
+    std::optional<ErrorCode> errorCode;
+    try
+    {
+        const auto thirdBuffer = bufferManager->getBufferBlocking();
+    }
+    catch (const Exception& exception)
+    {
+        errorCode = exception.code();
+    }
+    EXPECT_EQ(errorCode, ErrorCode::QueryMemoryLimitExceeded);
+    EXPECT_EQ(quota->getUsage().usedBytes, 2 * BUFFER_SIZE);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 2);
+
+    /// Other queries are not affected
+    const QueryMemoryQuota::Scope otherScope(bufferManager->createQueryMemoryQuota(QueryId(2), {.hardLimitInBytes = 2 * BUFFER_SIZE}));
+    EXPECT_NO_THROW({ const auto buffer = bufferManager->getBufferBlocking(); });
+}
+
+TEST_F(QueryMemoryQuotaTests, ReportsUsageWhileQuotaIsAlive)
+{
+    auto quota = bufferManager->createQueryMemoryQuota(QueryId(1), {.hardLimitInBytes = 4 * BUFFER_SIZE});
+    auto buffer = std::optional<TupleBuffer>{};
+    {
+        const QueryMemoryQuota::Scope scope(quota);
+        buffer = bufferManager->getBufferBlocking();
+    }
+    const auto usage = bufferManager->getQueryMemoryUsage(QueryId(1));
+    ASSERT_TRUE(usage.has_value());
+    EXPECT_EQ(usage->usedBytes, BUFFER_SIZE);
+    EXPECT_EQ(usage->limits.hardLimitInBytes, 4 * BUFFER_SIZE);
+    EXPECT_FALSE(bufferManager->getQueryMemoryUsage(QueryId(2)).has_value());
+
+    /// The buffer keeps the quota of the terminated query alive until it is released
+    quota.reset();
+    EXPECT_TRUE(bufferManager->getQueryMemoryUsage(QueryId(1)).has_value());
+    buffer.reset();
+    EXPECT_FALSE(bufferManager->getQueryMemoryUsage(QueryId(1)).has_value());
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
@@ -0,0 +1,98 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/SpillStore.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+namespace
+{
+constexpr uint32_t BUFFER_SIZE = 1024;
+constexpr uint32_t NUMBER_OF_BUFFERS = 4;
+
+std::vector<std::byte> toBytes(const std::string& value)
+{
+    const auto bytes = std::as_bytes(std::span{value});
+    return {bytes.begin(), bytes.end()};
+}
+}
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST(SpillStoreTests, ReloadsSpilledRegions)
+{
+    FileSpillStore spillStore(std::filesystem::temp_directory_path());
+    const auto first = toBytes("first spilled state");
+    const auto second = toBytes(std::string(3 * BUFFER_SIZE, 'x'));
+    const auto firstRegion = spillStore.spill(first);
+    const auto secondRegion = spillStore.spill(second);
+
+    EXPECT_EQ(spillStore.reload(secondRegion), second);
+    EXPECT_EQ(spillStore.reload(firstRegion), first);
+    const auto statistics = spillStore.getStatistics();
+    EXPECT_EQ(statistics.spilledBytes, first.size() + second.size());
+    EXPECT_EQ(statistics.reloadedBytes, first.size() + second.size());
+    EXPECT_EQ(statistics.numberOfSpills, 2);
+    EXPECT_EQ(statistics.numberOfReloads, 2);
+}
+
+TEST(SpillStoreTests, CannotSpillToMissingDirectory)
+{
+    EXPECT_ANY_THROW(FileSpillStore(std::filesystem::temp_directory_path() / "nes-spill-store-test-does-not-exist"));
+}
+
+TEST(SpillStoreTests, SerializesBuffersWithVariableSizedData)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto buffer = bufferManager->getBufferBlocking();
+    buffer.getBuffer<uint64_t>()[0] = 42;
+    buffer.setNumberOfTuples(1);
+    const std::vector<std::string> values{"small", std::string(4 * BUFFER_SIZE, 'y'), "another small value"};
+    std::vector<uint32_t> childBufferIndexes;
+    for (const auto& value : values)
+    {
+        const auto childBufferIdx = writeVarSizedData(buffer, value, *bufferManager);
+        ASSERT_TRUE(childBufferIdx.has_value());
+        childBufferIndexes.emplace_back(childBufferIdx.value());
+    }
+
+    std::vector<std::byte> spilledState;
+    serializeTupleBuffer(buffer, spilledState);
+    serializeTupleBuffer(buffer, spilledState);
+    std::span<const std::byte> remainingState{spilledState};
+    for (size_t copy = 0; copy < 2; ++copy)
+    {
+        const auto reloaded = deserializeTupleBuffer(remainingState, *bufferManager);
+        EXPECT_EQ(reloaded.getBufferSize(), buffer.getBufferSize());
+        EXPECT_EQ(reloaded.getNumberOfTuples(), 1);
+        EXPECT_EQ(reloaded.getBuffer<uint64_t>()[0], 42);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            EXPECT_EQ(readVarSizedData(reloaded, childBufferIndexes[i]), values[i]);
+        }
+    }
+    EXPECT_TRUE(remainingState.empty());
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
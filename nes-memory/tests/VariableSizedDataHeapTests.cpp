@@ -0,0 +1,115 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+namespace
+{
+constexpr uint32_t BUFFER_SIZE = 1024;
+constexpr uint32_t NUMBER_OF_BUFFERS = 4;
+}
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST(VariableSizedDataHeapTests, SmallValuesShareHeapBuffers)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto buffer = bufferManager->getBufferBlocking();
+
+    std::vector<std::pair<uint32_t, std::string>> values;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto value = std::to_string(i * 7919);
+        const auto childBufferIdx = writeVarSizedData(buffer, value, *bufferManager);
+        ASSERT_TRUE(childBufferIdx.has_value());
+        values.emplace_back(childBufferIdx.value(), std::move(value));
+    }
+
+    /// Each value takes at most 12 bytes including its length and padding. Thus, the values fill only a few heap buffers.
+    EXPECT_LE(bufferManager->getNumOfUnpooledBuffers(), (1000 * 12) / BUFFER_SIZE + 1);
+    EXPECT_EQ(buffer.getNumberOfChildBuffers(), 1000);
+    for (const auto& [childBufferIdx, value] : values)
+    {
+        EXPECT_EQ(readVarSizedData(buffer, childBufferIdx), value);
+    }
+}
+
+TEST(VariableSizedDataHeapTests, LargeValuesGetChildBufferOfTheirOwn)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto buffer = bufferManager->getBufferBlocking();
+
+    const std::string smallValue = "small";
+    const std::string largeValue(4 * BUFFER_SIZE, 'x');
+    const auto firstSmallIdx = writeVarSizedData(buffer, smallValue, *bufferManager);
+    const auto largeIdx = writeVarSizedData(buffer, largeValue, *bufferManager);
+    const auto secondSmallIdx = writeVarSizedData(buffer, smallValue, *bufferManager);
+    ASSERT_TRUE(firstSmallIdx.has_value() and largeIdx.has_value() and secondSmallIdx.has_value());
+
+    /// The large value must not replace the heap buffer that still has space left for the second small value
+    EXPECT_EQ(bufferManager->getNumOfUnpooledBuffers(), 2);
+    EXPECT_EQ(readVarSizedData(buffer, firstSmallIdx.value()), smallValue);
+    EXPECT_EQ(readVarSizedData(buffer, largeIdx.value()), largeValue);
+    EXPECT_EQ(readVarSizedData(buffer, secondSmallIdx.value()), smallValue);
+}
+
+TEST(VariableSizedDataHeapTests, ValuesOutliveTheBufferThatWroteThem)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const std::string value = "the heap buffer is kept alive by the child buffer";
+    std::optional<TupleBuffer> childBuffer;
+    {
+        const auto buffer = bufferManager->getBufferBlocking();
+        const auto childBufferIdx = writeVarSizedData(buffer, value, *bufferManager);
+        ASSERT_TRUE(childBufferIdx.has_value());
+        childBuffer = buffer.loadChildBuffer(childBufferIdx.value());
+    }
+    EXPECT_EQ(*childBuffer->getBuffer<uint32_t>(), value.size());
+    EXPECT_EQ(std::string(childBuffer->getBuffer<char>() + sizeof(uint32_t), value.size()), value);
+}
+
+TEST(VariableSizedDataHeapTests, SlicesKeepTheirBoundsWhenStoredInAnotherBuffer)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto buffer = bufferManager->getBufferBlocking();
+    ASSERT_TRUE(writeVarSizedData(buffer, "first value", *bufferManager).has_value());
+    const auto childBufferIdx = writeVarSizedData(buffer, "second value", *bufferManager);
+    ASSERT_TRUE(childBufferIdx.has_value());
+
+    /// The loaded child is a slice in the middle of the shared heap buffer
+    auto slice = buffer.loadChildBuffer(childBufferIdx.value());
+    const auto* const slicePtr = slice.getBuffer();
+    const auto sliceSize = slice.getBufferSize();
+
+    const auto otherBuffer = bufferManager->getBufferBlocking();
+    const auto otherChildBufferIdx = otherBuffer.storeChildBuffer(slice);
+    auto storedSlice = otherBuffer.loadChildBuffer(otherChildBufferIdx);
+    EXPECT_EQ(storedSlice.getBuffer(), slicePtr);
+    EXPECT_EQ(storedSlice.getBufferSize(), sliceSize);
+    EXPECT_EQ(readVarSizedData(otherBuffer, otherChildBufferIdx), "second value");
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
@@ -0,0 +1,63 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST(WrappedMemoryTests, WrapsMemoryWithoutCopy)
+{
+    auto memory = std::make_shared<std::vector<uint8_t>>(4096);
+    std::iota(memory->begin(), memory->end(), 0);
+
+    auto buffer = TupleBuffer::wrapMemory(memory->data() + 1024, 1024, memory);
+    EXPECT_EQ(buffer.getBuffer<uint8_t>(), memory->data() + 1024);
+    EXPECT_EQ(buffer.getBufferSize(), 1024);
+    EXPECT_EQ(buffer.getReferenceCounter(), 1);
+    EXPECT_EQ(buffer.getBuffer<uint8_t>()[0], static_cast<uint8_t>(1024));
+
+    buffer.setNumberOfTuples(1024);
+    EXPECT_EQ(buffer.getNumberOfTuples(), 1024);
+}
+
+TEST(WrappedMemoryTests, KeepsOwnerAliveUntilLastBufferIsReleased)
+{
+    auto memory = std::make_shared<std::vector<uint8_t>>(4096);
+    const std::weak_ptr<std::vector<uint8_t>> weakMemory = memory;
+
+    auto firstRegion = TupleBuffer::wrapMemory(memory->data(), 2048, memory);
+    auto secondRegion = TupleBuffer::wrapMemory(memory->data() + 2048, 2048, memory);
+    memory.reset();
+    EXPECT_FALSE(weakMemory.expired());
+
+    {
+        const auto copyOfFirstRegion = firstRegion;
+        EXPECT_EQ(firstRegion.getReferenceCounter(), 2);
+        firstRegion.release();
+    }
+    EXPECT_FALSE(weakMemory.expired());
+
+    secondRegion.release();
+    EXPECT_TRUE(weakMemory.expired());
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
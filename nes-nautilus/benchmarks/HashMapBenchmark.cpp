@@ -0,0 +1,131 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark compares the find-or-insert throughput of the ChainedHashMap and the OpenAddressingHashMap, as done by the aggregation
+/// and hash join build. The first argument is the number of distinct keys, the second the number of buckets the hash map is created with,
+/// which is the number_of_partitions of the QueryExecutionConfiguration. Each iteration processes a stream of 1M uniformly distributed keys.
+/// As in the compiled code, the keys are compared after the hash. We emulate this by comparing a key stored directly behind the entry.
+
+namespace
+{
+using Hash = NES::Nautilus::Interface::HashFunction::HashValue::raw_type;
+constexpr size_t NUMBER_OF_RECORDS = 1000 * 1000;
+constexpr uint64_t KEY_SIZE = sizeof(uint64_t);
+constexpr uint64_t VALUE_SIZE = sizeof(uint64_t);
+constexpr uint64_t PAGE_SIZE = 4096;
+
+std::vector<uint64_t> createKeys(const uint64_t numberOfDistinctKeys)
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<uint64_t> distribution(0, numberOfDistinctKeys - 1);
+    std::vector<uint64_t> keys(NUMBER_OF_RECORDS);
+    for (auto& key : keys)
+    {
+        key = distribution(random);
+    }
+    return keys;
+}
+
+Hash hashKey(const uint64_t key)
+{
+    /// Finalizer of MurMur3, as the keys are consecutive
+    auto hash = key;
+    hash ^= hash >> 33U;
+    hash *= 0xff51afd7ed558ccdUL;
+    hash ^= hash >> 33U;
+    hash *= 0xc4ceb3fe1a85ec53UL;
+    hash ^= hash >> 33U;
+    return hash;
+}
+
+uint64_t* getKey(NES::Nautilus::Interface::ChainedHashMapEntry* entry)
+{
+    return reinterpret_cast<uint64_t*>(entry + 1);
+}
+}
+
+static void BM_ChainedHashMap(benchmark::State& state)
+{
+    const auto keys = createKeys(state.range(0));
+    const auto bufferManager = NES::BufferManager::create();
+    for (auto _ : state)
+    {
+        NES::Nautilus::Interface::ChainedHashMap hashMap(KEY_SIZE, VALUE_SIZE, state.range(1), PAGE_SIZE);
+        for (const auto key : keys)
+        {
+            const auto hash = hashKey(key);
+            auto* entry = hashMap.getNumberOfTuples() == 0 ? nullptr : hashMap.findChain(hash);
+            while (entry != nullptr and (entry->hash != hash or *getKey(entry) != key))
+            {
+                entry = entry->next;
+            }
+            if (entry == nullptr)
+            {
+                entry = dynamic_cast<NES::Nautilus::Interface::ChainedHashMapEntry*>(hashMap.insertEntry(hash, bufferManager.get()));
+                *getKey(entry) = key;
+            }
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUMBER_OF_RECORDS);
+}
+
+static void BM_OpenAddressingHashMap(benchmark::State& state)
+{
+    using NES::Nautilus::Interface::OpenAddressingHashMap;
+    const auto keys = createKeys(state.range(0));
+    const auto bufferManager = NES::BufferManager::create();
+    for (auto _ : state)
+    {
+        OpenAddressingHashMap hashMap(KEY_SIZE, VALUE_SIZE, state.range(1), PAGE_SIZE);
+        for (const auto key : keys)
+        {
+            const auto hash = hashKey(key);
+            NES::Nautilus::Interface::ChainedHashMapEntry* entry = nullptr;
+            for (auto probeOffset = hashMap.findNextMatch(hash, 0); probeOffset != OpenAddressingHashMap::NO_MATCH;
+                 probeOffset = hashMap.findNextMatch(hash, probeOffset + 1))
+            {
+                if (auto* candidate = hashMap.getEntry(hash, probeOffset); *getKey(candidate) == key)
+                {
+                    entry = candidate;
+                    break;
+                }
+            }
+            if (entry == nullptr)
+            {
+                entry = dynamic_cast<NES::Nautilus::Interface::ChainedHashMapEntry*>(hashMap.insertEntry(hash, bufferManager.get()));
+                *getKey(entry) = key;
+            }
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUMBER_OF_RECORDS);
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_ChainedHashMap)->ArgsProduct({{10, 1000, 100000, 1000000}, {100, 1000000}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OpenAddressingHashMap)->ArgsProduct({{10, 1000, 100000, 1000000}, {100, 1000000}})->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -21,6 +21,7 @@
 #include <DataTypes/Schema.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <val_concepts.hpp>
@@ -55,12 +56,12 @@ public:
     [[nodiscard]] Record readRecord(const nautilus::val<ChainedHashMapEntry*>& entryRef) const;
     void writeRecord(
         const nautilus::val<ChainedHashMapEntry*>& entryRef,
-        const nautilus::val<ChainedHashMap*>& hashMapRef,
+        const nautilus::val<HashMap*>& hashMapRef,
         const nautilus::val<AbstractBufferProvider*>& bufferProvider,
         const Record& record) const;
     void writeEntryRef(
         const nautilus::val<ChainedHashMapEntry*>& entryRef,
-        const nautilus::val<ChainedHashMap*>& hashMapRef,
+        const nautilus::val<HashMap*>& hashMapRef,
         const nautilus::val<AbstractBufferProvider*>& bufferProvider,
         const nautilus::val<ChainedHashMapEntry*>& otherEntryRef) const;
 
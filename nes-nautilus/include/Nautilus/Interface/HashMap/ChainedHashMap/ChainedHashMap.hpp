@@ -49,8 +49,9 @@ public:
 /// The HashMap is distinguishing two memory areas:
 ///
 /// Entry Space:
-/// The entry space is fixed size and contains pointers into the storage space. The entry space operates as a starting point for each chain.
-/// This means that the entry space can be thought of buckets in a hash table.
+/// The entry space contains pointers into the storage space. The entry space operates as a starting point for each chain.
+/// This means that the entry space can be thought of buckets in a hash table. Once the number of entries exceeds the load factor, we double
+/// the number of chains and rebuild the chains. As the entries are not moved, pointers to entries stay valid across a resize.
 ///
 /// Storage Space:
 /// The storage space contains individual key-value pairs. It does not support variable length keys or values for now.
@@ -66,9 +67,10 @@ public:
     ChainedHashMap(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize);
     ~ChainedHashMap() override;
     [[nodiscard]] ChainedHashMapEntry* findChain(HashFunction::HashValue::raw_type hash) const;
-    int8_t* allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, size_t neededSize);
+    int8_t* allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, size_t neededSize) override;
     AbstractHashMapEntry* insertEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider) override;
     [[nodiscard]] uint64_t getNumberOfTuples() const override;
+    [[nodiscard]] ChainedHashMapEntry* getEntry(uint64_t tupleIndex) const override;
     [[nodiscard]] const ChainedHashMapEntry* getPage(uint64_t pageIndex) const;
     [[nodiscard]] ChainedHashMapEntry* getStartOfChain(uint64_t entryIdx) const;
     [[nodiscard]] uint64_t getNumberOfChains() const;
@@ -80,20 +82,28 @@ public:
     /// might allocate its own memory. Thus, the destructor of the value type should be called to release the memory.
     void setDestructorCallback(const std::function<void(ChainedHashMapEntry*)>& callback);
 
-    /// Creates a new chained hash map with the same configuration, i.e., pageSize, entrySize, entriesPerPage and numberOfChains
+    /// Creates a new chained hash map with the same configuration, i.e., pageSize, entrySize, entriesPerPage and numberOfBuckets.
+    /// The new map starts with the configured number of buckets and not with the number of chains the other map has grown to.
     static std::unique_ptr<ChainedHashMap> createNewMapWithSameConfiguration(const ChainedHashMap& other);
 
 private:
     friend class ChainedHashMapRef;
 
+    /// Allocates and zeroes a new entry space with newNumberOfChains chains and replaces the current one
+    void allocateEntrySpace(uint64_t newNumberOfChains, AbstractBufferProvider* bufferProvider);
+
+    /// Replaces the entry space with one of newNumberOfChains chains and rehashes all entries into the new chains
+    void resize(uint64_t newNumberOfChains, AbstractBufferProvider* bufferProvider);
+
     TupleBuffer entrySpace;
     std::vector<TupleBuffer> storageSpace;
     std::vector<TupleBuffer> varSizedSpace;
     uint64_t numberOfTuples; /// Number of entries in the hash map
+    uint64_t numberOfBuckets; /// Number of buckets the hash map has been created with
     uint64_t pageSize; /// Size of one storage page in bytes
     uint64_t entrySize; /// Size of one entry: sizeof(ChainedHashMapEntry) + keySize + valueSize
     uint64_t entriesPerPage; /// Number of entries per page
-    uint64_t numberOfChains; /// Number of buckets in the hash map
+    uint64_t numberOfChains; /// Number of buckets in the hash map, grows with the number of entries
     ChainedHashMapEntry** entries; /// Stores the pointers to the first entry in each chain
     HashFunction::HashValue::raw_type mask; /// Mask to calculate the bucket position from the hash value. Always a (power of 2)-1
     std::function<void(ChainedHashMapEntry*)> destructorCallBack; /// Callback function to be executed, once the destructor is called
@@ -54,13 +54,13 @@ public:
         [[nodiscard]] nautilus::val<ChainedHashMapEntry*> getNext() const;
         ChainedEntryRef(
             const nautilus::val<ChainedHashMapEntry*>& entryRef,
-            const nautilus::val<ChainedHashMap*>& hashMapRef,
+            const nautilus::val<HashMap*>& hashMapRef,
             std::vector<MemoryProvider::FieldOffsets> fieldsKey,
             std::vector<MemoryProvider::FieldOffsets> fieldsValue);
 
         ChainedEntryRef(
             const nautilus::val<ChainedHashMapEntry*>& entryRef,
-            const nautilus::val<ChainedHashMap*>& hashMapRef,
+            const nautilus::val<HashMap*>& hashMapRef,
             MemoryProvider::ChainedEntryMemoryProvider memoryProviderKeys,
             MemoryProvider::ChainedEntryMemoryProvider memoryProviderValues);
 
@@ -71,7 +71,7 @@ public:
 
 
         nautilus::val<ChainedHashMapEntry*> entryRef;
-        nautilus::val<ChainedHashMap*> hashMapRef;
+        nautilus::val<HashMap*> hashMapRef;
         MemoryProvider::ChainedEntryMemoryProvider memoryProviderKeys;
         MemoryProvider::ChainedEntryMemoryProvider memoryProviderValues;
     };
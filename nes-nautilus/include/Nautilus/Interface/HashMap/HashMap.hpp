@@ -13,6 +13,7 @@
 */
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -20,6 +21,15 @@
 namespace NES::Nautilus::Interface
 {
 
+/// Selects the hash map implementation that hash map based operators, e.g., the aggregation and the hash join, use for their state.
+enum class HashMapType : uint8_t
+{
+    /// Buckets point to a chain of entries, see ChainedHashMap
+    CHAINED,
+    /// Buckets are probed linearly via SIMD-compared tags, see OpenAddressingHashMap
+    OPEN_ADDRESSING
+};
+
 class AbstractHashMapEntry
 {
 public:
@@ -32,5 +42,11 @@ public:
     virtual ~HashMap() = default;
     virtual AbstractHashMapEntry* insertEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider) = 0;
     [[nodiscard]] virtual uint64_t getNumberOfTuples() const = 0;
+
+    /// Returns the tupleIndex-th inserted entry. This allows iterating over all entries outside of the compiled code.
+    [[nodiscard]] virtual AbstractHashMapEntry* getEntry(uint64_t tupleIndex) const = 0;
+
+    /// Allocates memory for variable sized keys or values that lives as long as the hash map
+    virtual int8_t* allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, size_t neededSize) = 0;
 };
 }
@@ -0,0 +1,111 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// Implementation of a single thread open-addressing HashMap that follows the design of Swiss tables, c.f.,
+/// https://abseil.io/about/design/swisstables.
+/// To operate on the hash-map, {@refitem OpenAddressingHashMapRef.hpp} provides a Nautilus wrapper.
+///
+/// The HashMap is distinguishing two memory areas:
+///
+/// Slot Space:
+/// An array of one control byte per slot and an array of entry pointers per slot. A control byte is either EMPTY or stores a 7-bit tag
+/// of the hash of the entry in this slot. A lookup starts at the slot given by the upper bits of the hash and compares GROUP_SIZE
+/// control bytes at once against the tag via SIMD instructions. Only entries with a matching tag have to be compared key by key.
+/// The lookup stops at the first EMPTY control byte. As we never delete single entries, there are no tombstones.
+/// Once the load factor exceeds MAX_LOAD_FACTOR, the slot space is doubled and all entries are reinserted via their stored hash.
+///
+/// Storage Space:
+/// The storage space contains individual key-value pairs in pages, as in the ChainedHashMap. Entries never move, even if the slot space
+/// grows. Entries use the layout of the ChainedHashMapEntry, with next always being nullptr. Thus, the keys and values can be read and
+/// written via the same ChainedEntryMemoryProvider and field offsets, regardless of the hash map type.
+///
+/// IMPORTANT:
+/// 1. This hash map is *NOT* thread save and allows for no concurrent accesses, as it does not use any locking, atomics or synchronization primitives.
+/// 2. This hash map does not clear the content of the entry. So it is up to the user to initialize values correctly.
+class OpenAddressingHashMap final : public HashMap
+{
+public:
+    /// Number of control bytes that are compared at once
+    static constexpr uint64_t GROUP_SIZE = 16;
+    static constexpr int8_t EMPTY = std::numeric_limits<int8_t>::min();
+    static constexpr uint64_t NO_MATCH = std::numeric_limits<uint64_t>::max();
+    static constexpr double MAX_LOAD_FACTOR = 0.875;
+
+    OpenAddressingHashMap(uint64_t entrySize, uint64_t numberOfBuckets, uint64_t pageSize);
+    OpenAddressingHashMap(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize);
+    ~OpenAddressingHashMap() override;
+
+    /// Returns the probe offset of the first slot at or after probeOffset in the probe sequence of the hash that has a matching tag.
+    /// Returns NO_MATCH, if an EMPTY slot is reached before, i.e., no further entry can belong to the hash.
+    [[nodiscard]] uint64_t findNextMatch(HashFunction::HashValue::raw_type hash, uint64_t probeOffset) const;
+    /// Returns the entry stored in the slot at probeOffset in the probe sequence of the hash
+    [[nodiscard]] ChainedHashMapEntry* getEntry(HashFunction::HashValue::raw_type hash, uint64_t probeOffset) const;
+    /// Returns the tupleIndex-th inserted entry. This allows iterating over all entries without looking at the slot space.
+    [[nodiscard]] ChainedHashMapEntry* getEntry(uint64_t tupleIndex) const override;
+
+    int8_t* allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, size_t neededSize) override;
+    AbstractHashMapEntry* insertEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider) override;
+    [[nodiscard]] uint64_t getNumberOfTuples() const override;
+    [[nodiscard]] uint64_t getCapacity() const;
+
+    /// Clears and deletes all entries in the hash map. It also releases the memory of any allocated buffers or other memory.
+    void clear() noexcept;
+
+    /// The passed method is being executed, once the destructor is called. This is necessary as the value type of this hash map
+    /// might allocate its own memory. Thus, the destructor of the value type should be called to release the memory.
+    void setDestructorCallback(const std::function<void(ChainedHashMapEntry*)>& callback);
+
+    /// Creates a new open-addressing hash map with the same configuration, i.e., pageSize, entrySize and initial capacity
+    static std::unique_ptr<OpenAddressingHashMap> createNewMapWithSameConfiguration(const OpenAddressingHashMap& other);
+
+private:
+    /// Allocates a slot space for newCapacity slots and reinserts all entries
+    void resize(uint64_t newCapacity, AbstractBufferProvider* bufferProvider);
+    /// Stores the entry in the first empty slot of the probe sequence of the hash
+    void insertIntoSlots(ChainedHashMapEntry* entry);
+    void setControlByte(uint64_t slot, int8_t controlByte);
+
+    TupleBuffer slotSpace;
+    std::vector<TupleBuffer> storageSpace;
+    std::vector<TupleBuffer> varSizedSpace;
+    uint64_t numberOfTuples; /// Number of entries in the hash map
+    uint64_t pageSize; /// Size of one storage page in bytes
+    uint64_t entrySize; /// Size of one entry: sizeof(ChainedHashMapEntry) + keySize + valueSize
+    uint64_t entriesPerPage; /// Number of entries per page
+    uint64_t initialCapacity; /// Number of slots that are allocated for the first insert
+    uint64_t capacity; /// Current number of slots. Always a power of 2 and at least GROUP_SIZE
+    uint64_t mask; /// Mask to calculate the slot position from the hash value. Always capacity - 1
+    uint64_t growthThreshold; /// Number of tuples after which the slot space is doubled
+    int8_t* controlBytes; /// capacity + GROUP_SIZE control bytes, the last GROUP_SIZE mirror the first ones for unaligned group loads
+    ChainedHashMapEntry** slots; /// Stores the pointer to the entry of each slot
+    std::function<void(ChainedHashMapEntry*)> destructorCallBack; /// Callback function to be executed, once the destructor is called
+};
+}
@@ -0,0 +1,89 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMapRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// A nautilus wrapper to operate on the open-addressing hash map.
+/// The SIMD comparison of the control bytes happens in the C++ runtime, the key comparison of the candidates is traced.
+/// As the entries share the layout of the ChainedHashMapEntry, the entries are read and written via the ChainedEntryRef.
+class OpenAddressingHashMapRef final : public HashMapRef
+{
+public:
+    using EntryRef = ChainedHashMapRef::ChainedEntryRef;
+
+    /// Iterator for iterating over all entries in the hash map.
+    /// As the entries are stored consecutively in pages, we iterate over the pages and not over the slots.
+    class EntryIterator
+    {
+    public:
+        EntryIterator(const nautilus::val<HashMap*>& hashMapRef, const nautilus::val<uint64_t>& tupleIndex);
+        EntryIterator& operator++();
+        nautilus::val<bool> operator==(const EntryIterator& other) const;
+        nautilus::val<bool> operator!=(const EntryIterator& other) const;
+        nautilus::val<ChainedHashMapEntry*> operator*() const;
+
+    private:
+        nautilus::val<HashMap*> hashMapRef;
+        nautilus::val<uint64_t> tupleIndex;
+    };
+
+    OpenAddressingHashMapRef(
+        const nautilus::val<HashMap*>& hashMapRef,
+        std::vector<MemoryProvider::FieldOffsets> fieldsKey,
+        std::vector<MemoryProvider::FieldOffsets> fieldsValue);
+    OpenAddressingHashMapRef(const OpenAddressingHashMapRef& other);
+    OpenAddressingHashMapRef& operator=(const OpenAddressingHashMapRef& other);
+    ~OpenAddressingHashMapRef() override = default;
+
+    nautilus::val<AbstractHashMapEntry*> findOrCreateEntry(
+        const Record& recordKey,
+        const HashFunction& hashFunction,
+        const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
+        const nautilus::val<AbstractBufferProvider*>& bufferProvider) override;
+    void insertOrUpdateEntry(
+        const nautilus::val<AbstractHashMapEntry*>& otherEntry,
+        const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onUpdate,
+        const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
+        const nautilus::val<AbstractBufferProvider*>& bufferProvider) override;
+    nautilus::val<AbstractHashMapEntry*> findEntry(const nautilus::val<AbstractHashMapEntry*>& otherEntry) override;
+    [[nodiscard]] EntryIterator begin() const;
+    [[nodiscard]] EntryIterator end() const;
+
+private:
+    nautilus::val<ChainedHashMapEntry*>
+    insert(const HashFunction::HashValue& hash, const nautilus::val<AbstractBufferProvider*>& bufferProvider);
+    [[nodiscard]] nautilus::val<bool> compareKeys(const EntryRef& entryRef, const Record& keys) const;
+    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findKey(const Record& recordKey, const HashFunction::HashValue& hash) const;
+
+    std::vector<MemoryProvider::FieldOffsets> fieldKeys;
+    std::vector<MemoryProvider::FieldOffsets> fieldValues;
+};
+}
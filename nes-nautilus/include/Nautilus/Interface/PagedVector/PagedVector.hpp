@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 #include <MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -63,6 +65,16 @@ public:
 
     [[nodiscard]] uint64_t getNumberOfPages() const { return pages.getNumberOfPages(); }
 
+    /// Returns the number of bytes of all pages, including their variable sized data
+    [[nodiscard]] uint64_t getNumberOfBytes() const;
+
+    /// Appends all pages to the spilled state and releases them. Afterward, this PagedVector is empty.
+    void spill(std::vector<std::byte>& spilledState);
+
+    /// Restores the pages at the beginning of the spilled state and advances the spilled state past them.
+    /// Pages that have been appended since spilling stay behind the restored pages.
+    void reload(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider);
+
 private:
     /// Wrapper around a vector of TupleBufferWithCumulativeSum to take care of updating the cumulative sums
     struct PagesWrapper
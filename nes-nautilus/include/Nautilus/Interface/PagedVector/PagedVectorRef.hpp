@@ -54,6 +54,9 @@ public:
 
     [[nodiscard]] PagedVectorRefIter begin(const std::vector<Record::RecordFieldIdentifier>& projections) const;
     [[nodiscard]] PagedVectorRefIter end(const std::vector<Record::RecordFieldIdentifier>& projections) const;
+    /// Returns an iterator pointing to the record at pos. If pos is equal to the number of tuples, it is equal to end().
+    [[nodiscard]] PagedVectorRefIter
+    at(const std::vector<Record::RecordFieldIdentifier>& projections, const nautilus::val<uint64_t>& pos) const;
     nautilus::val<bool> operator==(const PagedVectorRef& other) const;
     [[nodiscard]] nautilus::val<uint64_t> getNumberOfTuples() const;
 
@@ -21,6 +21,7 @@
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <nautilus/val_ptr.hpp>
@@ -106,13 +107,13 @@ Record ChainedEntryMemoryProvider::readRecord(const nautilus::val<ChainedHashMap
 namespace
 {
 void storeVarSized(
-    const nautilus::val<ChainedHashMap*>& hashMapRef,
+    const nautilus::val<HashMap*>& hashMapRef,
     const nautilus::val<AbstractBufferProvider*>& bufferProviderRef,
     const nautilus::val<int8_t*>& memoryAddress,
     const VariableSizedData& variableSizedData)
 {
     nautilus::invoke(
-        +[](ChainedHashMap* hashMap,
+        +[](HashMap* hashMap,
             AbstractBufferProvider* bufferProvider,
             const int8_t** memoryAddressInEntry,
             const int8_t* varSizedData,
@@ -132,7 +133,7 @@ void storeVarSized(
 
 void ChainedEntryMemoryProvider::writeRecord(
     const nautilus::val<ChainedHashMapEntry*>& entryRef,
-    const nautilus::val<ChainedHashMap*>& hashMapRef,
+    const nautilus::val<HashMap*>& hashMapRef,
     const nautilus::val<AbstractBufferProvider*>& bufferProvider,
     const Record& record) const
 {
@@ -156,7 +157,7 @@ void ChainedEntryMemoryProvider::writeRecord(
 
 void ChainedEntryMemoryProvider::writeEntryRef(
     const nautilus::val<ChainedHashMapEntry*>& entryRef,
-    const nautilus::val<ChainedHashMap*>& hashMapRef,
+    const nautilus::val<HashMap*>& hashMapRef,
     const nautilus::val<AbstractBufferProvider*>& bufferProvider,
     const nautilus::val<ChainedHashMapEntry*>& otherEntryRef) const
 {
@@ -55,6 +55,7 @@ uint64_t calcCapacity(const uint64_t numberOfKeys, const double loadFactor)
 
 ChainedHashMap::ChainedHashMap(uint64_t entrySize, const uint64_t numberOfBuckets, uint64_t pageSize)
     : numberOfTuples(0)
+    , numberOfBuckets(numberOfBuckets)
     , pageSize(pageSize)
     , entrySize(entrySize)
     , entriesPerPage(pageSize / entrySize)
@@ -81,6 +82,7 @@ ChainedHashMap::ChainedHashMap(uint64_t entrySize, const uint64_t numberOfBucket
 
 ChainedHashMap::ChainedHashMap(const uint64_t keySize, const uint64_t valueSize, const uint64_t numberOfBuckets, const uint64_t pageSize)
     : numberOfTuples(0)
+    , numberOfBuckets(numberOfBuckets)
     , pageSize(pageSize)
     , entrySize(sizeof(ChainedHashMapEntry) + keySize + valueSize)
     , entriesPerPage(pageSize / entrySize)
@@ -117,7 +119,52 @@ void ChainedHashMap::setDestructorCallback(const std::function<void(ChainedHashM
 
 std::unique_ptr<ChainedHashMap> ChainedHashMap::createNewMapWithSameConfiguration(const ChainedHashMap& other)
 {
-    return std::make_unique<ChainedHashMap>(other.entrySize, other.numberOfChains, other.pageSize);
+    /// We use the configured number of buckets and not the current number of chains, as the new map should grow on its own
+    return std::make_unique<ChainedHashMap>(other.entrySize, other.numberOfBuckets, other.pageSize);
+}
+
+void ChainedHashMap::allocateEntrySpace(const uint64_t newNumberOfChains, AbstractBufferProvider* bufferProvider)
+{
+    /// We add one more entry to the capacity, as we need to have a valid entry for the last entry in the entries array
+    /// We will be using this entry for checking, if we are at the end of our hash map in our EntryIterator
+    const auto totalSpace = (newNumberOfChains + 1) * sizeof(ChainedHashMapEntry*);
+    const auto entryBuffer = bufferProvider->getUnpooledBuffer(totalSpace);
+    if (not entryBuffer)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for ChainedHashMap of size {}", std::to_string(totalSpace));
+    }
+
+    /// The old entry space, if any, gets released here, as no one else holds a reference to it.
+    entrySpace = entryBuffer.value();
+    entries = reinterpret_cast<ChainedHashMapEntry**>(entrySpace.getBuffer());
+    std::memset(static_cast<void*>(entries), 0, entryBuffer->getBufferSize());
+    numberOfChains = newNumberOfChains;
+    mask = numberOfChains - 1;
+
+    /// Pointing the end of the entries to itself
+    entries[numberOfChains] = reinterpret_cast<ChainedHashMapEntry*>(&entries[numberOfChains]);
+}
+
+void ChainedHashMap::resize(const uint64_t newNumberOfChains, AbstractBufferProvider* bufferProvider)
+{
+    PRECONDITION(
+        (newNumberOfChains & (newNumberOfChains - 1)) == 0 and newNumberOfChains > numberOfChains,
+        "New number of chains {} has to be a power of 2 and larger than the current number of chains {}",
+        newNumberOfChains,
+        numberOfChains);
+    allocateEntrySpace(newNumberOfChains, bufferProvider);
+
+    /// The entries stay in their pages, we only rebuild the chains by rewriting the next pointers.
+    /// Thus, all pointers to entries that have been handed out before, e.g., to the compiled code, stay valid.
+    for (uint64_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+    {
+        const auto pageIndex = tupleIdx / entriesPerPage;
+        const auto entryOffsetInBuffer = tupleIdx - (pageIndex * entriesPerPage);
+        auto* const entry = reinterpret_cast<ChainedHashMapEntry*>(storageSpace[pageIndex].getBuffer() + (entryOffsetInBuffer * entrySize));
+        const auto entryPos = entry->hash & mask;
+        entry->next = entries[entryPos];
+        entries[entryPos] = entry;
+    }
 }
 
 ChainedHashMapEntry* ChainedHashMap::findChain(const HashFunction::HashValue::raw_type hash) const
@@ -142,25 +189,26 @@ uint64_t ChainedHashMap::getNumberOfTuples() const
     return numberOfTuples;
 }
 
+ChainedHashMapEntry* ChainedHashMap::getEntry(const uint64_t tupleIndex) const
+{
+    PRECONDITION(tupleIndex < numberOfTuples, "Tuple index {} is greater than the number of tuples {}", tupleIndex, numberOfTuples);
+    const auto pageIndex = tupleIndex / entriesPerPage;
+    const auto entryOffsetInBuffer = tupleIndex - (pageIndex * entriesPerPage);
+    return reinterpret_cast<ChainedHashMapEntry*>(storageSpace[pageIndex].getBuffer() + (entryOffsetInBuffer * entrySize));
+}
+
 AbstractHashMapEntry* ChainedHashMap::insertEntry(const HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider)
 {
     /// 0. Checking, if we have to set fill the entry space. This should be only done once, i.e., when the entries are still null
     if (entries == nullptr)
     {
-        /// We add one more entry to the capacity, as we need to have a valid entry for the last entry in the entries array
-        /// We will be using this entry for checking, if we are at the end of our hash map in our EntryIterator
-        const auto totalSpace = (numberOfChains + 1) * sizeof(ChainedHashMapEntry*);
-        const auto entryBuffer = bufferProvider->getUnpooledBuffer(totalSpace);
-        if (not entryBuffer)
-        {
-            throw CannotAllocateBuffer("Could not allocate memory for ChainedHashMap of size {}", std::to_string(totalSpace));
-        }
-        entrySpace = entryBuffer.value();
-        entries = reinterpret_cast<ChainedHashMapEntry**>(entrySpace.getBuffer());
-        std::memset(static_cast<void*>(entries), 0, entryBuffer->getBufferSize());
+        allocateEntrySpace(numberOfChains, bufferProvider);
+    }
 
-        /// Pointing the end of the entries to itself
-        entries[numberOfChains] = reinterpret_cast<ChainedHashMapEntry*>(&entries[numberOfChains]);
+    /// If the average chain length exceeds the load factor, we double the number of chains and rehash all entries.
+    if (numberOfTuples >= static_cast<uint64_t>(static_cast<double>(numberOfChains) * assumedLoadFactor))
+    {
+        resize(numberOfChains * 2, bufferProvider);
     }
 
     /// 1. Check if we need to allocate a new page
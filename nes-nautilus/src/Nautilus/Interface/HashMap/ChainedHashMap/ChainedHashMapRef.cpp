@@ -138,7 +138,7 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::ChainedEntryRef::getNext(
 
 ChainedHashMapRef::ChainedEntryRef::ChainedEntryRef(
     const nautilus::val<ChainedHashMapEntry*>& entryRef,
-    const nautilus::val<ChainedHashMap*>& hashMapRef,
+    const nautilus::val<HashMap*>& hashMapRef,
     std::vector<MemoryProvider::FieldOffsets> fieldsKey,
     std::vector<MemoryProvider::FieldOffsets> fieldsValue)
     : entryRef(entryRef), hashMapRef(hashMapRef), memoryProviderKeys(std::move(fieldsKey)), memoryProviderValues(std::move(fieldsValue))
@@ -147,7 +147,7 @@ ChainedHashMapRef::ChainedEntryRef::ChainedEntryRef(
 
 ChainedHashMapRef::ChainedEntryRef::ChainedEntryRef(
     const nautilus::val<ChainedHashMapEntry*>& entryRef,
-    const nautilus::val<ChainedHashMap*>& hashMapRef,
+    const nautilus::val<HashMap*>& hashMapRef,
     MemoryProvider::ChainedEntryMemoryProvider memoryProviderKeys,
     MemoryProvider::ChainedEntryMemoryProvider memoryProviderValues)
     : entryRef(entryRef)
@@ -278,6 +278,8 @@ ChainedHashMapRef::EntryIterator ChainedHashMapRef::end() const
 
 nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findChain(const HashFunction::HashValue& hash) const
 {
+    /// We must not trace the entry space or the mask as constants, as the hash map replaces both once it grows.
+    /// Thus, we read them for every lookup from the hash map.
     return invoke(
         +[](HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue)
         {
@@ -0,0 +1,322 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace NES::Nautilus::Interface
+{
+namespace
+{
+/// The lower 7 bits of the hash are stored as the tag in the control byte, the remaining bits select the first slot of the probe sequence
+constexpr uint64_t TAG_BITS = 7;
+constexpr uint64_t TAG_MASK = (1UL << TAG_BITS) - 1;
+
+int8_t getTag(const HashFunction::HashValue::raw_type hash)
+{
+    return static_cast<int8_t>(hash & TAG_MASK);
+}
+
+uint64_t getHomeSlot(const HashFunction::HashValue::raw_type hash)
+{
+    return hash >> TAG_BITS;
+}
+
+/// Bitmasks over the GROUP_SIZE control bytes of a group. Bit i is set, if the i-th control byte matches the tag or is EMPTY.
+struct GroupMatch
+{
+    uint32_t matchingTags;
+    uint32_t emptySlots;
+};
+
+GroupMatch matchGroup(const int8_t* group, const int8_t tag)
+{
+    static_assert(OpenAddressingHashMap::GROUP_SIZE == 16, "The SIMD match expects groups of 16 control bytes");
+#if defined(__SSE2__)
+    const auto controlBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    const auto matchingTags = _mm_movemask_epi8(_mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(tag)));
+    const auto emptySlots = _mm_movemask_epi8(_mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(OpenAddressingHashMap::EMPTY)));
+    return {.matchingTags = static_cast<uint32_t>(matchingTags), .emptySlots = static_cast<uint32_t>(emptySlots)};
+#else
+    /// Scalar fallback, e.g., for ARM. Compilers auto-vectorize this loop for most targets.
+    GroupMatch result{.matchingTags = 0, .emptySlots = 0};
+    for (uint64_t i = 0; i < OpenAddressingHashMap::GROUP_SIZE; ++i)
+    {
+        result.matchingTags |= static_cast<uint32_t>(group[i] == tag) << i;
+        result.emptySlots |= static_cast<uint32_t>(group[i] == OpenAddressingHashMap::EMPTY) << i;
+    }
+    return result;
+#endif
+}
+
+/// Calculates the number of slots so that the expected number of keys stays below the maximum load factor
+uint64_t calcNumberOfSlots(const uint64_t numberOfKeys)
+{
+    PRECONDITION(numberOfKeys > 0, "Number of keys {} has to be greater than 0", numberOfKeys);
+    const auto neededSlots = static_cast<uint64_t>(static_cast<double>(numberOfKeys) / OpenAddressingHashMap::MAX_LOAD_FACTOR) + 1;
+    return std::max(OpenAddressingHashMap::GROUP_SIZE, std::bit_ceil(neededSlots));
+}
+}
+
+OpenAddressingHashMap::OpenAddressingHashMap(const uint64_t entrySize, const uint64_t numberOfBuckets, const uint64_t pageSize)
+    : numberOfTuples(0)
+    , pageSize(pageSize)
+    , entrySize(entrySize)
+    , entriesPerPage(pageSize / entrySize)
+    , initialCapacity(calcNumberOfSlots(numberOfBuckets))
+    , capacity(0)
+    , mask(0)
+    , growthThreshold(0)
+    , controlBytes(nullptr)
+    , slots(nullptr)
+    , destructorCallBack(nullptr)
+{
+    PRECONDITION(entrySize > 0, "Entry size has to be greater than 0. Entry size is set to small for entry size {}", entrySize);
+    PRECONDITION(
+        entriesPerPage > 0,
+        "At least one entry has to fit on a page. Pagesize is set to small for pageSize {} and entry size {}",
+        pageSize,
+        entrySize);
+}
+
+OpenAddressingHashMap::OpenAddressingHashMap(
+    const uint64_t keySize, const uint64_t valueSize, const uint64_t numberOfBuckets, const uint64_t pageSize)
+    : OpenAddressingHashMap(sizeof(ChainedHashMapEntry) + keySize + valueSize, numberOfBuckets, pageSize)
+{
+}
+
+OpenAddressingHashMap::~OpenAddressingHashMap()
+{
+    clear();
+}
+
+void OpenAddressingHashMap::setDestructorCallback(const std::function<void(ChainedHashMapEntry*)>& callback)
+{
+    destructorCallBack = callback;
+}
+
+std::unique_ptr<OpenAddressingHashMap> OpenAddressingHashMap::createNewMapWithSameConfiguration(const OpenAddressingHashMap& other)
+{
+    auto newMap = std::make_unique<OpenAddressingHashMap>(other.entrySize, 1, other.pageSize);
+    newMap->initialCapacity = other.initialCapacity;
+    return newMap;
+}
+
+uint64_t OpenAddressingHashMap::findNextMatch(const HashFunction::HashValue::raw_type hash, uint64_t probeOffset) const
+{
+    if (numberOfTuples == 0)
+    {
+        return NO_MATCH;
+    }
+
+    /// As the load factor is below one, each probe sequence reaches an EMPTY slot eventually
+    const auto tag = getTag(hash);
+    const auto homeSlot = getHomeSlot(hash);
+    while (true)
+    {
+        const auto [matchingTags, emptySlots] = matchGroup(controlBytes + ((homeSlot + probeOffset) & mask), tag);
+
+        /// Tags behind the first EMPTY slot belong to other probe sequences
+        const auto firstEmptySlot = emptySlots == 0 ? GROUP_SIZE : static_cast<uint64_t>(std::countr_zero(emptySlots));
+        if (const auto candidates = matchingTags & ((1U << firstEmptySlot) - 1); candidates != 0)
+        {
+            return probeOffset + std::countr_zero(candidates);
+        }
+        if (emptySlots != 0)
+        {
+            return NO_MATCH;
+        }
+        probeOffset += GROUP_SIZE;
+    }
+}
+
+ChainedHashMapEntry* OpenAddressingHashMap::getEntry(const HashFunction::HashValue::raw_type hash, const uint64_t probeOffset) const
+{
+    const auto slot = (getHomeSlot(hash) + probeOffset) & mask;
+    INVARIANT(controlBytes[slot] != EMPTY, "Slot {} for probe offset {} is empty", slot, probeOffset);
+    return slots[slot];
+}
+
+ChainedHashMapEntry* OpenAddressingHashMap::getEntry(const uint64_t tupleIndex) const
+{
+    PRECONDITION(tupleIndex < numberOfTuples, "Tuple index {} is greater than the number of tuples {}", tupleIndex, numberOfTuples);
+    const auto pageIndex = tupleIndex / entriesPerPage;
+    const auto entryOffsetInBuffer = tupleIndex - (pageIndex * entriesPerPage);
+    return reinterpret_cast<ChainedHashMapEntry*>(storageSpace[pageIndex].getBuffer() + (entryOffsetInBuffer * entrySize));
+}
+
+int8_t* OpenAddressingHashMap::allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, const size_t neededSize)
+{
+    auto varSizedBuffer = bufferProvider->getUnpooledBuffer(neededSize);
+    if (not varSizedBuffer)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for OpenAddressingHashMap of size {}", std::to_string(neededSize));
+    }
+    varSizedSpace.emplace_back(varSizedBuffer.value());
+    return varSizedBuffer.value().getBuffer<int8_t>();
+}
+
+uint64_t OpenAddressingHashMap::getNumberOfTuples() const
+{
+    return numberOfTuples;
+}
+
+uint64_t OpenAddressingHashMap::getCapacity() const
+{
+    return capacity;
+}
+
+void OpenAddressingHashMap::setControlByte(const uint64_t slot, const int8_t controlByte)
+{
+    controlBytes[slot] = controlByte;
+    if (slot < GROUP_SIZE)
+    {
+        /// Keeping the mirrored control bytes in sync so that a group starting at the end of the slot space wraps around
+        controlBytes[capacity + slot] = controlByte;
+    }
+}
+
+void OpenAddressingHashMap::insertIntoSlots(ChainedHashMapEntry* entry)
+{
+    const auto homeSlot = getHomeSlot(entry->hash);
+    for (uint64_t probeOffset = 0;; probeOffset += GROUP_SIZE)
+    {
+        const auto [_, emptySlots] = matchGroup(controlBytes + ((homeSlot + probeOffset) & mask), EMPTY);
+        if (emptySlots != 0)
+        {
+            const auto slot = (homeSlot + probeOffset + std::countr_zero(emptySlots)) & mask;
+            setControlByte(slot, getTag(entry->hash));
+            slots[slot] = entry;
+            return;
+        }
+    }
+}
+
+void OpenAddressingHashMap::resize(const uint64_t newCapacity, AbstractBufferProvider* bufferProvider)
+{
+    PRECONDITION(
+        newCapacity >= GROUP_SIZE and std::has_single_bit(newCapacity),
+        "Capacity {} has to be a power of 2 and at least {}",
+        newCapacity,
+        GROUP_SIZE);
+
+    /// The entry pointers come first to keep them aligned, followed by the control bytes
+    const auto totalSpace = (newCapacity * sizeof(ChainedHashMapEntry*)) + newCapacity + GROUP_SIZE;
+    auto newSlotSpace = bufferProvider->getUnpooledBuffer(totalSpace);
+    if (not newSlotSpace)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for OpenAddressingHashMap of size {}", std::to_string(totalSpace));
+    }
+    slotSpace = newSlotSpace.value();
+    slots = reinterpret_cast<ChainedHashMapEntry**>(slotSpace.getBuffer());
+    controlBytes = reinterpret_cast<int8_t*>(slotSpace.getBuffer() + (newCapacity * sizeof(ChainedHashMapEntry*)));
+    std::memset(controlBytes, EMPTY, newCapacity + GROUP_SIZE);
+    capacity = newCapacity;
+    mask = newCapacity - 1;
+    growthThreshold = static_cast<uint64_t>(static_cast<double>(newCapacity) * MAX_LOAD_FACTOR);
+
+    /// Entries stay in their pages, we only have to reinsert the pointers into the new slot space
+    for (uint64_t tupleIndex = 0; tupleIndex < numberOfTuples; ++tupleIndex)
+    {
+        insertIntoSlots(getEntry(tupleIndex));
+    }
+}
+
+AbstractHashMapEntry*
+OpenAddressingHashMap::insertEntry(const HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider)
+{
+    /// 0. Allocating the slot space on the first insert or growing it, if the next insert exceeds the maximum load factor
+    if (controlBytes == nullptr)
+    {
+        resize(initialCapacity, bufferProvider);
+    }
+    else if (numberOfTuples + 1 > growthThreshold)
+    {
+        resize(capacity * 2, bufferProvider);
+    }
+
+    /// 1. Check if we need to allocate a new page
+    if (numberOfTuples % entriesPerPage == 0)
+    {
+        auto newPage = bufferProvider->getUnpooledBuffer(pageSize);
+        if (not newPage)
+        {
+            throw CannotAllocateBuffer(
+                "Could not allocate memory for new page in OpenAddressingHashMap of size {}", std::to_string(pageSize));
+        }
+        std::memset(newPage.value().getBuffer(), 0, pageSize);
+        storageSpace.emplace_back(newPage.value());
+    }
+
+    /// 2. Creating the new entry at the end of the last page
+    const auto pageIndex = numberOfTuples / entriesPerPage;
+    INVARIANT(
+        storageSpace.size() > pageIndex,
+        "Invalid page index {} as it is greater than the number of pages {}",
+        pageIndex,
+        storageSpace.size());
+    auto* page = storageSpace[pageIndex].getBuffer();
+    const auto entryOffsetInBuffer = numberOfTuples - (pageIndex * entriesPerPage);
+    auto* const newEntry = reinterpret_cast<ChainedHashMapEntry*>(page + (entryOffsetInBuffer * entrySize));
+    new (newEntry) ChainedHashMapEntry(hash);
+
+    /// 3. Storing the entry in the first empty slot of its probe sequence and updating the current size
+    insertIntoSlots(newEntry);
+    this->numberOfTuples++;
+    return newEntry;
+}
+
+void OpenAddressingHashMap::clear() noexcept
+{
+    /// Calling for every value in the hash map the destructor callback. As all entries are stored consecutively in the pages,
+    /// we do not have to look at the slot space.
+    if (destructorCallBack != nullptr)
+    {
+        for (uint64_t tupleIndex = 0; tupleIndex < numberOfTuples; ++tupleIndex)
+        {
+            destructorCallBack(getEntry(tupleIndex));
+        }
+    }
+    numberOfTuples = 0;
+    capacity = 0;
+    mask = 0;
+    growthThreshold = 0;
+    controlBytes = nullptr;
+    slots = nullptr;
+
+    /// Releasing all memory
+    slotSpace = TupleBuffer();
+    storageSpace.clear();
+    varSizedSpace.clear();
+}
+
+}
@@ -0,0 +1,228 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMapRef.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <nautilus/function.hpp>
+#include <nautilus/static.hpp>
+#include <nautilus/val.hpp>
+#include <nautilus/val_ptr.hpp>
+
+namespace NES::Nautilus::Interface
+{
+namespace
+{
+uint64_t findNextMatchProxy(const HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue, const uint64_t probeOffset)
+{
+    return dynamic_cast<const OpenAddressingHashMap*>(hashMap)->findNextMatch(hashValue, probeOffset);
+}
+
+ChainedHashMapEntry* getEntryProxy(const HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue, const uint64_t probeOffset)
+{
+    return dynamic_cast<const OpenAddressingHashMap*>(hashMap)->getEntry(hashValue, probeOffset);
+}
+}
+
+nautilus::val<ChainedHashMapEntry*> OpenAddressingHashMapRef::findKey(const Record& recordKey, const HashFunction::HashValue& hash) const
+{
+    /// Only slots whose tag matches the hash are candidates, we compare the keys of the candidates until we find the key.
+    nautilus::val<uint64_t> probeOffset = nautilus::invoke(findNextMatchProxy, hashMapRef, hash, nautilus::val<uint64_t>(0));
+    while (probeOffset != nautilus::val<uint64_t>(OpenAddressingHashMap::NO_MATCH))
+    {
+        const auto entry = nautilus::invoke(getEntryProxy, hashMapRef, hash, probeOffset);
+        const EntryRef entryRef(entry, hashMapRef, fieldKeys, fieldValues);
+        if (compareKeys(entryRef, recordKey))
+        {
+            return entry;
+        }
+        probeOffset = nautilus::invoke(findNextMatchProxy, hashMapRef, hash, probeOffset + nautilus::val<uint64_t>(1));
+    }
+    return nullptr;
+}
+
+nautilus::val<AbstractHashMapEntry*> OpenAddressingHashMapRef::findEntry(const nautilus::val<AbstractHashMapEntry*>& otherEntry)
+{
+    const auto otherChainedEntry = static_cast<nautilus::val<ChainedHashMapEntry*>>(otherEntry);
+    const EntryRef otherEntryRef{otherChainedEntry, hashMapRef, fieldKeys, fieldValues};
+    const auto entryRef = findKey(otherEntryRef.getKey(), otherEntryRef.getHash());
+    return entryRef;
+}
+
+nautilus::val<AbstractHashMapEntry*> OpenAddressingHashMapRef::findOrCreateEntry(
+    const Record& recordKey,
+    const HashFunction& hashFunction,
+    const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider)
+{
+    /// Calculating the hash value of the keys and finding the entry.
+    /// We can use here a std::vector to store the read VarValues of the keyFunction, as the number of keys does not change between
+    /// tracing and run time of the compiled query
+    std::vector<VarVal> keyValues;
+    for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(fieldKeys))
+    {
+        const auto& keyValue = recordKey.read(fieldIdentifier);
+        keyValues.emplace_back(keyValue);
+    }
+
+    ///  If entry contains nullptr, there does not exist a key with the same values.
+    const auto hashValue = hashFunction.calculate(keyValues);
+    if (const auto entryRef = findKey(recordKey, hashValue))
+    {
+        return static_cast<nautilus::val<AbstractHashMapEntry*>>(entryRef);
+    }
+
+    /// We have not found the entry, so we need to insert a new one and copy the keys into the entry.
+    const auto newEntryRef = EntryRef{insert(hashValue, bufferProvider), hashMapRef, fieldKeys, fieldValues};
+    newEntryRef.copyKeysToEntry(recordKey, bufferProvider);
+
+    /// Calling the onInsert lambda function to insert values or anything else that the user wants.
+    auto castedEntryRef = static_cast<nautilus::val<AbstractHashMapEntry*>>(newEntryRef.entryRef);
+    if (onInsert)
+    {
+        onInsert(castedEntryRef);
+    }
+    return castedEntryRef;
+}
+
+void OpenAddressingHashMapRef::insertOrUpdateEntry(
+    const nautilus::val<AbstractHashMapEntry*>& otherEntry,
+    const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onUpdate,
+    const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider)
+{
+    /// Finding the entry. If entry contains nullptr, there does not exist a key with the same values.
+    const auto otherChainedEntry = static_cast<nautilus::val<ChainedHashMapEntry*>>(otherEntry);
+    const EntryRef otherEntryRef(otherChainedEntry, hashMapRef, fieldKeys, fieldValues);
+    if (const auto entryRef = findKey(otherEntryRef.getKey(), otherEntryRef.getHash()))
+    {
+        auto castedEntry = static_cast<nautilus::val<AbstractHashMapEntry*>>(entryRef);
+        if (onUpdate)
+        {
+            onUpdate(castedEntry);
+        }
+        return;
+    }
+
+    /// We have not found the entry, so we need to insert a new one and copy the keys into the entry.
+    const auto newEntry = insert(otherEntryRef.getHash(), bufferProvider);
+    const EntryRef newEntryRef(newEntry, hashMapRef, fieldKeys, fieldValues);
+    newEntryRef.copyKeysToEntry(otherEntryRef, bufferProvider);
+    if (onInsert)
+    {
+        auto castedEntryRef = static_cast<nautilus::val<AbstractHashMapEntry*>>(newEntryRef.entryRef);
+        onInsert(castedEntryRef);
+    }
+}
+
+OpenAddressingHashMapRef::EntryIterator OpenAddressingHashMapRef::begin() const
+{
+    constexpr uint64_t numberOfTuples = 0;
+    return {hashMapRef, numberOfTuples};
+}
+
+OpenAddressingHashMapRef::EntryIterator OpenAddressingHashMapRef::end() const
+{
+    const auto numberOfTuples = nautilus::invoke(
+        +[](const HashMap* hashMap) -> uint64_t { return hashMap == nullptr ? 0 : hashMap->getNumberOfTuples(); }, hashMapRef);
+    return {hashMapRef, numberOfTuples};
+}
+
+nautilus::val<ChainedHashMapEntry*>
+OpenAddressingHashMapRef::insert(const HashFunction::HashValue& hash, const nautilus::val<AbstractBufferProvider*>& bufferProvider)
+{
+    const auto newEntry = nautilus::invoke(
+        +[](HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue, AbstractBufferProvider* bufferProviderVal)
+        { return dynamic_cast<OpenAddressingHashMap*>(hashMap)->insertEntry(hashValue, bufferProviderVal); },
+        hashMapRef,
+        hash,
+        bufferProvider);
+    return static_cast<nautilus::val<ChainedHashMapEntry*>>(newEntry);
+}
+
+nautilus::val<bool> OpenAddressingHashMapRef::compareKeys(const EntryRef& entryRef, const Record& keys) const
+{
+    nautilus::val<bool> equals = true;
+    for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(fieldKeys))
+    {
+        const auto& key = keys.read(fieldIdentifier);
+        const auto& keyFromEntry = entryRef.getKey(fieldIdentifier);
+        equals = equals && (key == keyFromEntry);
+    }
+    return equals;
+}
+
+OpenAddressingHashMapRef::OpenAddressingHashMapRef(
+    const nautilus::val<HashMap*>& hashMapRef,
+    std::vector<MemoryProvider::FieldOffsets> fieldsKey,
+    std::vector<MemoryProvider::FieldOffsets> fieldsValue)
+    : HashMapRef(hashMapRef), fieldKeys(std::move(fieldsKey)), fieldValues(std::move(fieldsValue))
+{
+}
+
+OpenAddressingHashMapRef::OpenAddressingHashMapRef(const OpenAddressingHashMapRef& other)
+    : OpenAddressingHashMapRef(other.hashMapRef, other.fieldKeys, other.fieldValues)
+{
+}
+
+OpenAddressingHashMapRef& OpenAddressingHashMapRef::operator=(const OpenAddressingHashMapRef& other)
+{
+    hashMapRef = other.hashMapRef;
+    fieldKeys = other.fieldKeys;
+    fieldValues = other.fieldValues;
+    return *this;
+}
+
+OpenAddressingHashMapRef::EntryIterator::EntryIterator(const nautilus::val<HashMap*>& hashMapRef, const nautilus::val<uint64_t>& tupleIndex)
+    : hashMapRef(hashMapRef), tupleIndex(tupleIndex)
+{
+}
+
+OpenAddressingHashMapRef::EntryIterator& OpenAddressingHashMapRef::EntryIterator::operator++()
+{
+    tupleIndex = tupleIndex + nautilus::val<uint64_t>(1);
+    return *this;
+}
+
+nautilus::val<bool> OpenAddressingHashMapRef::EntryIterator::operator==(const EntryIterator& other) const
+{
+    return tupleIndex == other.tupleIndex;
+}
+
+nautilus::val<bool> OpenAddressingHashMapRef::EntryIterator::operator!=(const EntryIterator& other) const
+{
+    return not(*this == other);
+}
+
+nautilus::val<ChainedHashMapEntry*> OpenAddressingHashMapRef::EntryIterator::operator*() const
+{
+    return nautilus::invoke(
+        +[](const HashMap* hashMap, const uint64_t tupleIndexVal)
+        { return dynamic_cast<const OpenAddressingHashMap*>(hashMap)->getEntry(tupleIndexVal); },
+        hashMapRef,
+        tupleIndex);
+}
+
+}
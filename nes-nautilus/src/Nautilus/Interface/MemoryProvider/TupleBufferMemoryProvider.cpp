@@ -19,11 +19,13 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
 #include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <MemoryLayout/RowLayout.hpp>
 #include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
@@ -45,10 +47,13 @@ namespace
 uint32_t storeAssociatedTextValueProxy(
     const TupleBuffer* tupleBuffer, AbstractBufferProvider* bufferProvider, const int8_t* textValue, const uint32_t totalVariableSize)
 {
-    auto buffer = bufferProvider->getUnpooledBuffer(totalVariableSize);
-    INVARIANT(buffer.has_value(), "Cannot allocate unpooled buffer of size {}", totalVariableSize);
-    std::memcpy(buffer.value().getBuffer<int8_t>(), textValue, totalVariableSize);
-    return tupleBuffer->storeChildBuffer(buffer.value());
+    /// The text value starts with its size, which writeVarSizedData writes itself
+    const auto text = std::string_view(
+        reinterpret_cast<const char*>(textValue) + sizeof(uint32_t), ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        totalVariableSize - sizeof(uint32_t));
+    const auto childIndex = writeVarSizedData(*tupleBuffer, text, *bufferProvider);
+    INVARIANT(childIndex.has_value(), "Cannot allocate unpooled buffer of size {}", totalVariableSize);
+    return childIndex.value();
 }
 
 const uint8_t* loadAssociatedTextValue(const TupleBuffer* tupleBuffer, const uint32_t childIndex)
@@ -16,14 +16,18 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <span>
+#include <utility>
 #include <vector>
 #include <MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/SpillStore.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <ErrorHandling.hpp>
 
@@ -106,6 +110,49 @@ std::optional<uint64_t> PagedVector::getBufferPosForEntry(const uint64_t entryPo
         });
 }
 
+uint64_t PagedVector::getNumberOfBytes() const
+{
+    uint64_t numberOfBytes = 0;
+    for (size_t pageIdx = 0; pageIdx < pages.getNumberOfPages(); ++pageIdx)
+    {
+        const auto& page = pages[pageIdx].buffer;
+        numberOfBytes += page.getBufferSize();
+        for (uint32_t childIdx = 0; childIdx < page.getNumberOfChildBuffers(); ++childIdx)
+        {
+            numberOfBytes += page.loadChildBuffer(childIdx).getBufferSize();
+        }
+    }
+    return numberOfBytes;
+}
+
+void PagedVector::spill(std::vector<std::byte>& spilledState)
+{
+    const uint64_t numberOfPages = pages.getNumberOfPages();
+    const auto numberOfPagesBytes = std::as_bytes(std::span{&numberOfPages, 1});
+    spilledState.insert(spilledState.end(), numberOfPagesBytes.begin(), numberOfPagesBytes.end());
+    for (size_t pageIdx = 0; pageIdx < numberOfPages; ++pageIdx)
+    {
+        serializeTupleBuffer(pages[pageIdx].buffer, spilledState);
+    }
+    pages.clearPages();
+}
+
+void PagedVector::reload(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider)
+{
+    PRECONDITION(spilledState.size() >= sizeof(uint64_t), "Spilled state does not contain a PagedVector");
+    uint64_t numberOfPages = 0;
+    std::memcpy(&numberOfPages, spilledState.data(), sizeof(numberOfPages));
+    spilledState = spilledState.subspan(sizeof(numberOfPages));
+
+    PagesWrapper reloadedPages;
+    for (uint64_t pageIdx = 0; pageIdx < numberOfPages; ++pageIdx)
+    {
+        reloadedPages.addPage(deserializeTupleBuffer(spilledState, bufferProvider));
+    }
+    reloadedPages.addPages(pages);
+    pages = std::move(reloadedPages);
+}
+
 uint64_t PagedVector::PagesWrapper::getNumberOfTuplesLastPage() const
 {
     return getLastPage().getNumberOfTuples();
@@ -105,6 +105,22 @@ PagedVectorRefIter PagedVectorRef::end(const std::vector<Record::RecordFieldIden
     return pagedVectorRefIter;
 }
 
+PagedVectorRefIter
+PagedVectorRef::at(const std::vector<Record::RecordFieldIdentifier>& projections, const nautilus::val<uint64_t>& pos) const
+{
+    /// Similar to end(), an iterator at the number of tuples does not point to any existing page
+    const auto numberOfTuplesInPagedVector = invoke(getTotalNumberOfEntriesProxy, pagedVectorRef);
+    nautilus::val<TupleBuffer*> curPage(nullptr);
+    nautilus::val<uint64_t> posOnPage(0);
+    if (pos < numberOfTuplesInPagedVector)
+    {
+        curPage = nautilus::invoke(getTupleBufferForEntryProxy, pagedVectorRef, pos);
+        posOnPage = nautilus::invoke(getBufferPosForEntryProxy, pagedVectorRef, pos);
+    }
+    PagedVectorRefIter pagedVectorRefIter(*this, memoryProvider, projections, curPage, posOnPage, pos, numberOfTuplesInPagedVector);
+    return pagedVectorRefIter;
+}
+
 nautilus::val<bool> PagedVectorRef::operator==(const PagedVectorRef& other) const
 {
     return memoryProvider == other.memoryProvider && pagedVectorRef == other.pagedVectorRef;
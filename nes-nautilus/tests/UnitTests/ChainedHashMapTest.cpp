@@ -120,6 +120,34 @@ TEST_P(ChainedHashMapTest, fixedDataTypesUpdate)
     checkEntryIterator(hashMap, exactMap);
 }
 
+TEST_P(ChainedHashMapTest, fixedDataTypesGrowing)
+{
+    /// Creating the hash map with a single bucket, so that the hash map has to grow multiple times while inserting
+    auto hashMap = ChainedHashMap(keySize, valueSize, 1, params.pageSize);
+    const auto initialNumberOfChains = hashMap.getNumberOfChains();
+
+    /// We are inserting the records and checking that all entries are still found after the chains have been rebuilt.
+    const auto exactMap = createExactMap(ExactMapInsert::INSERT);
+    auto findAndInsert = compileFindAndInsert();
+    for (auto& buffer : inputBuffers)
+    {
+        findAndInsert(std::addressof(buffer), bufferManager.get(), std::addressof(hashMap));
+    }
+
+    /// The average chain length must stay below one, as we double the number of chains once the load factor is exceeded.
+    if (hashMap.getNumberOfTuples() > initialNumberOfChains)
+    {
+        EXPECT_GT(hashMap.getNumberOfChains(), initialNumberOfChains);
+    }
+    EXPECT_LE(hashMap.getNumberOfTuples(), hashMap.getNumberOfChains());
+    checkIfValuesAreCorrectViaFindEntry(hashMap, exactMap);
+    checkEntryIterator(hashMap, exactMap);
+
+    /// A new hash map with the same configuration starts again with the configured number of buckets
+    const auto newHashMap = ChainedHashMap::createNewMapWithSameConfiguration(hashMap);
+    EXPECT_EQ(newHashMap->getNumberOfChains(), initialNumberOfChains);
+}
+
 INSTANTIATE_TEST_CASE_P(
     ChainedHashMapTest,
     ChainedHashMapTest,
@@ -0,0 +1,153 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// Tests the C++ side of the open-addressing hash map, i.e., the slot space, the probing and the growing.
+/// The keys are identified solely by their hash, as the key comparison happens in the traced code of the OpenAddressingHashMapRef.
+class OpenAddressingHashMapTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t KEY_SIZE = 8;
+    static constexpr uint64_t VALUE_SIZE = 8;
+    static constexpr uint64_t PAGE_SIZE = 4096;
+    std::shared_ptr<BufferManager> bufferManager;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("OpenAddressingHashMapTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup OpenAddressingHashMapTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create();
+    }
+
+    static void TearDownTestSuite() { NES_INFO("Tear down OpenAddressingHashMapTest class."); }
+
+    /// Follows the probe sequence of the hash and returns the entry with the same hash or nullptr
+    static ChainedHashMapEntry* findEntry(const OpenAddressingHashMap& hashMap, const HashFunction::HashValue::raw_type hash)
+    {
+        for (auto probeOffset = hashMap.findNextMatch(hash, 0); probeOffset != OpenAddressingHashMap::NO_MATCH;
+             probeOffset = hashMap.findNextMatch(hash, probeOffset + 1))
+        {
+            if (auto* entry = hashMap.getEntry(hash, probeOffset); entry->hash == hash)
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(OpenAddressingHashMapTest, insertAndFindWhileGrowing)
+{
+    constexpr uint64_t numberOfKeys = 10000;
+    constexpr uint64_t expectedNumberOfKeys = 10;
+    OpenAddressingHashMap hashMap(KEY_SIZE, VALUE_SIZE, expectedNumberOfKeys, PAGE_SIZE);
+    ASSERT_EQ(hashMap.getNumberOfTuples(), 0);
+    ASSERT_EQ(findEntry(hashMap, 42), nullptr);
+
+    std::mt19937_64 random(std::random_device{}());
+    std::unordered_set<HashFunction::HashValue::raw_type> hashes;
+    while (hashes.size() < numberOfKeys)
+    {
+        hashes.insert(random());
+    }
+
+    std::vector<ChainedHashMapEntry*> insertedEntries;
+    for (const auto hash : hashes)
+    {
+        insertedEntries.emplace_back(dynamic_cast<ChainedHashMapEntry*>(hashMap.insertEntry(hash, bufferManager.get())));
+        ASSERT_LE(hashMap.getNumberOfTuples(), hashMap.getCapacity() * OpenAddressingHashMap::MAX_LOAD_FACTOR);
+    }
+    EXPECT_EQ(hashMap.getNumberOfTuples(), numberOfKeys);
+    EXPECT_GE(hashMap.getCapacity(), numberOfKeys);
+
+    /// Entries must not move while the slot space grows
+    for (uint64_t tupleIndex = 0; tupleIndex < numberOfKeys; ++tupleIndex)
+    {
+        EXPECT_EQ(hashMap.getEntry(tupleIndex), insertedEntries[tupleIndex]);
+        EXPECT_EQ(findEntry(hashMap, insertedEntries[tupleIndex]->hash), insertedEntries[tupleIndex]);
+    }
+
+    /// Hashes that have not been inserted must not be found
+    for (uint64_t i = 0; i < numberOfKeys; ++i)
+    {
+        if (const auto hash = random(); not hashes.contains(hash))
+        {
+            EXPECT_EQ(findEntry(hashMap, hash), nullptr);
+        }
+    }
+}
+
+TEST_F(OpenAddressingHashMapTest, collidingHashes)
+{
+    /// All hashes share the tag and the first slot of their probe sequence. Thus, every lookup has to skip over the other candidates.
+    constexpr uint64_t numberOfKeys = 200;
+    constexpr uint64_t tag = 0x2A;
+    OpenAddressingHashMap hashMap(KEY_SIZE, VALUE_SIZE, numberOfKeys, PAGE_SIZE);
+    for (uint64_t i = 0; i < numberOfKeys; ++i)
+    {
+        hashMap.insertEntry((i << 48) | tag, bufferManager.get());
+    }
+
+    for (uint64_t i = 0; i < numberOfKeys; ++i)
+    {
+        const auto hash = (i << 48) | tag;
+        const auto* entry = findEntry(hashMap, hash);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry->hash, hash);
+    }
+    EXPECT_EQ(findEntry(hashMap, (numberOfKeys << 48) | tag), nullptr);
+}
+
+TEST_F(OpenAddressingHashMapTest, clearCallsDestructorCallback)
+{
+    constexpr uint64_t numberOfKeys = 1000;
+    uint64_t numberOfDestructedEntries = 0;
+    {
+        OpenAddressingHashMap hashMap(KEY_SIZE, VALUE_SIZE, numberOfKeys, PAGE_SIZE);
+        hashMap.setDestructorCallback([&numberOfDestructedEntries](ChainedHashMapEntry*) { ++numberOfDestructedEntries; });
+        for (uint64_t i = 0; i < numberOfKeys; ++i)
+        {
+            hashMap.insertEntry(i * 0x9E3779B97F4A7C15UL, bufferManager.get());
+        }
+
+        const auto newHashMap = OpenAddressingHashMap::createNewMapWithSameConfiguration(hashMap);
+        EXPECT_EQ(newHashMap->getNumberOfTuples(), 0);
+        EXPECT_EQ(findEntry(*newHashMap, 0), nullptr);
+    }
+    EXPECT_EQ(numberOfDestructedEntries, numberOfKeys);
+}
+
+}
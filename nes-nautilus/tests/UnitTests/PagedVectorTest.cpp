@@ -12,18 +12,25 @@
     limitations under the License.
 */
 
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <random>
+#include <span>
 #include <sstream>
+#include <utility>
 #include <vector>
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/DataTypeProvider.hpp>
 #include <DataTypes/Schema.hpp>
 #include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/ExecutionMode.hpp>
@@ -115,6 +122,33 @@ TEST_P(PagedVectorTest, storeAndRetrieveVarSizeValues)
     TestUtils::runRetrieveTest(pagedVector, testSchema, pageSize, projections, allRecords, *nautilusEngine, *bufferManager);
 }
 
+TEST_P(PagedVectorTest, spillAndReloadVarSizeValues)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}
+                                .addField("value1", DataType::Type::UINT64)
+                                .addField("value2", DataTypeProvider::provideDataType(DataType::Type::VARSIZED));
+    constexpr auto pageSize = PAGE_SIZE;
+    const auto projections = testSchema.getFieldNames();
+    const auto allRecords = createMonotonicallyIncreasingValues(testSchema, numberOfItems, *bufferManager);
+
+    PagedVector pagedVector;
+    TestUtils::runStoreTest(pagedVector, testSchema, pageSize, projections, allRecords, *nautilusEngine, *bufferManager);
+    const auto numberOfPages = pagedVector.getNumberOfPages();
+    EXPECT_GT(pagedVector.getNumberOfBytes(), numberOfPages * pageSize);
+
+    std::vector<std::byte> spilledState;
+    pagedVector.spill(spilledState);
+    EXPECT_EQ(pagedVector.getTotalNumberOfEntries(), 0);
+    EXPECT_EQ(pagedVector.getNumberOfBytes(), 0);
+
+    std::span<const std::byte> remainingState{spilledState};
+    pagedVector.reload(remainingState, *bufferManager);
+    EXPECT_TRUE(remainingState.empty());
+    EXPECT_EQ(pagedVector.getNumberOfPages(), numberOfPages);
+    TestUtils::runRetrieveTest(pagedVector, testSchema, pageSize, projections, allRecords, *nautilusEngine, *bufferManager);
+}
+
 TEST_P(PagedVectorTest, storeAndRetrieveLargeValues)
 {
     bufferManager = BufferManager::create();
@@ -285,6 +319,72 @@ TEST_P(PagedVectorTest, appendAllPagesMultipleVectorsWithDifferentPageSizes)
         projections, testSchema, entrySize, pageSize, allRecords, allRecordsAfterAppendAll, 1, *nautilusEngine, *bufferManager);
 }
 
+TEST_P(PagedVectorTest, iterateOverRangeOfValues)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}
+                                .addField("value1", DataType::Type::UINT64)
+                                .addField("value2", DataType::Type::UINT64)
+                                .addField("value3", DataType::Type::UINT64);
+    constexpr auto pageSize = PAGE_SIZE;
+    const auto projections = testSchema.getFieldNames();
+    const auto allRecords = createMonotonicallyIncreasingValues(testSchema, numberOfItems, *bufferManager);
+    PagedVector pagedVector;
+    TestUtils::runStoreTest(pagedVector, testSchema, pageSize, projections, allRecords, *nautilusEngine, *bufferManager);
+
+    /// Flattening the values of the first field, as the PagedVector stores the records in insertion order
+    std::vector<uint64_t> expectedValues;
+    for (const auto& buffer : allRecords)
+    {
+        for (uint64_t i = 0; i < buffer.getNumberOfTuples(); ++i)
+        {
+            expectedValues.emplace_back(buffer.getBuffer<uint64_t>()[i * projections.size()]);
+        }
+    }
+
+    /// Copies the records in [startPos, endPos) into the output buffer
+    const auto memoryProvider = MemoryProvider::TupleBufferMemoryProvider::create(pageSize, testSchema);
+    const auto memoryProviderOutputBuffer
+        = MemoryProvider::TupleBufferMemoryProvider::create(numberOfItems * testSchema.getSizeOfSchemaInBytes(), testSchema);
+    /// NOLINTBEGIN(performance-unnecessary-value-param)
+    auto readRange = nautilusEngine->registerFunction(std::function(
+        [=](nautilus::val<TupleBuffer*> outputBufferRef,
+            nautilus::val<AbstractBufferProvider*> bufferProviderVal,
+            nautilus::val<PagedVector*> pagedVectorVal,
+            nautilus::val<uint64_t> startPos,
+            nautilus::val<uint64_t> endPos)
+        {
+            RecordBuffer recordBuffer(outputBufferRef);
+            const PagedVectorRef pagedVectorRef(pagedVectorVal, memoryProvider);
+            nautilus::val<uint64_t> numberOfTuples = 0;
+            for (auto it = pagedVectorRef.at(projections, startPos); it != pagedVectorRef.at(projections, endPos); ++it)
+            {
+                auto record = *it;
+                memoryProviderOutputBuffer->writeRecord(numberOfTuples, recordBuffer, record, bufferProviderVal);
+                numberOfTuples = numberOfTuples + 1;
+                recordBuffer.setNumRecords(numberOfTuples);
+            }
+        }));
+    /// NOLINTEND(performance-unnecessary-value-param)
+
+    const std::vector<std::pair<uint64_t, uint64_t>> ranges{
+        {0, numberOfItems},
+        {0, numberOfItems / 3},
+        {numberOfItems / 3, (2 * numberOfItems) / 3},
+        {numberOfItems - 1, numberOfItems},
+        {7, 7}};
+    for (const auto& [startPos, endPos] : ranges)
+    {
+        auto outputBuffer = bufferManager->getUnpooledBuffer(numberOfItems * testSchema.getSizeOfSchemaInBytes()).value();
+        readRange(std::addressof(outputBuffer), bufferManager.get(), std::addressof(pagedVector), startPos, endPos);
+        ASSERT_EQ(outputBuffer.getNumberOfTuples(), endPos - startPos);
+        for (uint64_t i = 0; i < outputBuffer.getNumberOfTuples(); ++i)
+        {
+            EXPECT_EQ(outputBuffer.getBuffer<uint64_t>()[i * projections.size()], expectedValues[startPos + i]);
+        }
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(
     PagedVectorTest,
     PagedVectorTest,
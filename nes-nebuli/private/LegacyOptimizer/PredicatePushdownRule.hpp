@@ -0,0 +1,33 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <Plans/LogicalPlan.hpp>
+
+namespace NES
+{
+
+/// Moves selections towards the sources, so that tuples get dropped before they are joined, unioned, or aggregated.
+/// The predicate of a selection is split into its conjuncts and each conjunct moves down as far as possible:
+/// - below a join into the side that produces all fields the conjunct reads,
+/// - below a union into every child,
+/// - below a windowed aggregation, if the conjunct only reads grouping keys.
+/// Conjuncts that cannot move stay in a selection at the original position. Requires an inferred plan.
+class PredicatePushdownRule
+{
+public:
+    void apply(LogicalPlan& queryPlan) const;
+};
+}
@@ -0,0 +1,30 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <Plans/LogicalPlan.hpp>
+
+namespace NES
+{
+
+/// Determines the fields that the operators of the plan read and places a projection onto those fields directly above each source that
+/// produces more fields than needed. The projection starts the first pipeline after the source, which lets the input formatter skip
+/// parsing the unused fields. Additionally, joins and aggregations store and copy narrower tuples. Requires an inferred plan.
+class ProjectionPushdownRule
+{
+public:
+    void apply(LogicalPlan& queryPlan) const;
+};
+}
@@ -16,6 +16,8 @@
 
 #include <LegacyOptimizer/LogicalSourceExpansionRule.hpp>
 #include <LegacyOptimizer/OriginIdInferencePhase.hpp>
+#include <LegacyOptimizer/PredicatePushdownRule.hpp>
+#include <LegacyOptimizer/ProjectionPushdownRule.hpp>
 #include <LegacyOptimizer/RedundantProjectionRemovalRule.hpp>
 #include <LegacyOptimizer/RedundantUnionRemovalRule.hpp>
 #include <LegacyOptimizer/SinkBindingRule.hpp>
@@ -33,6 +35,8 @@ LogicalPlan LegacyOptimizer::optimize(const LogicalPlan& plan) const
     constexpr auto typeInference = TypeInferencePhase{};
     constexpr auto originIdInferencePhase = OriginIdInferencePhase{};
     constexpr auto redundantUnionRemovalRule = RedundantUnionRemovalRule{};
+    constexpr auto predicatePushdownRule = PredicatePushdownRule{};
+    constexpr auto projectionPushdownRule = ProjectionPushdownRule{};
     constexpr auto redundantProjectionRemovalRule = RedundantProjectionRemovalRule{};
 
     sinkBindingRule.apply(newPlan);
@@ -43,6 +47,13 @@ LogicalPlan LegacyOptimizer::optimize(const LogicalPlan& plan) const
     NES_INFO("After Redundant Union Removal:\n{}", newPlan);
     typeInference.apply(newPlan);
 
+    predicatePushdownRule.apply(newPlan);
+    typeInference.apply(newPlan);
+    NES_INFO("After Predicate Pushdown:\n{}", newPlan);
+    projectionPushdownRule.apply(newPlan);
+    typeInference.apply(newPlan);
+    NES_INFO("After Projection Pushdown:\n{}", newPlan);
+
     redundantProjectionRemovalRule.apply(newPlan);
     NES_INFO("After Redundant Projection Removal:\n{}", newPlan);
 
@@ -0,0 +1,239 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <LegacyOptimizer/PredicatePushdownRule.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/UnionLogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <Traits/Trait.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+std::vector<LogicalFunction> splitConjuncts(const LogicalFunction& predicate)
+{
+    if (not predicate.tryGet<AndLogicalFunction>().has_value())
+    {
+        return {predicate};
+    }
+    std::vector<LogicalFunction> conjuncts;
+    for (const auto& child : predicate.getChildren())
+    {
+        std::ranges::move(splitConjuncts(child), std::back_inserter(conjuncts));
+    }
+    return conjuncts;
+}
+
+LogicalOperator createSelection(const std::vector<LogicalFunction>& conjuncts, const TraitSet& traitSet, const LogicalOperator& child)
+{
+    PRECONDITION(not conjuncts.empty(), "A selection requires at least one conjunct");
+    auto predicate = conjuncts.front();
+    for (const auto& conjunct : conjuncts | std::views::drop(1))
+    {
+        predicate = AndLogicalFunction(predicate, conjunct);
+    }
+    return SelectionLogicalOperator(std::move(predicate)).withTraitSet(traitSet).withChildren({child});
+}
+
+bool readsOnly(const LogicalFunction& conjunct, const auto& isAvailable)
+{
+    return std::ranges::all_of(
+        BFSRange(conjunct),
+        [&isAvailable](const LogicalFunction& function)
+        {
+            const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>();
+            return not fieldAccess.has_value() or isAvailable(fieldAccess->getFieldName());
+        });
+}
+
+std::pair<std::vector<LogicalFunction>, std::vector<LogicalFunction>>
+partitionConjuncts(const std::vector<LogicalFunction>& conjuncts, const auto& isPushable)
+{
+    std::pair<std::vector<LogicalFunction>, std::vector<LogicalFunction>> pushableAndRemaining;
+    for (const auto& conjunct : conjuncts)
+    {
+        (isPushable(conjunct) ? pushableAndRemaining.first : pushableAndRemaining.second).push_back(conjunct);
+    }
+    return pushableAndRemaining;
+}
+
+bool readsOnlyFieldsOf(const LogicalFunction& conjunct, const Schema& schema)
+{
+    return readsOnly(conjunct, [&schema](const std::string& fieldName) { return schema.contains(fieldName); });
+}
+
+std::optional<LogicalOperator>
+pushBelow(const std::vector<LogicalFunction>& conjuncts, const TraitSet& traitSet, const LogicalOperator& child);
+
+/// Returns the subtree that applies the conjuncts to the output of the child, with the conjuncts moved as far down as possible
+LogicalOperator applyConjuncts(const std::vector<LogicalFunction>& conjuncts, const TraitSet& traitSet, const LogicalOperator& child)
+{
+    if (conjuncts.empty())
+    {
+        return child;
+    }
+    if (auto pushed = pushBelow(conjuncts, traitSet, child))
+    {
+        return *pushed;
+    }
+    return createSelection(conjuncts, traitSet, child);
+}
+
+/// Keeps the conjuncts that could not move below the child in a selection on top of it
+LogicalOperator keepAbove(const std::vector<LogicalFunction>& remainingConjuncts, const TraitSet& traitSet, const LogicalOperator& child)
+{
+    if (remainingConjuncts.empty())
+    {
+        return child;
+    }
+    return createSelection(remainingConjuncts, traitSet, child);
+}
+
+/// Returns the child with as many conjuncts as possible applied below it, or nullopt, if no conjunct can move below the child
+std::optional<LogicalOperator>
+pushBelow(const std::vector<LogicalFunction>& conjuncts, const TraitSet& traitSet, const LogicalOperator& child)
+{
+    const auto grandChildren = child.getChildren();
+    if (child.tryGet<SelectionLogicalOperator>().has_value())
+    {
+        INVARIANT(grandChildren.size() == 1, "Selection operator must have exactly one child");
+        if (auto pushed = pushBelow(conjuncts, traitSet, grandChildren.front()))
+        {
+            return child.withChildren({*pushed});
+        }
+        return std::nullopt;
+    }
+
+    if (child.tryGet<JoinLogicalOperator>().has_value())
+    {
+        INVARIANT(grandChildren.size() == 2, "Join operator must have exactly two children");
+        std::vector<LogicalFunction> leftConjuncts;
+        std::vector<LogicalFunction> rightConjuncts;
+        std::vector<LogicalFunction> remainingConjuncts;
+        for (const auto& conjunct : conjuncts)
+        {
+            if (readsOnlyFieldsOf(conjunct, grandChildren[0].getOutputSchema()))
+            {
+                leftConjuncts.push_back(conjunct);
+            }
+            else if (readsOnlyFieldsOf(conjunct, grandChildren[1].getOutputSchema()))
+            {
+                rightConjuncts.push_back(conjunct);
+            }
+            else
+            {
+                remainingConjuncts.push_back(conjunct);
+            }
+        }
+        if (leftConjuncts.empty() and rightConjuncts.empty())
+        {
+            return std::nullopt;
+        }
+        const auto join = child.withChildren(
+            {applyConjuncts(leftConjuncts, traitSet, grandChildren[0]), applyConjuncts(rightConjuncts, traitSet, grandChildren[1])});
+        return keepAbove(remainingConjuncts, traitSet, join);
+    }
+
+    if (child.tryGet<UnionLogicalOperator>().has_value())
+    {
+        const auto [pushableConjuncts, remainingConjuncts] = partitionConjuncts(
+            conjuncts,
+            [&grandChildren](const LogicalFunction& conjunct)
+            {
+                return std::ranges::all_of(
+                    grandChildren,
+                    [&conjunct](const LogicalOperator& unionChild) { return readsOnlyFieldsOf(conjunct, unionChild.getOutputSchema()); });
+            });
+        if (pushableConjuncts.empty())
+        {
+            return std::nullopt;
+        }
+        /// Every child gets a selection of its own
+        const auto unionOperator = child.withChildren(
+            grandChildren
+            | std::views::transform([&](const LogicalOperator& unionChild)
+                                    { return applyConjuncts(pushableConjuncts, traitSet, unionChild); })
+            | std::ranges::to<std::vector>());
+        return keepAbove(remainingConjuncts, traitSet, unionOperator);
+    }
+
+    if (const auto aggregation = child.tryGet<WindowedAggregationLogicalOperator>())
+    {
+        INVARIANT(grandChildren.size() == 1, "WindowedAggregation operator must have exactly one child");
+        /// The aggregation passes the values of the grouping keys through. Thus, filtering the output on keys drops the same groups as
+        /// filtering the input, while predicates on aggregates or the window bounds must stay above the aggregation.
+        const auto keyNames = aggregation->getGroupByKeyNames() | std::ranges::to<std::unordered_set<std::string>>();
+        const auto [pushableConjuncts, remainingConjuncts] = partitionConjuncts(
+            conjuncts,
+            [&keyNames](const LogicalFunction& conjunct)
+            { return readsOnly(conjunct, [&keyNames](const std::string& fieldName) { return keyNames.contains(fieldName); }); });
+        if (pushableConjuncts.empty())
+        {
+            return std::nullopt;
+        }
+        const auto newAggregation = child.withChildren({applyConjuncts(pushableConjuncts, traitSet, grandChildren.front())});
+        return keepAbove(remainingConjuncts, traitSet, newAggregation);
+    }
+    return std::nullopt;
+}
+
+LogicalOperator pushDownSelections(const LogicalOperator& op)
+{
+    const auto children = op.getChildren();
+    if (children.empty())
+    {
+        return op;
+    }
+
+    const auto newOperator = op.withChildren(children | std::views::transform(pushDownSelections) | std::ranges::to<std::vector>());
+    if (const auto selection = newOperator.tryGet<SelectionLogicalOperator>())
+    {
+        INVARIANT(children.size() == 1, "Selection operator must have exactly one child");
+        const auto conjuncts = splitConjuncts(selection->getPredicate());
+        if (auto pushed = pushBelow(conjuncts, newOperator.getTraitSet(), newOperator.getChildren().front()))
+        {
+            return *pushed;
+        }
+    }
+    return newOperator;
+}
+}
+
+void PredicatePushdownRule::apply(LogicalPlan& queryPlan) const ///NOLINT(readability-convert-member-functions-to-static)
+{
+    queryPlan = queryPlan.withRootOperators(
+        queryPlan.getRootOperators() | std::views::transform(pushDownSelections) | std::ranges::to<std::vector>());
+}
+
+}
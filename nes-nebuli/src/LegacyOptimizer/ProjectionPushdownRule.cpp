@@ -0,0 +1,256 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <LegacyOptimizer/ProjectionPushdownRule.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Operators/EventTimeWatermarkAssignerLogicalOperator.hpp>
+#include <Operators/IngestionTimeWatermarkAssignerLogicalOperator.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/Sources/SourceDescriptorLogicalOperator.hpp>
+#include <Operators/UnionLogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <WindowTypes/Types/WindowType.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void addAccessedFields(std::unordered_set<std::string>& fields, const LogicalFunction& function)
+{
+    for (const auto& accessedFunction : BFSRange(function))
+    {
+        if (const auto fieldAccess = accessedFunction.tryGet<FieldAccessLogicalFunction>())
+        {
+            fields.insert(fieldAccess->getFieldName());
+        }
+    }
+}
+
+/// Event time windows read the timestamp field. The join looks the field up in each of its inputs by its unqualified name.
+void addTimestampFields(
+    std::unordered_set<std::string>& fields,
+    const std::shared_ptr<Windowing::WindowType>& windowType,
+    const std::vector<Schema>& inputSchemas)
+{
+    const auto timeBasedWindowType = std::dynamic_pointer_cast<Windowing::TimeBasedWindowType>(windowType);
+    if (timeBasedWindowType == nullptr
+        or timeBasedWindowType->getTimeCharacteristic().getType() == Windowing::TimeCharacteristic::Type::IngestionTime)
+    {
+        return;
+    }
+    const auto& timestampField = timeBasedWindowType->getTimeCharacteristic().field;
+    fields.insert(timestampField.name);
+    for (const auto& schema : inputSchemas)
+    {
+        if (const auto field = schema.getFieldByName(timestampField.getUnqualifiedName()))
+        {
+            fields.insert(field->name);
+        }
+    }
+}
+
+/// Returns the fields of its inputs that the operator reads to produce the required fields of its output
+std::unordered_set<std::string>
+getRequiredInputFields(const LogicalOperator& op, const std::unordered_set<std::string>& requiredOutputFields)
+{
+    if (const auto projection = op.tryGet<ProjectionLogicalOperator>())
+    {
+        return projection->getAccessedFields() | std::ranges::to<std::unordered_set<std::string>>();
+    }
+    if (const auto selection = op.tryGet<SelectionLogicalOperator>())
+    {
+        auto fields = requiredOutputFields;
+        addAccessedFields(fields, selection->getPredicate());
+        return fields;
+    }
+    if (op.tryGet<IngestionTimeWatermarkAssignerLogicalOperator>())
+    {
+        return requiredOutputFields;
+    }
+    if (const auto watermarkAssigner = op.tryGet<EventTimeWatermarkAssignerLogicalOperator>())
+    {
+        auto fields = requiredOutputFields;
+        addAccessedFields(fields, watermarkAssigner->onField);
+        return fields;
+    }
+    if (const auto join = op.tryGet<JoinLogicalOperator>())
+    {
+        auto fields = requiredOutputFields;
+        addAccessedFields(fields, join->getJoinFunction());
+        addTimestampFields(fields, join->getWindowType(), op.getInputSchemas());
+        return fields;
+    }
+    if (const auto aggregation = op.tryGet<WindowedAggregationLogicalOperator>())
+    {
+        /// The aggregation produces all of its output fields regardless of which of them are required
+        std::unordered_set<std::string> fields;
+        for (const auto& key : aggregation->getGroupingKeys())
+        {
+            fields.insert(key.getFieldName());
+        }
+        for (const auto& windowAggregation : aggregation->getWindowAggregation())
+        {
+            fields.insert(windowAggregation->onField.getFieldName());
+        }
+        addTimestampFields(fields, aggregation->getWindowType(), op.getInputSchemas());
+        return fields;
+    }
+
+    /// Sinks and all other operators read every field of their inputs
+    std::unordered_set<std::string> fields;
+    for (const auto& schema : op.getInputSchemas())
+    {
+        std::ranges::copy(schema.getFieldNames(), std::inserter(fields, fields.end()));
+    }
+    return fields;
+}
+
+LogicalOperator projectFields(const LogicalOperator& child, const std::vector<std::string>& projectedFields)
+{
+    auto projections = projectedFields
+        | std::views::transform(
+                           [](const std::string& fieldName)
+                           {
+                               return ProjectionLogicalOperator::Projection{
+                                   FieldIdentifier(fieldName), FieldAccessLogicalFunction(fieldName)};
+                           })
+        | std::ranges::to<std::vector>();
+    return ProjectionLogicalOperator(std::move(projections), ProjectionLogicalOperator::Asterisk(false)).withChildren({child});
+}
+
+LogicalOperator projectRequiredFields(const LogicalOperator& source, const std::unordered_set<std::string>& requiredFields)
+{
+    const auto schema = source.getOutputSchema();
+    auto projectedFields = schema.getFieldNames()
+        | std::views::filter([&requiredFields](const std::string& fieldName) { return requiredFields.contains(fieldName); })
+        | std::ranges::to<std::vector>();
+    if (projectedFields.size() == schema.getNumberOfFields())
+    {
+        return source;
+    }
+    if (projectedFields.empty())
+    {
+        /// The successors only count the tuples, e.g., a count over ingestion time windows. A tuple needs at least one field.
+        projectedFields.push_back(schema.getFieldAt(0).name);
+    }
+    return projectFields(source, projectedFields);
+}
+
+LogicalOperator pushDownProjections(const LogicalOperator& op, const std::unordered_set<std::string>& requiredFields);
+
+/// The inputs of a union name their fields differently, e.g., qualified by different sources, but have the same order of fields. Thus, we
+/// map the required output fields to the fields of each input by their position. Operators below the union might read and pass on further
+/// fields. Hence, we project every input onto the required fields, so that the schemas of the inputs still match.
+LogicalOperator pushDownProjectionsThroughUnion(const LogicalOperator& unionOperator, const std::unordered_set<std::string>& requiredFields)
+{
+    const auto outputFieldNames = unionOperator.getOutputSchema().getFieldNames();
+    std::vector<size_t> requiredPositions;
+    for (size_t position = 0; position < outputFieldNames.size(); ++position)
+    {
+        if (requiredFields.contains(outputFieldNames[position]))
+        {
+            requiredPositions.push_back(position);
+        }
+    }
+    if (requiredPositions.empty())
+    {
+        /// A tuple needs at least one field
+        requiredPositions.push_back(0);
+    }
+
+    const auto children = unionOperator.getChildren();
+    std::vector<LogicalOperator> newChildren;
+    newChildren.reserve(children.size());
+    for (const auto& child : children)
+    {
+        const auto childSchema = child.getOutputSchema();
+        const auto requiredChildFields = requiredPositions
+            | std::views::transform([&childSchema](const size_t position) { return childSchema.getFieldAt(position).name; })
+            | std::ranges::to<std::vector>();
+        const auto newChild = pushDownProjections(child, requiredChildFields | std::ranges::to<std::unordered_set<std::string>>());
+        if (requiredChildFields.size() == childSchema.getNumberOfFields() or child.tryGet<SourceDescriptorLogicalOperator>().has_value())
+        {
+            /// The projection of a source already keeps the order of the fields
+            newChildren.push_back(newChild);
+        }
+        else
+        {
+            newChildren.push_back(projectFields(newChild, requiredChildFields));
+        }
+    }
+    return unionOperator.withChildren(std::move(newChildren));
+}
+
+LogicalOperator pushDownProjections(const LogicalOperator& op, const std::unordered_set<std::string>& requiredFields)
+{
+    if (op.tryGet<SourceDescriptorLogicalOperator>().has_value())
+    {
+        return projectRequiredFields(op, requiredFields);
+    }
+    if (op.tryGet<UnionLogicalOperator>().has_value())
+    {
+        return pushDownProjectionsThroughUnion(op, requiredFields);
+    }
+    const auto children = op.getChildren();
+    if (children.empty())
+    {
+        return op;
+    }
+
+    const auto requiredInputFields = getRequiredInputFields(op, requiredFields);
+    const auto isProjection = op.tryGet<ProjectionLogicalOperator>().has_value();
+    return op.withChildren(
+        children
+        | std::views::transform(
+            [&](const LogicalOperator& child)
+            {
+                /// A projection directly above a source already reads only the fields that it needs
+                if (isProjection and child.tryGet<SourceDescriptorLogicalOperator>().has_value())
+                {
+                    return child;
+                }
+                return pushDownProjections(child, requiredInputFields);
+            })
+        | std::ranges::to<std::vector>());
+}
+}
+
+void ProjectionPushdownRule::apply(LogicalPlan& queryPlan) const ///NOLINT(readability-convert-member-functions-to-static)
+{
+    queryPlan = queryPlan.withRootOperators(
+        queryPlan.getRootOperators()
+        | std::views::transform([](const LogicalOperator& sink) { return pushDownProjections(sink, {}); })
+        | std::ranges::to<std::vector>());
+}
+
+}
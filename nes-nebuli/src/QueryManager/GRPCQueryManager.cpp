@@ -35,6 +35,7 @@
 /// Both are needed, clang-tidy complains otherwise
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/Execution/QueryStatus.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <SingleNodeWorkerRPCService.grpc.pb.h>
 #include <SingleNodeWorkerRPCService.pb.h>
 
@@ -154,6 +155,15 @@ std::expected<LocalQueryStatus, Exception> GRPCQueryManager::status(const QueryI
             queryStatus.metrics.error = exception;
         }
 
+        if (responseMetrics.has_memoryusage())
+        {
+            const auto& memoryUsage = responseMetrics.memoryusage();
+            queryStatus.metrics.memoryUsage = QueryMemoryUsage{
+                .usedBytes = memoryUsage.usedbytes(),
+                .peakUsedBytes = memoryUsage.peakusedbytes(),
+                .limits = {.softLimitInBytes = memoryUsage.softlimitinbytes(), .hardLimitInBytes = memoryUsage.hardlimitinbytes()}};
+        }
+
         queryStatus.state = magic_enum::enum_cast<QueryState>(response.state()).value(); /// Invalid state will throw
         return queryStatus;
     }
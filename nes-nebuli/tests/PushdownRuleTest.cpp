@@ -0,0 +1,303 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <LegacyOptimizer/PredicatePushdownRule.hpp>
+#include <LegacyOptimizer/ProjectionPushdownRule.hpp>
+#include <LegacyOptimizer/TypeInferencePhase.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/Sinks/SinkLogicalOperator.hpp>
+#include <Operators/Sources/SourceDescriptorLogicalOperator.hpp>
+#include <Operators/UnionLogicalOperator.hpp>
+#include <Operators/Windows/Aggregations/SumAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Measures/TimeMeasure.hpp>
+#include <WindowTypes/Types/TumblingWindow.hpp>
+
+namespace NES
+{
+
+class PushdownRuleTest : public ::testing::Test
+{
+protected:
+    /// Every source produces the fields id, value, and payload, qualified by the name of its logical source
+    LogicalOperator createSource(const std::string& logicalSourceName)
+    {
+        auto logicalSource = sourceCatalog.getLogicalSource(logicalSourceName);
+        if (not logicalSource.has_value())
+        {
+            const auto schema = Schema{}
+                                    .addField("id", DataType::Type::UINT64)
+                                    .addField("value", DataType::Type::UINT64)
+                                    .addField("payload", DataType::Type::UINT64);
+            logicalSource = sourceCatalog.addLogicalSource(logicalSourceName, schema);
+        }
+        const auto parserConfig = ParserConfig{.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+        auto sourceDescriptor
+            = sourceCatalog.addPhysicalSource(logicalSource.value(), "File", {{"file_path", "/dev/null"}}, parserConfig).value(); /// NOLINT
+        return SourceDescriptorLogicalOperator(std::move(sourceDescriptor));
+    }
+
+    static LogicalPlan createInferredPlan(const LogicalOperator& child)
+    {
+        auto plan = LogicalPlan(SinkLogicalOperator().withChildren({child}));
+        TypeInferencePhase{}.apply(plan);
+        return plan;
+    }
+
+    static LogicalFunction equalsConstant(const std::string& fieldName)
+    {
+        const auto constant = ConstantValueLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::UINT64), "42");
+        return EqualsLogicalFunction(FieldAccessLogicalFunction(fieldName), constant);
+    }
+
+    static LogicalOperator project(const std::vector<std::string>& fieldNames, const LogicalOperator& child)
+    {
+        std::vector<ProjectionLogicalOperator::Projection> projections;
+        for (const auto& fieldName : fieldNames)
+        {
+            projections.emplace_back(FieldIdentifier(fieldName), FieldAccessLogicalFunction(fieldName));
+        }
+        return ProjectionLogicalOperator(std::move(projections), ProjectionLogicalOperator::Asterisk(false)).withChildren({child});
+    }
+
+    static std::shared_ptr<Windowing::WindowType> createTumblingWindow()
+    {
+        return std::make_shared<Windowing::TumblingWindow>(
+            Windowing::TimeCharacteristic::createIngestionTime(), Windowing::TimeMeasure(1000));
+    }
+
+    /// Returns the sorted names of the fields that the predicate of the selection reads
+    static std::vector<std::string> getPredicateFields(const LogicalOperator& selection)
+    {
+        std::vector<std::string> fieldNames;
+        for (const auto& function : BFSRange(selection.get<SelectionLogicalOperator>().getPredicate()))
+        {
+            if (const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>())
+            {
+                fieldNames.push_back(fieldAccess->getFieldName());
+            }
+        }
+        std::ranges::sort(fieldNames);
+        return fieldNames;
+    }
+
+    static LogicalOperator getOnlyChild(const LogicalOperator& op)
+    {
+        const auto children = op.getChildren();
+        EXPECT_EQ(children.size(), 1);
+        return children.front();
+    }
+
+    SourceCatalog sourceCatalog;
+};
+
+/// Before: Sink <- Selection(left.value, right.value, left.payload = right.payload) <- Join <- (Source left, Source right)
+/// After:  Sink <- Selection(left.payload = right.payload) <- Join <- (Selection(left.value) <- Source left, Selection(right.value) <- ...)
+TEST_F(PushdownRuleTest, selectionMovesIntoTheSidesOfAJoin)
+{
+    const auto join = JoinLogicalOperator(
+                          EqualsLogicalFunction(FieldAccessLogicalFunction("left$id"), FieldAccessLogicalFunction("right$id")),
+                          createTumblingWindow(),
+                          JoinLogicalOperator::JoinType::INNER_JOIN)
+                          .withChildren({createSource("left"), createSource("right")});
+    const auto predicate = AndLogicalFunction(
+        AndLogicalFunction(equalsConstant("left$value"), equalsConstant("right$value")),
+        EqualsLogicalFunction(FieldAccessLogicalFunction("left$payload"), FieldAccessLogicalFunction("right$payload")));
+    auto plan = createInferredPlan(SelectionLogicalOperator(predicate).withChildren({join}));
+
+    PredicatePushdownRule{}.apply(plan);
+    TypeInferencePhase{}.apply(plan);
+
+    const auto remainingSelection = getOnlyChild(plan.getRootOperators().front());
+    ASSERT_TRUE(remainingSelection.tryGet<SelectionLogicalOperator>().has_value());
+    EXPECT_EQ(getPredicateFields(remainingSelection), (std::vector<std::string>{"left$payload", "right$payload"}));
+
+    const auto newJoin = getOnlyChild(remainingSelection);
+    ASSERT_TRUE(newJoin.tryGet<JoinLogicalOperator>().has_value());
+    const auto joinChildren = newJoin.getChildren();
+    ASSERT_EQ(joinChildren.size(), 2);
+    EXPECT_EQ(getPredicateFields(joinChildren[0]), std::vector<std::string>{"left$value"});
+    EXPECT_EQ(getPredicateFields(joinChildren[1]), std::vector<std::string>{"right$value"});
+    EXPECT_TRUE(getOnlyChild(joinChildren[0]).tryGet<SourceDescriptorLogicalOperator>().has_value());
+    EXPECT_TRUE(getOnlyChild(joinChildren[1]).tryGet<SourceDescriptorLogicalOperator>().has_value());
+}
+
+/// Before: Sink <- Selection(stream.value) <- Union <- (Source, Source)
+/// After:  Sink <- Union <- (Selection(stream.value) <- Source, Selection(stream.value) <- Source)
+TEST_F(PushdownRuleTest, selectionMovesIntoEveryChildOfAUnion)
+{
+    const auto unionOperator = UnionLogicalOperator().withChildren({createSource("stream"), createSource("stream")});
+    auto plan = createInferredPlan(SelectionLogicalOperator(equalsConstant("stream$value")).withChildren({unionOperator}));
+
+    PredicatePushdownRule{}.apply(plan);
+    TypeInferencePhase{}.apply(plan);
+
+    const auto newUnion = getOnlyChild(plan.getRootOperators().front());
+    ASSERT_TRUE(newUnion.tryGet<UnionLogicalOperator>().has_value());
+    const auto unionChildren = newUnion.getChildren();
+    ASSERT_EQ(unionChildren.size(), 2);
+    EXPECT_NE(unionChildren[0].getId(), unionChildren[1].getId());
+    for (const auto& unionChild : unionChildren)
+    {
+        EXPECT_EQ(getPredicateFields(unionChild), std::vector<std::string>{"stream$value"});
+        EXPECT_TRUE(getOnlyChild(unionChild).tryGet<SourceDescriptorLogicalOperator>().has_value());
+    }
+}
+
+/// Before: Sink <- Selection(stream.id, stream.sum) <- WindowedAggregation(key stream.id) <- Source
+/// After:  Sink <- Selection(stream.sum) <- WindowedAggregation(key stream.id) <- Selection(stream.id) <- Source
+TEST_F(PushdownRuleTest, onlyKeyPredicatesMoveBelowAnAggregation)
+{
+    const auto aggregation = WindowedAggregationLogicalOperator(
+                                 {FieldAccessLogicalFunction("stream$id")},
+                                 {std::make_shared<SumAggregationLogicalFunction>(
+                                     FieldAccessLogicalFunction("stream$value"), FieldAccessLogicalFunction("stream$sum"))},
+                                 createTumblingWindow())
+                                 .withChildren({createSource("stream")});
+    const auto predicate = AndLogicalFunction(equalsConstant("stream$id"), equalsConstant("stream$sum"));
+    auto plan = createInferredPlan(SelectionLogicalOperator(predicate).withChildren({aggregation}));
+
+    PredicatePushdownRule{}.apply(plan);
+    TypeInferencePhase{}.apply(plan);
+
+    const auto remainingSelection = getOnlyChild(plan.getRootOperators().front());
+    EXPECT_EQ(getPredicateFields(remainingSelection), std::vector<std::string>{"stream$sum"});
+    const auto newAggregation = getOnlyChild(remainingSelection);
+    ASSERT_TRUE(newAggregation.tryGet<WindowedAggregationLogicalOperator>().has_value());
+    const auto pushedSelection = getOnlyChild(newAggregation);
+    EXPECT_EQ(getPredicateFields(pushedSelection), std::vector<std::string>{"stream$id"});
+    EXPECT_TRUE(getOnlyChild(pushedSelection).tryGet<SourceDescriptorLogicalOperator>().has_value());
+}
+
+/// Before: Sink <- Projection(stream.id) <- Selection(stream.value) <- Source
+/// After:  Sink <- Projection(stream.id) <- Selection(stream.value) <- Projection(stream.id, stream.value) <- Source
+TEST_F(PushdownRuleTest, sourceOnlyProducesTheFieldsThatAreRead)
+{
+    const auto selection = SelectionLogicalOperator(equalsConstant("stream$value")).withChildren({createSource("stream")});
+    auto plan = createInferredPlan(project({"stream$id"}, selection));
+
+    ProjectionPushdownRule{}.apply(plan);
+    TypeInferencePhase{}.apply(plan);
+
+    const auto newSelection = getOnlyChild(getOnlyChild(plan.getRootOperators().front()));
+    ASSERT_TRUE(newSelection.tryGet<SelectionLogicalOperator>().has_value());
+    const auto pushedProjection = getOnlyChild(newSelection);
+    ASSERT_TRUE(pushedProjection.tryGet<ProjectionLogicalOperator>().has_value());
+    EXPECT_EQ(pushedProjection.getOutputSchema().getFieldNames(), (std::vector<std::string>{"stream$id", "stream$value"}));
+    EXPECT_TRUE(getOnlyChild(pushedProjection).tryGet<SourceDescriptorLogicalOperator>().has_value());
+}
+
+/// Before: Sink <- Projection(left.value) <- Join(left.id = right.id) <- (Source left, Source right)
+/// After:  Sink <- Projection(left.value) <- Join <- (Projection(left.id, left.value) <- Source left, Projection(right.id) <- Source right)
+TEST_F(PushdownRuleTest, joinKeepsTheFieldsOfTheJoinFunction)
+{
+    const auto join = JoinLogicalOperator(
+                          EqualsLogicalFunction(FieldAccessLogicalFunction("left$id"), FieldAccessLogicalFunction("right$id")),
+                          createTumblingWindow(),
+                          JoinLogicalOperator::JoinType::INNER_JOIN)
+                          .withChildren({createSource("left"), createSource("right")});
+    auto plan = createInferredPlan(project({"left$value"}, join));
+
+    ProjectionPushdownRule{}.apply(plan);
+    TypeInferencePhase{}.apply(plan);
+
+    const auto newJoin = getOnlyChild(getOnlyChild(plan.getRootOperators().front()));
+    ASSERT_TRUE(newJoin.tryGet<JoinLogicalOperator>().has_value());
+    const auto joinChildren = newJoin.getChildren();
+    ASSERT_EQ(joinChildren.size(), 2);
+    EXPECT_EQ(joinChildren[0].getOutputSchema().getFieldNames(), (std::vector<std::string>{"left$id", "left$value"}));
+    EXPECT_EQ(joinChildren[1].getOutputSchema().getFieldNames(), std::vector<std::string>{"right$id"});
+}
+
+/// The union of differently named sources drops the source qualifiers. Thus, the required fields of the union are mapped to its inputs.
+/// Before: Sink <- Projection(value) <- Union <- (Source left, Selection(right.payload) <- Source right)
+/// After:  Sink <- Projection(value) <- Union <- (Projection(left.value) <- Source left,
+///             Projection(right.value) <- Selection(right.payload) <- Projection(right.value, right.payload) <- Source right)
+TEST_F(PushdownRuleTest, unionOfDifferentlyNamedSourcesProjectsTheSameFieldsOfEveryInput)
+{
+    const auto rightSelection = SelectionLogicalOperator(equalsConstant("right$payload")).withChildren({createSource("right")});
+    const auto unionOperator = UnionLogicalOperator().withChildren({createSource("left"), rightSelection});
+    auto plan = createInferredPlan(project({"value"}, unionOperator));
+
+    ProjectionPushdownRule{}.apply(plan);
+    TypeInferencePhase{}.apply(plan);
+
+    const auto newUnion = getOnlyChild(getOnlyChild(plan.getRootOperators().front()));
+    ASSERT_TRUE(newUnion.tryGet<UnionLogicalOperator>().has_value());
+    EXPECT_EQ(newUnion.getOutputSchema().getFieldNames(), std::vector<std::string>{"value"});
+    const auto unionChildren = newUnion.getChildren();
+    ASSERT_EQ(unionChildren.size(), 2);
+
+    ASSERT_TRUE(unionChildren[0].tryGet<ProjectionLogicalOperator>().has_value());
+    EXPECT_EQ(unionChildren[0].getOutputSchema().getFieldNames(), std::vector<std::string>{"left$value"});
+    EXPECT_TRUE(getOnlyChild(unionChildren[0]).tryGet<SourceDescriptorLogicalOperator>().has_value());
+
+    /// The selection reads the payload, which must not reach the union
+    ASSERT_TRUE(unionChildren[1].tryGet<ProjectionLogicalOperator>().has_value());
+    EXPECT_EQ(unionChildren[1].getOutputSchema().getFieldNames(), std::vector<std::string>{"right$value"});
+    const auto newSelection = getOnlyChild(unionChildren[1]);
+    ASSERT_TRUE(newSelection.tryGet<SelectionLogicalOperator>().has_value());
+    const auto pushedProjection = getOnlyChild(newSelection);
+    ASSERT_TRUE(pushedProjection.tryGet<ProjectionLogicalOperator>().has_value());
+    EXPECT_EQ(pushedProjection.getOutputSchema().getFieldNames(), (std::vector<std::string>{"right$value", "right$payload"}));
+}
+
+TEST_F(PushdownRuleTest, planThatReadsAllFieldsStaysUnchanged)
+{
+    auto plan = createInferredPlan(SelectionLogicalOperator(equalsConstant("stream$value")).withChildren({createSource("stream")}));
+    const auto planBefore = plan;
+
+    PredicatePushdownRule{}.apply(plan);
+    ProjectionPushdownRule{}.apply(plan);
+
+    EXPECT_EQ(plan, planBefore);
+    EXPECT_TRUE(getOperatorByType<ProjectionLogicalOperator>(plan).empty());
+}
+
+TEST_F(PushdownRuleTest, projectionAboveASourceIsNotDuplicated)
+{
+    auto plan = createInferredPlan(project({"stream$id"}, createSource("stream")));
+
+    ProjectionPushdownRule{}.apply(plan);
+
+    EXPECT_EQ(getOperatorByType<ProjectionLogicalOperator>(plan).size(), 1);
+}
+
+}
@@ -0,0 +1,252 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+#include <HashMapSlice.hpp>
+
+/// This Benchmark compares the hash join of one window without and with radix partitioning, as done by the HJBuildPhysicalOperator and the
+/// HJProbePhysicalOperator. The first argument is the number of worker threads, the second the zipf skew of the join keys times 10
+/// and the third the number of radix partitions, whereby 1 is the unpartitioned hash join.
+/// The build inserts 1M tuples per side into one hash map per worker thread and partition. Instead of paged vectors, the entries store
+/// the number of tuples per key. Without partitioning, one probe task probes every right entry against every left hash map.
+/// With partitioning, the worker threads take one partition after the other, merge its left hash maps and probe the right entries once.
+
+namespace
+{
+using Hash = NES::Nautilus::Interface::HashFunction::HashValue::raw_type;
+using NES::Nautilus::Interface::ChainedHashMap;
+using NES::Nautilus::Interface::ChainedHashMapEntry;
+constexpr size_t NUMBER_OF_RECORDS = 1000 * 1000;
+constexpr uint64_t NUMBER_OF_DISTINCT_KEYS = 100 * 1000;
+constexpr uint64_t KEY_SIZE = sizeof(uint64_t);
+constexpr uint64_t VALUE_SIZE = sizeof(uint64_t);
+constexpr uint64_t NUMBER_OF_BUCKETS = 1024;
+constexpr uint64_t PAGE_SIZE = 4096;
+
+/// Draws the keys via the inverse of the cumulative distribution function of the zipf distribution. A skew of 0 is uniform.
+std::vector<uint64_t> createKeys(const double skew, const uint64_t seed)
+{
+    std::vector<double> cumulativeProbabilities(NUMBER_OF_DISTINCT_KEYS);
+    double sum = 0;
+    for (uint64_t rank = 0; rank < NUMBER_OF_DISTINCT_KEYS; ++rank)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(rank + 1), skew);
+        cumulativeProbabilities[rank] = sum;
+    }
+
+    std::mt19937_64 random(seed);
+    std::uniform_real_distribution<double> distribution(0, sum);
+    std::vector<uint64_t> keys(NUMBER_OF_RECORDS);
+    for (auto& key : keys)
+    {
+        const auto rank = std::ranges::lower_bound(cumulativeProbabilities, distribution(random)) - cumulativeProbabilities.begin();
+        key = std::min<uint64_t>(rank, NUMBER_OF_DISTINCT_KEYS - 1);
+    }
+    return keys;
+}
+
+Hash hashKey(const uint64_t key)
+{
+    /// Finalizer of MurMur3, as the keys are consecutive
+    auto hash = key;
+    hash ^= hash >> 33U;
+    hash *= 0xff51afd7ed558ccdUL;
+    hash ^= hash >> 33U;
+    hash *= 0xc4ceb3fe1a85ec53UL;
+    hash ^= hash >> 33U;
+    return hash;
+}
+
+uint64_t* getKey(ChainedHashMapEntry* entry)
+{
+    return reinterpret_cast<uint64_t*>(entry + 1);
+}
+
+uint64_t* getNumberOfTuples(ChainedHashMapEntry* entry)
+{
+    return getKey(entry) + 1;
+}
+
+/// As the C++ side of the chained hash map does not offer an iterator, we remember all entries next to the hash map
+struct HashMapWithEntries
+{
+    HashMapWithEntries() : hashMap(KEY_SIZE, VALUE_SIZE, NUMBER_OF_BUCKETS, PAGE_SIZE) { }
+
+    ChainedHashMapEntry* find(const uint64_t key, const Hash hash) const
+    {
+        auto* entry = hashMap.getNumberOfTuples() == 0 ? nullptr : hashMap.findChain(hash);
+        while (entry != nullptr and (entry->hash != hash or *getKey(entry) != key))
+        {
+            entry = entry->next;
+        }
+        return entry;
+    }
+
+    void add(const uint64_t key, const Hash hash, const uint64_t numberOfTuples, NES::AbstractBufferProvider* bufferProvider)
+    {
+        auto* entry = find(key, hash);
+        if (entry == nullptr)
+        {
+            entry = dynamic_cast<ChainedHashMapEntry*>(hashMap.insertEntry(hash, bufferProvider));
+            *getKey(entry) = key;
+            *getNumberOfTuples(entry) = 0;
+            entries.emplace_back(entry);
+        }
+        *getNumberOfTuples(entry) += numberOfTuples;
+    }
+
+    ChainedHashMap hashMap;
+    std::vector<ChainedHashMapEntry*> entries;
+};
+
+/// Hash maps of one join side, stored partition after partition as in the HJSlice
+using HashMapsOfSide = std::vector<std::unique_ptr<HashMapWithEntries>>;
+
+HashMapsOfSide build(
+    const std::vector<uint64_t>& keys,
+    const uint64_t numberOfThreads,
+    const uint64_t numberOfPartitions,
+    NES::AbstractBufferProvider* bufferProvider)
+{
+    HashMapsOfSide hashMaps(numberOfThreads * numberOfPartitions);
+    for (auto& hashMap : hashMaps)
+    {
+        hashMap = std::make_unique<HashMapWithEntries>();
+    }
+
+    std::vector<std::jthread> threads;
+    for (uint64_t threadId = 0; threadId < numberOfThreads; ++threadId)
+    {
+        threads.emplace_back(
+            [&, threadId]
+            {
+                for (auto i = threadId; i < keys.size(); i += numberOfThreads)
+                {
+                    const auto hash = hashKey(keys[i]);
+                    const auto partition
+                        = numberOfPartitions > 1 ? NES::HashMapSlice::getRadixPartition(hash, numberOfPartitions) : 0;
+                    hashMaps[(partition * numberOfThreads) + threadId]->add(keys[i], hash, 1, bufferProvider);
+                }
+            });
+    }
+    return hashMaps;
+}
+
+/// Joins all hash maps of one partition and returns the number of joined tuples
+uint64_t probePartition(
+    const HashMapsOfSide& left,
+    const HashMapsOfSide& right,
+    const uint64_t numberOfThreads,
+    const uint64_t partition,
+    const bool mergeLeft,
+    NES::AbstractBufferProvider* bufferProvider)
+{
+    const auto firstHashMap = left.begin() + static_cast<std::ptrdiff_t>(partition * numberOfThreads);
+    const auto lastHashMap = firstHashMap + static_cast<std::ptrdiff_t>(numberOfThreads);
+    uint64_t numberOfJoinedTuples = 0;
+    if (not mergeLeft)
+    {
+        for (const auto& rightHashMap : right)
+        {
+            for (auto* rightEntry : rightHashMap->entries)
+            {
+                for (auto leftHashMap = firstHashMap; leftHashMap != lastHashMap; ++leftHashMap)
+                {
+                    if (auto* leftEntry = (*leftHashMap)->find(*getKey(rightEntry), rightEntry->hash))
+                    {
+                        numberOfJoinedTuples += *getNumberOfTuples(leftEntry) * *getNumberOfTuples(rightEntry);
+                    }
+                }
+            }
+        }
+        return numberOfJoinedTuples;
+    }
+
+    HashMapWithEntries mergedHashMap;
+    for (auto leftHashMap = firstHashMap; leftHashMap != lastHashMap; ++leftHashMap)
+    {
+        for (auto* leftEntry : (*leftHashMap)->entries)
+        {
+            mergedHashMap.add(*getKey(leftEntry), leftEntry->hash, *getNumberOfTuples(leftEntry), bufferProvider);
+        }
+    }
+    for (uint64_t rightHashMap = partition * numberOfThreads; rightHashMap < (partition + 1) * numberOfThreads; ++rightHashMap)
+    {
+        for (auto* rightEntry : right[rightHashMap]->entries)
+        {
+            if (auto* leftEntry = mergedHashMap.find(*getKey(rightEntry), rightEntry->hash))
+            {
+                numberOfJoinedTuples += *getNumberOfTuples(leftEntry) * *getNumberOfTuples(rightEntry);
+            }
+        }
+    }
+    return numberOfJoinedTuples;
+}
+}
+
+static void BM_HashJoin(benchmark::State& state)
+{
+    const auto numberOfThreads = static_cast<uint64_t>(state.range(0));
+    const auto skew = static_cast<double>(state.range(1)) / 10;
+    const auto numberOfPartitions = static_cast<uint64_t>(state.range(2));
+    const auto leftKeys = createKeys(skew, 42);
+    const auto rightKeys = createKeys(skew, 43);
+    const auto bufferManager = NES::BufferManager::create();
+    for (auto _ : state)
+    {
+        const auto left = build(leftKeys, numberOfThreads, numberOfPartitions, bufferManager.get());
+        const auto right = build(rightKeys, numberOfThreads, numberOfPartitions, bufferManager.get());
+
+        /// The worker threads take the probe tasks, i.e., the partitions, from a shared counter like from the task queue
+        std::atomic<uint64_t> nextPartition{0};
+        std::atomic<uint64_t> numberOfJoinedTuples{0};
+        {
+            std::vector<std::jthread> threads;
+            for (uint64_t threadId = 0; threadId < numberOfThreads; ++threadId)
+            {
+                threads.emplace_back(
+                    [&]
+                    {
+                        for (auto partition = nextPartition++; partition < numberOfPartitions; partition = nextPartition++)
+                        {
+                            numberOfJoinedTuples += probePartition(
+                                left, right, numberOfThreads, partition, numberOfPartitions > 1, bufferManager.get());
+                        }
+                    });
+            }
+        }
+        benchmark::DoNotOptimize(numberOfJoinedTuples.load());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2 * NUMBER_OF_RECORDS));
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_HashJoin)
+    ->ArgsProduct({{1, 2, 4, 8}, {0, 5, 10}, {1, 16, 64}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -15,11 +15,14 @@
 #pragma once
 
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <Aggregation/AggregationOperatorHandler.hpp>
+#include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Time/Timestamp.hpp>
@@ -31,32 +34,48 @@
 namespace NES
 {
 class AggregationBuildPhysicalOperator;
+AggregationSlice* getAggSliceProxy(
+    const AggregationOperatorHandler* operatorHandler, Timestamp timestamp, const AggregationBuildPhysicalOperator* buildOperator);
 Interface::HashMap* getAggHashMapProxy(
-    const AggregationOperatorHandler* operatorHandler,
-    Timestamp timestamp,
+    AggregationSlice* aggregationSlice,
     WorkerThreadId workerThreadId,
+    Nautilus::Interface::HashFunction::HashValue::raw_type hash,
+    const AggregationBuildPhysicalOperator* buildOperator);
+void finishAggWriteProxy(
+    AggregationSlice* aggregationSlice,
+    Nautilus::Interface::HashFunction::HashValue::raw_type hash,
     const AggregationBuildPhysicalOperator* buildOperator);
 
+/// If numberOfRadixPartitions is larger than 1, the upper bits of the hash of the grouping keys decide into which partition, i.e., into
+/// which of the hash maps of the worker thread, a tuple gets inserted. Thus, the partitions of a window can be combined in parallel.
 class AggregationBuildPhysicalOperator final : public WindowBuildPhysicalOperator
 {
 public:
+    friend AggregationSlice* getAggSliceProxy(
+        const AggregationOperatorHandler* operatorHandler, Timestamp timestamp, const AggregationBuildPhysicalOperator* buildOperator);
     friend Interface::HashMap* getAggHashMapProxy(
-        const AggregationOperatorHandler* operatorHandler,
-        Timestamp timestamp,
+        AggregationSlice* aggregationSlice,
         WorkerThreadId workerThreadId,
+        Nautilus::Interface::HashFunction::HashValue::raw_type hash,
+        const AggregationBuildPhysicalOperator* buildOperator);
+    friend void finishAggWriteProxy(
+        AggregationSlice* aggregationSlice,
+        Nautilus::Interface::HashFunction::HashValue::raw_type hash,
         const AggregationBuildPhysicalOperator* buildOperator);
 
     AggregationBuildPhysicalOperator(
         OperatorHandlerId operatorHandlerId,
         std::unique_ptr<TimeFunction> timeFunction,
         std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions,
-        HashMapOptions hashMapOptions);
+        HashMapOptions hashMapOptions,
+        uint64_t numberOfRadixPartitions = 1);
     void execute(ExecutionContext& ctx, Record& record) const override;
 
 private:
     /// The aggregation function is a shared_ptr, because it is used in the aggregation build and in the getSliceCleanupFunction()
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     HashMapOptions hashMapOptions;
+    uint64_t numberOfRadixPartitions;
 
     /// shared_ptr as multiple slices need access to it
     using NautilusCleanupExec = nautilus::engine::CallableFunction<void, Nautilus::Interface::HashMap*>;
@@ -18,6 +18,7 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include <Aggregation/AggregationSlice.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
@@ -32,13 +33,18 @@ namespace NES
 /// This struct models the information for an aggregation window trigger
 /// As we are triggering the probe pipeline by passing a tuple buffer to the probe operator, we assume that the tuple buffer
 /// is large enough to store all slices of the window to be triggered.
+/// If the build is radix-partitioned, each partition of a window gets its own trigger and thus, its own probe task.
 struct EmittedAggregationWindow
 {
     WindowInfo windowInfo;
     std::unique_ptr<Nautilus::Interface::HashMap>
         finalHashMap; /// Pointer to the final hash map that the probe should use to combine all hash maps
-    uint64_t numberOfHashMaps;
-    Nautilus::Interface::HashMap** hashMaps; /// Pointer to the stored pointers of all hash maps that the probe should combine
+    uint64_t partition;
+    uint64_t numberOfSlices;
+    AggregationSlice** slices; /// Pointer to the stored pointers of all slices of the window
+    /// The hash maps of the i-th slice are stored in hashMaps[hashMapOffsets[i]] until hashMaps[hashMapOffsets[i + 1]]
+    uint64_t* hashMapOffsets;
+    Nautilus::Interface::HashMap** hashMaps; /// Pointer to the stored pointers of the hash maps of the partition of all slices
 };
 
 class AggregationOperatorHandler final : public WindowBasedOperatorHandler
@@ -47,16 +53,21 @@ public:
     AggregationOperatorHandler(
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
-        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore);
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        uint64_t numberOfRadixPartitions = 1);
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
 
+    [[nodiscard]] uint64_t getNumberOfRadixPartitions() const;
 
 protected:
     void triggerSlices(
         const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
         PipelineExecutionContext* pipelineCtx) override;
+
+private:
+    uint64_t numberOfRadixPartitions;
 };
 
 }
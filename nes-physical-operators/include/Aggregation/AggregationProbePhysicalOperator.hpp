@@ -17,15 +17,21 @@
 #include <memory>
 #include <vector>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Windowing/WindowMetaData.hpp>
+#include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
 #include <WindowProbePhysicalOperator.hpp>
+#include <val.hpp>
 
 namespace NES
 {
 
+/// Combines the hash maps of one partition of all slices of a window into a final hash map and lowers its aggregation states.
+/// If cacheSlicePartials is set, i.e., if a slice belongs to multiple windows, we do not combine the hash maps of a slice again for every
+/// window. Instead, the probe of the first window combines them into a partial hash map that the slice caches for all further windows.
 class AggregationProbePhysicalOperator final : public WindowProbePhysicalOperator
 {
 public:
@@ -33,12 +39,20 @@ public:
         HashMapOptions hashMapOptions,
         std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
         OperatorHandlerId operatorHandlerId,
-        WindowMetaData windowMetaData);
+        WindowMetaData windowMetaData,
+        bool cacheSlicePartials = false);
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
+    /// Inserts all entries of the source hash map into the target hash map and combines the aggregation states of equal keys
+    void combineHashMaps(
+        ExecutionContext& executionCtx,
+        const nautilus::val<Interface::HashMap*>& targetHashMapPtr,
+        const nautilus::val<Interface::HashMap*>& sourceHashMapPtr) const;
+
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     HashMapOptions hashMapOptions;
+    bool cacheSlicePartials;
 };
 
 }
@@ -14,7 +14,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
@@ -25,17 +30,65 @@ namespace NES
 
 /// This class represents a single slice for the (keyed) aggregation. It stores the aggregation state in a hashmap.
 /// If it is a global/non-keyed aggregation, each hashmap contains a single entry for the keyValue = 0.
-/// In our current implementation, we have one hashmap per worker thread.
+/// In our current implementation, we have one hashmap per worker thread and radix partition. The hash maps are stored partition after
+/// partition, i.e., [Partition 0: [HashMap Worker 0][HashMap Worker 1]...][Partition 1: ...]...
+///
+/// If a slice belongs to multiple windows, the probe of the first window combines the hash maps of a partition into a partial hash map.
+/// The slice caches the partial hash map for the probes of all further windows. The hash maps of the worker threads stay alive until the
+/// slice gets destroyed, as build tasks might still hold pointers to them. If a build task writes to a partition after it has been
+/// probed, e.g., for a late record, the cached partial hash map is outdated and the next probe combines the partition again.
 class AggregationSlice final : public HashMapSlice
 {
 public:
     AggregationSlice(
-        SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, uint64_t numberOfHashMaps);
+        SliceStart sliceStart,
+        SliceEnd sliceEnd,
+        const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
+        uint64_t numberOfHashMaps,
+        uint64_t numberOfRadixPartitions = 1);
+    ~AggregationSlice() override;
 
     /// Returns the pointer to the underlying hashmap.
     /// IMPORTANT: This method should only be used for passing the hashmap to the nautilus executable.
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId) const;
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId);
+    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId, uint64_t partition = 0) const;
+    /// Returns the pointer to the hashmap that a build task writes to. The build task must call finishWrite() after writing the record.
+    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId, uint64_t partition = 0);
+    /// Signals that a build task has written a record to the partition. If the partition has already been probed, this invalidates the
+    /// cached partial hash map of the partition.
+    void finishWrite(uint64_t partition = 0);
+    [[nodiscard]] uint64_t getNumberOfHashMapsForPartition() const;
+    [[nodiscard]] uint64_t getNumberOfRadixPartitions() const;
+
+    /// Creates an empty hash map with the same configuration as the hash maps of this slice
+    [[nodiscard]] std::unique_ptr<Nautilus::Interface::HashMap> createHashMap() const;
+
+    /// Locks the partial hash map of the partition and returns it. If the cached partial hash map is outdated, it gets replaced by an
+    /// empty one. If isPartialHashMapCombined() returns false afterward, the caller must combine the hash maps of the partition into the
+    /// partial hash map. In any case, the caller must call unlockPartialHashMap().
+    [[nodiscard]] Nautilus::Interface::HashMap* lockPartialHashMap(uint64_t partition);
+    [[nodiscard]] bool isPartialHashMapCombined(uint64_t partition) const;
+
+    /// Marks the partial hash map as combined with all writes that happened before lockPartialHashMap() and unlocks it
+    void unlockPartialHashMap(uint64_t partition);
+
+private:
+    struct PartialHashMap
+    {
+        std::mutex mutex;
+        std::unique_ptr<Nautilus::Interface::HashMap> hashMap;
+        /// Set by the first probe of the partition. Afterward, each finished write of a build task to the partition increments
+        /// numberOfWrites.
+        std::atomic<bool> probed = false;
+        std::atomic<uint64_t> numberOfWrites = 0;
+        /// The number of writes that the partial hash map contains, if it has been combined. Both are protected by the mutex.
+        std::optional<uint64_t> combinedWrites;
+        uint64_t writesOnLock = 0;
+    };
+
+    [[nodiscard]] uint64_t getHashMapPos(WorkerThreadId workerThreadId, uint64_t partition) const;
+
+    uint64_t numberOfRadixPartitions;
+    std::vector<PartialHashMap> partialHashMaps;
 };
 
 }
@@ -14,20 +14,18 @@
 
 #pragma once
 
-#include <cstddef>
 #include <memory>
-#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/QuantileAggregationPhysicalFunction.hpp>
 #include <DataTypes/DataType.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
 #include <Nautilus/Interface/Record.hpp>
-#include <Runtime/AbstractBufferProvider.hpp>
-#include <val_concepts.hpp>
 
 namespace NES
 {
 
-class MedianAggregationPhysicalFunction : public AggregationPhysicalFunction
+/// The median is the quantile 0.5. For an even number of values, it is the average of the two middle values.
+class MedianAggregationPhysicalFunction : public QuantileAggregationPhysicalFunction
 {
 public:
     MedianAggregationPhysicalFunction(
@@ -36,22 +34,7 @@ public:
         PhysicalFunction inputFunction,
         Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
         std::shared_ptr<Nautilus::Interface::MemoryProvider::TupleBufferMemoryProvider> memProviderPagedVector);
-    void lift(
-        const nautilus::val<AggregationState*>& aggregationState,
-        PipelineMemoryProvider& pipelineMemoryProvider,
-        const Nautilus::Record& record) override;
-    void combine(
-        nautilus::val<AggregationState*> aggregationState1,
-        nautilus::val<AggregationState*> aggregationState2,
-        PipelineMemoryProvider& pipelineMemoryProvider) override;
-    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
-    void reset(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
-    void cleanup(nautilus::val<AggregationState*> aggregationState) override;
-    [[nodiscard]] size_t getSizeOfStateInBytes() const override;
     ~MedianAggregationPhysicalFunction() override = default;
-
-private:
-    std::shared_ptr<Nautilus::Interface::MemoryProvider::TupleBufferMemoryProvider> memProviderPagedVector;
 };
 
 }
@@ -0,0 +1,69 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Calculates the exact quantile of all values in a window. The aggregation state is a PagedVector that stores all seen records.
+/// During lower(), we copy the input values into a contiguous array and select the quantile via std::nth_element (introselect),
+/// which takes O(n) on average instead of comparing every value with every other value.
+/// The values keep their input type during the selection, as a double can not represent all 64-bit integers. Only if the quantile falls
+/// between two values, we convert them and interpolate linearly between them. Thus, the quantile 0.5 is the median.
+class QuantileAggregationPhysicalFunction : public AggregationPhysicalFunction
+{
+public:
+    QuantileAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+        std::shared_ptr<Nautilus::Interface::MemoryProvider::TupleBufferMemoryProvider> memProviderPagedVector,
+        double quantile);
+    void lift(
+        const nautilus::val<AggregationState*>& aggregationState,
+        PipelineMemoryProvider& pipelineMemoryProvider,
+        const Nautilus::Record& record) override;
+    void combine(
+        nautilus::val<AggregationState*> aggregationState1,
+        nautilus::val<AggregationState*> aggregationState2,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void reset(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void cleanup(nautilus::val<AggregationState*> aggregationState) override;
+    [[nodiscard]] size_t getSizeOfStateInBytes() const override;
+    ~QuantileAggregationPhysicalFunction() override = default;
+
+    /// Returns the quantile of the values. The values get reordered. Expects at least one value and a quantile in [0, 1].
+    /// Instantiated for all numeric types.
+    template <typename T>
+    static double selectQuantile(std::span<T> values, double quantile);
+
+private:
+    std::shared_ptr<Nautilus::Interface::MemoryProvider::TupleBufferMemoryProvider> memProviderPagedVector;
+    double quantile;
+};
+
+}
@@ -23,8 +23,11 @@
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMapRef.hpp>
 #include <ErrorHandling.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -42,7 +45,8 @@ struct HashMapOptions
         const uint64_t keySize,
         const uint64_t valueSize,
         const uint64_t pageSize,
-        const uint64_t numberOfBuckets)
+        const uint64_t numberOfBuckets,
+        const Nautilus::Interface::HashMapType hashMapType = Nautilus::Interface::HashMapType::CHAINED)
         : hashFunction(std::move(hashFunction))
         , keyFunctions(std::move(keyFunctions))
         , fieldKeys(std::move(fieldKeys))
@@ -53,6 +57,7 @@ struct HashMapOptions
         , valueSize(valueSize)
         , pageSize(pageSize)
         , numberOfBuckets(numberOfBuckets)
+        , hashMapType(hashMapType)
     {
         INVARIANT(entriesPerPage > 0, "The number of entries per page must be greater than 0");
         INVARIANT(entrySize > 0, "The entry size must be greater than 0");
@@ -78,6 +83,7 @@ struct HashMapOptions
         , valueSize(std::move(other.valueSize))
         , pageSize(std::move(other.pageSize))
         , numberOfBuckets(std::move(other.numberOfBuckets))
+        , hashMapType(other.hashMapType)
     {
     }
 
@@ -92,6 +98,7 @@ struct HashMapOptions
         , valueSize(other.valueSize)
         , pageSize(other.pageSize)
         , numberOfBuckets(other.numberOfBuckets)
+        , hashMapType(other.hashMapType)
     {
     }
 
@@ -107,6 +114,7 @@ struct HashMapOptions
         valueSize = std::move(other.valueSize);
         pageSize = std::move(other.pageSize);
         numberOfBuckets = std::move(other.numberOfBuckets);
+        hashMapType = other.hashMapType;
         return *this;
     };
 
@@ -122,6 +130,7 @@ struct HashMapOptions
         valueSize = other.valueSize;
         pageSize = other.pageSize;
         numberOfBuckets = other.numberOfBuckets;
+        hashMapType = other.hashMapType;
         return *this;
     }
 
@@ -144,6 +153,27 @@ struct HashMapOptions
         };
     }
 
+    /// Calls the function with the nautilus wrapper of the configured hash map type, e.g., [&](auto& hashMapRef) { ... }.
+    /// As the hash map type is known during tracing, solely the wrapper of the configured hash map ends up in the compiled code.
+    template <typename Function>
+    void withHashMapRef(const nautilus::val<Nautilus::Interface::HashMap*>& hashMap, Function&& function) const
+    {
+        switch (hashMapType)
+        {
+            case Nautilus::Interface::HashMapType::CHAINED: {
+                Nautilus::Interface::ChainedHashMapRef hashMapRef(hashMap, fieldKeys, fieldValues, entriesPerPage, entrySize);
+                function(hashMapRef);
+                return;
+            }
+            case Nautilus::Interface::HashMapType::OPEN_ADDRESSING: {
+                Nautilus::Interface::OpenAddressingHashMapRef hashMapRef(hashMap, fieldKeys, fieldValues);
+                function(hashMapRef);
+                return;
+            }
+        }
+        INVARIANT(false, "Unknown hash map type {}", static_cast<uint8_t>(hashMapType));
+    }
+
     /// It is fine that these are not nautilus types, because they are only used in the tracing and not in the actual execution
     std::unique_ptr<Nautilus::Interface::HashFunction> hashFunction;
     std::vector<PhysicalFunction> keyFunctions;
@@ -155,6 +185,7 @@ struct HashMapOptions
     uint64_t valueSize;
     uint64_t pageSize;
     uint64_t numberOfBuckets;
+    Nautilus::Interface::HashMapType hashMapType;
 };
 
 }
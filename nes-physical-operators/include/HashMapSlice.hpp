@@ -37,21 +37,28 @@ struct CreateNewHashMapSliceArgs final : CreateNewSlicesArguments
         const uint64_t keySize,
         const uint64_t valueSize,
         const uint64_t pageSize,
-        const uint64_t numberOfBuckets)
+        const uint64_t numberOfBuckets,
+        const Nautilus::Interface::HashMapType hashMapType = Nautilus::Interface::HashMapType::CHAINED)
         : nautilusCleanup(std::move(nautilusCleanup))
         , keySize(keySize)
         , valueSize(valueSize)
         , pageSize(pageSize)
         , numberOfBuckets(numberOfBuckets)
+        , hashMapType(hashMapType)
     {
     }
 
     ~CreateNewHashMapSliceArgs() override = default;
+
+    /// Creates an empty hash map of the configured hash map type
+    [[nodiscard]] std::unique_ptr<Nautilus::Interface::HashMap> createHashMap() const;
+
     std::vector<std::shared_ptr<NautilusCleanupExec>> nautilusCleanup;
     uint64_t keySize;
     uint64_t valueSize;
     uint64_t pageSize;
     uint64_t numberOfBuckets;
+    Nautilus::Interface::HashMapType hashMapType;
 };
 
 /// A HashMapSlice stores a number of hashmaps per input stream. We assume that each input stream has the same number of hashmaps
@@ -79,6 +86,10 @@ public:
 
     [[nodiscard]] uint64_t getNumberOfTuples() const;
 
+    /// Maps the upper 32 bits of the hash onto [0, numberOfRadixPartitions) via a multiply-shift.
+    /// In contrast to masking, this does not require the number of partitions to be a power of two.
+    [[nodiscard]] static uint64_t getRadixPartition(uint64_t hash, uint64_t numberOfRadixPartitions);
+
 protected:
     std::vector<std::unique_ptr<Nautilus::Interface::HashMap>> hashMaps;
     CreateNewHashMapSliceArgs createNewHashMapSliceArgs;
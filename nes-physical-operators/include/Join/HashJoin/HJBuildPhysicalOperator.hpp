@@ -13,11 +13,13 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
 #include <Join/StreamJoinBuildPhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
 #include <Nautilus/Interface/Record.hpp>
@@ -35,11 +37,14 @@ Interface::HashMap* getHashJoinHashMapProxy(
     Timestamp timestamp,
     WorkerThreadId workerThreadId,
     JoinBuildSideType buildSide,
+    Nautilus::Interface::HashFunction::HashValue::raw_type hash,
     const HJBuildPhysicalOperator* buildOperator);
 
 /// This class is the first phase of the join. For both streams (left and right), the tuples are stored in a hash map of a
 /// corresponding slice one after the other. Afterward, the second phase (HJProbe) will start joining the tuples by comparing the join keys
 /// via a hash function.
+/// If numberOfRadixPartitions is larger than 1, the upper bits of the hash of the join keys decide into which partition, i.e., into which
+/// of the hash maps of the worker thread, a tuple gets inserted. Thus, the probe of one partition solely touches a fraction of the state.
 class HJBuildPhysicalOperator final : public StreamJoinBuildPhysicalOperator
 {
 public:
@@ -48,18 +53,21 @@ public:
         Timestamp timestamp,
         WorkerThreadId workerThreadId,
         JoinBuildSideType buildSide,
+        Nautilus::Interface::HashFunction::HashValue::raw_type hash,
         const HJBuildPhysicalOperator* buildOperator);
     HJBuildPhysicalOperator(
         OperatorHandlerId operatorHandlerId,
         JoinBuildSideType joinBuildSide,
         std::unique_ptr<TimeFunction> timeFunction,
         const std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider>& memoryProvider,
-        HashMapOptions hashMapOptions);
+        HashMapOptions hashMapOptions,
+        uint64_t numberOfRadixPartitions = 1);
     void setup(ExecutionContext& executionCtx) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
 
 private:
     HashMapOptions hashMapOptions;
+    uint64_t numberOfRadixPartitions;
 };
 
 }
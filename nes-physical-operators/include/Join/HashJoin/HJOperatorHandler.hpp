@@ -13,12 +13,16 @@
 */
 
 #pragma once
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Join/StreamJoinOperatorHandler.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
@@ -43,14 +47,27 @@ struct EmittedHJWindowTrigger
         rightHashMaps; /// Pointer to the stored pointers of all hash maps of the right input stream that the probe should iterate over
 };
 
+/// If the build is radix-partitioned, each combination of a left and right slice gets probed by one task per partition.
+/// A task solely receives the hash maps of its partition, as tuples of different partitions can not have the same join keys.
+/// Before a sample of the slices gets probed, the handler counts their records and estimates their distinct join keys per input and
+/// reports both to the given JoinStatisticsStore under the keys of the left and right input. Without a store, the handler takes no samples.
 class HJOperatorHandler final : public StreamJoinOperatorHandler
 {
 public:
+    /// Every n-th slice gets sampled
+    static constexpr uint64_t STATISTICS_SAMPLING_INTERVAL = 16;
+
     HJOperatorHandler(
         const std::vector<OriginId>& inputOrigins,
         const OriginId outputOriginId,
-        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        const uint64_t numberOfRadixPartitions = 1,
+        std::shared_ptr<JoinStatisticsStore> statisticsStore = nullptr,
+        std::array<std::string, 2> statisticsInputKeys = {})
         : StreamJoinOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
+        , numberOfRadixPartitions(numberOfRadixPartitions)
+        , statisticsStore(std::move(statisticsStore))
+        , statisticsInputKeys(std::move(statisticsInputKeys))
     {
     }
 
@@ -60,15 +77,26 @@ public:
     void setNautilusCleanupExec(
         std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> nautilusCleanupExec, const JoinBuildSideType& buildSide);
     [[nodiscard]] std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> getNautilusCleanupExec() const;
+    [[nodiscard]] uint64_t getNumberOfRadixPartitions() const;
 
 private:
     /// shared_ptr as multiple slices need access to it
     std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> leftCleanupStateNautilusFunction;
     std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> rightCleanupStateNautilusFunction;
+    uint64_t numberOfRadixPartitions;
+    std::shared_ptr<JoinStatisticsStore> statisticsStore;
+    std::array<std::string, 2> statisticsInputKeys;
+    std::atomic<uint64_t> numberOfProbedSlices{0};
+
+    /// Reports the statistics of every STATISTICS_SAMPLING_INTERVAL-th slice to the JoinStatisticsStore
+    void sampleStatistics(const Slice& slice);
 
+    [[nodiscard]] ProbeTaskSplit splitIntoProbeTasks(Slice& sliceLeft, Slice& sliceRight) const override;
     void emitSlicesToProbe(
         Slice& sliceLeft,
         Slice& sliceRight,
+        const ProbeTaskSplit& split,
+        uint64_t probeTaskIndex,
         const WindowInfo& windowInfo,
         const SequenceData& sequenceData,
         PipelineExecutionContext* pipelineCtx) override;
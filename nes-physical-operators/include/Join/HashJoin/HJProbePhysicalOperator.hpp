@@ -14,13 +14,16 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <Functions/PhysicalFunction.hpp>
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
 #include <Windowing/WindowMetaData.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
@@ -29,6 +32,9 @@ namespace NES
 {
 
 /// Performs the second phase of the join. The tuples are joined via probing the previously built hash tables
+/// If the build is radix-partitioned, a probe task receives the hash maps of one partition. We merge its left hash maps into one temporary
+/// hash map and probe each right entry once against it. Thus, the probe is linear in the size of the partition instead of probing every
+/// right entry against every left hash map.
 class HJProbePhysicalOperator final : public StreamJoinProbePhysicalOperator
 {
 public:
@@ -40,15 +46,45 @@ public:
         std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider> leftMemoryProvider,
         std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider> rightMemoryProvider,
         HashMapOptions leftHashMapBasedOptions,
-        HashMapOptions rightHashMapBasedOptions);
+        HashMapOptions rightHashMapBasedOptions,
+        uint64_t numberOfRadixPartitions = 1);
 
     /// As the second phase gets triggered by the first phase, we receive a tuple buffer containing all information for performing the probe.
     /// Thus, we start a new pipeline and therefore, we create new Records from the built-up state.
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
+    /// Joins all records of the paged vectors of two entries with the same key
+    void joinEntries(
+        ExecutionContext& executionCtx,
+        const Interface::ChainedHashMapRef::ChainedEntryRef& leftEntryRef,
+        const Interface::ChainedHashMapRef::ChainedEntryRef& rightEntryRef,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const;
+
+    /// Probes every right hash map against every left hash map
+    void probeAllHashMaps(
+        ExecutionContext& executionCtx,
+        const nautilus::val<Interface::HashMap**>& leftHashMapRefs,
+        const nautilus::val<uint64_t>& leftNumberOfHashMaps,
+        const nautilus::val<Interface::HashMap**>& rightHashMapRefs,
+        const nautilus::val<uint64_t>& rightNumberOfHashMaps,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const;
+
+    /// Merges the left hash maps of a radix partition into one hash map and probes every right hash map against it
+    void probeMergedHashMap(
+        ExecutionContext& executionCtx,
+        const nautilus::val<Interface::HashMap**>& leftHashMapRefs,
+        const nautilus::val<uint64_t>& leftNumberOfHashMaps,
+        const nautilus::val<Interface::HashMap**>& rightHashMapRefs,
+        const nautilus::val<uint64_t>& rightNumberOfHashMaps,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const;
+
     std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider> leftMemoryProvider, rightMemoryProvider;
     HashMapOptions leftHashMapOptions, rightHashMapOptions;
+    uint64_t numberOfRadixPartitions;
 };
 
 }
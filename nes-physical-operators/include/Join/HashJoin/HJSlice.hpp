@@ -14,11 +14,17 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
+#include <Util/HyperLogLog.hpp>
 #include <HashMapSlice.hpp>
 
 namespace NES
@@ -26,14 +32,42 @@ namespace NES
 
 /// As a hash join has left and right side, we need to handle the left and right side of the join with one slice
 /// Thus, we use a HashMapSlice and set the number of input streams to 2 in its constructor
+/// If the build is radix-partitioned, each worker thread has one hash map per partition. The hash maps of one side are stored partition
+/// after partition, i.e., [Partition 0: [HashMap Worker 0][HashMap Worker 1]...][Partition 1: ...]...
 class HJSlice final : public HashMapSlice
 {
 public:
     HJSlice(
-        SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, uint64_t numberOfHashMaps);
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide) const;
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide);
+        SliceStart sliceStart,
+        SliceEnd sliceEnd,
+        const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
+        uint64_t numberOfHashMaps,
+        uint64_t numberOfRadixPartitions = 1);
+    [[nodiscard]] Nautilus::Interface::HashMap*
+    getHashMapPtr(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, uint64_t partition = 0) const;
+    [[nodiscard]] Nautilus::Interface::HashMap*
+    getHashMapPtrOrCreate(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, uint64_t partition = 0);
     [[nodiscard]] uint64_t getNumberOfHashMapsForSide() const;
+    [[nodiscard]] uint64_t getNumberOfHashMapsForPartition() const;
+    [[nodiscard]] uint64_t getNumberOfRadixPartitions() const;
+
+    /// Adds the hashes of the join keys of one build side to the sketch and returns the number of records of this side.
+    /// Iterates over all entries of the side. Thus, it should only be called for a sample of the slices.
+    uint64_t collectStatistics(const JoinBuildSideType& buildSide, HyperLogLog& keySketch) const;
+
+    /// Spilling writes out the records of all entries, i.e., their PagedVectors. The keys stay in the hash maps, as the entries are chained
+    /// via pointers and new records of a key might still arrive.
+    [[nodiscard]] uint64_t getSpillableStateSizeInBytes() const override;
+    void spillState(std::vector<std::byte>& spilledState) override;
+    void reloadState(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider) override;
+
+private:
+    [[nodiscard]] uint64_t getHashMapPos(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, uint64_t partition) const;
+
+    /// Returns the PagedVector that stores the records of the entry
+    [[nodiscard]] Nautilus::Interface::PagedVector* getRecords(const Nautilus::Interface::HashMap& hashMap, uint64_t entryIdx) const;
+
+    uint64_t numberOfRadixPartitions;
 };
 
 }
@@ -0,0 +1,65 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NES
+{
+
+/// Statistics of one join input per second of event time
+struct JoinInputStatistics
+{
+    double recordsPerSecond = 0;
+    double distinctKeysPerSecond = 0;
+
+    /// Estimates the number of records and distinct keys of the input within a window or slice of the given size
+    [[nodiscard]] double getNumberOfRecords(double durationInMs) const;
+    [[nodiscard]] double getNumberOfDistinctKeys(double durationInMs) const;
+};
+
+/// Store of the statistics of join inputs. Each QueryOptimizer owns one store and shares it with the hash joins that it plans. Running hash
+/// joins sample the records and join keys of their slices and report them for each of their inputs. The optimizer reads them, when it
+/// plans the next join over the same pair of inputs, to choose the join implementation and to size the hash maps.
+/// An input is identified by the names of its join key fields together with those of the input that it is joined with, as these are
+/// qualified by the name of the logical source. Thus, the statistics of an input do not leak into joins with other sources.
+/// The statistics are normalized to one second of event time, as queries differ in their window sizes. We assume that the number of
+/// distinct keys grows proportionally with the duration, which overestimates the keys of long windows.
+class JoinStatisticsStore
+{
+public:
+    /// Creates the key of a join input from the names of its join key fields and of those of the other input, independent of their order
+    /// in the join function
+    [[nodiscard]] static std::string createInputKey(std::vector<std::string> joinFieldNames, std::vector<std::string> otherJoinFieldNames);
+
+    /// Folds the sample into the statistics of the input via an exponential moving average
+    void update(const std::string& inputKey, const JoinInputStatistics& sample);
+
+    [[nodiscard]] std::optional<JoinInputStatistics> get(const std::string& inputKey) const;
+
+    void clear();
+
+private:
+    static constexpr double WEIGHT_OF_NEW_SAMPLE = 0.25;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, JoinInputStatistics> statistics;
+};
+
+}
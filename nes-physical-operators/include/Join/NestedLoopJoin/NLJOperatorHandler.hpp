@@ -26,31 +26,48 @@
 
 namespace NES
 {
-/// This task models the information for a join window trigger
+/// This task models the information for a join window trigger. The probe joins the left tuples [leftStartPos, leftEndPos) with the
+/// right tuples [rightStartPos, rightEndPos), i.e., one tile of the cross product of the left and right slice.
 struct EmittedNLJWindowTrigger
 {
     SliceEnd leftSliceEnd;
     SliceEnd rightSliceEnd;
     WindowInfo windowInfo;
+    uint64_t leftStartPos;
+    uint64_t leftEndPos;
+    uint64_t rightStartPos;
+    uint64_t rightEndPos;
 };
 
+/// To not keep a single worker thread busy with the cross product of two large slices, we split each side into tiles of at least
+/// minNumberOfTuplesPerTile tuples but into at most as many tiles as worker threads. Every combination of a left and a right tile is
+/// emitted as its own probe task. A minNumberOfTuplesPerTile of 0 disables the tiling.
 class NLJOperatorHandler final : public StreamJoinOperatorHandler
 {
 public:
     NLJOperatorHandler(
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
-        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore);
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        uint64_t minNumberOfTuplesPerTile = 0);
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments&) const override;
 
 private:
+    /// Returns into how many tiles a side with the number of tuples gets split
+    [[nodiscard]] uint64_t getNumberOfTiles(uint64_t numberOfTuples) const;
+
+    [[nodiscard]] ProbeTaskSplit splitIntoProbeTasks(Slice& sliceLeft, Slice& sliceRight) const override;
     void emitSlicesToProbe(
         Slice& sliceLeft,
         Slice& sliceRight,
+        const ProbeTaskSplit& split,
+        uint64_t probeTaskIndex,
         const WindowInfo& windowInfo,
         const SequenceData& sequenceData,
         PipelineExecutionContext* pipelineCtx) override;
+
+    uint64_t minNumberOfTuplesPerTile;
 };
 }
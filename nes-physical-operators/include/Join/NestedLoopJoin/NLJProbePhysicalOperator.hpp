@@ -29,7 +29,8 @@ namespace NES
 {
 using namespace Interface::MemoryProvider;
 
-/// Performs the second phase of the join. The tuples are joined via two nested loops.
+/// Performs the second phase of the join. The tuples of one tile, i.e., a range of left and a range of right tuples, are joined via two
+/// nested loops.
 class NLJProbePhysicalOperator final : public StreamJoinProbePhysicalOperator
 {
 public:
@@ -47,6 +48,10 @@ protected:
     void performNLJ(
         const Interface::PagedVectorRef& outerPagedVector,
         const Interface::PagedVectorRef& innerPagedVector,
+        const nautilus::val<uint64_t>& outerStartPos,
+        const nautilus::val<uint64_t>& outerEndPos,
+        const nautilus::val<uint64_t>& innerStartPos,
+        const nautilus::val<uint64_t>& innerEndPos,
         Interface::MemoryProvider::TupleBufferMemoryProvider& outerMemoryProvider,
         Interface::MemoryProvider::TupleBufferMemoryProvider& innerMemoryProvider,
         ExecutionContext& executionCtx,
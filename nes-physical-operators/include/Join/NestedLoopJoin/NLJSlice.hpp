@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
@@ -45,6 +47,11 @@ public:
     /// Moves all tuples in this slice to the PagedVector at 0th index on both sides.
     void combinePagedVectors();
 
+    /// Spilling writes out the pages of all PagedVectors of both sides
+    [[nodiscard]] uint64_t getSpillableStateSizeInBytes() const override;
+    void spillState(std::vector<std::byte>& spilledState) override;
+    void reloadState(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider) override;
+
 private:
     std::vector<std::unique_ptr<Nautilus::Interface::PagedVector>> leftPagedVectors;
     std::vector<std::unique_ptr<Nautilus::Interface::PagedVector>> rightPagedVectors;
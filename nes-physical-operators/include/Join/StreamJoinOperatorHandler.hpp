@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <vector>
@@ -26,6 +27,16 @@
 
 namespace NES
 {
+/// Split of the combination of a left and a right slice into probe tasks, e.g., one per radix partition or one per tile.
+/// The handler splits every combination once when triggering it, so that the chunk numbers and the probe tasks agree, even if further
+/// records arrive until the last probe task is emitted. Thus, handlers that split the tuples of the slices record the numbers of tuples.
+struct ProbeTaskSplit
+{
+    uint64_t numberOfProbeTasks;
+    uint64_t numberOfTuplesLeft = 0;
+    uint64_t numberOfTuplesRight = 0;
+};
+
 /// This operator is the general join operator handler. It is expected that all StreamJoinOperatorHandlers inherit from this class
 class StreamJoinOperatorHandler : public WindowBasedOperatorHandler
 {
@@ -40,10 +51,15 @@ protected:
         const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
         PipelineExecutionContext* pipelineCtx) override;
 
-    /// Emits the left and right slice to the probe
+    /// Returns into how many probe tasks the combination of the left and right slice gets split
+    [[nodiscard]] virtual ProbeTaskSplit splitIntoProbeTasks(Slice& sliceLeft, Slice& sliceRight) const;
+
+    /// Emits the left and right slice to the probe. The probe task index lies in [0, split.numberOfProbeTasks).
     virtual void emitSlicesToProbe(
         Slice& sliceLeft,
         Slice& sliceRight,
+        const ProbeTaskSplit& split,
+        uint64_t probeTaskIndex,
         const WindowInfo& windowInfo,
         const SequenceData& sequenceData,
         PipelineExecutionContext* pipelineCtx)
@@ -41,6 +41,9 @@ public:
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    /// Returns the fields that the scan reads from the tuple buffer
+    [[nodiscard]] const std::vector<Record::RecordFieldIdentifier>& getProjections() const;
+
 private:
     std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider> memoryProvider;
     std::vector<Record::RecordFieldIdentifier> projections;
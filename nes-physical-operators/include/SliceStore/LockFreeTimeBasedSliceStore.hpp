@@ -0,0 +1,85 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceAssigner.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Slice store that finds existing slices without acquiring any lock.
+/// It places a ring of the recently created slices in front of the DefaultTimeBasedSliceStore. The slot of a slice is given by
+/// sliceEnd / sliceSize modulo the ring size, whereby sliceSize is the gcd of the window size and slide,
+/// as every slice end is a multiple of it.
+/// A lookup reads the slot and, if it contains the slice with the searched slice end, returns it. Otherwise, the lookup goes to the
+/// DefaultTimeBasedSliceStore, which stays the owner of all slices and windows, and publishes the returned slice via a CAS into the slot.
+/// The slots are protected by hazard pointers and solely store a weak_ptr to the slice. Thus, a slice is still released by the garbage
+/// collection of the DefaultTimeBasedSliceStore and a stale slot lets the lookup simply take the slower path.
+class LockFreeTimeBasedSliceStore final : public WindowSlicesStoreInterface
+{
+public:
+    LockFreeTimeBasedSliceStore(uint64_t windowSize, uint64_t windowSlide);
+    LockFreeTimeBasedSliceStore(uint64_t windowSize, uint64_t windowSlide, uint64_t numberOfSlots);
+
+    ~LockFreeTimeBasedSliceStore() override;
+    std::vector<std::shared_ptr<Slice>> getSlicesOrCreate(
+        Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+    getTriggerableWindowSlices(Timestamp globalWatermark) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() override;
+    std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) override;
+    std::vector<std::shared_ptr<Slice>> getSlicesEndingIn(Timestamp lowerBound, Timestamp upperBound) override;
+    void garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) override;
+    void deleteState() override;
+    void incrementNumberOfInputPipelines() override;
+    uint64_t getWindowSize() const override;
+
+    /// Number of slots of the ring, if not set explicitly. Must be a power of two.
+    static constexpr uint64_t DEFAULT_NUMBER_OF_SLOTS = 64;
+
+private:
+    /// Entry of a slot in the ring, it gets allocated once the slice is published and retired once the slot is overwritten or cleared
+    struct SliceRingEntry;
+
+    [[nodiscard]] std::atomic<SliceRingEntry*>& getSlot(SliceEnd sliceEnd);
+
+    /// Tries to find the slice for the slice end in the ring. Returns nullptr, if the slot is empty, contains another slice or the slice
+    /// has already been released.
+    [[nodiscard]] std::shared_ptr<Slice> findSlice(SliceEnd sliceEnd);
+
+    /// Publishes the slice into its slot. If another thread publishes into the same slot concurrently, we keep the other slice.
+    void publishSlice(SliceEnd sliceEnd, const std::shared_ptr<Slice>& slice);
+
+    /// Clears all slots, whose slice end is smaller than the given timestamp
+    void clearSlots(Timestamp sliceEndsBefore);
+
+    DefaultTimeBasedSliceStore sliceStore;
+    SliceAssigner sliceAssigner;
+    uint64_t sliceSize;
+    uint64_t slotMask;
+    std::vector<std::atomic<SliceRingEntry*>> slots;
+};
+
+}
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <Time/Timestamp.hpp>
 
 namespace NES
@@ -60,6 +64,17 @@ public:
     bool operator==(const Slice& rhs) const;
     bool operator!=(const Slice& rhs) const;
 
+    /// Returns the number of bytes that spillState() would release. Slices that can not be spilled return 0.
+    [[nodiscard]] virtual uint64_t getSpillableStateSizeInBytes() const;
+
+    /// Appends the spillable state to the spilled state and releases its memory.
+    /// No build task may write into the slice during spilling and reloading, while late records may be added in between.
+    /// Probes must not access the slice until its state got reloaded.
+    virtual void spillState(std::vector<std::byte>& spilledState);
+
+    /// Restores the state at the beginning of the spilled state, which spillState() has appended
+    virtual void reloadState(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider);
+
 protected:
     SliceStart sliceStart;
     SliceEnd sliceEnd;
@@ -0,0 +1,35 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace NES
+{
+class WindowSlicesStoreInterface;
+
+/// Implementations of the WindowSlicesStoreInterface for time-based windows
+enum class SliceStoreType : uint8_t
+{
+    /// Stores the slices and windows in maps that are protected by locks, see DefaultTimeBasedSliceStore
+    DEFAULT,
+    /// Places a ring of recent slices in front of the maps to find existing slices without locking, see LockFreeTimeBasedSliceStore
+    LOCK_FREE
+};
+
+std::unique_ptr<WindowSlicesStoreInterface> provideSliceStore(SliceStoreType sliceStoreType, uint64_t windowSize, uint64_t windowSlide);
+
+}
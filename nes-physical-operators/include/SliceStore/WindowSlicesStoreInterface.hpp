@@ -78,6 +78,9 @@ public:
     /// Retrieves the slice by its end timestamp. If no slice exists for the given slice end, the optional return value is nullopt
     virtual std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) = 0;
 
+    /// Retrieves all slices with lowerBound < sliceEnd <= upperBound, e.g., the slices that a watermark has passed since the last call
+    virtual std::vector<std::shared_ptr<Slice>> getSlicesEndingIn(Timestamp lowerBound, Timestamp upperBound) = 0;
+
     /// Retrieves all current non-deleted slices that have not been triggered yet
     /// This method returns for each window all slices that have not been triggered yet, regardless of any watermark timestamp
     /// Additionally, it returns a sequence number per window that is incremented for each window and thus, it can be used to set it in the emitted tuple buffer for the probe operator.
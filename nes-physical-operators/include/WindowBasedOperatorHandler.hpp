@@ -18,10 +18,14 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/SpillStore.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
@@ -71,8 +75,21 @@ public:
 
     WindowSlicesStoreInterface& getSliceAndWindowStore() const;
 
+    /// Enables spilling the state of slices to the spill store, once the state of all slices that the build watermark has passed exceeds
+    /// the memory budget. Such cold slices only wait for their windows to be triggered, but might still receive late records.
+    /// Spilled slices are reloaded before their windows get triggered.
+    void setSpilling(std::shared_ptr<SpillStore> spillStore, uint64_t memoryBudgetInBytes);
+
+    /// If spilling is enabled, a build task has shared access to all slices from opening until closing its buffer.
+    /// Spilling and reloading slices waits for exclusive access, as late records of running build tasks might write into any slice.
+    /// The pipeline execution context of the task keeps the access, so that a failing build task releases it, too.
+    /// Returns nullptr, if spilling is disabled.
+    using BuildTaskSliceAccess = std::shared_lock<std::shared_mutex>;
+    BuildTaskSliceAccess* startBuildTask(PipelineExecutionContext& pipelineCtx);
+    static void finishBuildTask(BuildTaskSliceAccess* sliceAccess);
+
     /// Updates the corresponding watermark processor, and then garbage collects all slices and windows that are not valid anymore
-    void garbageCollectSlicesAndWindows(const BufferMetaData& bufferMetaData) const;
+    void garbageCollectSlicesAndWindows(const BufferMetaData& bufferMetaData);
 
     /// Checks and triggers windows that are ready to be triggered, e.g., the watermark has passed the window end for time-based windows.
     /// This method updates the watermarkProcessor and is thread-safe
@@ -100,5 +117,51 @@ protected:
     uint64_t numberOfWorkerThreads;
     const OriginId outputOriginId;
     const std::vector<OriginId> inputOrigins;
+
+private:
+    struct ColdSlice
+    {
+        /// We must not extend the lifetime of a slice, as the slice store garbage collects it
+        std::weak_ptr<Slice> slice;
+        uint64_t stateSizeInBytes;
+        std::optional<SpillRegion> spilledRegion;
+    };
+
+    /// Window whose probe tasks have been emitted but not all of them have been processed yet. Its slices must not be spilled.
+    struct PendingWindow
+    {
+        std::vector<SliceEnd> sliceEnds;
+        uint64_t numberOfProcessedProbeTasks{0};
+        /// Known once the probe has processed the task with the last chunk
+        std::optional<uint64_t> numberOfProbeTasks;
+    };
+
+    /// Reloads the spilled slices of the windows that are about to be triggered and marks the windows as pending
+    void reloadSpilledSlices(
+        const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+        PipelineExecutionContext* pipelineCtx);
+
+    /// Registers the slices that became cold and spills the most recent cold slices until their state fits into the memory budget.
+    /// We spill the most recent ones, as they are part of windows that get triggered last.
+    void spillColdSlices(Timestamp newGlobalWatermark);
+
+    /// Counts the processed probe task and removes its window from the pending windows, once all of its probe tasks are processed
+    void finishProbeTask(const SequenceData& sequenceData);
+
+    /// Waits until no build task is running. Build tasks that start afterward wait until the returned lock gets released.
+    [[nodiscard]] std::unique_lock<std::shared_mutex> waitForExclusiveSliceAccess();
+
+    std::shared_ptr<SpillStore> spillStore;
+    uint64_t memoryBudgetInBytes{0};
+    /// Held shared by running build tasks and exclusively while accessing the state of slices for spilling. Acquired after spillMutex.
+    std::shared_mutex buildTaskMutex;
+    /// Held while waiting for exclusive access to buildTaskMutex, so that no new build task acquires it in the meantime
+    std::mutex buildTaskGateMutex;
+    /// Guards all following members. Spilling is skipped if another thread already holds the lock, while reloading waits for it.
+    std::mutex spillMutex;
+    std::map<SliceEnd, ColdSlice> coldSlices;
+    std::map<SequenceNumber, PendingWindow> pendingWindows;
+    Timestamp coldWatermark{Timestamp::INITIAL_VALUE};
+    uint64_t coldStateInMemoryInBytes{0};
 };
 }
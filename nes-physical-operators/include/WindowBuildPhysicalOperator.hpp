@@ -21,6 +21,7 @@
 #include <Watermark/TimeFunction.hpp>
 #include <OperatorState.hpp>
 #include <PhysicalOperator.hpp>
+#include <WindowBasedOperatorHandler.hpp>
 #include <val.hpp>
 
 namespace NES
@@ -30,12 +31,21 @@ namespace NES
 class WindowOperatorBuildLocalState : public OperatorState
 {
 public:
-    explicit WindowOperatorBuildLocalState(const nautilus::val<OperatorHandler*>& operatorHandler) : operatorHandler(operatorHandler) { }
+    WindowOperatorBuildLocalState(
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const nautilus::val<WindowBasedOperatorHandler::BuildTaskSliceAccess*>& buildTaskSliceAccess)
+        : operatorHandler(operatorHandler), buildTaskSliceAccess(buildTaskSliceAccess)
+    {
+    }
 
     nautilus::val<OperatorHandler*> getOperatorHandler() { return operatorHandler; }
 
+    nautilus::val<WindowBasedOperatorHandler::BuildTaskSliceAccess*> getBuildTaskSliceAccess() { return buildTaskSliceAccess; }
+
 private:
     nautilus::val<OperatorHandler*> operatorHandler;
+    /// Shared access of the build task to the slices of the handler, which the build task releases when closing its buffer
+    nautilus::val<WindowBasedOperatorHandler::BuildTaskSliceAccess*> buildTaskSliceAccess;
 };
 
 /// Is the general probe operator for window operators. It is responsible for emitting slices and windows to the second phase (probe).
@@ -36,6 +36,7 @@ struct AggregationPhysicalFunctionRegistryArguments
     PhysicalFunction inputFunction;
     Record::RecordFieldIdentifier resultFieldIdentifier;
     std::optional<std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider>> memProviderPagedVector;
+    std::optional<double> quantile;
 };
 
 class AggregationPhysicalFunctionRegistry : public BaseRegistry<
@@ -23,6 +23,8 @@
 #include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
@@ -40,11 +42,8 @@
 
 namespace NES
 {
-Interface::HashMap* getAggHashMapProxy(
-    const AggregationOperatorHandler* operatorHandler,
-    const Timestamp timestamp,
-    const WorkerThreadId workerThreadId,
-    const AggregationBuildPhysicalOperator* buildOperator)
+AggregationSlice* getAggSliceProxy(
+    const AggregationOperatorHandler* operatorHandler, const Timestamp timestamp, const AggregationBuildPhysicalOperator* buildOperator)
 {
     PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
     PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
@@ -55,7 +54,8 @@ Interface::HashMap* getAggHashMapProxy(
         buildOperator->hashMapOptions.keySize,
         buildOperator->hashMapOptions.valueSize,
         buildOperator->hashMapOptions.pageSize,
-        buildOperator->hashMapOptions.numberOfBuckets};
+        buildOperator->hashMapOptions.numberOfBuckets,
+        buildOperator->hashMapOptions.hashMapType};
     auto wrappedCreateFunction(
         [createFunction = operatorHandler->getCreateNewSlicesFunction(hashMapSliceArgs),
          cleanupStateNautilusFunction = buildOperator->cleanupStateNautilusFunction](const SliceStart sliceStart, const SliceEnd sliceEnd)
@@ -71,25 +71,37 @@ Interface::HashMap* getAggHashMapProxy(
         "slicing, but got {}",
         hashMap.size());
 
-    /// Converting the slice to an AggregationSlice and returning the pointer to the hashmap
+    /// Converting the slice to an AggregationSlice
     const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(hashMap[0]);
     INVARIANT(aggregationSlice != nullptr, "The slice should be an AggregationSlice in an AggregationBuild");
-    return aggregationSlice->getHashMapPtrOrCreate(workerThreadId);
+    return aggregationSlice.get();
 }
 
-void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+Interface::HashMap* getAggHashMapProxy(
+    AggregationSlice* aggregationSlice,
+    const WorkerThreadId workerThreadId,
+    const Nautilus::Interface::HashFunction::HashValue::raw_type hash,
+    const AggregationBuildPhysicalOperator* buildOperator)
 {
-    /// Getting the correspinding slice so that we can update the aggregation states
-    const auto timestamp = timeFunction->getTs(ctx, record);
-    const auto hashMapPtr = invoke(
-        getAggHashMapProxy,
-        ctx.getGlobalOperatorHandler(operatorHandlerId),
-        timestamp,
-        ctx.workerThreadId,
-        nautilus::val<const AggregationBuildPhysicalOperator*>(this));
-    Interface::ChainedHashMapRef hashMap(
-        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
+    PRECONDITION(aggregationSlice != nullptr, "The aggregation slice should not be null");
+    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
+    const auto partition = HashMapSlice::getRadixPartition(hash, buildOperator->numberOfRadixPartitions);
+    return aggregationSlice->getHashMapPtrOrCreate(workerThreadId, partition);
+}
 
+void finishAggWriteProxy(
+    AggregationSlice* aggregationSlice,
+    const Nautilus::Interface::HashFunction::HashValue::raw_type hash,
+    const AggregationBuildPhysicalOperator* buildOperator)
+{
+    PRECONDITION(aggregationSlice != nullptr, "The aggregation slice should not be null");
+    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
+    const auto partition = HashMapSlice::getRadixPartition(hash, buildOperator->numberOfRadixPartitions);
+    aggregationSlice->finishWrite(partition);
+}
+
+void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+{
     /// Calling the key functions to add/update the keys to the record
     for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
     {
@@ -99,23 +111,52 @@ void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& re
         record.write(fieldIdentifier, value);
     }
 
+    /// If the build is radix-partitioned, we need the hash of the keys to pick the hash map of the tuple's partition.
+    /// As the number of partitions is known during tracing, an unpartitioned build does not calculate the hash twice.
+    Nautilus::Interface::HashFunction::HashValue hash = 0;
+    if (numberOfRadixPartitions > 1)
+    {
+        std::vector<VarVal> keyValues;
+        for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(hashMapOptions.fieldKeys))
+        {
+            keyValues.emplace_back(record.read(fieldIdentifier));
+        }
+        hash = hashMapOptions.hashFunction->calculate(keyValues);
+    }
+
+    /// Getting the correspinding slice so that we can update the aggregation states
+    const auto timestamp = timeFunction->getTs(ctx, record);
+    const auto aggregationSlice = invoke(
+        getAggSliceProxy,
+        ctx.getGlobalOperatorHandler(operatorHandlerId),
+        timestamp,
+        nautilus::val<const AggregationBuildPhysicalOperator*>(this));
+    const auto hashMapPtr = invoke(
+        getAggHashMapProxy, aggregationSlice, ctx.workerThreadId, hash, nautilus::val<const AggregationBuildPhysicalOperator*>(this));
+
     /// Finding or creating the entry for the provided record
-    const auto hashMapEntry = hashMap.findOrCreateEntry(
-        record,
-        *hashMapOptions.hashFunction,
-        [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
+    nautilus::val<Interface::AbstractHashMapEntry*> hashMapEntry = nullptr;
+    hashMapOptions.withHashMapRef(
+        hashMapPtr,
+        [&](auto& hashMap)
         {
-            /// If the entry for the provided keys does not exist, we need to create a new one and initialize the aggregation states
-            const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset(
-                entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
-            auto state = static_cast<nautilus::val<AggregationState*>>(entryRefReset.getValueMemArea());
-            for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-            {
-                aggFunction->reset(state, ctx.pipelineMemoryProvider);
-                state = state + aggFunction->getSizeOfStateInBytes();
-            }
-        },
-        ctx.pipelineMemoryProvider.bufferProvider);
+            hashMapEntry = hashMap.findOrCreateEntry(
+                record,
+                *hashMapOptions.hashFunction,
+                [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
+                {
+                    /// If the entry for the provided keys does not exist, we need to create a new one and initialize the aggregation states
+                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset(
+                        entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
+                    auto state = static_cast<nautilus::val<AggregationState*>>(entryRefReset.getValueMemArea());
+                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                    {
+                        aggFunction->reset(state, ctx.pipelineMemoryProvider);
+                        state = state + aggFunction->getSizeOfStateInBytes();
+                    }
+                },
+                ctx.pipelineMemoryProvider.bufferProvider);
+        });
 
 
     /// Updating the aggregation states
@@ -127,17 +168,24 @@ void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& re
         aggFunction->lift(state, ctx.pipelineMemoryProvider, record);
         state = state + aggFunction->getSizeOfStateInBytes();
     }
+
+    /// The record is only part of the slice's partition after it has been aggregated, so that a concurrent probe does not miss it
+    invoke(finishAggWriteProxy, aggregationSlice, hash, nautilus::val<const AggregationBuildPhysicalOperator*>(this));
 }
 
 AggregationBuildPhysicalOperator::AggregationBuildPhysicalOperator(
     const OperatorHandlerId operatorHandlerId,
     std::unique_ptr<TimeFunction> timeFunction,
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions,
-    HashMapOptions hashMapOptions)
+    HashMapOptions hashMapOptions,
+    const uint64_t numberOfRadixPartitions)
     : WindowBuildPhysicalOperator(operatorHandlerId, std::move(timeFunction))
     , aggregationPhysicalFunctions(std::move(aggregationFunctions))
     , hashMapOptions(std::move(hashMapOptions))
+    , numberOfRadixPartitions(numberOfRadixPartitions)
 {
+    PRECONDITION(numberOfRadixPartitions > 0, "The number of radix partitions must be greater than 0");
+
     nautilus::engine::Options options;
     options.setOption("engine.Compilation", false);
     const nautilus::engine::NautilusEngine nautilusEngine(options);
@@ -146,24 +194,25 @@ AggregationBuildPhysicalOperator::AggregationBuildPhysicalOperator(
     /// ReSharper disable once CppPassValueParameterByConstReference
     /// NOLINTBEGIN(performance-unnecessary-value-param)
     cleanupStateNautilusFunction = std::make_shared<NautilusCleanupExec>(nautilusEngine.registerFunction(std::function(
-        [copyOfFieldKeys = this->hashMapOptions.fieldKeys,
-         copyOfFieldValues = this->hashMapOptions.fieldValues,
-         copyOfEntriesPerPage = this->hashMapOptions.entriesPerPage,
-         copyOfEntrySize = this->hashMapOptions.entrySize,
+        [copyOfHashMapOptions = this->hashMapOptions,
          copyOfAggregationFunctions = aggregationPhysicalFunctions](nautilus::val<Nautilus::Interface::HashMap*> hashMap)
         {
-            const Interface::ChainedHashMapRef hashMapRef(
-                hashMap, copyOfFieldKeys, copyOfFieldValues, copyOfEntriesPerPage, copyOfEntrySize);
-            for (const auto entry : hashMapRef)
-            {
-                const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset(entry, hashMap, copyOfFieldKeys, copyOfFieldValues);
-                auto state = static_cast<nautilus::val<AggregationState*>>(entryRefReset.getValueMemArea());
-                for (const auto& aggFunction : nautilus::static_iterable(copyOfAggregationFunctions))
+            copyOfHashMapOptions.withHashMapRef(
+                hashMap,
+                [&](const auto& hashMapRef)
                 {
-                    aggFunction->cleanup(state);
-                    state = state + aggFunction->getSizeOfStateInBytes();
-                }
-            }
+                    for (const auto entry : hashMapRef)
+                    {
+                        const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset(
+                            entry, hashMap, copyOfHashMapOptions.fieldKeys, copyOfHashMapOptions.fieldValues);
+                        auto state = static_cast<nautilus::val<AggregationState*>>(entryRefReset.getValueMemArea());
+                        for (const auto& aggFunction : nautilus::static_iterable(copyOfAggregationFunctions))
+                        {
+                            aggFunction->cleanup(state);
+                            state = state + aggFunction->getSizeOfStateInBytes();
+                        }
+                    }
+                });
         })));
     ///NOLINTEND(performance-unnecessary-value-param)
 }
@@ -22,7 +22,6 @@
 #include <vector>
 #include <Aggregation/AggregationSlice.hpp>
 #include <Identifiers/Identifiers.hpp>
-#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <SliceStore/Slice.hpp>
@@ -34,13 +33,15 @@
 
 namespace NES
 {
-
 AggregationOperatorHandler::AggregationOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
-    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+    const uint64_t numberOfRadixPartitions)
     : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
+    , numberOfRadixPartitions(numberOfRadixPartitions)
 {
+    PRECONDITION(numberOfRadixPartitions > 0, "The number of radix partitions must be greater than 0");
 }
 
 std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
@@ -50,88 +51,109 @@ AggregationOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArgu
         numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Was setWorkerThreads() being called?");
     const auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
     return std::function(
-        [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewHashMapArgs = newHashMapArgs](
-            SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        [outputOriginId = outputOriginId,
+         numberOfWorkerThreads = numberOfWorkerThreads,
+         numberOfRadixPartitions = numberOfRadixPartitions,
+         copyOfNewHashMapArgs = newHashMapArgs](SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
         {
             NES_TRACE("Creating new aggregation slice with for slice {}-{} for output origin {}", sliceStart, sliceEnd, outputOriginId);
-            return {std::make_shared<AggregationSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads)};
+            return {std::make_shared<AggregationSlice>(
+                sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads, numberOfRadixPartitions)};
         });
 }
 
+uint64_t AggregationOperatorHandler::getNumberOfRadixPartitions() const
+{
+    return numberOfRadixPartitions;
+}
+
 void AggregationOperatorHandler::triggerSlices(
     const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
     PipelineExecutionContext* pipelineCtx)
 {
     for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
     {
-        /// Getting all hashmaps for each slice that has at least one tuple
-        std::unique_ptr<Nautilus::Interface::ChainedHashMap> finalHashMap;
-        std::vector<Nautilus::Interface::HashMap*> allHashMaps;
-        uint64_t totalNumberOfTuples = 0;
-        for (const auto& slice : allSlices)
+        /// Each partition of the window is combined by its own probe task. The chunk numbers run over all partitions of the window.
+        for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
         {
-            const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(slice);
-            for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMaps(); ++hashMapIdx)
+            /// Getting all hashmaps of the partition for each slice that have at least one tuple
+            std::vector<AggregationSlice*> aggregationSlices;
+            std::vector<uint64_t> hashMapOffsets;
+            std::vector<Nautilus::Interface::HashMap*> allHashMaps;
+            uint64_t totalNumberOfTuples = 0;
+            for (const auto& slice : allSlices)
             {
-                if (auto* hashMap = aggregationSlice->getHashMapPtr(WorkerThreadId(hashMapIdx));
-                    (hashMap != nullptr) and hashMap->getNumberOfTuples() > 0)
+                auto* const aggregationSlice = dynamic_cast<AggregationSlice*>(slice.get());
+                INVARIANT(aggregationSlice != nullptr, "Slice must be of type AggregationSlice!");
+                aggregationSlices.emplace_back(aggregationSlice);
+                hashMapOffsets.emplace_back(allHashMaps.size());
+                for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMapsForPartition(); ++hashMapIdx)
                 {
-                    allHashMaps.emplace_back(hashMap);
-                    totalNumberOfTuples += hashMap->getNumberOfTuples();
-                    if (not finalHashMap)
+                    if (auto* hashMap = aggregationSlice->getHashMapPtr(WorkerThreadId(hashMapIdx), partition);
+                        (hashMap != nullptr) and hashMap->getNumberOfTuples() > 0)
                     {
-                        finalHashMap = Nautilus::Interface::ChainedHashMap::createNewMapWithSameConfiguration(
-                            *dynamic_cast<Nautilus::Interface::ChainedHashMap*>(hashMap));
+                        allHashMaps.emplace_back(hashMap);
+                        totalNumberOfTuples += hashMap->getNumberOfTuples();
                     }
                 }
             }
+            hashMapOffsets.emplace_back(allHashMaps.size());
+
+            /// We need a buffer that is large enough to store:
+            /// - size of EmittedAggregationWindow
+            /// - all pointers to the slices of the window and the offsets of their hash maps
+            /// - all pointers to all hashmaps of the partition of the window to be triggered
+            const auto neededBufferSize = sizeof(EmittedAggregationWindow) + (aggregationSlices.size() * sizeof(AggregationSlice*))
+                + (hashMapOffsets.size() * sizeof(uint64_t)) + (allHashMaps.size() * sizeof(Nautilus::Interface::HashMap*));
+            const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
+            if (not tupleBufferVal.has_value())
+            {
+                throw CannotAllocateBuffer("{}B for the aggregation window trigger were requested", neededBufferSize);
+            }
+            auto tupleBuffer = tupleBufferVal.value();
+
+            /// It might be that the buffer is not zeroed out.
+            std::memset(tupleBuffer.getBuffer(), 0, neededBufferSize);
+
+            /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
+            /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
+            tupleBuffer.setOriginId(outputOriginId);
+            tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
+            tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL + partition));
+            tupleBuffer.setLastChunk(partition + 1 == numberOfRadixPartitions);
+            tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
+            tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
+
+            /// Writing all necessary information for the aggregation probe to the buffer.
+            /// The probe creates a new hashmap, so that we are not overwriting the thread local hashmaps.
+            auto* bufferMemory = tupleBuffer.getBuffer<EmittedAggregationWindow>();
+            bufferMemory->windowInfo = windowInfo.windowInfo;
+            bufferMemory->finalHashMap = aggregationSlices.front()->createHashMap();
+            bufferMemory->partition = partition;
+            bufferMemory->numberOfSlices = aggregationSlices.size();
+            auto* addressFirstSlicePtr = reinterpret_cast<int8_t*>(bufferMemory) + sizeof(EmittedAggregationWindow);
+            auto* addressFirstHashMapOffset = addressFirstSlicePtr + (aggregationSlices.size() * sizeof(AggregationSlice*));
+            auto* addressFirstHashMapPtr = addressFirstHashMapOffset + (hashMapOffsets.size() * sizeof(uint64_t));
+            bufferMemory->slices = reinterpret_cast<AggregationSlice**>(addressFirstSlicePtr);
+            bufferMemory->hashMapOffsets = reinterpret_cast<uint64_t*>(addressFirstHashMapOffset);
+            bufferMemory->hashMaps = reinterpret_cast<Nautilus::Interface::HashMap**>(addressFirstHashMapPtr);
+            std::memcpy(addressFirstSlicePtr, aggregationSlices.data(), aggregationSlices.size() * sizeof(AggregationSlice*));
+            std::memcpy(addressFirstHashMapOffset, hashMapOffsets.data(), hashMapOffsets.size() * sizeof(uint64_t));
+            std::memcpy(addressFirstHashMapPtr, allHashMaps.data(), allHashMaps.size() * sizeof(Nautilus::Interface::HashMap*));
+
+            /// Dispatching the buffer to the probe operator via the task queue.
+            pipelineCtx->emitBuffer(tupleBuffer);
+            NES_TRACE(
+                "Emitted window {}-{} with watermarkTs {} sequenceNumber {} chunkNumber {} originId {} and {} hashmaps of partition {}",
+                windowInfo.windowInfo.windowStart,
+                windowInfo.windowInfo.windowEnd,
+                tupleBuffer.getWatermark(),
+                tupleBuffer.getSequenceNumber(),
+                tupleBuffer.getChunkNumber(),
+                tupleBuffer.getOriginId(),
+                allHashMaps.size(),
+                partition);
         }
-
-
-        /// We need a buffer that is large enough to store:
-        /// - all pointers to all hashmaps of the window to be triggered
-        /// - a new hashmap for the probe operator, so that we are not overwriting the thread local hashmaps
-        /// - size of EmittedAggregationWindow
-        const auto neededBufferSize = sizeof(EmittedAggregationWindow) + (allHashMaps.size() * sizeof(Nautilus::Interface::HashMap*));
-        const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
-        if (not tupleBufferVal.has_value())
-        {
-            throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededBufferSize);
-        }
-        auto tupleBuffer = tupleBufferVal.value();
-
-        /// It might be that the buffer is not zeroed out.
-        std::memset(tupleBuffer.getBuffer(), 0, neededBufferSize);
-
-        /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
-        /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
-        tupleBuffer.setOriginId(outputOriginId);
-        tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
-        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
-        tupleBuffer.setLastChunk(true);
-        tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
-        tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
-
-
-        /// Writing all necessary information for the aggregation probe to the buffer.
-        auto* bufferMemory = tupleBuffer.getBuffer<EmittedAggregationWindow>();
-        bufferMemory->windowInfo = windowInfo.windowInfo;
-        bufferMemory->numberOfHashMaps = allHashMaps.size();
-        bufferMemory->finalHashMap = std::move(finalHashMap);
-        auto* addressFirstHashMapPtr = reinterpret_cast<int8_t*>(bufferMemory) + sizeof(EmittedAggregationWindow);
-        bufferMemory->hashMaps = reinterpret_cast<Nautilus::Interface::HashMap**>(addressFirstHashMapPtr);
-        std::memcpy(addressFirstHashMapPtr, allHashMaps.data(), allHashMaps.size() * sizeof(Nautilus::Interface::HashMap*));
-
-
-        /// Dispatching the buffer to the probe operator via the task queue.
-        pipelineCtx->emitBuffer(tupleBuffer);
-        NES_TRACE(
-            "Emitted window {}-{} with watermarkTs {} sequenceNumber {} originId {}",
-            windowInfo.windowInfo.windowStart,
-            windowInfo.windowInfo.windowEnd,
-            tupleBuffer.getWatermark(),
-            tupleBuffer.getSequenceNumber(),
-            tupleBuffer.getOriginId());
     }
 }
 
@@ -18,6 +18,7 @@
 #include <utility>
 #include <vector>
 #include <Aggregation/AggregationOperatorHandler.hpp>
+#include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
@@ -40,10 +41,94 @@ Interface::HashMap* getHashMapPtrProxy(const EmittedAggregationWindow* emittedAg
 {
     PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
     PRECONDITION(
-        currentHashMapVal < emittedAggregationWindow->numberOfHashMaps, "curHashMapVal must be smaller than the number of hash maps");
+        currentHashMapVal < emittedAggregationWindow->hashMapOffsets[emittedAggregationWindow->numberOfSlices],
+        "curHashMapVal must be smaller than the number of hash maps");
     return emittedAggregationWindow->hashMaps[currentHashMapVal];
 }
 
+uint64_t getHashMapOffsetProxy(const EmittedAggregationWindow* emittedAggregationWindow, const uint64_t sliceIdx)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    PRECONDITION(sliceIdx <= emittedAggregationWindow->numberOfSlices, "sliceIdx must not be larger than the number of slices");
+    return emittedAggregationWindow->hashMapOffsets[sliceIdx];
+}
+
+AggregationSlice* getSliceProxy(const EmittedAggregationWindow* emittedAggregationWindow, const uint64_t sliceIdx)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    PRECONDITION(sliceIdx < emittedAggregationWindow->numberOfSlices, "sliceIdx must be smaller than the number of slices");
+    return emittedAggregationWindow->slices[sliceIdx];
+}
+
+void AggregationProbePhysicalOperator::combineHashMaps(
+    ExecutionContext& executionCtx,
+    const nautilus::val<Interface::HashMap*>& targetHashMapPtr,
+    const nautilus::val<Interface::HashMap*>& sourceHashMapPtr) const
+{
+    hashMapOptions.withHashMapRef(
+        targetHashMapPtr,
+        [&](auto& targetHashMap)
+        {
+            hashMapOptions.withHashMapRef(
+                sourceHashMapPtr,
+                [&](const auto& sourceHashMap)
+                {
+                    for (const auto entry : sourceHashMap)
+                    {
+                        const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
+                            entry, sourceHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
+
+                        /// Inserting the record key into the target hash map. If an entry for the key already exists, we have to combine the aggregation states
+                        /// We do this by iterating over the aggregation functions and combining all aggregation states into a global state.
+                        targetHashMap.insertOrUpdateEntry(
+                            entryRef.entryRef,
+                            [fieldKeys = hashMapOptions.fieldKeys,
+                             fieldValues = hashMapOptions.fieldValues,
+                             &executionCtx,
+                             &entryRef,
+                             &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
+                             hashMapPtr = sourceHashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnUpdate)
+                            {
+                                /// Combining the aggregation states of the current entry with the aggregation states of the target hash map
+                                const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(
+                                    entryOnUpdate, hashMapPtr, fieldKeys, fieldValues);
+                                auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
+                                auto entryRefState = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                                for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                                {
+                                    aggFunction->combine(globalState, entryRefState, executionCtx.pipelineMemoryProvider);
+                                    globalState = globalState + aggFunction->getSizeOfStateInBytes();
+                                    entryRefState = entryRefState + aggFunction->getSizeOfStateInBytes();
+                                }
+                            },
+                            [fieldKeys = hashMapOptions.fieldKeys,
+                             fieldValues = hashMapOptions.fieldValues,
+                             &executionCtx,
+                             &entryRef,
+                             &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
+                             hashMapPtr = sourceHashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnInsert)
+                            {
+                                /// If the entry for the provided key has not been seen by the target hash map, we need
+                                /// to create a new one and initialize the aggregation states. After that, we can combine the aggregation states.
+                                const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(
+                                    entryOnInsert, hashMapPtr, fieldKeys, fieldValues);
+                                auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
+                                auto entryRefStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                                for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                                {
+                                    /// In contrast to the lambda method above, we have to reset the aggregation state before combining it with the other state
+                                    aggFunction->reset(globalState, executionCtx.pipelineMemoryProvider);
+                                    aggFunction->combine(globalState, entryRefStatePtr, executionCtx.pipelineMemoryProvider);
+                                    globalState = globalState + aggFunction->getSizeOfStateInBytes();
+                                    entryRefStatePtr = entryRefStatePtr + aggFunction->getSizeOfStateInBytes();
+                                }
+                            },
+                            executionCtx.pipelineMemoryProvider.bufferProvider);
+                    }
+                });
+        });
+}
+
 void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
     /// As this operator functions as a scan, we have to set the execution context for this pipeline
@@ -62,102 +147,94 @@ void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, Reco
     const auto windowEnd = invoke(
         +[](const EmittedAggregationWindow* emittedAggregationWindow) { return emittedAggregationWindow->windowInfo.windowEnd; },
         aggregationWindowRef);
-    const auto numberOfHashMaps = invoke(
-        +[](const EmittedAggregationWindow* emittedAggregationWindow) { return emittedAggregationWindow->numberOfHashMaps; },
+    const auto partition = invoke(
+        +[](const EmittedAggregationWindow* emittedAggregationWindow) { return emittedAggregationWindow->partition; },
+        aggregationWindowRef);
+    const auto numberOfSlices = invoke(
+        +[](const EmittedAggregationWindow* emittedAggregationWindow) { return emittedAggregationWindow->numberOfSlices; },
         aggregationWindowRef);
     auto finalHashMapPtr = invoke(
         +[](const EmittedAggregationWindow* emittedAggregationWindow) { return emittedAggregationWindow->finalHashMap.get(); },
         aggregationWindowRef);
 
 
-    /// Combining all keys from all hash maps in the final hash map, and then iterating over the final hash map once to lower the aggregation states
-    Interface::ChainedHashMapRef finalHashMap(
-        finalHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
-    for (nautilus::val<uint64_t> curHashMap = 0; curHashMap < numberOfHashMaps; ++curHashMap)
+    /// Combining all keys from all hash maps of all slices in the final hash map
+    for (nautilus::val<uint64_t> curSlice = 0; curSlice < numberOfSlices; ++curSlice)
     {
-        const auto hashMapPtr = nautilus::invoke(getHashMapPtrProxy, aggregationWindowRef, curHashMap);
-        const Interface::ChainedHashMapRef currentMap(
-            hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
-        for (const auto entry : currentMap)
+        const auto firstHashMap = nautilus::invoke(getHashMapOffsetProxy, aggregationWindowRef, curSlice);
+        const auto endHashMap = nautilus::invoke(getHashMapOffsetProxy, aggregationWindowRef, curSlice + 1);
+
+        /// As cacheSlicePartials is known during tracing, only one of the two variants ends up in the compiled code
+        if (cacheSlicePartials)
         {
-            const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
-                entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
-            const auto tmpRecordKey = entryRef.getKey();
-
-            /// Inserting the record key into the final/global hash map. If an entry for the key already exists, we have to combine the aggregation states
-            /// We do this by iterating over the aggregation functions and combining all aggregation states into a global state.
-            finalHashMap.insertOrUpdateEntry(
-                entryRef.entryRef,
-                [fieldKeys = hashMapOptions.fieldKeys,
-                 fieldValues = hashMapOptions.fieldValues,
-                 &executionCtx,
-                 &entryRef,
-                 &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
-                 hashMapPtr = hashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnUpdate)
-                {
-                    /// Combining the aggregation states of the current entry with the aggregation states of the final hash map
-                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(entryOnUpdate, hashMapPtr, fieldKeys, fieldValues);
-                    auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
-                    auto entryRefState = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-                    {
-                        aggFunction->combine(globalState, entryRefState, executionCtx.pipelineMemoryProvider);
-                        globalState = globalState + aggFunction->getSizeOfStateInBytes();
-                        entryRefState = entryRefState + aggFunction->getSizeOfStateInBytes();
-                    }
-                },
-                [fieldKeys = hashMapOptions.fieldKeys,
-                 fieldValues = hashMapOptions.fieldValues,
-                 &executionCtx,
-                 &entryRef,
-                 &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
-                 hashMapPtr = hashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnInsert)
+            /// Only the first probe of a partition of the slice combines its hash maps into the partial hash map.
+            /// Other probes of the same partition of the slice wait until the partial hash map is complete.
+            const auto slicePtr = nautilus::invoke(getSliceProxy, aggregationWindowRef, curSlice);
+            const auto partialHashMapPtr = nautilus::invoke(
+                +[](AggregationSlice* slice, const uint64_t slicePartition) { return slice->lockPartialHashMap(slicePartition); },
+                slicePtr,
+                partition);
+            const auto isCombined = nautilus::invoke(
+                +[](AggregationSlice* slice, const uint64_t slicePartition) { return slice->isPartialHashMapCombined(slicePartition); },
+                slicePtr,
+                partition);
+            if (not isCombined)
+            {
+                for (nautilus::val<uint64_t> curHashMap = firstHashMap; curHashMap < endHashMap; ++curHashMap)
                 {
-                    /// If the entry for the provided key has not been seen by this hash map / worker thread, we need
-                    /// to create a new one and initialize the aggregation states. After that, we can combine the aggregation states.
-                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(entryOnInsert, hashMapPtr, fieldKeys, fieldValues);
-                    auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
-                    auto entryRefStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-                    {
-                        /// In contrast to the lambda method above, we have to reset the aggregation state before combining it with the other state
-                        aggFunction->reset(globalState, executionCtx.pipelineMemoryProvider);
-                        aggFunction->combine(globalState, entryRefStatePtr, executionCtx.pipelineMemoryProvider);
-                        globalState = globalState + aggFunction->getSizeOfStateInBytes();
-                        entryRefStatePtr = entryRefStatePtr + aggFunction->getSizeOfStateInBytes();
-                    }
-                },
-                executionCtx.pipelineMemoryProvider.bufferProvider);
+                    const auto hashMapPtr = nautilus::invoke(getHashMapPtrProxy, aggregationWindowRef, curHashMap);
+                    combineHashMaps(executionCtx, partialHashMapPtr, hashMapPtr);
+                }
+            }
+            nautilus::invoke(
+                +[](AggregationSlice* slice, const uint64_t slicePartition) { slice->unlockPartialHashMap(slicePartition); },
+                slicePtr,
+                partition);
+            combineHashMaps(executionCtx, finalHashMapPtr, partialHashMapPtr);
+        }
+        else
+        {
+            for (nautilus::val<uint64_t> curHashMap = firstHashMap; curHashMap < endHashMap; ++curHashMap)
+            {
+                const auto hashMapPtr = nautilus::invoke(getHashMapPtrProxy, aggregationWindowRef, curHashMap);
+                combineHashMaps(executionCtx, finalHashMapPtr, hashMapPtr);
+            }
         }
     }
 
-    /// Lowering, each aggregation state in the final hash map and passing the record to the child
-    for (const auto entry : finalHashMap)
-    {
-        const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
-            entry, finalHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
-        const auto recordKey = entryRef.getKey();
-        Record outputRecord;
-        for (auto finalStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-             const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+    /// Iterating over the final hash map once to lower the aggregation states
+    hashMapOptions.withHashMapRef(
+        finalHashMapPtr,
+        [&](auto& finalHashMap)
         {
-            outputRecord.reassignFields(aggFunction->lower(finalStatePtr, executionCtx.pipelineMemoryProvider));
-            finalStatePtr = finalStatePtr + aggFunction->getSizeOfStateInBytes();
-        }
+            /// Lowering, each aggregation state in the final hash map and passing the record to the child
+            for (const auto entry : finalHashMap)
+            {
+                const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
+                    entry, finalHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
+                const auto recordKey = entryRef.getKey();
+                Record outputRecord;
+                for (auto finalStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                     const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                {
+                    outputRecord.reassignFields(aggFunction->lower(finalStatePtr, executionCtx.pipelineMemoryProvider));
+                    finalStatePtr = finalStatePtr + aggFunction->getSizeOfStateInBytes();
+                }
 
-        /// Adding the window start and end to the output record and then passing the record to the child
-        outputRecord.reassignFields(recordKey);
-        outputRecord.write(windowMetaData.windowStartFieldName, windowStart.convertToValue());
-        outputRecord.write(windowMetaData.windowEndFieldName, windowEnd.convertToValue());
-        executeChild(executionCtx, outputRecord);
+                /// Adding the window start and end to the output record and then passing the record to the child
+                outputRecord.reassignFields(recordKey);
+                outputRecord.write(windowMetaData.windowStartFieldName, windowStart.convertToValue());
+                outputRecord.write(windowMetaData.windowEndFieldName, windowEnd.convertToValue());
+                executeChild(executionCtx, outputRecord);
 
-        for (auto finalStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-             const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-        {
-            aggFunction->cleanup(finalStatePtr);
-            finalStatePtr = finalStatePtr + aggFunction->getSizeOfStateInBytes();
-        }
-    }
+                for (auto finalStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                     const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                {
+                    aggFunction->cleanup(finalStatePtr);
+                    finalStatePtr = finalStatePtr + aggFunction->getSizeOfStateInBytes();
+                }
+            }
+        });
 
     /// As we are creating a new hash map for the probe operator, we have to reset/destroy the final hash map of the emitted aggregation window
     nautilus::invoke(
@@ -176,10 +253,12 @@ AggregationProbePhysicalOperator::AggregationProbePhysicalOperator(
     HashMapOptions hashMapOptions,
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
     const OperatorHandlerId operatorHandlerId,
-    WindowMetaData windowMetaData)
+    WindowMetaData windowMetaData,
+    const bool cacheSlicePartials)
     : WindowProbePhysicalOperator(operatorHandlerId, std::move(windowMetaData))
     , aggregationPhysicalFunctions(std::move(aggregationPhysicalFunctions))
     , hashMapOptions(std::move(hashMapOptions))
+    , cacheSlicePartials(cacheSlicePartials)
 {
 }
 }
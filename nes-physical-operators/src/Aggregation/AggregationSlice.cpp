@@ -17,7 +17,6 @@
 #include <memory>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
-#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
 #include <ErrorHandling.hpp>
@@ -29,32 +28,122 @@ AggregationSlice::AggregationSlice(
     const SliceStart sliceStart,
     const SliceEnd sliceEnd,
     const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
-    const uint64_t numberOfHashMaps)
-    : HashMapSlice(sliceStart, sliceEnd, createNewHashMapSliceArgs, numberOfHashMaps, 1)
+    const uint64_t numberOfHashMaps,
+    const uint64_t numberOfRadixPartitions)
+    : HashMapSlice(sliceStart, sliceEnd, createNewHashMapSliceArgs, numberOfHashMaps * numberOfRadixPartitions, 1)
+    , numberOfRadixPartitions(numberOfRadixPartitions)
+    , partialHashMaps(numberOfRadixPartitions)
 {
+    PRECONDITION(numberOfRadixPartitions > 0, "The number of radix partitions must be greater than 0");
 }
 
-Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtr(const WorkerThreadId workerThreadId) const
+AggregationSlice::~AggregationSlice()
 {
-    const auto pos = workerThreadId % hashMaps.size();
-    INVARIANT(pos < hashMaps.size(), "The worker thread id should be smaller than the number of hashmaps");
-    return hashMaps[pos].get();
+    /// The partial hash maps contain aggregation states, too. Thus, we have to clean them up like the hash maps of the worker threads.
+    for (const auto& partialHashMap : partialHashMaps)
+    {
+        if (partialHashMap.hashMap and partialHashMap.hashMap->getNumberOfTuples() > 0)
+        {
+            createNewHashMapSliceArgs.nautilusCleanup[0]->operator()(partialHashMap.hashMap.get());
+        }
+    }
+}
+
+uint64_t AggregationSlice::getHashMapPos(const WorkerThreadId workerThreadId, const uint64_t partition) const
+{
+    const auto numberOfHashMapsForPartition = getNumberOfHashMapsForPartition();
+    const auto pos = (workerThreadId % numberOfHashMapsForPartition) + (partition * numberOfHashMapsForPartition);
+    INVARIANT(
+        partition < numberOfRadixPartitions and pos < hashMaps.size(),
+        "No hashmap found for workerThreadId {} and partition {} at pos {} for {} hashmaps",
+        workerThreadId,
+        partition,
+        pos,
+        hashMaps.size());
+    return pos;
 }
 
-Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId)
+Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const uint64_t partition) const
 {
-    const auto pos = workerThreadId % hashMaps.size();
-    INVARIANT(pos < hashMaps.size(), "The worker thread id should be smaller than the number of hashmaps");
+    return hashMaps[getHashMapPos(workerThreadId, partition)].get();
+}
 
+Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const uint64_t partition)
+{
+    const auto pos = getHashMapPos(workerThreadId, partition);
     if (hashMaps.at(pos) == nullptr)
     {
-        hashMaps.at(pos) = std::make_unique<Nautilus::Interface::ChainedHashMap>(
-            createNewHashMapSliceArgs.keySize,
-            createNewHashMapSliceArgs.valueSize,
-            createNewHashMapSliceArgs.numberOfBuckets,
-            createNewHashMapSliceArgs.pageSize);
+        hashMaps.at(pos) = createNewHashMapSliceArgs.createHashMap();
     }
     return hashMaps[pos].get();
 }
 
+void AggregationSlice::finishWrite(const uint64_t partition)
+{
+    /// Only writes after the first probe of the partition pay for the shared counter, as these are rare (e.g., late records).
+    /// We count the write after the record is in the hash map. Otherwise, a probe could combine the partition after counting the write
+    /// but before the record arrives, and would then consider the partial hash map to contain the record.
+    if (auto& partialHashMap = partialHashMaps[partition]; partialHashMap.probed.load())
+    {
+        partialHashMap.numberOfWrites.fetch_add(1);
+    }
+}
+
+uint64_t AggregationSlice::getNumberOfHashMapsForPartition() const
+{
+    return numberOfHashMapsPerInputStream / numberOfRadixPartitions;
+}
+
+uint64_t AggregationSlice::getNumberOfRadixPartitions() const
+{
+    return numberOfRadixPartitions;
+}
+
+std::unique_ptr<Nautilus::Interface::HashMap> AggregationSlice::createHashMap() const
+{
+    return createNewHashMapSliceArgs.createHashMap();
+}
+
+Nautilus::Interface::HashMap* AggregationSlice::lockPartialHashMap(const uint64_t partition)
+{
+    PRECONDITION(partition < numberOfRadixPartitions, "Partition {} does not exist for {} partitions", partition, numberOfRadixPartitions);
+    auto& partialHashMap = partialHashMaps[partition];
+    partialHashMap.mutex.lock();
+
+    /// All writes that finish after probed is set increment numberOfWrites and thus invalidate the combined partial hash map
+    partialHashMap.probed.store(true);
+    partialHashMap.writesOnLock = partialHashMap.numberOfWrites.load();
+    if (partialHashMap.combinedWrites.has_value() and partialHashMap.combinedWrites.value() != partialHashMap.writesOnLock)
+    {
+        /// A build task has written to the partition since it was combined. Thus, the caller has to combine the partition again.
+        if (partialHashMap.hashMap->getNumberOfTuples() > 0)
+        {
+            createNewHashMapSliceArgs.nautilusCleanup[0]->operator()(partialHashMap.hashMap.get());
+        }
+        partialHashMap.hashMap.reset();
+        partialHashMap.combinedWrites.reset();
+    }
+
+    if (not partialHashMap.hashMap)
+    {
+        partialHashMap.hashMap = createNewHashMapSliceArgs.createHashMap();
+    }
+    return partialHashMap.hashMap.get();
+}
+
+bool AggregationSlice::isPartialHashMapCombined(const uint64_t partition) const
+{
+    return partialHashMaps[partition].combinedWrites.has_value();
+}
+
+void AggregationSlice::unlockPartialHashMap(const uint64_t partition)
+{
+    auto& partialHashMap = partialHashMaps[partition];
+    if (not partialHashMap.combinedWrites.has_value())
+    {
+        partialHashMap.combinedWrites = partialHashMap.writesOnLock;
+    }
+    partialHashMap.mutex.unlock();
+}
+
 }
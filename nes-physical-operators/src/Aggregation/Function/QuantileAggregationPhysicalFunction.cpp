@@ -0,0 +1,259 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/QuantileAggregationPhysicalFunction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <magic_enum/magic_enum.hpp>
+#include <nautilus/function.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+QuantileAggregationPhysicalFunction::QuantileAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+    std::shared_ptr<Nautilus::Interface::MemoryProvider::TupleBufferMemoryProvider> memProviderPagedVector,
+    const double quantile)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , memProviderPagedVector(std::move(memProviderPagedVector))
+    , quantile(quantile)
+{
+    PRECONDITION(0 <= quantile and quantile <= 1, "The quantile must be in [0, 1] but was {}", quantile);
+}
+
+template <typename T>
+double QuantileAggregationPhysicalFunction::selectQuantile(const std::span<T> values, const double quantile)
+{
+    PRECONDITION(not values.empty(), "Can not calculate the quantile of zero values");
+
+    /// The quantile lies at the (fractional) position rank of the sorted values
+    const auto rank = quantile * static_cast<double>(values.size() - 1);
+    const auto lowerPos = static_cast<size_t>(std::floor(rank));
+    const auto lowerIt = values.begin() + static_cast<std::ptrdiff_t>(lowerPos);
+    std::ranges::nth_element(values, lowerIt);
+    const auto lowerValue = *lowerIt;
+    if (lowerPos + 1 == values.size() or rank == static_cast<double>(lowerPos))
+    {
+        return static_cast<double>(lowerValue);
+    }
+
+    /// nth_element places all values that are not smaller behind lowerPos. Thus, the next value of the sorted values is their minimum.
+    const auto upperValue = *std::ranges::min_element(lowerIt + 1, values.end());
+    const auto fraction = rank - static_cast<double>(lowerPos);
+    if constexpr (std::is_integral_v<T>)
+    {
+        /// The distance between two integers is exact in the unsigned type of the same width, even if it exceeds the signed range.
+        /// We interpolate in long double, which represents all 64-bit integers on x86, and round only the result to a double.
+        using UnsignedT = std::make_unsigned_t<T>;
+        const auto distance = static_cast<UnsignedT>(static_cast<UnsignedT>(upperValue) - static_cast<UnsignedT>(lowerValue));
+        return static_cast<double>(
+            static_cast<long double>(lowerValue) + (static_cast<long double>(fraction) * static_cast<long double>(distance)));
+    }
+    else
+    {
+        return static_cast<double>(lowerValue) + (fraction * (static_cast<double>(upperValue) - static_cast<double>(lowerValue)));
+    }
+}
+
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<uint8_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<uint16_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<uint32_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<uint64_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<int8_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<int16_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<int32_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<int64_t>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<float>, double);
+template double QuantileAggregationPhysicalFunction::selectQuantile(std::span<double>, double);
+
+namespace
+{
+template <typename T>
+double selectQuantileProxy(int8_t* valuesPtr, const uint64_t numberOfValues, const double quantile)
+{
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return QuantileAggregationPhysicalFunction::selectQuantile(std::span(reinterpret_cast<T*>(valuesPtr), numberOfValues), quantile);
+}
+
+nautilus::val<double> selectQuantileOfType(
+    const DataType::Type type,
+    const nautilus::val<int8_t*>& values,
+    const nautilus::val<uint64_t>& numberOfValues,
+    const nautilus::val<double>& quantile)
+{
+    switch (type)
+    {
+        case DataType::Type::UINT8:
+            return nautilus::invoke(selectQuantileProxy<uint8_t>, values, numberOfValues, quantile);
+        case DataType::Type::UINT16:
+            return nautilus::invoke(selectQuantileProxy<uint16_t>, values, numberOfValues, quantile);
+        case DataType::Type::UINT32:
+            return nautilus::invoke(selectQuantileProxy<uint32_t>, values, numberOfValues, quantile);
+        case DataType::Type::UINT64:
+            return nautilus::invoke(selectQuantileProxy<uint64_t>, values, numberOfValues, quantile);
+        case DataType::Type::INT8:
+            return nautilus::invoke(selectQuantileProxy<int8_t>, values, numberOfValues, quantile);
+        case DataType::Type::INT16:
+            return nautilus::invoke(selectQuantileProxy<int16_t>, values, numberOfValues, quantile);
+        case DataType::Type::INT32:
+            return nautilus::invoke(selectQuantileProxy<int32_t>, values, numberOfValues, quantile);
+        case DataType::Type::INT64:
+            return nautilus::invoke(selectQuantileProxy<int64_t>, values, numberOfValues, quantile);
+        case DataType::Type::FLOAT32:
+            return nautilus::invoke(selectQuantileProxy<float>, values, numberOfValues, quantile);
+        case DataType::Type::FLOAT64:
+            return nautilus::invoke(selectQuantileProxy<double>, values, numberOfValues, quantile);
+        case DataType::Type::BOOLEAN:
+        case DataType::Type::CHAR:
+        case DataType::Type::UNDEFINED:
+        case DataType::Type::VARSIZED:
+        case DataType::Type::VARSIZED_POINTER_REP:
+            break;
+    }
+    throw UnknownDataType("Can not calculate the quantile of values of type {}", magic_enum::enum_name(type));
+}
+}
+
+void QuantileAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState, PipelineMemoryProvider& pipelineMemoryProvider, const Record& record)
+{
+    /// Adding the record to the paged vector. We are storing the full record in the paged vector for now.
+    const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
+    const Interface::PagedVectorRef pagedVectorRef(memArea, memProviderPagedVector);
+    pagedVectorRef.writeRecord(record, pipelineMemoryProvider.bufferProvider);
+}
+
+void QuantileAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    /// Getting the paged vectors from the aggregation states
+    const auto memArea1 = static_cast<nautilus::val<Interface::PagedVector*>>(aggregationState1);
+    const auto memArea2 = static_cast<nautilus::val<Interface::PagedVector*>>(aggregationState2);
+
+    /// Calling the copyFrom function of the paged vector to combine the two paged vectors by copying the content of the second paged
+    /// vector to the first paged vector
+    nautilus::invoke(
+        +[](Interface::PagedVector* vector1, const Interface::PagedVector* vector2) -> void { vector1->copyFrom(*vector2); },
+        memArea1,
+        memArea2);
+}
+
+Nautilus::Record QuantileAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    /// Getting the paged vector from the aggregation state
+    const auto pagedVectorPtr = static_cast<nautilus::val<Interface::PagedVector*>>(aggregationState);
+    const Interface::PagedVectorRef pagedVectorRef(pagedVectorPtr, memProviderPagedVector);
+    const auto allFieldNames = memProviderPagedVector->getMemoryLayout()->getSchema().getFieldNames();
+    const auto numberOfEntries = invoke(
+        +[](const Interface::PagedVector* pagedVector)
+        {
+            const auto numberOfEntriesVal = pagedVector->getTotalNumberOfEntries();
+            INVARIANT(numberOfEntriesVal > 0, "The number of entries in the paged vector must be greater than 0");
+            return numberOfEntriesVal;
+        },
+        pagedVectorPtr);
+
+    /// Copying the input values in their input type into a contiguous array.
+    /// The array lives in the arena, i.e., it gets released after this pipeline invocation.
+    const auto valueSize = nautilus::val<uint64_t>(inputType.getSizeInBytes());
+    const auto values = pipelineMemoryProvider.arena.allocateMemory(numberOfEntries * valueSize);
+    auto curValue = values;
+    const auto endIt = pagedVectorRef.end(allFieldNames);
+    for (auto it = pagedVectorRef.begin(allFieldNames); it != endIt; ++it)
+    {
+        const auto value = inputFunction.execute(*it, pipelineMemoryProvider.arena);
+        value.castToType(inputType.type).writeToMemory(curValue);
+        curValue = curValue + valueSize;
+    }
+
+    /// Selecting the quantile from the array
+    const auto quantileValue = selectQuantileOfType(inputType.type, values, numberOfEntries, nautilus::val<double>(quantile));
+
+    /// Adding the quantile to the result record
+    Record resultRecord;
+    resultRecord.write(resultFieldIdentifier, VarVal(quantileValue).castToType(resultType.type));
+    return resultRecord;
+}
+
+void QuantileAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    nautilus::invoke(
+        +[](AggregationState* pagedVectorMemArea) -> void
+        {
+            /// Allocates a new PagedVector in the memory area provided by the pointer to the pagedvector
+            auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
+            new (pagedVector) Nautilus::Interface::PagedVector();
+        },
+        aggregationState);
+}
+
+void QuantileAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*> aggregationState)
+{
+    invoke(
+        +[](AggregationState* pagedVectorMemArea) -> void
+        {
+            /// Calls the destructor of the PagedVector
+            auto* pagedVector
+                = reinterpret_cast<Interface::PagedVector*>(pagedVectorMemArea); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            pagedVector->~PagedVector();
+        },
+        aggregationState);
+}
+
+size_t QuantileAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return sizeof(Interface::PagedVector);
+}
+
+AggregationPhysicalFunctionRegistryReturnType AggregationPhysicalFunctionGeneratedRegistrar::RegisterQuantileAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.memProviderPagedVector.has_value(), "Memory provider paged vector not set");
+    INVARIANT(arguments.quantile.has_value(), "Quantile not set");
+    return std::make_shared<QuantileAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.resultFieldIdentifier,
+        arguments.memProviderPagedVector.value(),
+        arguments.quantile.value());
+}
+
+}
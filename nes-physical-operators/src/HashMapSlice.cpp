@@ -24,12 +24,26 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
 #include <SliceStore/Slice.hpp>
 #include <ErrorHandling.hpp>
 
 namespace NES
 {
 
+std::unique_ptr<Nautilus::Interface::HashMap> CreateNewHashMapSliceArgs::createHashMap() const
+{
+    switch (hashMapType)
+    {
+        case Nautilus::Interface::HashMapType::CHAINED:
+            return std::make_unique<Nautilus::Interface::ChainedHashMap>(keySize, valueSize, numberOfBuckets, pageSize);
+        case Nautilus::Interface::HashMapType::OPEN_ADDRESSING:
+            return std::make_unique<Nautilus::Interface::OpenAddressingHashMap>(keySize, valueSize, numberOfBuckets, pageSize);
+    }
+    INVARIANT(false, "Unknown hash map type {}", static_cast<uint8_t>(hashMapType));
+    std::unreachable();
+}
+
 HashMapSlice::HashMapSlice(
     const SliceStart sliceStart,
     const SliceEnd sliceEnd,
@@ -78,4 +92,12 @@ uint64_t HashMapSlice::getNumberOfTuples() const
         0,
         [](uint64_t runningSum, const auto& hashMap) { return runningSum + hashMap->getNumberOfTuples(); });
 }
+
+uint64_t HashMapSlice::getRadixPartition(const uint64_t hash, const uint64_t numberOfRadixPartitions)
+{
+    /// The hash maps use the lower bits of the hash to find the chain / slot of a key. Thus, we take the upper bits for the partition
+    /// so that the keys of one partition are still spread over all chains / slots of its hash maps.
+    constexpr uint64_t upperBits = 32;
+    return ((hash >> upperBits) * numberOfRadixPartitions) >> upperBits;
+}
 }
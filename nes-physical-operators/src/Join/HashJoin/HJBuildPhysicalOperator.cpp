@@ -18,11 +18,14 @@
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
 #include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinBuildPhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
@@ -48,6 +51,7 @@ Interface::HashMap* getHashJoinHashMapProxy(
     const Timestamp timestamp,
     const WorkerThreadId workerThreadId,
     const JoinBuildSideType buildSide,
+    const Nautilus::Interface::HashFunction::HashValue::raw_type hash,
     const HJBuildPhysicalOperator* buildOperator)
 {
     PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
@@ -58,7 +62,8 @@ Interface::HashMap* getHashJoinHashMapProxy(
         buildOperator->hashMapOptions.keySize,
         buildOperator->hashMapOptions.valueSize,
         buildOperator->hashMapOptions.pageSize,
-        buildOperator->hashMapOptions.numberOfBuckets};
+        buildOperator->hashMapOptions.numberOfBuckets,
+        buildOperator->hashMapOptions.hashMapType};
     const auto hashMap = operatorHandler->getSliceAndWindowStore().getSlicesOrCreate(
         timestamp, operatorHandler->getCreateNewSlicesFunction(hashMapSliceArgs));
     INVARIANT(
@@ -70,7 +75,8 @@ Interface::HashMap* getHashJoinHashMapProxy(
     /// Converting the slice to an HJSlice and returning the pointer to the hashmap
     const auto hjSlice = std::dynamic_pointer_cast<HJSlice>(hashMap[0]);
     INVARIANT(hjSlice != nullptr, "The slice should be an HJSlice in an HJBuildPhysicalOperator");
-    return hjSlice->getHashMapPtrOrCreate(workerThreadId, buildSide);
+    const auto partition = HashMapSlice::getRadixPartition(hash, buildOperator->numberOfRadixPartitions);
+    return hjSlice->getHashMapPtrOrCreate(workerThreadId, buildSide, partition);
 }
 
 void HJBuildPhysicalOperator::setup(ExecutionContext& executionCtx) const
@@ -90,28 +96,28 @@ void HJBuildPhysicalOperator::setup(ExecutionContext& executionCtx) const
             /// NOLINTBEGIN(performance-unnecessary-value-param)
             const auto cleanupStateNautilusFunction
                 = std::make_shared<CreateNewHashMapSliceArgs::NautilusCleanupExec>(nautilusEngine.registerFunction(std::function(
-                    [copyOfFieldKeys = buildOperator->hashMapOptions.fieldKeys,
-                     copyOfFieldValues = buildOperator->hashMapOptions.fieldValues,
-                     copyOfEntriesPerPage = buildOperator->hashMapOptions.entriesPerPage,
-                     copyOfEntrySize = buildOperator->hashMapOptions.entrySize](nautilus::val<Nautilus::Interface::HashMap*> hashMap)
+                    [copyOfHashMapOptions = buildOperator->hashMapOptions](nautilus::val<Nautilus::Interface::HashMap*> hashMap)
                     {
-                        const Interface::ChainedHashMapRef hashMapRef(
-                            hashMap, copyOfFieldKeys, copyOfFieldValues, copyOfEntriesPerPage, copyOfEntrySize);
-                        for (const auto entry : hashMapRef)
-                        {
-                            const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset(
-                                entry, hashMap, copyOfFieldKeys, copyOfFieldValues);
-                            const auto state = entryRefReset.getValueMemArea();
-                            nautilus::invoke(
-                                +[](int8_t* pagedVectorMemArea) -> void
+                        copyOfHashMapOptions.withHashMapRef(
+                            hashMap,
+                            [&](const auto& hashMapRef)
+                            {
+                                for (const auto entry : hashMapRef)
                                 {
-                                    /// Calls the destructor of the PagedVector
-                                    /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                                    auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
-                                    pagedVector->~PagedVector();
-                                },
-                                state);
-                        }
+                                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset(
+                                        entry, hashMap, copyOfHashMapOptions.fieldKeys, copyOfHashMapOptions.fieldValues);
+                                    const auto state = entryRefReset.getValueMemArea();
+                                    nautilus::invoke(
+                                        +[](int8_t* pagedVectorMemArea) -> void
+                                        {
+                                            /// Calls the destructor of the PagedVector
+                                            /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                                            auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
+                                            pagedVector->~PagedVector();
+                                        },
+                                        state);
+                                }
+                            });
                     })));
             /// NOLINTEND(performance-unnecessary-value-param)
             operatorHandler->setNautilusCleanupExec(cleanupStateNautilusFunction, buildSide);
@@ -127,6 +133,28 @@ void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) con
     auto* localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
     auto operatorHandler = localState->getOperatorHandler();
 
+    /// Calling the key functions to add/update the keys to the record
+    for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
+    {
+        const auto& [fieldIdentifier, type, fieldOffset] = hashMapOptions.fieldKeys[i];
+        const auto& function = hashMapOptions.keyFunctions[i];
+        const auto value = function.execute(record, ctx.pipelineMemoryProvider.arena);
+        record.write(fieldIdentifier, value);
+    }
+
+    /// If the build is radix-partitioned, we need the hash of the keys to pick the hash map of the tuple's partition.
+    /// As the number of partitions is known during tracing, an unpartitioned build does not calculate the hash twice.
+    Nautilus::Interface::HashFunction::HashValue hash = 0;
+    if (numberOfRadixPartitions > 1)
+    {
+        std::vector<VarVal> keyValues;
+        for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(hashMapOptions.fieldKeys))
+        {
+            keyValues.emplace_back(record.read(fieldIdentifier));
+        }
+        hash = hashMapOptions.hashFunction->calculate(keyValues);
+    }
+
     /// Get the current slice / hash map that we have to insert the tuple into
     const auto timestamp = timeFunction->getTs(ctx, record);
     const auto hashMapPtr = invoke(
@@ -135,40 +163,36 @@ void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) con
         timestamp,
         ctx.workerThreadId,
         nautilus::val<JoinBuildSideType>(joinBuildSide),
+        hash,
         nautilus::val<const HJBuildPhysicalOperator*>(this));
-    Interface::ChainedHashMapRef hashMap{
-        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize};
-
-    /// Calling the key functions to add/update the keys to the record
-    for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
-    {
-        const auto& [fieldIdentifier, type, fieldOffset] = hashMapOptions.fieldKeys[i];
-        const auto& function = hashMapOptions.keyFunctions[i];
-        const auto value = function.execute(record, ctx.pipelineMemoryProvider.arena);
-        record.write(fieldIdentifier, value);
-    }
 
     /// Finding or creating the entry for the provided record
-    const auto hashMapEntry = hashMap.findOrCreateEntry(
-        record,
-        *hashMapOptions.hashFunction,
-        [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
+    nautilus::val<Interface::AbstractHashMapEntry*> hashMapEntry = nullptr;
+    hashMapOptions.withHashMapRef(
+        hashMapPtr,
+        [&](auto& hashMap)
         {
-            /// If the entry for the provided keys does not exist, we need to create a new one and initialize the underyling paged vector
-            const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset{
-                entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues};
-            const auto state = entryRefReset.getValueMemArea();
-            nautilus::invoke(
-                +[](int8_t* pagedVectorMemArea) -> void
+            hashMapEntry = hashMap.findOrCreateEntry(
+                record,
+                *hashMapOptions.hashFunction,
+                [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
                 {
-                    /// Allocates a new PagedVector in the memory area provided by the pointer to the pagedvector
-                    /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                    auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
-                    new (pagedVector) Nautilus::Interface::PagedVector();
+                    /// If the entry for the provided keys does not exist, we need to create a new one and initialize the underyling paged vector
+                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset{
+                        entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues};
+                    const auto state = entryRefReset.getValueMemArea();
+                    nautilus::invoke(
+                        +[](int8_t* pagedVectorMemArea) -> void
+                        {
+                            /// Allocates a new PagedVector in the memory area provided by the pointer to the pagedvector
+                            /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                            auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
+                            new (pagedVector) Nautilus::Interface::PagedVector();
+                        },
+                        state);
                 },
-                state);
-        },
-        ctx.pipelineMemoryProvider.bufferProvider);
+                ctx.pipelineMemoryProvider.bufferProvider);
+        });
 
     /// Inserting the tuple into the corresponding hash entry
     const Interface::ChainedHashMapRef::ChainedEntryRef entryRef{
@@ -183,10 +207,13 @@ HJBuildPhysicalOperator::HJBuildPhysicalOperator(
     const JoinBuildSideType joinBuildSide,
     std::unique_ptr<TimeFunction> timeFunction,
     const std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider>& memoryProvider,
-    HashMapOptions hashMapOptions)
+    HashMapOptions hashMapOptions,
+    const uint64_t numberOfRadixPartitions)
     : StreamJoinBuildPhysicalOperator(operatorHandlerId, joinBuildSide, std::move(timeFunction), memoryProvider)
     , hashMapOptions(std::move(hashMapOptions))
+    , numberOfRadixPartitions(numberOfRadixPartitions)
 {
+    PRECONDITION(numberOfRadixPartitions > 0, "The number of radix partitions must be greater than 0");
 }
 
 }
@@ -15,6 +15,8 @@
 
 #include <Join/HashJoin/HJOperatorHandler.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -23,11 +25,13 @@
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJSlice.hpp>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Util/HyperLogLog.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
@@ -42,11 +46,13 @@ HJOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments& ne
 
     const auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
     return std::function(
-        [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewHashMapArgs = newHashMapArgs](
-            SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        [outputOriginId = outputOriginId,
+         numberOfWorkerThreads = numberOfWorkerThreads,
+         numberOfRadixPartitions = numberOfRadixPartitions,
+         copyOfNewHashMapArgs = newHashMapArgs](SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
         {
             NES_TRACE("Creating new hash-join slice for slice {}-{} for output origin {}", sliceStart, sliceEnd, outputOriginId);
-            return {std::make_shared<HJSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads)};
+            return {std::make_shared<HJSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads, numberOfRadixPartitions)};
         });
 }
 
@@ -70,25 +76,70 @@ std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> HJO
     return {leftCleanupStateNautilusFunction, rightCleanupStateNautilusFunction};
 }
 
+uint64_t HJOperatorHandler::getNumberOfRadixPartitions() const
+{
+    return numberOfRadixPartitions;
+}
+
+ProbeTaskSplit HJOperatorHandler::splitIntoProbeTasks(Slice&, Slice&) const
+{
+    return {.numberOfProbeTasks = numberOfRadixPartitions};
+}
+
+void HJOperatorHandler::sampleStatistics(const Slice& slice)
+{
+    if (statisticsStore == nullptr or numberOfProbedSlices.fetch_add(1, std::memory_order::relaxed) % STATISTICS_SAMPLING_INTERVAL != 0)
+    {
+        return;
+    }
+
+    const auto* const hashJoinSlice = dynamic_cast<const HJSlice*>(&slice);
+    INVARIANT(hashJoinSlice != nullptr, "Slice must be of type HJSlice!");
+    const auto sliceDurationInMs = slice.getSliceEnd().getRawValue() - slice.getSliceStart().getRawValue();
+    if (sliceDurationInMs == 0)
+    {
+        return;
+    }
+
+    const auto samplesPerSecond = 1000.0 / static_cast<double>(sliceDurationInMs);
+    for (const auto buildSide : {JoinBuildSideType::Left, JoinBuildSideType::Right})
+    {
+        HyperLogLog keySketch;
+        const auto numberOfRecords = hashJoinSlice->collectStatistics(buildSide, keySketch);
+        statisticsStore->update(
+            statisticsInputKeys[static_cast<size_t>(buildSide == JoinBuildSideType::Right)],
+            {.recordsPerSecond = static_cast<double>(numberOfRecords) * samplesPerSecond,
+             .distinctKeysPerSecond = keySketch.estimate() * samplesPerSecond});
+    }
+}
+
 void HJOperatorHandler::emitSlicesToProbe(
     Slice& sliceLeft,
     Slice& sliceRight,
+    const ProbeTaskSplit&,
+    const uint64_t probeTaskIndex,
     const WindowInfo& windowInfo,
     const SequenceData& sequenceData,
     PipelineExecutionContext* pipelineCtx)
 {
+    /// Each slice gets combined with itself once per window. We take the sample before the probe might release the slice.
+    if (probeTaskIndex == 0 and &sliceLeft == &sliceRight)
+    {
+        sampleStatistics(sliceLeft);
+    }
+
     /// Counting how many tuples the probe has to check for this probe task
     uint64_t totalNumberOfTuples = 0;
 
-    /// Getting all hash maps for the left and right slice
+    /// Getting all hash maps for the left and right slice. The probe task index is the radix partition of this probe task.
     auto getHashMapsForSlice = [&](const Slice& slice, const JoinBuildSideType& buildSide)
     {
         std::vector<Nautilus::Interface::HashMap*> allHashMaps;
         const auto* const hashJoinSlice = dynamic_cast<const HJSlice*>(&slice);
         INVARIANT(hashJoinSlice != nullptr, "Slice must be of type HashMapSlice!");
-        for (uint64_t hashMapIdx = 0; hashMapIdx < hashJoinSlice->getNumberOfHashMapsForSide(); ++hashMapIdx)
+        for (uint64_t hashMapIdx = 0; hashMapIdx < hashJoinSlice->getNumberOfHashMapsForPartition(); ++hashMapIdx)
         {
-            if (auto* hashMap = hashJoinSlice->getHashMapPtr(WorkerThreadId(hashMapIdx), buildSide);
+            if (auto* hashMap = hashJoinSlice->getHashMapPtr(WorkerThreadId(hashMapIdx), buildSide, probeTaskIndex);
                 hashMap and hashMap->getNumberOfTuples() > 0)
             {
                 allHashMaps.emplace_back(hashMap);
@@ -139,14 +190,16 @@ void HJOperatorHandler::emitSlicesToProbe(
     /// Dispatching the buffer to the probe operator via the task queue.
     pipelineCtx->emitBuffer(tupleBuffer);
     NES_TRACE(
-        "Triggered window {}-{} with watermarkTs {} sequenceNumber {} originId {} and {}-{} hashmaps",
+        "Triggered window {}-{} with watermarkTs {} sequenceNumber {} chunkNumber {} originId {} and {}-{} hashmaps of partition {}",
         windowInfo.windowStart,
         windowInfo.windowEnd,
         tupleBuffer.getWatermark(),
         tupleBuffer.getSequenceNumber(),
+        tupleBuffer.getChunkNumber(),
         tupleBuffer.getOriginId(),
         leftHashMaps.size(),
-        rightHashMaps.size());
+        rightHashMaps.size(),
+        probeTaskIndex);
 }
 
 }
@@ -13,6 +13,7 @@
 */
 #include <Join/HashJoin/HJProbePhysicalOperator.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -23,13 +24,16 @@
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/MemoryProvider/TupleBufferMemoryProvider.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
 #include <Windowing/WindowMetaData.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
+#include <HashMapSlice.hpp>
 #include <function.hpp>
 #include <val.hpp>
 #include <val_ptr.hpp>
@@ -45,12 +49,14 @@ HJProbePhysicalOperator::HJProbePhysicalOperator(
     std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider> leftMemoryProvider,
     std::shared_ptr<Interface::MemoryProvider::TupleBufferMemoryProvider> rightMemoryProvider,
     HashMapOptions leftHashMapBasedOptions,
-    HashMapOptions rightHashMapBasedOptions)
+    HashMapOptions rightHashMapBasedOptions,
+    const uint64_t numberOfRadixPartitions)
     : StreamJoinProbePhysicalOperator(operatorHandlerId, std::move(joinFunction), std::move(windowMetaData), std::move(joinSchema))
     , leftMemoryProvider(std::move(leftMemoryProvider))
     , rightMemoryProvider(std::move(rightMemoryProvider))
     , leftHashMapOptions(std::move(leftHashMapBasedOptions))
     , rightHashMapOptions(std::move(rightHashMapBasedOptions))
+    , numberOfRadixPartitions(numberOfRadixPartitions)
 {
 }
 
@@ -62,6 +68,58 @@ Interface::HashMap* getHashMapPtrProxy(Interface::HashMap** hashMaps, const uint
     auto* const hashMapPtr = hashMaps[hashMapIndex];
     return hashMapPtr;
 }
+
+/// Creates an empty hash map that is large enough to store all entries of the given hash maps without growing
+Interface::HashMap*
+createMergedHashMapProxy(const HashMapOptions* hashMapOptions, Interface::HashMap** hashMaps, const uint64_t numberOfHashMaps)
+{
+    PRECONDITION(hashMapOptions != nullptr, "The hash map options should not be null");
+    PRECONDITION(hashMaps != nullptr, "HashMaps MUST NOT be null");
+    uint64_t numberOfEntries = 0;
+    for (uint64_t hashMapIndex = 0; hashMapIndex < numberOfHashMaps; ++hashMapIndex)
+    {
+        numberOfEntries += hashMaps[hashMapIndex]->getNumberOfTuples();
+    }
+
+    const CreateNewHashMapSliceArgs hashMapArgs{
+        {},
+        hashMapOptions->keySize,
+        hashMapOptions->valueSize,
+        hashMapOptions->pageSize,
+        std::max<uint64_t>(numberOfEntries, 1),
+        hashMapOptions->hashMapType};
+    return hashMapArgs.createHashMap().release();
+}
+
+void deleteMergedHashMapProxy(const Interface::HashMap* hashMap)
+{
+    delete hashMap;
+}
+}
+
+void HJProbePhysicalOperator::joinEntries(
+    ExecutionContext& executionCtx,
+    const Interface::ChainedHashMapRef::ChainedEntryRef& leftEntryRef,
+    const Interface::ChainedHashMapRef::ChainedEntryRef& rightEntryRef,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
+    auto leftPagedVectorMem = leftEntryRef.getValueMemArea();
+    auto rightPagedVectorMem = rightEntryRef.getValueMemArea();
+    const Interface::PagedVectorRef leftPagedVector{leftPagedVectorMem, leftMemoryProvider};
+    const Interface::PagedVectorRef rightPagedVector{rightPagedVectorMem, rightMemoryProvider};
+    const auto leftFields = leftMemoryProvider->getMemoryLayout()->getSchema().getFieldNames();
+    const auto rightFields = rightMemoryProvider->getMemoryLayout()->getSchema().getFieldNames();
+    for (auto leftIt = leftPagedVector.begin(leftFields); leftIt != leftPagedVector.end(leftFields); ++leftIt)
+    {
+        for (auto rightIt = rightPagedVector.begin(rightFields); rightIt != rightPagedVector.end(rightFields); ++rightIt)
+        {
+            const auto leftRecord = *leftIt;
+            const auto rightRecord = *rightIt;
+            auto joinedRecord = createJoinedRecord(leftRecord, rightRecord, windowStart, windowEnd, leftFields, rightFields);
+            executeChild(executionCtx, joinedRecord);
+        }
+    }
 }
 
 void HJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
@@ -92,56 +150,161 @@ void HJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer&
         +[](const EmittedHJWindowTrigger* emittedJoinWindow) { return emittedJoinWindow->rightHashMaps; }, hashJoinWindowRef);
 
 
+    /// As the number of partitions is known during tracing, only one of the two probe variants ends up in the compiled code
+    if (numberOfRadixPartitions > 1)
+    {
+        probeMergedHashMap(
+            executionCtx, leftHashMapRefs, leftNumberOfHashMaps, rightHashMapRefs, rightNumberOfHashMaps, windowStart, windowEnd);
+    }
+    else
+    {
+        probeAllHashMaps(
+            executionCtx, leftHashMapRefs, leftNumberOfHashMaps, rightHashMapRefs, rightNumberOfHashMaps, windowStart, windowEnd);
+    }
+}
+
+void HJProbePhysicalOperator::probeAllHashMaps(
+    ExecutionContext& executionCtx,
+    const nautilus::val<Interface::HashMap**>& leftHashMapRefs,
+    const nautilus::val<uint64_t>& leftNumberOfHashMaps,
+    const nautilus::val<Interface::HashMap**>& rightHashMapRefs,
+    const nautilus::val<uint64_t>& rightNumberOfHashMaps,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
     /// We iterate over all "left" hash maps and check if we find a tuple with the same key in the "right" hash maps
     for (nautilus::val<uint64_t> leftHashMapIndex = 0; leftHashMapIndex < leftNumberOfHashMaps; ++leftHashMapIndex)
     {
         const auto leftHashMapPtr = nautilus::invoke(getHashMapPtrProxy, leftHashMapRefs, leftHashMapIndex);
-        Interface::ChainedHashMapRef leftHashMap{
+        leftHashMapOptions.withHashMapRef(
             leftHashMapPtr,
-            leftHashMapOptions.fieldKeys,
-            leftHashMapOptions.fieldValues,
-            leftHashMapOptions.entriesPerPage,
-            leftHashMapOptions.entrySize};
-        for (nautilus::val<uint64_t> rightHashMapIndex = 0; rightHashMapIndex < rightNumberOfHashMaps; ++rightHashMapIndex)
+            [&](auto& leftHashMap)
+            {
+                for (nautilus::val<uint64_t> rightHashMapIndex = 0; rightHashMapIndex < rightNumberOfHashMaps; ++rightHashMapIndex)
+                {
+                    const auto rightHashMapPtr = nautilus::invoke(getHashMapPtrProxy, rightHashMapRefs, rightHashMapIndex);
+                    rightHashMapOptions.withHashMapRef(
+                        rightHashMapPtr,
+                        [&](const auto& rightHashMap)
+                        {
+                            for (const auto rightEntry : rightHashMap)
+                            {
+                                const Interface::ChainedHashMapRef::ChainedEntryRef rightEntryRef{
+                                    rightEntry, rightHashMapPtr, rightHashMapOptions.fieldKeys, rightHashMapOptions.fieldValues};
+
+                                /// We use here findEntry as the other methods would insert a new entry, which is unnecessary
+                                if (auto leftEntry = leftHashMap.findEntry(rightEntryRef.entryRef))
+                                {
+                                    /// At this moment, we can be sure that both paged vector contain only records that satisfy the join condition
+                                    const Interface::ChainedHashMapRef::ChainedEntryRef leftEntryRef{
+                                        leftEntry, leftHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
+                                    joinEntries(executionCtx, leftEntryRef, rightEntryRef, windowStart, windowEnd);
+                                }
+                            }
+                        });
+                }
+            });
+    }
+}
+
+void HJProbePhysicalOperator::probeMergedHashMap(
+    ExecutionContext& executionCtx,
+    const nautilus::val<Interface::HashMap**>& leftHashMapRefs,
+    const nautilus::val<uint64_t>& leftNumberOfHashMaps,
+    const nautilus::val<Interface::HashMap**>& rightHashMapRefs,
+    const nautilus::val<uint64_t>& rightNumberOfHashMaps,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
+    const auto mergedHashMapPtr = nautilus::invoke(
+        createMergedHashMapProxy, nautilus::val<const HashMapOptions*>(&leftHashMapOptions), leftHashMapRefs, leftNumberOfHashMaps);
+    leftHashMapOptions.withHashMapRef(
+        mergedHashMapPtr,
+        [&](auto& mergedHashMap)
         {
-            const auto rightHashMapPtr = nautilus::invoke(getHashMapPtrProxy, rightHashMapRefs, rightHashMapIndex);
-            const Interface::ChainedHashMapRef rightHashMap{
-                rightHashMapPtr,
-                rightHashMapOptions.fieldKeys,
-                rightHashMapOptions.fieldValues,
-                rightHashMapOptions.entriesPerPage,
-                rightHashMapOptions.entrySize};
-            for (const auto rightEntry : rightHashMap)
+            /// Merging all left hash maps of this partition. The merged entries solely share the pages of the left paged vectors.
+            /// Thus, the state of the slice does not get modified, as it might be probed by other tasks concurrently.
+            for (nautilus::val<uint64_t> leftHashMapIndex = 0; leftHashMapIndex < leftNumberOfHashMaps; ++leftHashMapIndex)
             {
-                const Interface::ChainedHashMapRef::ChainedEntryRef rightEntryRef{
-                    rightEntry, rightHashMapPtr, rightHashMapOptions.fieldKeys, rightHashMapOptions.fieldValues};
+                const auto leftHashMapPtr = nautilus::invoke(getHashMapPtrProxy, leftHashMapRefs, leftHashMapIndex);
+                leftHashMapOptions.withHashMapRef(
+                    leftHashMapPtr,
+                    [&](const auto& leftHashMap)
+                    {
+                        for (const auto leftEntry : leftHashMap)
+                        {
+                            const Interface::ChainedHashMapRef::ChainedEntryRef leftEntryRef{
+                                leftEntry, leftHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
+                            const auto leftPagedVectorMem = leftEntryRef.getValueMemArea();
+                            const auto copyPages = [&](const nautilus::val<Interface::AbstractHashMapEntry*>& mergedEntry, const bool isNew)
+                            {
+                                const Interface::ChainedHashMapRef::ChainedEntryRef mergedEntryRef{
+                                    mergedEntry, mergedHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
+                                nautilus::invoke(
+                                    +[](int8_t* mergedPagedVectorMemArea, int8_t* leftPagedVectorMemArea, const bool isNewEntry)
+                                    {
+                                        /// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+                                        auto* mergedPagedVector
+                                            = reinterpret_cast<Nautilus::Interface::PagedVector*>(mergedPagedVectorMemArea);
+                                        const auto* leftPagedVector
+                                            = reinterpret_cast<Nautilus::Interface::PagedVector*>(leftPagedVectorMemArea);
+                                        /// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+                                        if (isNewEntry)
+                                        {
+                                            new (mergedPagedVector) Nautilus::Interface::PagedVector();
+                                        }
+                                        mergedPagedVector->copyFrom(*leftPagedVector);
+                                    },
+                                    mergedEntryRef.getValueMemArea(),
+                                    leftPagedVectorMem,
+                                    nautilus::val<bool>(isNew));
+                            };
+                            mergedHashMap.insertOrUpdateEntry(
+                                leftEntryRef.entryRef,
+                                [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry) { copyPages(entry, false); },
+                                [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry) { copyPages(entry, true); },
+                                executionCtx.pipelineMemoryProvider.bufferProvider);
+                        }
+                    });
+            }
 
-                /// We use here findEntry as the other methods would insert a new entry, which is unnecessary
-                if (auto leftEntry = leftHashMap.findEntry(rightEntryRef.entryRef))
-                {
-                    /// At this moment, we can be sure that both paged vector contain only records that satisfy the join condition
-                    const Interface::ChainedHashMapRef::ChainedEntryRef leftEntryRef{
-                        leftEntry, leftHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
-                    auto leftPagedVectorMem = leftEntryRef.getValueMemArea();
-                    auto rightPagedVectorMem = rightEntryRef.getValueMemArea();
-                    const Interface::PagedVectorRef leftPagedVector{leftPagedVectorMem, leftMemoryProvider};
-                    const Interface::PagedVectorRef rightPagedVector{rightPagedVectorMem, rightMemoryProvider};
-                    const auto leftFields = leftMemoryProvider->getMemoryLayout()->getSchema().getFieldNames();
-                    const auto rightFields = rightMemoryProvider->getMemoryLayout()->getSchema().getFieldNames();
-                    for (auto leftIt = leftPagedVector.begin(leftFields); leftIt != leftPagedVector.end(leftFields); ++leftIt)
+            /// Probing each right entry once against the merged hash map
+            for (nautilus::val<uint64_t> rightHashMapIndex = 0; rightHashMapIndex < rightNumberOfHashMaps; ++rightHashMapIndex)
+            {
+                const auto rightHashMapPtr = nautilus::invoke(getHashMapPtrProxy, rightHashMapRefs, rightHashMapIndex);
+                rightHashMapOptions.withHashMapRef(
+                    rightHashMapPtr,
+                    [&](const auto& rightHashMap)
                     {
-                        for (auto rightIt = rightPagedVector.begin(rightFields); rightIt != rightPagedVector.end(rightFields); ++rightIt)
+                        for (const auto rightEntry : rightHashMap)
                         {
-                            const auto leftRecord = *leftIt;
-                            const auto rightRecord = *rightIt;
-                            auto joinedRecord
-                                = createJoinedRecord(leftRecord, rightRecord, windowStart, windowEnd, leftFields, rightFields);
-                            executeChild(executionCtx, joinedRecord);
+                            const Interface::ChainedHashMapRef::ChainedEntryRef rightEntryRef{
+                                rightEntry, rightHashMapPtr, rightHashMapOptions.fieldKeys, rightHashMapOptions.fieldValues};
+                            if (auto mergedEntry = mergedHashMap.findEntry(rightEntryRef.entryRef))
+                            {
+                                const Interface::ChainedHashMapRef::ChainedEntryRef mergedEntryRef{
+                                    mergedEntry, mergedHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
+                                joinEntries(executionCtx, mergedEntryRef, rightEntryRef, windowStart, windowEnd);
+                            }
                         }
-                    }
-                }
+                    });
             }
-        }
-    }
+
+            /// Releasing the shared pages of the merged paged vectors before deleting the merged hash map
+            for (const auto mergedEntry : mergedHashMap)
+            {
+                const Interface::ChainedHashMapRef::ChainedEntryRef mergedEntryRef{
+                    mergedEntry, mergedHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
+                nautilus::invoke(
+                    +[](int8_t* pagedVectorMemArea)
+                    {
+                        /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
+                        pagedVector->~PagedVector();
+                    },
+                    mergedEntryRef.getValueMemArea());
+            }
+        });
+    nautilus::invoke(deleteMergedHashMapProxy, mergedHashMapPtr);
 }
 }
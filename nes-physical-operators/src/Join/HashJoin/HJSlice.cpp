@@ -13,62 +13,70 @@
 */
 #include <Join/HashJoin/HJSlice.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
+#include <Util/HyperLogLog.hpp>
 #include <ErrorHandling.hpp>
 #include <HashMapSlice.hpp>
 
 namespace NES
 {
 HJSlice::HJSlice(
-    SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, const uint64_t numberOfHashMaps)
-    : HashMapSlice(std::move(sliceStart), std::move(sliceEnd), createNewHashMapSliceArgs, numberOfHashMaps, 2)
+    SliceStart sliceStart,
+    SliceEnd sliceEnd,
+    const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
+    const uint64_t numberOfHashMaps,
+    const uint64_t numberOfRadixPartitions)
+    : HashMapSlice(
+          std::move(sliceStart), std::move(sliceEnd), createNewHashMapSliceArgs, numberOfHashMaps * numberOfRadixPartitions, 2)
+    , numberOfRadixPartitions(numberOfRadixPartitions)
 {
+    PRECONDITION(numberOfRadixPartitions > 0, "The number of radix partitions must be greater than 0");
 }
 
-Nautilus::Interface::HashMap* HJSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide) const
+uint64_t HJSlice::getHashMapPos(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, const uint64_t partition) const
 {
-    /// Hashmaps of the left build side come before right
-    auto pos = (workerThreadId % numberOfHashMapsPerInputStream)
+    /// Hashmaps of the left build side come before right and within one side, the hashmaps of one partition lie next to each other
+    const auto numberOfHashMapsForPartition = getNumberOfHashMapsForPartition();
+    const auto pos = (workerThreadId % numberOfHashMapsForPartition) + (partition * numberOfHashMapsForPartition)
         + ((static_cast<uint64_t>(buildSide == JoinBuildSideType::Right) * numberOfHashMapsPerInputStream));
 
     INVARIANT(
-        not hashMaps.empty() and pos < hashMaps.size(),
-        "No hashmap found for workerThreadId {} at pos {} for {} hashmaps",
+        not hashMaps.empty() and partition < numberOfRadixPartitions and pos < hashMaps.size(),
+        "No hashmap found for workerThreadId {} and partition {} at pos {} for {} hashmaps",
         workerThreadId,
+        partition,
         pos,
         hashMaps.size());
-    return hashMaps[pos].get();
+    return pos;
 }
 
-Nautilus::Interface::HashMap* HJSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide)
+Nautilus::Interface::HashMap*
+HJSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, const uint64_t partition) const
 {
-    /// Hashmaps of the left build side come before right
-    auto pos = (workerThreadId % numberOfHashMapsPerInputStream)
-        + ((static_cast<uint64_t>(buildSide == JoinBuildSideType::Right) * numberOfHashMapsPerInputStream));
-
-    INVARIANT(
-        not hashMaps.empty() and pos < hashMaps.size(),
-        "No hashmap found for workerThreadId {} at pos {} for {} hashmaps",
-        workerThreadId,
-        pos,
-        hashMaps.size());
+    return hashMaps[getHashMapPos(workerThreadId, buildSide, partition)].get();
+}
 
+Nautilus::Interface::HashMap*
+HJSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, const uint64_t partition)
+{
+    const auto pos = getHashMapPos(workerThreadId, buildSide, partition);
     if (hashMaps.at(pos) == nullptr)
     {
         /// Hashmap at pos has not been initialized
-        hashMaps.at(pos) = std::make_unique<Nautilus::Interface::ChainedHashMap>(
-            createNewHashMapSliceArgs.keySize,
-            createNewHashMapSliceArgs.valueSize,
-            createNewHashMapSliceArgs.numberOfBuckets,
-            createNewHashMapSliceArgs.pageSize);
+        hashMaps.at(pos) = createNewHashMapSliceArgs.createHashMap();
     }
     return hashMaps.at(pos).get();
 }
@@ -78,4 +86,87 @@ uint64_t HJSlice::getNumberOfHashMapsForSide() const
     return numberOfHashMapsPerInputStream;
 }
 
+uint64_t HJSlice::getNumberOfHashMapsForPartition() const
+{
+    return numberOfHashMapsPerInputStream / numberOfRadixPartitions;
+}
+
+uint64_t HJSlice::getNumberOfRadixPartitions() const
+{
+    return numberOfRadixPartitions;
+}
+
+Nautilus::Interface::PagedVector* HJSlice::getRecords(const Nautilus::Interface::HashMap& hashMap, const uint64_t entryIdx) const
+{
+    /// Both hash map types store their entries in the layout of the ChainedHashMapEntry. The value of an entry is the paged vector of all
+    /// records with the key of the entry and follows directly after the keys.
+    auto* const entry = reinterpret_cast<int8_t*>(hashMap.getEntry(entryIdx));
+    return reinterpret_cast<Nautilus::Interface::PagedVector*>(
+        entry + sizeof(Nautilus::Interface::ChainedHashMapEntry) + createNewHashMapSliceArgs.keySize);
+}
+
+uint64_t HJSlice::collectStatistics(const JoinBuildSideType& buildSide, HyperLogLog& keySketch) const
+{
+    const auto firstHashMapOfSide = static_cast<uint64_t>(buildSide == JoinBuildSideType::Right) * numberOfHashMapsPerInputStream;
+    uint64_t numberOfRecords = 0;
+    for (uint64_t hashMapIdx = firstHashMapOfSide; hashMapIdx < firstHashMapOfSide + numberOfHashMapsPerInputStream; ++hashMapIdx)
+    {
+        const auto* const hashMap = hashMaps[hashMapIdx].get();
+        if (hashMap == nullptr)
+        {
+            continue;
+        }
+        for (uint64_t entryIdx = 0; entryIdx < hashMap->getNumberOfTuples(); ++entryIdx)
+        {
+            keySketch.add(static_cast<const Nautilus::Interface::ChainedHashMapEntry*>(hashMap->getEntry(entryIdx))->hash);
+            numberOfRecords += getRecords(*hashMap, entryIdx)->getTotalNumberOfEntries();
+        }
+    }
+    return numberOfRecords;
+}
+
+uint64_t HJSlice::getSpillableStateSizeInBytes() const
+{
+    uint64_t numberOfBytes = 0;
+    for (const auto& hashMap : hashMaps)
+    {
+        for (uint64_t entryIdx = 0; hashMap and entryIdx < hashMap->getNumberOfTuples(); ++entryIdx)
+        {
+            numberOfBytes += getRecords(*hashMap, entryIdx)->getNumberOfBytes();
+        }
+    }
+    return numberOfBytes;
+}
+
+void HJSlice::spillState(std::vector<std::byte>& spilledState)
+{
+    /// The handler only spills and reloads a slice while no build task is running. In between, late records might add entries to the
+    /// spilled slice. Thus, we store how many entries of each hash map we have spilled.
+    for (const auto& hashMap : hashMaps)
+    {
+        const uint64_t numberOfEntries = hashMap ? hashMap->getNumberOfTuples() : 0;
+        const auto numberOfEntriesBytes = std::as_bytes(std::span{&numberOfEntries, 1});
+        spilledState.insert(spilledState.end(), numberOfEntriesBytes.begin(), numberOfEntriesBytes.end());
+        for (uint64_t entryIdx = 0; entryIdx < numberOfEntries; ++entryIdx)
+        {
+            getRecords(*hashMap, entryIdx)->spill(spilledState);
+        }
+    }
+}
+
+void HJSlice::reloadState(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider)
+{
+    for (const auto& hashMap : hashMaps)
+    {
+        PRECONDITION(spilledState.size() >= sizeof(uint64_t), "Spilled state does not contain a hash map");
+        uint64_t numberOfEntries = 0;
+        std::memcpy(&numberOfEntries, spilledState.data(), sizeof(numberOfEntries));
+        spilledState = spilledState.subspan(sizeof(numberOfEntries));
+        for (uint64_t entryIdx = 0; entryIdx < numberOfEntries; ++entryIdx)
+        {
+            getRecords(*hashMap, entryIdx)->reload(spilledState, bufferProvider);
+        }
+    }
+}
+
 }
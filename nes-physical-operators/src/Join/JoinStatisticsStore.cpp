@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/JoinStatisticsStore.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace NES
+{
+
+double JoinInputStatistics::getNumberOfRecords(const double durationInMs) const
+{
+    return recordsPerSecond * durationInMs / 1000;
+}
+
+double JoinInputStatistics::getNumberOfDistinctKeys(const double durationInMs) const
+{
+    /// There can not be more distinct keys than records
+    return std::min(distinctKeysPerSecond * durationInMs / 1000, getNumberOfRecords(durationInMs));
+}
+
+std::string JoinStatisticsStore::createInputKey(std::vector<std::string> joinFieldNames, std::vector<std::string> otherJoinFieldNames)
+{
+    const auto toSortedSet = [](std::vector<std::string>& fieldNames)
+    {
+        std::ranges::sort(fieldNames);
+        const auto [first, last] = std::ranges::unique(fieldNames);
+        fieldNames.erase(first, last);
+    };
+    toSortedSet(joinFieldNames);
+    toSortedSet(otherJoinFieldNames);
+    return fmt::format("{}|{}", fmt::join(joinFieldNames, ","), fmt::join(otherJoinFieldNames, ","));
+}
+
+void JoinStatisticsStore::update(const std::string& inputKey, const JoinInputStatistics& sample)
+{
+    const std::scoped_lock lock(mutex);
+    const auto [it, inserted] = statistics.try_emplace(inputKey, sample);
+    if (not inserted)
+    {
+        auto& [recordsPerSecond, distinctKeysPerSecond] = it->second;
+        recordsPerSecond += WEIGHT_OF_NEW_SAMPLE * (sample.recordsPerSecond - recordsPerSecond);
+        distinctKeysPerSecond += WEIGHT_OF_NEW_SAMPLE * (sample.distinctKeysPerSecond - distinctKeysPerSecond);
+    }
+    NES_DEBUG(
+        "Join input {} has {:.1f} records and {:.1f} distinct keys per second",
+        inputKey,
+        it->second.recordsPerSecond,
+        it->second.distinctKeysPerSecond);
+}
+
+std::optional<JoinInputStatistics> JoinStatisticsStore::get(const std::string& inputKey) const
+{
+    const std::scoped_lock lock(mutex);
+    if (const auto it = statistics.find(inputKey); it != statistics.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void JoinStatisticsStore::clear()
+{
+    const std::scoped_lock lock(mutex);
+    statistics.clear();
+}
+
+}
@@ -15,6 +15,7 @@
 #include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -38,8 +39,10 @@ namespace NES
 NLJOperatorHandler::NLJOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
-    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+    const uint64_t minNumberOfTuplesPerTile)
     : StreamJoinOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
+    , minNumberOfTuplesPerTile(minNumberOfTuplesPerTile)
 {
 }
 
@@ -58,19 +61,53 @@ NLJOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments&)
         });
 }
 
+uint64_t NLJOperatorHandler::getNumberOfTiles(const uint64_t numberOfTuples) const
+{
+    if (minNumberOfTuplesPerTile == 0)
+    {
+        return 1;
+    }
+    return std::clamp<uint64_t>(numberOfTuples / minNumberOfTuplesPerTile, 1, std::max<uint64_t>(numberOfWorkerThreads, 1));
+}
+
+ProbeTaskSplit NLJOperatorHandler::splitIntoProbeTasks(Slice& sliceLeft, Slice& sliceRight) const
+{
+    /// Records that arrive after this point are not part of the tiles. Otherwise, the probe tasks of the combination would disagree on
+    /// the tiles and on the number of chunks.
+    auto& nljSliceLeft = dynamic_cast<NLJSlice&>(sliceLeft);
+    auto& nljSliceRight = dynamic_cast<NLJSlice&>(sliceRight);
+    nljSliceLeft.combinePagedVectors();
+    nljSliceRight.combinePagedVectors();
+    const auto numberOfTuplesLeft = nljSliceLeft.getNumberOfTuplesLeft();
+    const auto numberOfTuplesRight = nljSliceRight.getNumberOfTuplesRight();
+    return {
+        .numberOfProbeTasks = getNumberOfTiles(numberOfTuplesLeft) * getNumberOfTiles(numberOfTuplesRight),
+        .numberOfTuplesLeft = numberOfTuplesLeft,
+        .numberOfTuplesRight = numberOfTuplesRight};
+}
+
 void NLJOperatorHandler::emitSlicesToProbe(
     Slice& sliceLeft,
     Slice& sliceRight,
+    const ProbeTaskSplit& split,
+    const uint64_t probeTaskIndex,
     const WindowInfo& windowInfo,
     const SequenceData& sequenceData,
     PipelineExecutionContext* pipelineCtx)
 {
-    auto& nljSliceLeft = dynamic_cast<NLJSlice&>(sliceLeft);
-    auto& nljSliceRight = dynamic_cast<NLJSlice&>(sliceRight);
-
-    nljSliceLeft.combinePagedVectors();
-    nljSliceRight.combinePagedVectors();
-    const auto totalNumberOfTuples = nljSliceLeft.getNumberOfTuplesLeft() + nljSliceRight.getNumberOfTuplesRight();
+    /// Calculating the tuple ranges of the left and right tile of this probe task from the tuples that the split covers
+    const auto numberOfTuplesLeft = split.numberOfTuplesLeft;
+    const auto numberOfTuplesRight = split.numberOfTuplesRight;
+    const auto numberOfTilesLeft = getNumberOfTiles(numberOfTuplesLeft);
+    const auto numberOfTilesRight = getNumberOfTiles(numberOfTuplesRight);
+    const auto leftTile = probeTaskIndex / numberOfTilesRight;
+    const auto rightTile = probeTaskIndex % numberOfTilesRight;
+    INVARIANT(leftTile < numberOfTilesLeft, "Probe task {} exceeds the {}x{} tiles", probeTaskIndex, numberOfTilesLeft, numberOfTilesRight);
+    const auto leftStartPos = (leftTile * numberOfTuplesLeft) / numberOfTilesLeft;
+    const auto leftEndPos = ((leftTile + 1) * numberOfTuplesLeft) / numberOfTilesLeft;
+    const auto rightStartPos = (rightTile * numberOfTuplesRight) / numberOfTilesRight;
+    const auto rightEndPos = ((rightTile + 1) * numberOfTuplesRight) / numberOfTilesRight;
+    const auto totalNumberOfTuples = (leftEndPos - leftStartPos) + (rightEndPos - rightStartPos);
 
     auto tupleBuffer = pipelineCtx->getBufferManager()->getBufferBlocking();
 
@@ -87,20 +124,26 @@ void NLJOperatorHandler::emitSlicesToProbe(
     bufferMemory->leftSliceEnd = sliceLeft.getSliceEnd();
     bufferMemory->rightSliceEnd = sliceRight.getSliceEnd();
     bufferMemory->windowInfo = windowInfo;
+    bufferMemory->leftStartPos = leftStartPos;
+    bufferMemory->leftEndPos = leftEndPos;
+    bufferMemory->rightStartPos = rightStartPos;
+    bufferMemory->rightEndPos = rightEndPos;
 
     /// Dispatching the buffer to the probe operator via the task queue.
     pipelineCtx->emitBuffer(tupleBuffer);
 
     NES_DEBUG(
-        "Emitted leftSliceId {} rightSliceId {} with watermarkTs {} sequenceNumber {} originId {} for no. left tuples "
-        "{} and no. right tuples {} for window info: {}-{}",
+        "Emitted leftSliceId {} rightSliceId {} with watermarkTs {} sequenceNumber {} originId {} for left tuples "
+        "[{}, {}) and right tuples [{}, {}) for window info: {}-{}",
         bufferMemory->leftSliceEnd,
         bufferMemory->rightSliceEnd,
         tupleBuffer.getWatermark(),
         tupleBuffer.getSequenceDataAsString(),
         tupleBuffer.getOriginId(),
-        nljSliceLeft.getNumberOfTuplesLeft(),
-        nljSliceRight.getNumberOfTuplesRight(),
+        leftStartPos,
+        leftEndPos,
+        rightStartPos,
+        rightEndPos,
         windowInfo.windowStart,
         windowInfo.windowEnd);
 }
@@ -81,6 +81,34 @@ SliceEnd getNLJSliceEndProxy(const EmittedNLJWindowTrigger* nljWindowTriggerTask
     }
     std::unreachable();
 }
+
+uint64_t getNLJTileStartPosProxy(const EmittedNLJWindowTrigger* nljWindowTriggerTask, const JoinBuildSideType joinBuildSide)
+{
+    PRECONDITION(nljWindowTriggerTask != nullptr, "nljWindowTriggerTask should not be null");
+
+    switch (joinBuildSide)
+    {
+        case JoinBuildSideType::Left:
+            return nljWindowTriggerTask->leftStartPos;
+        case JoinBuildSideType::Right:
+            return nljWindowTriggerTask->rightStartPos;
+    }
+    std::unreachable();
+}
+
+uint64_t getNLJTileEndPosProxy(const EmittedNLJWindowTrigger* nljWindowTriggerTask, const JoinBuildSideType joinBuildSide)
+{
+    PRECONDITION(nljWindowTriggerTask != nullptr, "nljWindowTriggerTask should not be null");
+
+    switch (joinBuildSide)
+    {
+        case JoinBuildSideType::Left:
+            return nljWindowTriggerTask->leftEndPos;
+        case JoinBuildSideType::Right:
+            return nljWindowTriggerTask->rightEndPos;
+    }
+    std::unreachable();
+}
 }
 
 NLJProbePhysicalOperator::NLJProbePhysicalOperator(
@@ -99,6 +127,10 @@ NLJProbePhysicalOperator::NLJProbePhysicalOperator(
 void NLJProbePhysicalOperator::performNLJ(
     const Interface::PagedVectorRef& outerPagedVector,
     const Interface::PagedVectorRef& innerPagedVector,
+    const nautilus::val<uint64_t>& outerStartPos,
+    const nautilus::val<uint64_t>& outerEndPos,
+    const nautilus::val<uint64_t>& innerStartPos,
+    const nautilus::val<uint64_t>& innerEndPos,
     Interface::MemoryProvider::TupleBufferMemoryProvider& outerMemoryProvider,
     Interface::MemoryProvider::TupleBufferMemoryProvider& innerMemoryProvider,
     ExecutionContext& executionCtx,
@@ -110,11 +142,15 @@ void NLJProbePhysicalOperator::performNLJ(
     const auto outerFields = outerMemoryProvider.getMemoryLayout()->getSchema().getFieldNames();
     const auto innerFields = innerMemoryProvider.getMemoryLayout()->getSchema().getFieldNames();
 
-    nautilus::val<uint64_t> outerItemPos(0);
-    for (auto outerIt = outerPagedVector.begin(outerKeyFields); outerIt != outerPagedVector.end(outerKeyFields); ++outerIt)
+    /// We only join the tuples of our tile, i.e., the outer tuples [outerStartPos, outerEndPos) with the inner tuples
+    /// [innerStartPos, innerEndPos)
+    nautilus::val<uint64_t> outerItemPos = outerStartPos;
+    const auto outerEndIt = outerPagedVector.at(outerKeyFields, outerEndPos);
+    for (auto outerIt = outerPagedVector.at(outerKeyFields, outerStartPos); outerIt != outerEndIt; ++outerIt)
     {
-        nautilus::val<uint64_t> innerItemPos(0);
-        for (auto innerIt = innerPagedVector.begin(innerKeyFields); innerIt != innerPagedVector.end(innerKeyFields); ++innerIt)
+        nautilus::val<uint64_t> innerItemPos = innerStartPos;
+        const auto innerEndIt = innerPagedVector.at(innerKeyFields, innerEndPos);
+        for (auto innerIt = innerPagedVector.at(innerKeyFields, innerStartPos); innerIt != innerEndIt; ++innerIt)
         {
             const auto joinedKeyFields = createJoinedRecord(*outerIt, *innerIt, windowStart, windowEnd, outerKeyFields, innerKeyFields);
             if (joinFunction.execute(joinedKeyFields, executionCtx.pipelineMemoryProvider.arena))
@@ -179,17 +215,47 @@ void NLJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer
 
     const Interface::PagedVectorRef leftPagedVector(leftPagedVectorRef, leftMemoryProvider);
     const Interface::PagedVectorRef rightPagedVector(rightPagedVectorRef, rightMemoryProvider);
-    const auto numberOfTuplesLeft = leftPagedVector.getNumberOfTuples();
-    const auto numberOfTuplesRight = rightPagedVector.getNumberOfTuples();
+
+    /// Getting the tuple ranges of the tile that this task joins
+    const auto leftSide = nautilus::val<JoinBuildSideType>(JoinBuildSideType::Left);
+    const auto rightSide = nautilus::val<JoinBuildSideType>(JoinBuildSideType::Right);
+    const auto leftStartPos = invoke(getNLJTileStartPosProxy, nljWindowTriggerTaskRef, leftSide);
+    const auto leftEndPos = invoke(getNLJTileEndPosProxy, nljWindowTriggerTaskRef, leftSide);
+    const auto rightStartPos = invoke(getNLJTileStartPosProxy, nljWindowTriggerTaskRef, rightSide);
+    const auto rightEndPos = invoke(getNLJTileEndPosProxy, nljWindowTriggerTaskRef, rightSide);
+    const auto numberOfTuplesLeft = leftEndPos - leftStartPos;
+    const auto numberOfTuplesRight = rightEndPos - rightStartPos;
 
     /// Outer loop should have more no. tuples
     if (numberOfTuplesLeft < numberOfTuplesRight)
     {
-        performNLJ(leftPagedVector, rightPagedVector, *leftMemoryProvider, *rightMemoryProvider, executionCtx, windowStart, windowEnd);
+        performNLJ(
+            leftPagedVector,
+            rightPagedVector,
+            leftStartPos,
+            leftEndPos,
+            rightStartPos,
+            rightEndPos,
+            *leftMemoryProvider,
+            *rightMemoryProvider,
+            executionCtx,
+            windowStart,
+            windowEnd);
     }
     else
     {
-        performNLJ(rightPagedVector, leftPagedVector, *rightMemoryProvider, *leftMemoryProvider, executionCtx, windowStart, windowEnd);
+        performNLJ(
+            rightPagedVector,
+            leftPagedVector,
+            rightStartPos,
+            rightEndPos,
+            leftStartPos,
+            leftEndPos,
+            *rightMemoryProvider,
+            *leftMemoryProvider,
+            executionCtx,
+            windowStart,
+            windowEnd);
     }
 }
 
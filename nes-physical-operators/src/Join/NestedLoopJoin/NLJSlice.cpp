@@ -14,14 +14,18 @@
 
 #include <Join/NestedLoopJoin/NLJSlice.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <span>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
 
 namespace NES
@@ -111,4 +115,40 @@ void NLJSlice::combinePagedVectors()
         rightPagedVectors.erase(rightPagedVectors.begin() + 1, rightPagedVectors.end());
     }
 }
+
+uint64_t NLJSlice::getSpillableStateSizeInBytes() const
+{
+    uint64_t numberOfBytes = 0;
+    for (const auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        for (const auto& pagedVector : *pagedVectors)
+        {
+            numberOfBytes += pagedVector->getNumberOfBytes();
+        }
+    }
+    return numberOfBytes;
+}
+
+void NLJSlice::spillState(std::vector<std::byte>& spilledState)
+{
+    for (const auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        for (const auto& pagedVector : *pagedVectors)
+        {
+            pagedVector->spill(spilledState);
+        }
+    }
+}
+
+void NLJSlice::reloadState(std::span<const std::byte>& spilledState, AbstractBufferProvider& bufferProvider)
+{
+    /// The number of PagedVectors does not change while the slice is spilled, as we only combine them when emitting the slice to the probe
+    for (const auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        for (const auto& pagedVector : *pagedVectors)
+        {
+            pagedVector->reload(spilledState, bufferProvider);
+        }
+    }
+}
 }
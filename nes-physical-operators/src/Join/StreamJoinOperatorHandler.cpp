@@ -14,6 +14,7 @@
 
 #include <Join/StreamJoinOperatorHandler.hpp>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <ranges>
@@ -37,23 +38,47 @@ StreamJoinOperatorHandler::StreamJoinOperatorHandler(
 {
 }
 
+ProbeTaskSplit StreamJoinOperatorHandler::splitIntoProbeTasks(Slice&, Slice&) const
+{
+    return {.numberOfProbeTasks = 1};
+}
+
 void StreamJoinOperatorHandler::triggerSlices(
     const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
     PipelineExecutionContext* pipelineCtx)
 {
     /// For every window, we have to trigger all combination of slices. This is necessary, as we have to give the probe operator all
     /// combinations of slices for a given window to ensure that it has seen all tuples of the window.
+    /// As each combination might be split into multiple probe tasks, the chunk numbers run over all probe tasks of the window.
+    /// We split every combination once and emit exactly these probe tasks, as the slices might still change while we emit them.
     for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
     {
+        std::vector<ProbeTaskSplit> splits;
+        splits.reserve(allSlices.size() * allSlices.size());
+        uint64_t totalNumberOfProbeTasks = 0;
+        for (const auto& sliceLeft : allSlices)
+        {
+            for (const auto& sliceRight : allSlices)
+            {
+                const auto& split = splits.emplace_back(splitIntoProbeTasks(*sliceLeft, *sliceRight));
+                totalNumberOfProbeTasks += split.numberOfProbeTasks;
+            }
+        }
+
         ChunkNumber::Underlying chunkNumber = ChunkNumber::INITIAL;
+        auto split = splits.begin();
         for (const auto& sliceLeft : allSlices)
         {
             for (const auto& sliceRight : allSlices)
             {
-                const bool isLastChunk = chunkNumber == (allSlices.size() * allSlices.size());
-                const SequenceData sequenceData{windowInfo.sequenceNumber, ChunkNumber(chunkNumber), isLastChunk};
-                emitSlicesToProbe(*sliceLeft, *sliceRight, windowInfo.windowInfo, sequenceData, pipelineCtx);
-                ++chunkNumber;
+                for (uint64_t probeTaskIndex = 0; probeTaskIndex < split->numberOfProbeTasks; ++probeTaskIndex)
+                {
+                    const bool isLastChunk = chunkNumber == totalNumberOfProbeTasks;
+                    const SequenceData sequenceData{windowInfo.sequenceNumber, ChunkNumber(chunkNumber), isLastChunk};
+                    emitSlicesToProbe(*sliceLeft, *sliceRight, *split, probeTaskIndex, windowInfo.windowInfo, sequenceData, pipelineCtx);
+                    ++chunkNumber;
+                }
+                ++split;
             }
         }
     }
@@ -67,4 +67,9 @@ void ScanPhysicalOperator::setChild(PhysicalOperator child)
     this->child = std::move(child);
 }
 
+const std::vector<Record::RecordFieldIdentifier>& ScanPhysicalOperator::getProjections() const
+{
+    return projections;
+}
+
 }
@@ -134,6 +134,17 @@ std::optional<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSliceBySlic
     return {};
 }
 
+std::vector<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSlicesEndingIn(const Timestamp lowerBound, const Timestamp upperBound)
+{
+    std::vector<std::shared_ptr<Slice>> slicesEndingIn;
+    const auto slicesReadLocked = slices.rlock();
+    for (auto it = slicesReadLocked->upper_bound(lowerBound); it != slicesReadLocked->end() and it->first <= upperBound; ++it)
+    {
+        slicesEndingIn.emplace_back(it->second);
+    }
+    return slicesEndingIn;
+}
+
 std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> DefaultTimeBasedSliceStore::getAllNonTriggeredSlices()
 {
     /// Acquiring a lock for the windows, as we have to iterate over all windows and trigger all non-triggered windows
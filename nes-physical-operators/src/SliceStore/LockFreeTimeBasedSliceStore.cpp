@@ -0,0 +1,194 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/LockFreeTimeBasedSliceStore.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <folly/synchronization/Hazptr.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+struct LockFreeTimeBasedSliceStore::SliceRingEntry : folly::hazptr_obj_base<SliceRingEntry>
+{
+    SliceRingEntry(const SliceEnd sliceEnd, std::weak_ptr<Slice> slice) : sliceEnd(sliceEnd), slice(std::move(slice)) { }
+
+    SliceEnd sliceEnd;
+    std::weak_ptr<Slice> slice;
+};
+
+LockFreeTimeBasedSliceStore::LockFreeTimeBasedSliceStore(const uint64_t windowSize, const uint64_t windowSlide)
+    : LockFreeTimeBasedSliceStore(windowSize, windowSlide, DEFAULT_NUMBER_OF_SLOTS)
+{
+}
+
+LockFreeTimeBasedSliceStore::LockFreeTimeBasedSliceStore(
+    const uint64_t windowSize, const uint64_t windowSlide, const uint64_t numberOfSlots)
+    : sliceStore(windowSize, windowSlide)
+    , sliceAssigner(windowSize, windowSlide)
+    , sliceSize(std::gcd(windowSize, windowSlide))
+    , slotMask(numberOfSlots - 1)
+    , slots(numberOfSlots)
+{
+    PRECONDITION(sliceSize > 0, "The window size {} and the window slide {} must not be both 0", windowSize, windowSlide);
+    PRECONDITION(
+        numberOfSlots > 0 and (numberOfSlots & (numberOfSlots - 1)) == 0, "Number of slots {} has to be a power of 2", numberOfSlots);
+}
+
+LockFreeTimeBasedSliceStore::~LockFreeTimeBasedSliceStore()
+{
+    deleteState();
+}
+
+std::atomic<LockFreeTimeBasedSliceStore::SliceRingEntry*>& LockFreeTimeBasedSliceStore::getSlot(const SliceEnd sliceEnd)
+{
+    return slots[(sliceEnd.getRawValue() / sliceSize) & slotMask];
+}
+
+std::shared_ptr<Slice> LockFreeTimeBasedSliceStore::findSlice(const SliceEnd sliceEnd)
+{
+    /// The hazard pointer guarantees that the entry does not get deleted, while we are reading it
+    auto hazardPointer = folly::make_hazard_pointer<>();
+    if (const auto* entry = hazardPointer.protect(getSlot(sliceEnd)); entry != nullptr and entry->sliceEnd == sliceEnd)
+    {
+        return entry->slice.lock();
+    }
+    return nullptr;
+}
+
+void LockFreeTimeBasedSliceStore::publishSlice(const SliceEnd sliceEnd, const std::shared_ptr<Slice>& slice)
+{
+    auto& slot = getSlot(sliceEnd);
+    auto* oldEntry = slot.load(std::memory_order_acquire);
+    auto* newEntry = new SliceRingEntry(sliceEnd, slice);
+    if (slot.compare_exchange_strong(oldEntry, newEntry, std::memory_order_acq_rel))
+    {
+        if (oldEntry != nullptr)
+        {
+            oldEntry->retire();
+        }
+        return;
+    }
+
+    /// Another thread has published a slice in the meantime.
+    /// As the slot should contain the most recently used slice, we keep the other one.
+    /// No other thread has seen our entry, therefore, we can delete it right away.
+    delete newEntry;
+}
+
+void LockFreeTimeBasedSliceStore::clearSlots(const Timestamp sliceEndsBefore)
+{
+    for (auto& slot : slots)
+    {
+        auto hazardPointer = folly::make_hazard_pointer<>();
+        auto* entry = hazardPointer.protect(slot);
+        if (entry == nullptr or entry->sliceEnd >= sliceEndsBefore)
+        {
+            continue;
+        }
+
+        /// Only the thread that removes the entry from the slot is allowed to retire it
+        if (slot.compare_exchange_strong(entry, nullptr, std::memory_order_acq_rel))
+        {
+            entry->retire();
+        }
+    }
+}
+
+std::vector<std::shared_ptr<Slice>> LockFreeTimeBasedSliceStore::getSlicesOrCreate(
+    const Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice)
+{
+    const auto sliceEnd = sliceAssigner.getSliceEndTs(timestamp);
+    if (auto slice = findSlice(sliceEnd))
+    {
+        return {std::move(slice)};
+    }
+
+    /// The slice is not in the ring, so we have to ask the slice store that either returns the existing one or creates a new slice.
+    auto newSlices = sliceStore.getSlicesOrCreate(timestamp, createNewSlice);
+    INVARIANT(newSlices.size() == 1, "We assume that only one slice is created per timestamp for our lock-free time-based slice store.");
+    publishSlice(sliceEnd, newSlices[0]);
+    return newSlices;
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+LockFreeTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWatermark)
+{
+    return sliceStore.getTriggerableWindowSlices(globalWatermark);
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> LockFreeTimeBasedSliceStore::getAllNonTriggeredSlices()
+{
+    return sliceStore.getAllNonTriggeredSlices();
+}
+
+std::optional<std::shared_ptr<Slice>> LockFreeTimeBasedSliceStore::getSliceBySliceEnd(const SliceEnd sliceEnd)
+{
+    if (auto slice = findSlice(sliceEnd))
+    {
+        return slice;
+    }
+    return sliceStore.getSliceBySliceEnd(sliceEnd);
+}
+
+std::vector<std::shared_ptr<Slice>> LockFreeTimeBasedSliceStore::getSlicesEndingIn(const Timestamp lowerBound, const Timestamp upperBound)
+{
+    return sliceStore.getSlicesEndingIn(lowerBound, upperBound);
+}
+
+void LockFreeTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp newGlobalWaterMark)
+{
+    /// The slice store deletes all slices with sliceEnd + windowSize < newGlobalWaterMark. We clear the same slots, as their weak_ptr
+    /// would be expired anyway, so that the ring entries do not keep the memory of the slices' control blocks alive.
+    sliceStore.garbageCollectSlicesAndWindows(newGlobalWaterMark);
+    if (newGlobalWaterMark.getRawValue() > sliceAssigner.getWindowSize())
+    {
+        clearSlots(newGlobalWaterMark - sliceAssigner.getWindowSize());
+    }
+}
+
+void LockFreeTimeBasedSliceStore::deleteState()
+{
+    for (auto& slot : slots)
+    {
+        if (auto* entry = slot.exchange(nullptr, std::memory_order_acq_rel); entry != nullptr)
+        {
+            entry->retire();
+        }
+    }
+    sliceStore.deleteState();
+}
+
+void LockFreeTimeBasedSliceStore::incrementNumberOfInputPipelines()
+{
+    sliceStore.incrementNumberOfInputPipelines();
+}
+
+uint64_t LockFreeTimeBasedSliceStore::getWindowSize() const
+{
+    return sliceStore.getWindowSize();
+}
+}
@@ -14,6 +14,12 @@
 
 #include <SliceStore/Slice.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
+
 namespace NES
 {
 
@@ -45,4 +51,17 @@ bool Slice::operator!=(const Slice& rhs) const
 {
     return !(rhs == *this);
 }
+
+uint64_t Slice::getSpillableStateSizeInBytes() const
+{
+    return 0;
+}
+
+void Slice::spillState(std::vector<std::byte>&)
+{
+}
+
+void Slice::reloadState(std::span<const std::byte>&, AbstractBufferProvider&)
+{
+}
 }
@@ -0,0 +1,40 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/SliceStoreProvider.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/LockFreeTimeBasedSliceStore.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+
+namespace NES
+{
+
+std::unique_ptr<WindowSlicesStoreInterface>
+provideSliceStore(const SliceStoreType sliceStoreType, const uint64_t windowSize, const uint64_t windowSlide)
+{
+    switch (sliceStoreType)
+    {
+        case SliceStoreType::DEFAULT:
+            return std::make_unique<DefaultTimeBasedSliceStore>(windowSize, windowSlide);
+        case SliceStoreType::LOCK_FREE:
+            return std::make_unique<LockFreeTimeBasedSliceStore>(windowSize, windowSlide);
+    }
+    std::unreachable();
+}
+
+}
@@ -14,16 +14,27 @@
 
 #include <WindowBasedOperatorHandler.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/SpillStore.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
 
 namespace NES
@@ -54,6 +65,55 @@ void WindowBasedOperatorHandler::start(PipelineExecutionContext& pipelineExecuti
 
 void WindowBasedOperatorHandler::stop(QueryTerminationType, PipelineExecutionContext&)
 {
+    if (spillStore)
+    {
+        const auto statistics = spillStore->getStatistics();
+        NES_INFO(
+            "Operator handler of origin {} spilled {}B in {} spills and reloaded {}B in {} reloads",
+            outputOriginId,
+            statistics.spilledBytes,
+            statistics.numberOfSpills,
+            statistics.reloadedBytes,
+            statistics.numberOfReloads);
+    }
+}
+
+void WindowBasedOperatorHandler::setSpilling(std::shared_ptr<SpillStore> spillStore, const uint64_t memoryBudgetInBytes)
+{
+    WindowBasedOperatorHandler::spillStore = std::move(spillStore);
+    WindowBasedOperatorHandler::memoryBudgetInBytes = memoryBudgetInBytes;
+}
+
+WindowBasedOperatorHandler::BuildTaskSliceAccess* WindowBasedOperatorHandler::startBuildTask(PipelineExecutionContext& pipelineCtx)
+{
+    if (not spillStore)
+    {
+        return nullptr;
+    }
+
+    /// Waiting at the gate, if a spill or reload waits for exclusive access. Otherwise, a steady stream of build tasks starves it.
+    {
+        const std::scoped_lock gate(buildTaskGateMutex);
+    }
+    auto sliceAccess = std::make_shared<BuildTaskSliceAccess>(buildTaskMutex);
+    auto* const sliceAccessPtr = sliceAccess.get();
+    pipelineCtx.keepAliveUntilTaskEnds(std::move(sliceAccess));
+    return sliceAccessPtr;
+}
+
+void WindowBasedOperatorHandler::finishBuildTask(BuildTaskSliceAccess* sliceAccess)
+{
+    /// Closing the buffer might spill slices, which waits for exclusive access. Thus, we must not wait for the task to end.
+    if (sliceAccess != nullptr)
+    {
+        sliceAccess->unlock();
+    }
+}
+
+std::unique_lock<std::shared_mutex> WindowBasedOperatorHandler::waitForExclusiveSliceAccess()
+{
+    const std::scoped_lock gate(buildTaskGateMutex);
+    return std::unique_lock(buildTaskMutex);
 }
 
 WindowSlicesStoreInterface& WindowBasedOperatorHandler::getSliceAndWindowStore() const
@@ -61,8 +121,13 @@ WindowSlicesStoreInterface& WindowBasedOperatorHandler::getSliceAndWindowStore()
     return *sliceAndWindowStore;
 }
 
-void WindowBasedOperatorHandler::garbageCollectSlicesAndWindows(const BufferMetaData& bufferMetaData) const
+void WindowBasedOperatorHandler::garbageCollectSlicesAndWindows(const BufferMetaData& bufferMetaData)
 {
+    if (spillStore)
+    {
+        finishProbeTask(bufferMetaData.seqNumber);
+    }
+
     const auto newGlobalWaterMarkProbe
         = watermarkProcessorProbe->updateWatermark(bufferMetaData.watermarkTs, bufferMetaData.seqNumber, bufferMetaData.originId);
 
@@ -90,14 +155,164 @@ void WindowBasedOperatorHandler::checkAndTriggerWindows(const BufferMetaData& bu
 
     /// Getting all slices that can be triggered and triggering them
     const auto slicesAndWindowInfo = sliceAndWindowStore->getTriggerableWindowSlices(newGlobalWatermark);
+    if (spillStore)
+    {
+        reloadSpilledSlices(slicesAndWindowInfo, pipelineCtx);
+    }
     triggerSlices(slicesAndWindowInfo, pipelineCtx);
+    if (spillStore)
+    {
+        spillColdSlices(newGlobalWatermark);
+    }
 }
 
 void WindowBasedOperatorHandler::triggerAllWindows(PipelineExecutionContext* pipelineCtx)
 {
     const auto slicesAndWindowInfo = sliceAndWindowStore->getAllNonTriggeredSlices();
     NES_TRACE("Triggering {} windows for origin: {}", slicesAndWindowInfo.size(), outputOriginId);
+    if (spillStore)
+    {
+        reloadSpilledSlices(slicesAndWindowInfo, pipelineCtx);
+    }
     triggerSlices(slicesAndWindowInfo, pipelineCtx);
 }
 
+void WindowBasedOperatorHandler::reloadSpilledSlices(
+    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+    PipelineExecutionContext* pipelineCtx)
+{
+    const std::scoped_lock lock(spillMutex);
+    std::unique_lock<std::shared_mutex> exclusiveSliceAccess;
+    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    {
+        auto& pendingWindow = pendingWindows[windowInfo.sequenceNumber];
+        for (const auto& slice : allSlices)
+        {
+            pendingWindow.sliceEnds.emplace_back(slice->getSliceEnd());
+            const auto coldSlice = coldSlices.find(slice->getSliceEnd());
+            if (coldSlice == coldSlices.end() or not coldSlice->second.spilledRegion.has_value())
+            {
+                continue;
+            }
+
+            /// Build tasks might write late records into the slice while we reload it. Thus, we wait until no build task is running.
+            if (not exclusiveSliceAccess.owns_lock())
+            {
+                exclusiveSliceAccess = waitForExclusiveSliceAccess();
+            }
+            const auto spilledState = spillStore->reload(coldSlice->second.spilledRegion.value());
+            std::span<const std::byte> remainingState{spilledState};
+            slice->reloadState(remainingState, *pipelineCtx->getBufferManager());
+            INVARIANT(
+                remainingState.empty(),
+                "Slice {} did not reload all of its {}B of spilled state",
+                slice->getSliceEnd(),
+                spilledState.size());
+            coldSlice->second.spilledRegion.reset();
+            coldStateInMemoryInBytes += coldSlice->second.stateSizeInBytes;
+        }
+    }
+}
+
+void WindowBasedOperatorHandler::spillColdSlices(const Timestamp newGlobalWatermark)
+{
+    const std::unique_lock lock(spillMutex, std::try_to_lock);
+    if (not lock.owns_lock() or (newGlobalWatermark <= coldWatermark and coldStateInMemoryInBytes <= memoryBudgetInBytes))
+    {
+        return;
+    }
+
+    /// The build has processed all records before the watermark. Only late records might still be written into these slices.
+    std::vector<std::shared_ptr<Slice>> newColdSlices;
+    if (newGlobalWatermark > coldWatermark)
+    {
+        newColdSlices = sliceAndWindowStore->getSlicesEndingIn(coldWatermark, newGlobalWatermark);
+        coldWatermark = newGlobalWatermark;
+    }
+    if (newColdSlices.empty() and coldStateInMemoryInBytes <= memoryBudgetInBytes)
+    {
+        return;
+    }
+
+    /// Running build tasks might write late records into any slice while we read the size of its state or spill it.
+    /// Thus, we wait until they are done. New build tasks wait until we are done.
+    const auto exclusiveSliceAccess = waitForExclusiveSliceAccess();
+    for (const auto& slice : newColdSlices)
+    {
+        if (const auto stateSizeInBytes = slice->getSpillableStateSizeInBytes(); stateSizeInBytes > 0)
+        {
+            coldSlices.emplace(slice->getSliceEnd(), ColdSlice{.slice = slice, .stateSizeInBytes = stateSizeInBytes, .spilledRegion = {}});
+            coldStateInMemoryInBytes += stateSizeInBytes;
+        }
+    }
+
+    /// Forgetting the slices that the slice store has already garbage collected
+    std::erase_if(
+        coldSlices,
+        [this](const auto& sliceEndAndColdSlice)
+        {
+            const auto& [sliceEnd, coldSlice] = sliceEndAndColdSlice;
+            if (not coldSlice.slice.expired())
+            {
+                return false;
+            }
+            if (coldSlice.spilledRegion.has_value())
+            {
+                spillStore->release(coldSlice.spilledRegion.value());
+            }
+            else
+            {
+                coldStateInMemoryInBytes -= coldSlice.stateSizeInBytes;
+            }
+            return true;
+        });
+
+    /// Slices of windows that are currently probed must stay in memory
+    std::vector<SliceEnd> pendingSliceEnds;
+    for (const auto& pendingWindow : pendingWindows | std::views::values)
+    {
+        pendingSliceEnds.insert(pendingSliceEnds.end(), pendingWindow.sliceEnds.begin(), pendingWindow.sliceEnds.end());
+    }
+
+    std::vector<std::byte> spilledState;
+    for (auto& [sliceEnd, coldSlice] : coldSlices | std::views::reverse)
+    {
+        if (coldStateInMemoryInBytes <= memoryBudgetInBytes)
+        {
+            break;
+        }
+        const auto slice = coldSlice.slice.lock();
+        if (not slice or coldSlice.spilledRegion.has_value() or std::ranges::contains(pendingSliceEnds, sliceEnd))
+        {
+            continue;
+        }
+
+        spilledState.clear();
+        slice->spillState(spilledState);
+        coldSlice.spilledRegion = spillStore->spill(spilledState);
+        coldStateInMemoryInBytes -= coldSlice.stateSizeInBytes;
+        NES_DEBUG("Spilled {}B of slice {}-{}", spilledState.size(), slice->getSliceStart(), sliceEnd);
+    }
+}
+
+void WindowBasedOperatorHandler::finishProbeTask(const SequenceData& sequenceData)
+{
+    const std::scoped_lock lock(spillMutex);
+    const auto pendingWindow = pendingWindows.find(SequenceNumber(sequenceData.sequenceNumber));
+    if (pendingWindow == pendingWindows.end())
+    {
+        return;
+    }
+
+    ++pendingWindow->second.numberOfProcessedProbeTasks;
+    if (sequenceData.lastChunk)
+    {
+        pendingWindow->second.numberOfProbeTasks = sequenceData.chunkNumber - ChunkNumber::INITIAL + 1;
+    }
+    if (pendingWindow->second.numberOfProbeTasks == pendingWindow->second.numberOfProcessedProbeTasks)
+    {
+        pendingWindows.erase(pendingWindow);
+    }
+}
+
 }
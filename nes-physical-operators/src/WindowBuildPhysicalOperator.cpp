@@ -25,6 +25,7 @@
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
 #include <WindowBasedOperatorHandler.hpp>
 #include <function.hpp>
 
@@ -49,6 +50,20 @@ void checkWindowsTriggerProxy(
     opHandler->checkAndTriggerWindows(bufferMetaData, pipelineCtx);
 }
 
+/// Holds the slices shared until the build task is done, so that the handler does not spill a slice while we write into it
+WindowBasedOperatorHandler::BuildTaskSliceAccess* startBuildTaskProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
+    return opHandler->startBuildTask(*pipelineCtx);
+}
+
+void finishBuildTaskProxy(WindowBasedOperatorHandler::BuildTaskSliceAccess* sliceAccess)
+{
+    WindowBasedOperatorHandler::finishBuildTask(sliceAccess);
+}
+
 void triggerAllWindowsProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* piplineContext)
 {
     PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
@@ -75,6 +90,8 @@ void WindowBuildPhysicalOperator::close(ExecutionContext& executionCtx, RecordBu
 {
     /// Update the watermark for the nlj operator and trigger slices
     auto operatorHandlerMemRef = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(executionCtx.getLocalState(id));
+    invoke(finishBuildTaskProxy, localState->getBuildTaskSliceAccess());
     invoke(
         checkWindowsTriggerProxy,
         operatorHandlerMemRef,
@@ -99,7 +116,8 @@ void WindowBuildPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuf
 
     /// Creating the local state for the window operator build.
     const auto operatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
-    executionCtx.setLocalOperatorState(id, std::make_unique<WindowOperatorBuildLocalState>(operatorHandler));
+    const auto sliceAccess = invoke(startBuildTaskProxy, operatorHandler, executionCtx.pipelineContext);
+    executionCtx.setLocalOperatorState(id, std::make_unique<WindowOperatorBuildLocalState>(operatorHandler, sliceAccess));
 }
 
 void WindowBuildPhysicalOperator::terminate(ExecutionContext& executionCtx) const
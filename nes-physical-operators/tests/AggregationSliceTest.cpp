@@ -0,0 +1,259 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/AggregationSlice.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <semaphore>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <Engine.hpp>
+#include <HashMapSlice.hpp>
+#include <function.hpp>
+#include <options.hpp>
+
+namespace NES
+{
+
+namespace
+{
+std::atomic<uint64_t> numberOfCleanedUpHashMaps{0};
+}
+
+class AggregationSliceTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("AggregationSliceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup AggregationSliceTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        numberOfCleanedUpHashMaps = 0;
+    }
+
+    /// Creates a slice whose cleanup function counts the hash maps that it cleans up
+    static std::unique_ptr<AggregationSlice> createSlice(const uint64_t numberOfWorkerThreads, const uint64_t numberOfRadixPartitions)
+    {
+        nautilus::engine::Options options;
+        options.setOption("engine.Compilation", false);
+        const nautilus::engine::NautilusEngine nautilusEngine(options);
+        /// NOLINTBEGIN(performance-unnecessary-value-param)
+        const auto cleanup = std::make_shared<CreateNewHashMapSliceArgs::NautilusCleanupExec>(nautilusEngine.registerFunction(std::function(
+            [](nautilus::val<Nautilus::Interface::HashMap*> hashMap)
+            { nautilus::invoke(+[](Nautilus::Interface::HashMap*) { ++numberOfCleanedUpHashMaps; }, hashMap); })));
+        /// NOLINTEND(performance-unnecessary-value-param)
+        const CreateNewHashMapSliceArgs args{{cleanup}, sizeof(uint64_t), sizeof(uint64_t), 4096, 16};
+        return std::make_unique<AggregationSlice>(SliceStart(0), SliceEnd(10), args, numberOfWorkerThreads, numberOfRadixPartitions);
+    }
+
+    /// Simulates a record of a build task by inserting an entry for the hash into the hash map of the worker thread and partition
+    void insertRecord(AggregationSlice& slice, const WorkerThreadId workerThreadId, const uint64_t partition, const uint64_t hash) const
+    {
+        slice.getHashMapPtrOrCreate(workerThreadId, partition)->insertEntry(hash, bufferManager.get());
+        slice.finishWrite(partition);
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(AggregationSliceTest, radixPartitionsHaveSeparateHashMaps)
+{
+    constexpr uint64_t numberOfWorkerThreads = 2;
+    constexpr uint64_t numberOfRadixPartitions = 3;
+    const auto slice = createSlice(numberOfWorkerThreads, numberOfRadixPartitions);
+    EXPECT_EQ(slice->getNumberOfRadixPartitions(), numberOfRadixPartitions);
+    EXPECT_EQ(slice->getNumberOfHashMapsForPartition(), numberOfWorkerThreads);
+    EXPECT_EQ(slice->getNumberOfHashMaps(), numberOfWorkerThreads * numberOfRadixPartitions);
+
+    std::set<Nautilus::Interface::HashMap*> hashMaps;
+    for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
+    {
+        for (uint64_t workerThread = 0; workerThread < numberOfWorkerThreads; ++workerThread)
+        {
+            EXPECT_EQ(slice->getHashMapPtr(WorkerThreadId(workerThread), partition), nullptr);
+            auto* hashMap = slice->getHashMapPtrOrCreate(WorkerThreadId(workerThread), partition);
+            EXPECT_EQ(slice->getHashMapPtr(WorkerThreadId(workerThread), partition), hashMap);
+            hashMaps.insert(hashMap);
+        }
+    }
+    EXPECT_EQ(hashMaps.size(), numberOfWorkerThreads * numberOfRadixPartitions);
+    EXPECT_EQ(slice->getHashMapPtrOrCreate(WorkerThreadId(numberOfWorkerThreads), 1), slice->getHashMapPtr(WorkerThreadId(0), 1));
+}
+
+TEST_F(AggregationSliceTest, radixPartitionCoversAllPartitions)
+{
+    for (const uint64_t numberOfRadixPartitions : {1, 2, 7, 16})
+    {
+        std::set<uint64_t> partitions;
+        for (uint64_t i = 0; i < 1024; ++i)
+        {
+            /// Spreading the hashes over the upper bits, as the radix partition only looks at them
+            const auto hash = i * (UINT64_MAX / 1024);
+            const auto partition = HashMapSlice::getRadixPartition(hash, numberOfRadixPartitions);
+            EXPECT_LT(partition, numberOfRadixPartitions);
+            partitions.insert(partition);
+        }
+        EXPECT_EQ(partitions.size(), numberOfRadixPartitions);
+    }
+}
+
+TEST_F(AggregationSliceTest, partialHashMapGetsCachedAcrossProbes)
+{
+    const auto slice = createSlice(2, 2);
+    insertRecord(*slice, WorkerThreadId(0), 1, 1);
+    insertRecord(*slice, WorkerThreadId(1), 1, 2);
+
+    /// The first probe of the partition has to combine the hash maps, all further probes reuse the partial hash map
+    auto* partialHashMap = slice->lockPartialHashMap(1);
+    EXPECT_FALSE(slice->isPartialHashMapCombined(1));
+    partialHashMap->insertEntry(1, bufferManager.get());
+    partialHashMap->insertEntry(2, bufferManager.get());
+    slice->unlockPartialHashMap(1);
+
+    EXPECT_EQ(slice->lockPartialHashMap(1), partialHashMap);
+    EXPECT_TRUE(slice->isPartialHashMapCombined(1));
+    slice->unlockPartialHashMap(1);
+
+    /// The other partition is cached independently
+    std::ignore = slice->lockPartialHashMap(0);
+    EXPECT_FALSE(slice->isPartialHashMapCombined(0));
+    slice->unlockPartialHashMap(0);
+}
+
+TEST_F(AggregationSliceTest, hashMapsOfWorkerThreadsStayAliveAfterCombining)
+{
+    const auto slice = createSlice(2, 1);
+    insertRecord(*slice, WorkerThreadId(0), 0, 1);
+    auto* hashMap = slice->getHashMapPtr(WorkerThreadId(0), 0);
+
+    std::ignore = slice->lockPartialHashMap(0);
+    slice->unlockPartialHashMap(0);
+
+    /// A build task might still hold the pointer to the hash map. Thus, it must neither be cleaned up nor be released.
+    EXPECT_EQ(numberOfCleanedUpHashMaps, 0);
+    EXPECT_EQ(slice->getHashMapPtr(WorkerThreadId(0), 0), hashMap);
+    EXPECT_EQ(hashMap->getNumberOfTuples(), 1);
+}
+
+TEST_F(AggregationSliceTest, lateRecordInvalidatesPartialHashMap)
+{
+    const auto slice = createSlice(2, 2);
+    insertRecord(*slice, WorkerThreadId(0), 1, 1);
+
+    auto* partialHashMap = slice->lockPartialHashMap(1);
+    ASSERT_FALSE(slice->isPartialHashMapCombined(1));
+    partialHashMap->insertEntry(1, bufferManager.get());
+    slice->unlockPartialHashMap(1);
+
+    /// A late record for the other partition does not invalidate the partial hash map
+    insertRecord(*slice, WorkerThreadId(1), 0, 2);
+    EXPECT_EQ(slice->lockPartialHashMap(1), partialHashMap);
+    EXPECT_TRUE(slice->isPartialHashMapCombined(1));
+    slice->unlockPartialHashMap(1);
+
+    /// A late record for the partition lands in the hash map of the worker thread, which still contains the earlier records
+    insertRecord(*slice, WorkerThreadId(0), 1, 3);
+    EXPECT_EQ(slice->getHashMapPtr(WorkerThreadId(0), 1)->getNumberOfTuples(), 2);
+
+    /// The next probe gets an empty partial hash map and has to combine the partition again. The outdated one got cleaned up.
+    partialHashMap = slice->lockPartialHashMap(1);
+    EXPECT_FALSE(slice->isPartialHashMapCombined(1));
+    EXPECT_EQ(partialHashMap->getNumberOfTuples(), 0);
+    EXPECT_EQ(numberOfCleanedUpHashMaps, 1);
+    partialHashMap->insertEntry(1, bufferManager.get());
+    partialHashMap->insertEntry(3, bufferManager.get());
+    slice->unlockPartialHashMap(1);
+
+    std::ignore = slice->lockPartialHashMap(1);
+    EXPECT_TRUE(slice->isPartialHashMapCombined(1));
+    slice->unlockPartialHashMap(1);
+}
+
+TEST_F(AggregationSliceTest, recordWrittenDuringProbeInvalidatesPartialHashMap)
+{
+    const auto slice = createSlice(2, 1);
+    insertRecord(*slice, WorkerThreadId(0), 0, 1);
+    auto* partialHashMap = slice->lockPartialHashMap(0);
+    partialHashMap->insertEntry(1, bufferManager.get());
+    slice->unlockPartialHashMap(0);
+
+    /// A build task gets its hash map, then a probe of the partition runs before the build task has written the record
+    std::binary_semaphore hashMapAcquired{0};
+    std::binary_semaphore probeDone{0};
+    std::thread buildTask(
+        [&]
+        {
+            auto* hashMap = slice->getHashMapPtrOrCreate(WorkerThreadId(1), 0);
+            hashMapAcquired.release();
+            probeDone.acquire();
+            hashMap->insertEntry(2, bufferManager.get());
+            slice->finishWrite(0);
+        });
+
+    hashMapAcquired.acquire();
+    EXPECT_EQ(slice->lockPartialHashMap(0), partialHashMap);
+    EXPECT_TRUE(slice->isPartialHashMapCombined(0));
+    slice->unlockPartialHashMap(0);
+    probeDone.release();
+    buildTask.join();
+
+    /// The partial hash map does not contain the record. Thus, the next probe has to combine the partition again.
+    partialHashMap = slice->lockPartialHashMap(0);
+    EXPECT_FALSE(slice->isPartialHashMapCombined(0));
+    partialHashMap->insertEntry(1, bufferManager.get());
+    partialHashMap->insertEntry(2, bufferManager.get());
+    slice->unlockPartialHashMap(0);
+
+    std::ignore = slice->lockPartialHashMap(0);
+    EXPECT_TRUE(slice->isPartialHashMapCombined(0));
+    slice->unlockPartialHashMap(0);
+}
+
+TEST_F(AggregationSliceTest, destructorCleansUpAllHashMaps)
+{
+    {
+        const auto slice = createSlice(2, 2);
+        insertRecord(*slice, WorkerThreadId(0), 0, 1);
+        insertRecord(*slice, WorkerThreadId(1), 1, 2);
+        /// The hash map of worker thread 0 for partition 1 is empty and thus does not need to be cleaned up
+        std::ignore = slice->getHashMapPtrOrCreate(WorkerThreadId(0), 1);
+
+        auto* partialHashMap = slice->lockPartialHashMap(1);
+        partialHashMap->insertEntry(2, bufferManager.get());
+        slice->unlockPartialHashMap(1);
+    }
+    EXPECT_EQ(numberOfCleanedUpHashMaps, 3);
+}
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/JoinStatisticsStore.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class JoinStatisticsStoreTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("JoinStatisticsStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup JoinStatisticsStoreTest class.");
+    }
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(JoinStatisticsStoreTest, inputKeyIsIndependentOfTheFieldOrder)
+{
+    EXPECT_EQ(
+        JoinStatisticsStore::createInputKey({"left$b", "left$a"}, {"right$b", "right$a"}),
+        JoinStatisticsStore::createInputKey({"left$a", "left$b"}, {"right$a", "right$b"}));
+    EXPECT_EQ(JoinStatisticsStore::createInputKey({"left$a", "left$a"}, {"right$a"}), "left$a|right$a");
+}
+
+TEST_F(JoinStatisticsStoreTest, inputKeyDependsOnTheOtherInput)
+{
+    EXPECT_NE(
+        JoinStatisticsStore::createInputKey({"left$a"}, {"right$a"}), JoinStatisticsStore::createInputKey({"left$a"}, {"other$a"}));
+    EXPECT_NE(JoinStatisticsStore::createInputKey({"left$a"}, {"right$a"}), JoinStatisticsStore::createInputKey({"right$a"}, {"left$a"}));
+}
+
+TEST_F(JoinStatisticsStoreTest, movingAverageOfSamples)
+{
+    JoinStatisticsStore store;
+    EXPECT_FALSE(store.get("stream$a").has_value());
+
+    store.update("stream$a", {.recordsPerSecond = 1000, .distinctKeysPerSecond = 100});
+    store.update("stream$a", {.recordsPerSecond = 2000, .distinctKeysPerSecond = 500});
+    const auto statistics = store.get("stream$a");
+    ASSERT_TRUE(statistics.has_value());
+    EXPECT_DOUBLE_EQ(statistics->recordsPerSecond, 1250);
+    EXPECT_DOUBLE_EQ(statistics->distinctKeysPerSecond, 200);
+    EXPECT_FALSE(store.get("stream$b").has_value());
+}
+
+TEST_F(JoinStatisticsStoreTest, storesDoNotShareStatistics)
+{
+    JoinStatisticsStore store;
+    store.update("stream$a", {.recordsPerSecond = 1000, .distinctKeysPerSecond = 100});
+    EXPECT_FALSE(JoinStatisticsStore{}.get("stream$a").has_value());
+
+    store.clear();
+    EXPECT_FALSE(store.get("stream$a").has_value());
+}
+
+TEST_F(JoinStatisticsStoreTest, scalesToDuration)
+{
+    const JoinInputStatistics statistics{.recordsPerSecond = 1000, .distinctKeysPerSecond = 4000};
+    EXPECT_DOUBLE_EQ(statistics.getNumberOfRecords(500), 500);
+    /// There are never more distinct keys than records
+    EXPECT_DOUBLE_EQ(statistics.getNumberOfDistinctKeys(500), 500);
+    const JoinInputStatistics fewKeys{.recordsPerSecond = 1000, .distinctKeysPerSecond = 10};
+    EXPECT_DOUBLE_EQ(fewKeys.getNumberOfDistinctKeys(2000), 20);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
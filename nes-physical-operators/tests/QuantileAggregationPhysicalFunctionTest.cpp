@@ -0,0 +1,112 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+#include <Aggregation/Function/QuantileAggregationPhysicalFunction.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class QuantileAggregationPhysicalFunctionTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("QuantileAggregationPhysicalFunctionTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup QuantileAggregationPhysicalFunctionTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Calculates the quantile by sorting all values
+    static double sortedQuantile(std::vector<double> values, const double quantile)
+    {
+        std::ranges::sort(values);
+        const auto rank = quantile * static_cast<double>(values.size() - 1);
+        const auto lower = values[static_cast<size_t>(std::floor(rank))];
+        const auto upper = values[static_cast<size_t>(std::ceil(rank))];
+        return lower + ((rank - std::floor(rank)) * (upper - lower));
+    }
+};
+
+TEST_F(QuantileAggregationPhysicalFunctionTest, medianOfOddAndEvenNumberOfValues)
+{
+    std::vector<double> oddValues{5, 1, 4, 2, 3};
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(oddValues), 0.5), 3);
+
+    std::vector<double> evenValues{4, 1, 3, 2};
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(evenValues), 0.5), 2.5);
+
+    std::vector<double> singleValue{42};
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(singleValue), 0.5), 42);
+}
+
+TEST_F(QuantileAggregationPhysicalFunctionTest, quantilesWithDuplicates)
+{
+    std::vector<double> values{7, 7, 7, 1, 1, 9};
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(values), 0), 1);
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(values), 1), 9);
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(values), 0.5), 7);
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(values), 0.9), 8);
+}
+
+TEST_F(QuantileAggregationPhysicalFunctionTest, selectsLargeIntegersInTheirInputType)
+{
+    /// Above 2^53, neighboring integers are not distinguishable as doubles. Converting the values before the interpolation would round
+    /// them to 2^53 and 2^53 + 4, which results in 2^53 + 1 and is rounded to 2^53. The exact quantile is 2^53 + 1.5.
+    constexpr int64_t twoToThePowerOf53 = int64_t{1} << 53;
+    std::vector<int64_t> values{twoToThePowerOf53 + 3, twoToThePowerOf53 + 1};
+    EXPECT_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(values), 0.25), static_cast<double>(twoToThePowerOf53 + 2));
+
+    /// The distance between the values exceeds the range of int64_t
+    std::vector<int64_t> extremeValues{std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+    EXPECT_DOUBLE_EQ(QuantileAggregationPhysicalFunction::selectQuantile(std::span(extremeValues), 0.5), -0.5);
+
+    std::vector<uint64_t> unsignedValues{std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max() - 1, 0};
+    EXPECT_EQ(
+        QuantileAggregationPhysicalFunction::selectQuantile(std::span(unsignedValues), 1.0),
+        static_cast<double>(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST_F(QuantileAggregationPhysicalFunctionTest, randomValuesMatchSorting)
+{
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> valueDistribution(-1000, 1000);
+    for (const uint64_t numberOfValues : {1, 2, 3, 10, 1000, 100001})
+    {
+        std::vector<double> values(numberOfValues);
+        std::ranges::generate(values, [&] { return valueDistribution(random); });
+        for (const auto quantile : {0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0})
+        {
+            auto valuesToSelect = values;
+            const auto selectedQuantile = QuantileAggregationPhysicalFunction::selectQuantile(std::span(valuesToSelect), quantile);
+            EXPECT_DOUBLE_EQ(selectedQuantile, sortedQuantile(values, quantile))
+                << "numberOfValues " << numberOfValues << " quantile " << quantile;
+        }
+    }
+}
+
+}
@@ -0,0 +1,137 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceStoreProvider.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class TimeBasedSliceStoreTest : public Testing::BaseUnitTest, public testing::WithParamInterface<SliceStoreType>
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("TimeBasedSliceStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup TimeBasedSliceStoreTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Creates a single slice and counts how often it has been called
+    auto createSliceFunction()
+    {
+        return [this](const SliceStart sliceStart, const SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        {
+            ++numberOfCreatedSlices;
+            return {std::make_shared<Slice>(sliceStart, sliceEnd)};
+        };
+    }
+
+    std::atomic<uint64_t> numberOfCreatedSlices{0};
+};
+
+TEST_P(TimeBasedSliceStoreTest, sameSliceForSameSliceEnd)
+{
+    constexpr uint64_t windowSize = 10;
+    constexpr uint64_t windowSlide = 5;
+    const auto sliceStore = provideSliceStore(GetParam(), windowSize, windowSlide);
+    sliceStore->incrementNumberOfInputPipelines();
+
+    const auto firstSlice = sliceStore->getSlicesOrCreate(Timestamp(1), createSliceFunction());
+    const auto secondSlice = sliceStore->getSlicesOrCreate(Timestamp(4), createSliceFunction());
+    const auto thirdSlice = sliceStore->getSlicesOrCreate(Timestamp(5), createSliceFunction());
+    ASSERT_EQ(firstSlice.size(), 1);
+    ASSERT_EQ(secondSlice.size(), 1);
+    ASSERT_EQ(thirdSlice.size(), 1);
+    EXPECT_EQ(firstSlice[0], secondSlice[0]);
+    EXPECT_NE(firstSlice[0], thirdSlice[0]);
+    EXPECT_EQ(numberOfCreatedSlices, 2);
+    EXPECT_EQ(sliceStore->getSliceBySliceEnd(SliceEnd(5)), firstSlice[0]);
+    EXPECT_EQ(sliceStore->getSliceBySliceEnd(SliceEnd(10)), thirdSlice[0]);
+    EXPECT_FALSE(sliceStore->getSliceBySliceEnd(SliceEnd(15)).has_value());
+
+    /// The window [0, 10) contains both slices and gets triggered once the watermark passes its end
+    const auto triggeredWindows = sliceStore->getTriggerableWindowSlices(Timestamp(11));
+    ASSERT_EQ(triggeredWindows.size(), 1);
+    EXPECT_EQ(triggeredWindows.begin()->first.windowInfo.windowEnd, Timestamp(10));
+    EXPECT_EQ(triggeredWindows.begin()->second.size(), 2);
+
+    /// After the garbage collection, the first slice is not available anymore, as sliceEnd + windowSize < watermark
+    sliceStore->garbageCollectSlicesAndWindows(Timestamp(16));
+    EXPECT_FALSE(sliceStore->getSliceBySliceEnd(SliceEnd(5)).has_value());
+    EXPECT_EQ(sliceStore->getSliceBySliceEnd(SliceEnd(10)), thirdSlice[0]);
+}
+
+TEST_P(TimeBasedSliceStoreTest, concurrentGetSlicesOrCreate)
+{
+    /// All threads write into the same tumbling windows. All threads must see the same slice for the same slice end.
+    /// We can not check the number of calls to createSliceFunction, as the slice stores create slices speculatively before locking.
+    constexpr uint64_t windowSize = 100;
+    constexpr uint64_t numberOfThreads = 8;
+    constexpr uint64_t numberOfTimestamps = 100000;
+    const auto sliceStore = provideSliceStore(GetParam(), windowSize, windowSize);
+    sliceStore->incrementNumberOfInputPipelines();
+
+    std::vector<std::map<SliceEnd, Slice*>> seenSlicesPerThread(numberOfThreads);
+    {
+        std::vector<std::jthread> threads;
+        for (uint64_t threadId = 0; threadId < numberOfThreads; ++threadId)
+        {
+            threads.emplace_back(
+                [&, threadId]()
+                {
+                    for (uint64_t timestamp = 0; timestamp < numberOfTimestamps; ++timestamp)
+                    {
+                        const auto slices = sliceStore->getSlicesOrCreate(Timestamp(timestamp), createSliceFunction());
+                        ASSERT_EQ(slices.size(), 1);
+                        const auto [it, inserted] = seenSlicesPerThread[threadId].try_emplace(slices[0]->getSliceEnd(), slices[0].get());
+                        ASSERT_EQ(it->second, slices[0].get());
+                    }
+                });
+        }
+    }
+
+    EXPECT_EQ(seenSlicesPerThread[0].size(), numberOfTimestamps / windowSize);
+    for (const auto& seenSlices : seenSlicesPerThread)
+    {
+        EXPECT_EQ(seenSlices, seenSlicesPerThread[0]);
+    }
+
+    const auto allWindows = sliceStore->getAllNonTriggeredSlices();
+    EXPECT_EQ(allWindows.size(), numberOfTimestamps / windowSize);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    TimeBasedSliceStoreTest,
+    TimeBasedSliceStoreTest,
+    ::testing::Values(SliceStoreType::DEFAULT, SliceStoreType::LOCK_FREE),
+    [](const testing::TestParamInfo<TimeBasedSliceStoreTest::ParamType>& info)
+    { return std::string(magic_enum::enum_name(info.param)); });
+}
@@ -0,0 +1,304 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <WindowBasedOperatorHandler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/SpillStore.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr uint64_t STATE_SIZE_IN_BYTES = 100;
+constexpr uint64_t WINDOW_SIZE = 30;
+constexpr uint64_t WINDOW_SLIDE = 10;
+const OriginId INPUT_ORIGIN_ID(1);
+const OriginId OUTPUT_ORIGIN_ID(2);
+
+/// Slice whose state is a fixed number of bytes, so that we can check if it is spilled or in memory
+class SpillableTestSlice final : public Slice
+{
+public:
+    SpillableTestSlice(const SliceStart sliceStart, const SliceEnd sliceEnd)
+        : Slice(sliceStart, sliceEnd), state(STATE_SIZE_IN_BYTES, std::byte{42})
+    {
+    }
+
+    [[nodiscard]] uint64_t getSpillableStateSizeInBytes() const override { return state.size(); }
+
+    void spillState(std::vector<std::byte>& spilledState) override
+    {
+        spilledState.insert(spilledState.end(), state.begin(), state.end());
+        state.clear();
+        spilled = true;
+    }
+
+    void reloadState(std::span<const std::byte>& spilledState, AbstractBufferProvider&) override
+    {
+        state.assign(spilledState.begin(), spilledState.begin() + STATE_SIZE_IN_BYTES);
+        spilledState = spilledState.subspan(STATE_SIZE_IN_BYTES);
+        spilled = false;
+    }
+
+    std::vector<std::byte> state;
+    std::atomic<bool> spilled{false};
+};
+
+/// Remembers the size of the state of all slices of a window at the time the window gets triggered
+class SpillingTestOperatorHandler final : public WindowBasedOperatorHandler
+{
+public:
+    using WindowBasedOperatorHandler::WindowBasedOperatorHandler;
+
+    [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+    getCreateNewSlicesFunction(const CreateNewSlicesArguments&) const override
+    {
+        return [](const SliceStart sliceStart, const SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        { return {std::make_shared<SpillableTestSlice>(sliceStart, sliceEnd)}; };
+    }
+
+    std::map<SequenceNumber, std::vector<uint64_t>> triggeredStateSizes;
+
+protected:
+    void triggerSlices(
+        const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+        PipelineExecutionContext*) override
+    {
+        for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+        {
+            for (const auto& slice : allSlices)
+            {
+                triggeredStateSizes[windowInfo.sequenceNumber].emplace_back(slice->getSpillableStateSizeInBytes());
+            }
+        }
+    }
+};
+
+struct TestPipelineExecutionContext final : PipelineExecutionContext
+{
+    bool emitBuffer(const TupleBuffer&, ContinuationPolicy) override { return true; }
+
+    TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+    [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+    [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+    [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+    [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+    std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override { return operatorHandlers; }
+
+    void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+    {
+        operatorHandlers = opHandlers;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+    std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+};
+}
+
+class WindowBasedOperatorHandlerTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("WindowBasedOperatorHandlerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup WindowBasedOperatorHandlerTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Windows of size 30 and slide 10, i.e., each slice of 10 belongs to up to three windows
+    void createHandler(const uint64_t memoryBudgetInBytes)
+    {
+        handler = std::make_unique<SpillingTestOperatorHandler>(
+            std::vector{INPUT_ORIGIN_ID}, OUTPUT_ORIGIN_ID, std::make_unique<DefaultTimeBasedSliceStore>(WINDOW_SIZE, WINDOW_SLIDE));
+        handler->setSpilling(std::make_shared<FileSpillStore>(std::filesystem::temp_directory_path()), memoryBudgetInBytes);
+        handler->start(pipelineContext, 0);
+    }
+
+    /// Creates the slice that contains the timestamp, as a build task would
+    void createSlice(const uint64_t timestamp) const
+    {
+        std::ignore = handler->getSliceAndWindowStore().getSlicesOrCreate(
+            Timestamp(timestamp), handler->getCreateNewSlicesFunction(CreateNewSlicesArguments{}));
+    }
+
+    /// Passes a buffer with the watermark to the handler, as the build does at the end of each buffer
+    void advanceBuildWatermark(const uint64_t watermark)
+    {
+        const SequenceData sequenceData(SequenceNumber(nextSequenceNumber++), INITIAL<ChunkNumber>, true);
+        handler->checkAndTriggerWindows(BufferMetaData(Timestamp(watermark), sequenceData, INPUT_ORIGIN_ID), &pipelineContext);
+    }
+
+    /// Passes the single probe task of the window to the handler, as the probe does once it is done with the window
+    void finishProbeOfWindow(const SequenceNumber sequenceNumber) const
+    {
+        handler->garbageCollectSlicesAndWindows(
+            BufferMetaData(Timestamp(0), SequenceData(sequenceNumber, INITIAL<ChunkNumber>, true), OUTPUT_ORIGIN_ID));
+    }
+
+    [[nodiscard]] bool isSpilled(const uint64_t sliceEnd) const
+    {
+        const auto slice = handler->getSliceAndWindowStore().getSliceBySliceEnd(SliceEnd(sliceEnd));
+        EXPECT_TRUE(slice.has_value());
+        return slice.has_value() and std::dynamic_pointer_cast<SpillableTestSlice>(slice.value())->spilled;
+    }
+
+    TestPipelineExecutionContext pipelineContext;
+    std::unique_ptr<SpillingTestOperatorHandler> handler;
+    SequenceNumber::Underlying nextSequenceNumber = SequenceNumber::INITIAL;
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(WindowBasedOperatorHandlerTest, noSpillingWithinMemoryBudget)
+{
+    createHandler(3 * STATE_SIZE_IN_BYTES);
+    for (const uint64_t timestamp : {5, 15, 25, 35})
+    {
+        createSlice(timestamp);
+    }
+    advanceBuildWatermark(30);
+    EXPECT_FALSE(isSpilled(10));
+    EXPECT_FALSE(isSpilled(20));
+    EXPECT_FALSE(isSpilled(30));
+    EXPECT_FALSE(isSpilled(40));
+}
+
+TEST_F(WindowBasedOperatorHandlerTest, spillsMostRecentColdSlicesAndReloadsThemBeforeTriggering)
+{
+    createHandler(STATE_SIZE_IN_BYTES + (STATE_SIZE_IN_BYTES / 2));
+    for (const uint64_t timestamp : {5, 15, 25, 35})
+    {
+        createSlice(timestamp);
+    }
+
+    /// The watermark has passed two slices, but no window. The slice that ends last is part of the windows that get triggered last.
+    advanceBuildWatermark(20);
+    EXPECT_FALSE(isSpilled(10));
+    EXPECT_TRUE(isSpilled(20));
+    EXPECT_FALSE(isSpilled(30));
+    EXPECT_TRUE(handler->triggeredStateSizes.empty());
+
+    /// Triggering the window [0, 30) reloads the spilled slice before the window gets triggered
+    advanceBuildWatermark(31);
+    ASSERT_EQ(handler->triggeredStateSizes.size(), 1);
+    EXPECT_EQ(
+        handler->triggeredStateSizes.at(SequenceNumber(SequenceNumber::INITIAL)),
+        (std::vector{STATE_SIZE_IN_BYTES, STATE_SIZE_IN_BYTES, STATE_SIZE_IN_BYTES}));
+    EXPECT_FALSE(isSpilled(20));
+}
+
+TEST_F(WindowBasedOperatorHandlerTest, slicesOfProbedWindowsStayInMemoryUntilTheProbeIsDone)
+{
+    createHandler(STATE_SIZE_IN_BYTES);
+    for (const uint64_t timestamp : {5, 15, 25, 35})
+    {
+        createSlice(timestamp);
+    }
+
+    /// All cold slices belong to the window [0, 30), whose probe is still running
+    advanceBuildWatermark(31);
+    ASSERT_EQ(handler->triggeredStateSizes.size(), 1);
+    EXPECT_FALSE(isSpilled(10));
+    EXPECT_FALSE(isSpilled(20));
+    EXPECT_FALSE(isSpilled(30));
+
+    /// Once the probe is done, the next watermark spills the most recent cold slices until the state fits into the budget
+    finishProbeOfWindow(SequenceNumber(SequenceNumber::INITIAL));
+    advanceBuildWatermark(32);
+    EXPECT_FALSE(isSpilled(10));
+    EXPECT_TRUE(isSpilled(20));
+    EXPECT_TRUE(isSpilled(30));
+    EXPECT_FALSE(isSpilled(40));
+
+    /// The window [10, 40) reloads both spilled slices
+    advanceBuildWatermark(41);
+    ASSERT_EQ(handler->triggeredStateSizes.size(), 2);
+    EXPECT_EQ(
+        handler->triggeredStateSizes.at(SequenceNumber(SequenceNumber::INITIAL + 1)),
+        (std::vector{STATE_SIZE_IN_BYTES, STATE_SIZE_IN_BYTES, STATE_SIZE_IN_BYTES}));
+    EXPECT_FALSE(isSpilled(20));
+    EXPECT_FALSE(isSpilled(30));
+}
+
+TEST_F(WindowBasedOperatorHandlerTest, spillingWaitsForRunningBuildTasks)
+{
+    createHandler(0);
+    createSlice(5);
+
+    /// A running build task might still write a late record into the cold slice. Thus, the handler must not spill it yet.
+    auto* sliceAccess = handler->startBuildTask(pipelineContext);
+    std::thread closingBuildTask([this] { advanceBuildWatermark(10); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(isSpilled(10));
+
+    WindowBasedOperatorHandler::finishBuildTask(sliceAccess);
+    closingBuildTask.join();
+    EXPECT_TRUE(isSpilled(10));
+}
+
+TEST_F(WindowBasedOperatorHandlerTest, failingBuildTaskReleasesItsSliceAccess)
+{
+    createHandler(0);
+    createSlice(5);
+
+    /// The build task fails before closing its buffer. Its pipeline execution context gets destroyed with the task.
+    {
+        TestPipelineExecutionContext failingTaskContext;
+        std::ignore = handler->startBuildTask(failingTaskContext);
+    }
+
+    /// Otherwise, the spill would wait forever for the build task, and would keep all new build tasks waiting, too
+    advanceBuildWatermark(10);
+    EXPECT_TRUE(isSpilled(10));
+    WindowBasedOperatorHandler::finishBuildTask(handler->startBuildTask(pipelineContext));
+}
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -14,6 +14,9 @@
 
 #include <Generator.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <ranges>
@@ -53,6 +56,69 @@ void Generator::generateTuple(std::ostream& ostream)
     ostream << Generator::tupleDelimiter;
 }
 
+size_t Generator::generateTuples(int8_t* buffer, const size_t maxNumberOfTuples)
+{
+    PRECONDITION(not this->fields.empty(), "Cannot generate a row if there are no fields!");
+    const auto numberOfTuples = getNumberOfTuplesUntilStop(maxNumberOfTuples);
+    const auto tupleSizeInBytes = getTupleSizeInBytes();
+    int8_t* firstValueOfField = buffer;
+    const auto generateColumn = Overloaded{
+        [&](GeneratorFields::BaseStoppableGeneratorField& field)
+        {
+            const bool fieldAlreadyStopped = field.stop;
+            field.generate(firstValueOfField, numberOfTuples, tupleSizeInBytes, this->randEng);
+            if (field.stop && !fieldAlreadyStopped)
+            {
+                this->numStoppedFields++;
+            }
+            firstValueOfField += field.getSizeInBytes();
+        },
+        [&](GeneratorFields::BaseGeneratorField& field)
+        {
+            field.generate(firstValueOfField, numberOfTuples, tupleSizeInBytes, this->randEng);
+            firstValueOfField += field.getSizeInBytes();
+        }};
+
+    for (auto& field : this->fields)
+    {
+        std::visit(generateColumn, *field);
+    }
+    return numberOfTuples;
+}
+
+size_t Generator::getTupleSizeInBytes() const
+{
+    size_t tupleSizeInBytes = 0;
+    for (const auto& field : this->fields)
+    {
+        tupleSizeInBytes
+            += std::visit([](const GeneratorFields::BaseGeneratorField& baseField) { return baseField.getSizeInBytes(); }, *field);
+    }
+    return tupleSizeInBytes;
+}
+
+size_t Generator::getNumberOfTuplesUntilStop(const size_t maxNumberOfTuples) const
+{
+    if (this->sequenceStopsGenerator == GeneratorStop::NONE)
+    {
+        return maxNumberOfTuples;
+    }
+    /// The generator stops once all sequences stopped (ALL) or once the first sequence stopped (ONE)
+    size_t numberOfTuples = this->sequenceStopsGenerator == GeneratorStop::ALL ? 0 : maxNumberOfTuples;
+    for (const auto& field : this->fields)
+    {
+        const auto* const sequenceField = std::get_if<GeneratorFields::SequenceField>(field.get());
+        if (sequenceField == nullptr or sequenceField->stop)
+        {
+            continue;
+        }
+        const auto numberOfValues = sequenceField->getNumberOfValuesUntilStop(maxNumberOfTuples);
+        numberOfTuples = this->sequenceStopsGenerator == GeneratorStop::ALL ? std::max(numberOfTuples, numberOfValues)
+                                                                           : std::min(numberOfTuples, numberOfValues);
+    }
+    return numberOfTuples;
+}
+
 void Generator::addField(std::unique_ptr<GeneratorFields::GeneratorFieldType> field)
 {
     std::visit(
@@ -81,6 +147,18 @@ void Generator::parseRawSchemaLine(std::string_view line)
     {
         this->addField(std::make_unique<GeneratorFields::GeneratorFieldType>(GeneratorFields::NormalDistributionField(line)));
     }
+    else if (firstWord == GeneratorFields::UNIFORM_IDENTIFIER)
+    {
+        this->addField(std::make_unique<GeneratorFields::GeneratorFieldType>(GeneratorFields::UniformField(line)));
+    }
+    else if (firstWord == GeneratorFields::ZIPF_IDENTIFIER)
+    {
+        this->addField(std::make_unique<GeneratorFields::GeneratorFieldType>(GeneratorFields::ZipfField(line)));
+    }
+    else if (firstWord == GeneratorFields::EVENT_TIME_IDENTIFIER)
+    {
+        this->addField(std::make_unique<GeneratorFields::GeneratorFieldType>(GeneratorFields::EventTimeField(line)));
+    }
     else
     {
         throw InvalidConfigParameter("Invalid line, {} is not a recognized generatorType: {}", firstWord, line);
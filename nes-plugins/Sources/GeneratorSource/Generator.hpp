@@ -54,6 +54,13 @@ public:
     /// @param ostream output stream
     void generateTuple(std::ostream& ostream);
 
+    /// Generates up to maxNumberOfTuples rows in the native row layout, column by column, and returns the number of generated rows.
+    /// Generates fewer rows, if the sequences stop the generator before.
+    size_t generateTuples(int8_t* buffer, size_t maxNumberOfTuples);
+
+    /// Size of a row in the native row layout
+    [[nodiscard]] size_t getTupleSizeInBytes() const;
+
     void addField(std::unique_ptr<GeneratorFields::GeneratorFieldType> field);
 
     /// TODO #355: Parse from YAML Nodes instead of a string
@@ -76,5 +83,8 @@ private:
 
     /// TODO #355: Parse from YAML Nodes instead of a string
     void parseRawSchemaLine(std::string_view line);
+
+    /// Returns the number of rows, up to maxNumberOfTuples, that the generator produces until 'shouldStop()' becomes true
+    [[nodiscard]] size_t getNumberOfTuplesUntilStop(size_t maxNumberOfTuples) const;
 };
 }
@@ -14,14 +14,20 @@
 
 #include <GeneratorFields.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <ios>
+#include <optional>
 #include <ostream>
 #include <random>
 #include <ranges>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <variant>
 #include <vector>
 #include <DataTypes/DataType.hpp>
@@ -35,6 +41,101 @@
 
 namespace NES::GeneratorFields
 {
+namespace
+{
+/// Writes one value per tuple of the native row layout. The row layout packs the fields, thus, the values may be unaligned.
+template <typename T, typename GenerateValue>
+void writeColumn(int8_t* firstValue, const size_t numberOfTuples, const size_t tupleSizeInBytes, GenerateValue&& generateValue)
+{
+    for (size_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+    {
+        const T value = generateValue();
+        std::memcpy(firstValue + (tupleIdx * tupleSizeInBytes), &value, sizeof(T));
+    }
+}
+
+template <typename T>
+void writeText(std::ostream& os, const T value)
+{
+    if constexpr (std::is_same_v<T, uint8_t> or std::is_same_v<T, int8_t>)
+    {
+        /// Need to cast it to an int32, as we would get 'NULL' and not '0'
+        os << static_cast<int32_t>(value);
+    }
+    else
+    {
+        os << value;
+    }
+}
+
+/// Returns a zero of the C++ type that represents the numeric data type. Visiting it dispatches on the type of a field.
+std::optional<FieldType> createZeroValue(const DataType::Type type)
+{
+    switch (type)
+    {
+        case DataType::Type::UINT8:
+            return uint8_t{};
+        case DataType::Type::UINT16:
+            return uint16_t{};
+        case DataType::Type::UINT32:
+            return uint32_t{};
+        case DataType::Type::UINT64:
+            return uint64_t{};
+        case DataType::Type::INT8:
+            return int8_t{};
+        case DataType::Type::INT16:
+            return int16_t{};
+        case DataType::Type::INT32:
+            return int32_t{};
+        case DataType::Type::INT64:
+            return int64_t{};
+        case DataType::Type::FLOAT32:
+            return float{};
+        case DataType::Type::FLOAT64:
+            return double{};
+        case DataType::Type::BOOLEAN:
+        case DataType::Type::CHAR:
+        case DataType::Type::UNDEFINED:
+        case DataType::Type::VARSIZED:
+        case DataType::Type::VARSIZED_POINTER_REP:
+            return std::nullopt;
+    }
+    return std::nullopt;
+}
+
+std::optional<FieldType> parseValue(const FieldType& zeroValue, const std::string_view value)
+{
+    return std::visit(
+        [value]<typename T>(const T&) -> std::optional<FieldType>
+        {
+            if (const auto parsedValue = Util::from_chars<T>(value))
+            {
+                return parsedValue.value();
+            }
+            return std::nullopt;
+        },
+        zeroValue);
+}
+
+/// The standard library does not define uniform_int_distribution for 8-bit types
+template <typename T>
+auto createUniformDistribution(const T min, const T max)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return std::uniform_real_distribution<T>(min, max);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return std::uniform_int_distribution<std::conditional_t<std::is_signed_v<T>, int16_t, uint16_t>>(min, max);
+    }
+    else
+    {
+        return std::uniform_int_distribution<T>(min, max);
+    }
+}
+}
+
 SequenceField::SequenceField(const FieldType start, const FieldType end, const FieldType step)
     : sequencePosition(start), sequenceStart(start), sequenceEnd(end), sequenceStepSize(step)
 {
@@ -260,6 +361,63 @@ std::ostream& SequenceField::generate(std::ostream& os, std::default_random_engi
     return os;
 }
 
+void SequenceField::generate(
+    int8_t* firstValue, const size_t numberOfTuples, const size_t tupleSizeInBytes, std::default_random_engine& /*randEng*/)
+{
+    std::visit(
+        [&]<typename T>(T& pos)
+        {
+            const auto& end = std::get<T>(sequenceEnd);
+            const auto& step = std::get<T>(sequenceStepSize);
+            writeColumn<T>(
+                firstValue,
+                numberOfTuples,
+                tupleSizeInBytes,
+                [&pos, &end, &step]
+                {
+                    const T value = pos;
+                    if (pos < end)
+                    {
+                        pos += step;
+                    }
+                    return value;
+                });
+        },
+        sequencePosition);
+    if (sequencePosition >= this->sequenceEnd)
+    {
+        this->stop = true;
+    }
+}
+
+size_t SequenceField::getSizeInBytes() const
+{
+    return std::visit([]<typename T>(const T&) { return sizeof(T); }, sequencePosition);
+}
+
+size_t SequenceField::getNumberOfValuesUntilStop(const size_t maxNumberOfValues) const
+{
+    return std::visit(
+        [&]<typename T>(T pos)
+        {
+            const auto& end = std::get<T>(sequenceEnd);
+            const auto& step = std::get<T>(sequenceStepSize);
+            for (size_t numberOfValues = 1; numberOfValues <= maxNumberOfValues; ++numberOfValues)
+            {
+                if (pos < end)
+                {
+                    pos += step;
+                }
+                if (pos >= end)
+                {
+                    return numberOfValues;
+                }
+            }
+            return maxNumberOfValues;
+        },
+        sequencePosition);
+}
+
 namespace
 {
 template <typename T, typename U = double>
@@ -321,6 +479,7 @@ NormalDistributionField::NormalDistributionField(const std::string_view rawSchem
             break;
         case DataType::Type::FLOAT64:
             distribution = createDistribution<double, double>(mean, stddev);
+            break;
 
         /// We require an integer for binomial_distribution
         case DataType::Type::BOOLEAN:
@@ -355,6 +514,23 @@ std::ostream& NormalDistributionField::generate(std::ostream& os, std::default_r
     return os;
 }
 
+void NormalDistributionField::generate(
+    int8_t* firstValue, const size_t numberOfTuples, const size_t tupleSizeInBytes, std::default_random_engine& randEng)
+{
+    std::visit(
+        [&]<typename Distribution>(Distribution& distribution)
+        {
+            writeColumn<typename Distribution::result_type>(
+                firstValue, numberOfTuples, tupleSizeInBytes, [&distribution, &randEng] { return distribution(randEng); });
+        },
+        distribution);
+}
+
+size_t NormalDistributionField::getSizeInBytes() const
+{
+    return outputType.getSizeInBytes();
+}
+
 void NormalDistributionField::validate(std::string_view rawSchemaLine)
 {
     const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
@@ -386,5 +562,209 @@ void NormalDistributionField::validate(std::string_view rawSchemaLine)
     }
 }
 
+UniformField::UniformField(const std::string_view rawSchemaLine)
+{
+    const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
+    const auto zeroValue = createZeroValue(DataTypeProvider::provideDataType(std::string{parameters[1]}).type);
+    INVARIANT(zeroValue.has_value(), "Output Type \"{}\" is not supported for uniform distribution.", parameters[1]);
+    this->min = parseValue(zeroValue.value(), parameters[2]).value();
+    this->max = parseValue(zeroValue.value(), parameters[3]).value();
+}
+
+std::ostream& UniformField::generate(std::ostream& os, std::default_random_engine& randEng)
+{
+    std::visit(
+        [&]<typename T>(const T& minValue)
+        {
+            auto distribution = createUniformDistribution(minValue, std::get<T>(max));
+            writeText(os, static_cast<T>(distribution(randEng)));
+        },
+        min);
+    return os;
+}
+
+void UniformField::generate(
+    int8_t* firstValue, const size_t numberOfTuples, const size_t tupleSizeInBytes, std::default_random_engine& randEng)
+{
+    std::visit(
+        [&]<typename T>(const T& minValue)
+        {
+            auto distribution = createUniformDistribution(minValue, std::get<T>(max));
+            writeColumn<T>(
+                firstValue, numberOfTuples, tupleSizeInBytes, [&distribution, &randEng] { return static_cast<T>(distribution(randEng)); });
+        },
+        min);
+}
+
+size_t UniformField::getSizeInBytes() const
+{
+    return std::visit([]<typename T>(const T&) { return sizeof(T); }, min);
+}
+
+void UniformField::validate(const std::string_view rawSchemaLine)
+{
+    const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
+    if (parameters.size() != NUM_PARAMETERS_UNIFORM_FIELD)
+    {
+        throw InvalidConfigParameter("Number of UniformField parameters does not match! {}", rawSchemaLine);
+    }
+    const auto dataType = DataTypeProvider::tryProvideDataType(std::string{parameters[1]});
+    const auto zeroValue = dataType.has_value() ? createZeroValue(dataType.value().type) : std::nullopt;
+    if (not zeroValue.has_value())
+    {
+        throw InvalidConfigParameter("Invalid UniformField type of {}!", parameters[1]);
+    }
+    const auto min = parseValue(zeroValue.value(), parameters[2]);
+    const auto max = parseValue(zeroValue.value(), parameters[3]);
+    if (not min.has_value() or not max.has_value())
+    {
+        throw InvalidConfigParameter("Could not parse min or max of UniformField: {}", rawSchemaLine);
+    }
+    if (max.value() < min.value())
+    {
+        throw InvalidConfigParameter("The min of a UniformField must not be larger than its max: {}", rawSchemaLine);
+    }
+}
+
+ZipfField::ZipfField(const std::string_view rawSchemaLine)
+{
+    const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
+    this->outputType = DataTypeProvider::provideDataType(std::string{parameters[1]});
+    const auto numberOfKeys = Util::from_chars<uint64_t>(parameters[2]).value();
+    const auto exponent = Util::from_chars<double>(parameters[3]).value();
+
+    this->cumulativeProbabilities.reserve(numberOfKeys);
+    double sumOfWeights = 0;
+    for (uint64_t key = 0; key < numberOfKeys; ++key)
+    {
+        sumOfWeights += 1.0 / std::pow(static_cast<double>(key + 1), exponent);
+        this->cumulativeProbabilities.emplace_back(sumOfWeights);
+    }
+    for (auto& cumulativeProbability : this->cumulativeProbabilities)
+    {
+        cumulativeProbability /= sumOfWeights;
+    }
+    /// Rounding errors must not yield a probability below one for drawing any of the keys
+    this->cumulativeProbabilities.back() = 1.0;
+}
+
+uint64_t ZipfField::nextKey(std::default_random_engine& randEng) const
+{
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    const auto key = std::ranges::upper_bound(cumulativeProbabilities, distribution(randEng)) - cumulativeProbabilities.begin();
+    return std::min(static_cast<uint64_t>(key), cumulativeProbabilities.size() - 1);
+}
+
+std::ostream& ZipfField::generate(std::ostream& os, std::default_random_engine& randEng)
+{
+    return os << nextKey(randEng);
+}
+
+void ZipfField::generate(
+    int8_t* firstValue, const size_t numberOfTuples, const size_t tupleSizeInBytes, std::default_random_engine& randEng)
+{
+    std::visit(
+        [&]<typename T>(const T&)
+        { writeColumn<T>(firstValue, numberOfTuples, tupleSizeInBytes, [this, &randEng] { return static_cast<T>(nextKey(randEng)); }); },
+        createZeroValue(outputType.type).value());
+}
+
+size_t ZipfField::getSizeInBytes() const
+{
+    return outputType.getSizeInBytes();
+}
+
+void ZipfField::validate(const std::string_view rawSchemaLine)
+{
+    const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
+    if (parameters.size() != NUM_PARAMETERS_ZIPF_FIELD)
+    {
+        throw InvalidConfigParameter("Number of ZipfField parameters does not match! {}", rawSchemaLine);
+    }
+    const auto dataType = DataTypeProvider::tryProvideDataType(std::string{parameters[1]});
+    const auto [acceptedTypesBegin, acceptedTypesEnd] = FieldNameToAcceptedTypes.equal_range(ZIPF_IDENTIFIER);
+    if (not dataType.has_value()
+        or std::none_of(acceptedTypesBegin, acceptedTypesEnd, [&dataType](const auto& entry) { return entry.second == dataType->type; }))
+    {
+        throw InvalidConfigParameter("Invalid ZipfField type of {}!", parameters[1]);
+    }
+    const auto numberOfKeys = Util::from_chars<uint64_t>(parameters[2]);
+    if (not numberOfKeys.has_value() or numberOfKeys.value() == 0 or numberOfKeys.value() > MAX_NUMBER_OF_ZIPF_KEYS)
+    {
+        throw InvalidConfigParameter("The number of keys of a ZipfField must be in [1, {}]: {}", MAX_NUMBER_OF_ZIPF_KEYS, rawSchemaLine);
+    }
+    const auto exponent = Util::from_chars<double>(parameters[3]);
+    if (not exponent.has_value() or exponent.value() < 0.0)
+    {
+        throw InvalidConfigParameter("The exponent of a ZipfField must be a non-negative number: {}", rawSchemaLine);
+    }
+}
+
+EventTimeField::EventTimeField(const std::string_view rawSchemaLine)
+{
+    const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
+    this->outputType = DataTypeProvider::provideDataType(std::string{parameters[1]});
+    this->start = Util::from_chars<uint64_t>(parameters[2]).value();
+    this->step = Util::from_chars<uint64_t>(parameters[3]).value();
+    this->maxOutOfOrderness = Util::from_chars<uint64_t>(parameters[4]).value();
+    this->currentTimestamp = this->start;
+}
+
+uint64_t EventTimeField::nextTimestamp(std::default_random_engine& randEng)
+{
+    /// The delay never moves a timestamp before the start of the stream
+    const auto maxDelay = std::min(maxOutOfOrderness, currentTimestamp - start);
+    const auto delay = maxDelay == 0 ? 0 : std::uniform_int_distribution<uint64_t>(0, maxDelay)(randEng);
+    const auto timestamp = currentTimestamp - delay;
+    currentTimestamp += step;
+    return timestamp;
+}
+
+std::ostream& EventTimeField::generate(std::ostream& os, std::default_random_engine& randEng)
+{
+    return os << nextTimestamp(randEng);
+}
+
+void EventTimeField::generate(
+    int8_t* firstValue, const size_t numberOfTuples, const size_t tupleSizeInBytes, std::default_random_engine& randEng)
+{
+    std::visit(
+        [&]<typename T>(const T&)
+        {
+            writeColumn<T>(
+                firstValue, numberOfTuples, tupleSizeInBytes, [this, &randEng] { return static_cast<T>(nextTimestamp(randEng)); });
+        },
+        createZeroValue(outputType.type).value());
+}
+
+size_t EventTimeField::getSizeInBytes() const
+{
+    return outputType.getSizeInBytes();
+}
+
+void EventTimeField::validate(const std::string_view rawSchemaLine)
+{
+    const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
+    if (parameters.size() != NUM_PARAMETERS_EVENT_TIME_FIELD)
+    {
+        throw InvalidConfigParameter("Number of EventTimeField parameters does not match! {}", rawSchemaLine);
+    }
+    const auto dataType = DataTypeProvider::tryProvideDataType(std::string{parameters[1]});
+    if (not dataType.has_value() or (dataType->type != DataType::Type::UINT64 and dataType->type != DataType::Type::INT64))
+    {
+        throw InvalidConfigParameter("Invalid EventTimeField type of {}, supported are only UINT64 and INT64!", parameters[1]);
+    }
+    const auto validateParameter = [](const std::string_view parameter, const std::string_view name)
+    {
+        if (not Util::from_chars<uint64_t>(parameter).has_value())
+        {
+            throw InvalidConfigParameter("Could not parse {} as EventTimeField {}!", parameter, name);
+        }
+    };
+    validateParameter(parameters[2], "start");
+    validateParameter(parameters[3], "step");
+    validateParameter(parameters[4], "max out-of-orderness");
+}
+
 
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <ostream>
@@ -22,6 +23,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 #include <DataTypes/DataType.hpp>
 
 #include <DataTypes/DataType.hpp>
@@ -31,6 +33,9 @@ namespace NES::GeneratorFields
 
 static constexpr std::string_view SEQUENCE_IDENTIFIER = "SEQUENCE";
 static constexpr std::string_view NORMAL_DISTRIBUTION_IDENTIFIER = "NORMAL_DISTRIBUTION";
+static constexpr std::string_view UNIFORM_IDENTIFIER = "UNIFORM";
+static constexpr std::string_view ZIPF_IDENTIFIER = "ZIPF";
+static constexpr std::string_view EVENT_TIME_IDENTIFIER = "EVENT_TIME";
 
 /// @brief Variant containing the types that a field can generate
 using FieldType = std::variant<uint64_t, uint32_t, uint16_t, uint8_t, int64_t, int32_t, int16_t, int8_t, float, double>;
@@ -41,6 +46,13 @@ class BaseGeneratorField
 public:
     virtual ~BaseGeneratorField() = default;
     virtual std::ostream& generate(std::ostream& os, std::default_random_engine& /*randEng*/) = 0;
+
+    /// Writes the values of the field for the next numberOfTuples tuples in the native row layout, i.e., the value of the i-th tuple to
+    /// firstValue + i * tupleSizeInBytes. Generating a whole column at once dispatches on the type of the field only once per column.
+    virtual void generate(int8_t* firstValue, size_t numberOfTuples, size_t tupleSizeInBytes, std::default_random_engine& randEng) = 0;
+
+    /// Size of a value of the field in the native row layout
+    [[nodiscard]] virtual size_t getSizeInBytes() const = 0;
 };
 
 class BaseStoppableGeneratorField : public BaseGeneratorField
@@ -59,6 +71,11 @@ public:
     explicit SequenceField(std::string_view rawSchemaLine);
 
     std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generate(int8_t* firstValue, size_t numberOfTuples, size_t tupleSizeInBytes, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
+
+    /// Returns the number of values, up to maxNumberOfValues, that the field generates until it stops
+    [[nodiscard]] size_t getNumberOfValuesUntilStop(size_t maxNumberOfValues) const;
 
     static void validate(std::string_view rawSchemaLine);
 
@@ -99,6 +116,8 @@ public:
 
     explicit NormalDistributionField(std::string_view rawSchemaLine);
     std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generate(int8_t* firstValue, size_t numberOfTuples, size_t tupleSizeInBytes, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
     static void validate(std::string_view rawSchemaLine);
 
 private:
@@ -106,8 +125,71 @@ private:
     DataType outputType;
 };
 
+constexpr auto NUM_PARAMETERS_UNIFORM_FIELD = 4;
+
+/// @brief generates uniformly distributed records in the closed range [min, max]
+class UniformField final : public BaseGeneratorField
+{
+public:
+    explicit UniformField(std::string_view rawSchemaLine);
+    std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generate(int8_t* firstValue, size_t numberOfTuples, size_t tupleSizeInBytes, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
+    static void validate(std::string_view rawSchemaLine);
+
+private:
+    FieldType min;
+    FieldType max;
+};
+
+constexpr auto NUM_PARAMETERS_ZIPF_FIELD = 4;
+/// Bounds the size of the table of cumulative probabilities to 128 MiB
+constexpr uint64_t MAX_NUMBER_OF_ZIPF_KEYS = 1UL << 24U;
+
+/// @brief generates keys in [0, numberOfKeys) whose frequencies follow a zipf distribution, i.e., key k has a probability proportional
+/// to 1 / (k + 1)^exponent. Thus, key 0 is the most frequent one. An exponent of zero yields uniformly distributed keys.
+class ZipfField final : public BaseGeneratorField
+{
+public:
+    explicit ZipfField(std::string_view rawSchemaLine);
+    std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generate(int8_t* firstValue, size_t numberOfTuples, size_t tupleSizeInBytes, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
+    static void validate(std::string_view rawSchemaLine);
+
+private:
+    [[nodiscard]] uint64_t nextKey(std::default_random_engine& randEng) const;
+
+    /// The i-th entry is the probability of drawing a key that is less than or equal to i
+    std::vector<double> cumulativeProbabilities;
+    DataType outputType;
+};
+
+constexpr auto NUM_PARAMETERS_EVENT_TIME_FIELD = 5;
+
+/// @brief generates event timestamps that advance by step per tuple. Each timestamp lags behind its position in the stream by a uniformly
+/// distributed delay of at most maxOutOfOrderness. Thus, a watermark that trails the largest timestamp by maxOutOfOrderness is exact.
+class EventTimeField final : public BaseGeneratorField
+{
+public:
+    explicit EventTimeField(std::string_view rawSchemaLine);
+    std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generate(int8_t* firstValue, size_t numberOfTuples, size_t tupleSizeInBytes, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
+    static void validate(std::string_view rawSchemaLine);
+
+private:
+    [[nodiscard]] uint64_t nextTimestamp(std::default_random_engine& randEng);
+
+    uint64_t start;
+    uint64_t step;
+    uint64_t maxOutOfOrderness;
+    uint64_t currentTimestamp;
+    DataType outputType;
+};
+
 /// @brief Variant containing the types of base generator fields
-using GeneratorFieldType = std::variant<SequenceField, NormalDistributionField>;
+using GeneratorFieldType = std::variant<SequenceField, NormalDistributionField, UniformField, ZipfField, EventTimeField>;
 
 struct FieldValidator
 {
@@ -116,9 +198,12 @@ struct FieldValidator
 };
 
 /// @brief Array containing functions paired with the fields identifier used to validate the fields syntax
-static const std::array<FieldValidator, 2> Validators
+static const std::array<FieldValidator, 5> Validators
     = {{{.identifier = SEQUENCE_IDENTIFIER, .validator = SequenceField::validate},
-        {.identifier = NORMAL_DISTRIBUTION_IDENTIFIER, .validator = NormalDistributionField::validate}}};
+        {.identifier = NORMAL_DISTRIBUTION_IDENTIFIER, .validator = NormalDistributionField::validate},
+        {.identifier = UNIFORM_IDENTIFIER, .validator = UniformField::validate},
+        {.identifier = ZIPF_IDENTIFIER, .validator = ZipfField::validate},
+        {.identifier = EVENT_TIME_IDENTIFIER, .validator = EventTimeField::validate}}};
 
 /// @brief Multimap containing key-value pairs of the existing generator fields and which types they accept
 /// NOLINTBEGIN(cert-err58-cpp): do not warn about static storage duration
@@ -134,7 +219,23 @@ static const std::unordered_multimap<std::string_view, DataType::Type> FieldName
        {SEQUENCE_IDENTIFIER, DataType::Type::FLOAT64},
        {SEQUENCE_IDENTIFIER, DataType::Type::FLOAT32},
        {NORMAL_DISTRIBUTION_IDENTIFIER, DataType::Type::FLOAT64},
-       {NORMAL_DISTRIBUTION_IDENTIFIER, DataType::Type::FLOAT32}};
+       {NORMAL_DISTRIBUTION_IDENTIFIER, DataType::Type::FLOAT32},
+       {UNIFORM_IDENTIFIER, DataType::Type::INT64},
+       {UNIFORM_IDENTIFIER, DataType::Type::INT32},
+       {UNIFORM_IDENTIFIER, DataType::Type::INT16},
+       {UNIFORM_IDENTIFIER, DataType::Type::INT8},
+       {UNIFORM_IDENTIFIER, DataType::Type::UINT64},
+       {UNIFORM_IDENTIFIER, DataType::Type::UINT32},
+       {UNIFORM_IDENTIFIER, DataType::Type::UINT16},
+       {UNIFORM_IDENTIFIER, DataType::Type::UINT8},
+       {UNIFORM_IDENTIFIER, DataType::Type::FLOAT64},
+       {UNIFORM_IDENTIFIER, DataType::Type::FLOAT32},
+       {ZIPF_IDENTIFIER, DataType::Type::INT64},
+       {ZIPF_IDENTIFIER, DataType::Type::INT32},
+       {ZIPF_IDENTIFIER, DataType::Type::UINT64},
+       {ZIPF_IDENTIFIER, DataType::Type::UINT32},
+       {EVENT_TIME_IDENTIFIER, DataType::Type::UINT64},
+       {EVENT_TIME_IDENTIFIER, DataType::Type::INT64}};
 }
 
 /// NOLINTEND(cert-err58-cpp)
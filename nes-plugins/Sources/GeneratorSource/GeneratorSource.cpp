@@ -14,6 +14,7 @@
 
 #include <GeneratorSource.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -29,6 +30,8 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/Strings.hpp>
+#include <ErrorHandling.hpp>
 #include <FixedGeneratorRate.hpp>
 #include <Generator.hpp>
 #include <GeneratorDataRegistry.hpp>
@@ -49,6 +52,7 @@ GeneratorSource::GeneratorSource(const SourceDescriptor& sourceDescriptor)
           sourceDescriptor.getFromConfig(ConfigParametersGenerator::SEQUENCE_STOPS_GENERATOR),
           sourceDescriptor.getFromConfig(ConfigParametersGenerator::GENERATOR_SCHEMA))
     , flushInterval(std::chrono::milliseconds{sourceDescriptor.getFromConfig(ConfigParametersGenerator::FLUSH_INTERVAL_MS)})
+    , binary(sourceDescriptor.getFromConfig(ConfigParametersGenerator::BINARY))
 {
     NES_TRACE("Init GeneratorSource.")
     switch (sourceDescriptor.getFromConfig(ConfigParametersGenerator::GENERATOR_RATE_TYPE))
@@ -80,6 +84,70 @@ void GeneratorSource::close()
     NES_TRACE("Generated {} buffers in {}. Closing GeneratorSource.", generatedBuffers, totalElapsedTime);
 }
 
+std::pair<uint64_t, uint64_t> GeneratorSource::waitForNumberOfTuplesToGenerate() const
+{
+    uint64_t numberOfTuplesToGenerate = 0;
+    uint64_t noIntervals = 1;
+    while (numberOfTuplesToGenerate == 0)
+    {
+        const auto endOfInterval = startOfInterval + (flushInterval * noIntervals);
+        numberOfTuplesToGenerate = generatorRate->calcNumberOfTuplesForInterval(startOfInterval, endOfInterval);
+        NES_DEBUG("numberOfTuplesToGenerate: {}", numberOfTuplesToGenerate);
+        if (numberOfTuplesToGenerate == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds{flushInterval});
+            ++noIntervals;
+        }
+    }
+    return {numberOfTuplesToGenerate, noIntervals};
+}
+
+size_t GeneratorSource::fillTupleBufferBinary(TupleBuffer& tupleBuffer, const std::stop_token& stopToken)
+{
+    const auto tupleSizeInBytes = this->generator.getTupleSizeInBytes();
+    const uint64_t bufferCapacity = tupleBuffer.getBufferSize() / tupleSizeInBytes;
+    if (bufferCapacity == 0)
+    {
+        throw InvalidConfigParameter(
+            "A generated tuple of {} bytes does not fit into a buffer of {} bytes", tupleSizeInBytes, tupleBuffer.getBufferSize());
+    }
+
+    if (numberOfPendingTuples == 0)
+    {
+        const auto [numberOfTuplesToGenerate, noIntervals] = waitForNumberOfTuplesToGenerate();
+        this->numberOfPendingTuples = numberOfTuplesToGenerate;
+        this->endOfInterval = startOfInterval + (flushInterval * noIntervals);
+    }
+    if (this->generator.shouldStop() or stopToken.stop_requested())
+    {
+        return 0;
+    }
+
+    /// The Native input format expects whole tuples in each buffer. Thus, tuples never span buffers.
+    const auto numberOfTuples
+        = this->generator.generateTuples(tupleBuffer.getBuffer(), std::min(this->numberOfPendingTuples, bufferCapacity));
+    this->numberOfPendingTuples -= numberOfTuples;
+    this->generatedTuplesCounter += numberOfTuples;
+    ++generatedBuffers;
+
+    /// Emits full buffers without sleeping, until all tuples of the interval are generated. Then, sleeps for the rest of the interval.
+    if (this->numberOfPendingTuples == 0)
+    {
+        if (const auto now = std::chrono::system_clock::now(); now > this->endOfInterval)
+        {
+            NES_WARNING(
+                "Can not produce all required tuples until the end of the interval, as we are behind by {}",
+                std::chrono::duration_cast<std::chrono::milliseconds>(now - this->endOfInterval));
+        }
+        else
+        {
+            std::this_thread::sleep_for(this->endOfInterval - now);
+        }
+        this->startOfInterval = std::chrono::system_clock::now();
+    }
+    return numberOfTuples * tupleSizeInBytes;
+}
+
 size_t GeneratorSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken)
 {
     NES_DEBUG("Filling buffer in GeneratorSource.");
@@ -92,23 +160,14 @@ size_t GeneratorSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::sto
             NES_INFO("Reached max runtime! Stopping Source");
             return 0;
         }
-
-        /// Asking the generatorRate how many tuples we should generate for this interval [now, now + flushInterval].
-        /// If we receive 0 tuples, we do not return but wait till another interval, as a return value of 0 tuples results in the query being terminated.
-        uint64_t numberOfTuplesToGenerate = 0;
-        uint64_t noIntervals = 1;
-        while (numberOfTuplesToGenerate == 0)
+        if (binary)
         {
-            const auto endOfInterval = startOfInterval + (flushInterval * noIntervals);
-            numberOfTuplesToGenerate = generatorRate->calcNumberOfTuplesForInterval(startOfInterval, endOfInterval);
-            NES_DEBUG("numberOfTuplesToGenerate: {}", numberOfTuplesToGenerate);
-            if (numberOfTuplesToGenerate == 0)
-            {
-                std::this_thread::sleep_for(std::chrono::microseconds{flushInterval});
-                ++noIntervals;
-            }
+            return fillTupleBufferBinary(tupleBuffer, stopToken);
         }
 
+        /// Asking the generatorRate how many tuples we should generate for this interval [now, now + flushInterval].
+        const auto [numberOfTuplesToGenerate, noIntervals] = waitForNumberOfTuplesToGenerate();
+
         /// Generating the required number of tuples. Any tuples that do not fit into the tuple buffer, we add to the orphanTuples and emit
         /// a warning. Also, we first add the orphanTuples to the tuple buffer, before adding newly-created once.
         const size_t rawTBSize = tupleBuffer.getBufferSize();
@@ -171,6 +230,7 @@ std::ostream& GeneratorSource::toString(std::ostream& str) const
     str << "\n\tgenerated buffers: " << this->generatedBuffers;
     str << "\n\tschema: " << this->generatorSchemaRaw;
     str << "\n\tseed: " << this->seed;
+    str << "\n\tbinary: " << this->binary;
     str << ")\n";
     return str;
 }
@@ -197,6 +257,13 @@ SourceRegistryReturnType SourceGeneratedRegistrar::RegisterGeneratorSource(Sourc
 GeneratorDataRegistryReturnType
 GeneratorDataGeneratedRegistrar::RegisterGeneratorGeneratorData(GeneratorDataRegistryArguments systestAdaptorArguments)
 {
+    /// A binary generator writes the native row layout, which does not need to be parsed
+    const auto& sourceConfig = systestAdaptorArguments.physicalSourceConfig.sourceConfig;
+    if (const auto binary = sourceConfig.find(ConfigParametersGenerator::BINARY.name);
+        binary != sourceConfig.end() and Util::from_chars<bool>(binary->second).value_or(false))
+    {
+        systestAdaptorArguments.physicalSourceConfig.parserConfig["type"] = "Native";
+    }
     return systestAdaptorArguments.physicalSourceConfig;
 }
 }
@@ -26,6 +26,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <Configurations/Descriptor.hpp>
 #include <Configurations/Enums/EnumWrapper.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -42,6 +43,10 @@
 namespace NES
 {
 
+/// Generates tuples at the rate of its GeneratorRate. By default, it writes the tuples as CSV, which the CSV input formatter parses again.
+/// In binary mode, it writes typed values directly in the native row layout for the Native input format, one column at a time.
+/// Then, the source emits a full TupleBuffer immediately, as long as tuples of the current interval are pending, so that its rate is not
+/// limited by the parsing, but by the engine.
 class GeneratorSource : public Source
 {
 public:
@@ -65,6 +70,13 @@ public:
     static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
 
 private:
+    /// Asks the generatorRate how many tuples to generate in the next interval. Extends the interval by further flush intervals, until
+    /// the generatorRate returns at least one tuple, as a return value of 0 tuples results in the query being terminated.
+    /// @return the number of tuples and the number of flush intervals of the interval
+    std::pair<uint64_t, uint64_t> waitForNumberOfTuplesToGenerate() const;
+
+    size_t fillTupleBufferBinary(TupleBuffer& tupleBuffer, const std::stop_token& stopToken);
+
     uint32_t seed;
     int32_t maxRuntime;
     uint64_t generatedTuplesCounter{0};
@@ -76,6 +88,10 @@ private:
     std::chrono::time_point<std::chrono::system_clock> startOfInterval;
     std::chrono::milliseconds flushInterval;
     std::unique_ptr<GeneratorRate> generatorRate;
+    bool binary;
+    /// Tuples of the current interval that the binary mode did not emit yet
+    uint64_t numberOfPendingTuples{0};
+    std::chrono::time_point<std::chrono::system_clock> endOfInterval;
 
     /// if inserting a set of generated tuples into the buffer would overflow it, this string saves them so it can be inserted into the next buffer
     std::string orphanTuples;
@@ -204,6 +220,12 @@ struct ConfigParametersGenerator
             return value;
         }};
 
+    /// Writes the tuples in the native row layout instead of CSV. Requires the Native input format.
+    static inline const DescriptorConfig::ConfigParameter<bool> BINARY{
+        "binary",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(BINARY, config); }};
+
     /// @brief config option for setting the max runtime in ms, if set to -1 the source will run till stopped by another thread
     static inline const DescriptorConfig::ConfigParameter<int32_t> MAX_RUNTIME_MS{
         "max_runtime_ms",
@@ -219,6 +241,7 @@ struct ConfigParametersGenerator
             SEQUENCE_STOPS_GENERATOR,
             GENERATOR_RATE_TYPE,
             GENERATOR_RATE_CONFIG,
-            FLUSH_INTERVAL_MS);
+            FLUSH_INTERVAL_MS,
+            BINARY);
 };
 }
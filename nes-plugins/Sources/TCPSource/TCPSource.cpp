@@ -16,9 +16,12 @@
 
 #include <cerrno> /// For socket error
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <string>
@@ -35,6 +38,7 @@
 #include <Configurations/Descriptor.hpp>
 #include <DataServer/TCPDataServer.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <SystestSources/SourceTypes.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -265,6 +269,50 @@ bool TCPSource::fillBuffer(TupleBuffer& tupleBuffer, size_t& numReceivedBytes)
     return numReceivedBytes == 0 and readWasValid;
 }
 
+std::optional<NonBlockingReadConfiguration> TCPSource::getNonBlockingReadConfiguration() const
+{
+    return NonBlockingReadConfiguration{.flushInterval = std::chrono::milliseconds(static_cast<int64_t>(flushIntervalInMs))};
+}
+
+std::optional<int> TCPSource::getReadinessFileDescriptor() const
+{
+    return sockfd;
+}
+
+NonBlockingFillResult TCPSource::fillTupleBufferNonBlocking(TupleBuffer& tupleBuffer, const size_t offset)
+{
+    const size_t rawTBSize = tupleBuffer.getBufferSize();
+    size_t numReceivedBytes = 0;
+    while (offset + numReceivedBytes < rawTBSize)
+    {
+        /// MSG_DONTWAIT makes the read non-blocking, regardless of the flags of the socket
+        const ssize_t bufferSizeReceived
+            = recv(sockfd, tupleBuffer.getBuffer() + offset + numReceivedBytes, rawTBSize - offset - numReceivedBytes, MSG_DONTWAIT);
+        if (bufferSizeReceived == EOF_RECEIVED_BUFFER_SIZE)
+        {
+            NES_INFO("TCP Source detected EoS");
+            return {.numberOfBytes = numReceivedBytes, .endOfStream = true};
+        }
+        if (bufferSizeReceived == INVALID_RECEIVED_BUFFER_SIZE)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN or errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            /// Like the blocking read, we end the stream if the socket fails
+            NES_ERROR("An error occurred while reading from socket. Error: {}", strerror(errno));
+            return {.numberOfBytes = numReceivedBytes, .endOfStream = true};
+        }
+        numReceivedBytes += bufferSizeReceived;
+    }
+    generatedBuffers += static_cast<uint64_t>(offset + numReceivedBytes == rawTBSize);
+    return {.numberOfBytes = numReceivedBytes, .endOfStream = false};
+}
+
 DescriptorConfig::Config TCPSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
 {
     return DescriptorConfig::validateAndFormat<ConfigParametersTCP>(std::move(config), name());
@@ -181,6 +181,11 @@ public:
 
     size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
 
+    [[nodiscard]] std::optional<NonBlockingReadConfiguration> getNonBlockingReadConfiguration() const override;
+    /// The socket becomes readable once new data arrived
+    [[nodiscard]] std::optional<int> getReadinessFileDescriptor() const override;
+    NonBlockingFillResult fillTupleBufferNonBlocking(TupleBuffer& tupleBuffer, size_t offset) override;
+
     /// Open TCP connection.
     void open() override;
     /// Close TCP connection.
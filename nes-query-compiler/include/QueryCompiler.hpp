@@ -14,6 +14,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <Util/DumpMode.hpp>
 #include <CompiledQueryPlan.hpp>
 #include <PhysicalPlan.hpp>
@@ -29,6 +31,8 @@ struct QueryCompilationRequest
     /// IMPORTANT: only the queryPlan should influence the actual result, other request options only influence how much to debug print etc.
     bool debug = false;
     DumpMode dumpCompilationResult = DumpMode::NONE;
+    /// Identifies structurally equal query plans. If set, the compiled pipelines are taken from and added to the CompiledPipelineCache.
+    std::optional<std::string> planFingerprint;
 };
 
 /// The query compiler behaves as a pure function: QueryPlan -> CompiledQueryPlan
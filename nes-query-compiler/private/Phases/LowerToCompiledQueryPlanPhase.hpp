@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -29,8 +33,10 @@ namespace NES
 class LowerToCompiledQueryPlanPhase
 {
 public:
-    explicit LowerToCompiledQueryPlanPhase(DumpMode dumpQueryCompilationIntermediateRepresentations)
+    explicit LowerToCompiledQueryPlanPhase(
+        DumpMode dumpQueryCompilationIntermediateRepresentations, std::optional<std::string> planFingerprint = std::nullopt)
         : dumpQueryCompilationIntermediateRepresentations(dumpQueryCompilationIntermediateRepresentations)
+        , planFingerprint(std::move(planFingerprint))
     {
     }
 
@@ -53,8 +59,11 @@ private:
     std::unordered_map<PipelineId, std::shared_ptr<ExecutablePipeline>> pipelineToExecutableMap;
 
     std::shared_ptr<PipelinedQueryPlan> pipelineQueryPlan;
+    /// Position of the next compiled pipeline within the plan. Together with the plan fingerprint, it identifies the pipeline.
+    size_t numberOfCompiledStages = 0;
 
     /// Config parameter
     DumpMode dumpQueryCompilationIntermediateRepresentations;
+    std::optional<std::string> planFingerprint;
 };
 }
@@ -18,22 +18,27 @@
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 #include <Configuration/WorkerConfiguration.hpp>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <InputFormatters/InputFormatterProvider.hpp>
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/DumpMode.hpp>
 #include <Util/ExecutionMode.hpp>
+#include <fmt/format.h>
+#include <magic_enum/magic_enum.hpp>
 #include <CompiledQueryPlan.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutablePipelineStage.hpp>
 #include <Pipeline.hpp>
 #include <PipelinedQueryPlan.hpp>
+#include <ScanPhysicalOperator.hpp>
 #include <SinkPhysicalOperator.hpp>
 #include <SourcePhysicalOperator.hpp>
 #include <options.hpp>
@@ -41,6 +46,32 @@
 namespace NES
 {
 
+namespace
+{
+/// Returns the names of the fields that the successors of a source pipeline read. The InputFormatterTask only needs to parse these fields.
+/// A successor that does not start with a scan, e.g., a sink, reads all fields of the schema.
+std::vector<std::string> getFieldsReadBySuccessors(const Schema& schema, const Pipeline& sourcePipeline)
+{
+    std::vector<std::string> fieldsReadBySuccessors;
+    for (const auto& successor : sourcePipeline.getSuccessors())
+    {
+        const auto scan = successor->getRootOperator().tryGet<ScanPhysicalOperator>();
+        if (not scan.has_value())
+        {
+            return schema.getFieldNames();
+        }
+        for (const auto& fieldName : scan->getProjections())
+        {
+            if (not std::ranges::contains(fieldsReadBySuccessors, fieldName))
+            {
+                fieldsReadBySuccessors.emplace_back(fieldName);
+            }
+        }
+    }
+    return fieldsReadBySuccessors;
+}
+}
+
 LowerToCompiledQueryPlanPhase::Successor
 LowerToCompiledQueryPlanPhase::processSuccessor(const Predecessor& predecessor, const std::shared_ptr<Pipeline>& pipeline)
 {
@@ -62,8 +93,11 @@ void LowerToCompiledQueryPlanPhase::processSource(const std::shared_ptr<Pipeline
     const auto sourceOperator = pipeline->getRootOperator().get<SourcePhysicalOperator>();
 
     const std::vector<std::shared_ptr<ExecutablePipeline>> executableSuccessorPipelines;
-    auto inputFormatterTaskPipeline = provideInputFormatterTask(
-        *sourceOperator.getDescriptor().getLogicalSource().getSchema(), sourceOperator.getDescriptor().getParserConfig());
+    /// The InputFormatterTask skips parsing fields that no successor reads. With projections that the optimizer pushes down to the source,
+    /// wide schemas of which a query uses only a few fields thus do not pay for converting the remaining fields.
+    const auto& schema = *sourceOperator.getDescriptor().getLogicalSource().getSchema();
+    auto inputFormatterTaskPipeline
+        = provideInputFormatterTask(schema, sourceOperator.getDescriptor().getParserConfig(), getFieldsReadBySuccessors(schema, *pipeline));
 
     auto executableInputFormatterPipeline
         = ExecutablePipeline::create(pipeline->getPipelineId(), std::move(inputFormatterTaskPipeline), executableSuccessorPipelines);
@@ -140,7 +174,16 @@ std::unique_ptr<ExecutablePipelineStage> LowerToCompiledQueryPlanPhase::getStage
             options.setOption("dump.file", true);
             break;
     }
-    return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options);
+
+    /// Interpreted pipelines call back into the traced operators and can not be shared across queries
+    std::optional<std::string> fingerprint;
+    if (planFingerprint.has_value() and pipelineQueryPlan->getExecutionMode() == ExecutionMode::COMPILER)
+    {
+        fingerprint = fmt::format(
+            "{}/{}/{}", *planFingerprint, numberOfCompiledStages, magic_enum::enum_name(dumpQueryCompilationIntermediateRepresentations));
+    }
+    ++numberOfCompiledStages;
+    return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options, std::move(fingerprint));
 }
 
 std::shared_ptr<ExecutablePipeline> LowerToCompiledQueryPlanPhase::processOperatorPipeline(const std::shared_ptr<Pipeline>& pipeline)
@@ -42,6 +42,8 @@ public:
     /// Creates and submits a new Task targeting the `target` node.
     /// If the `potentiallyProcessTheWorkInPlace` parameter is set, the task may be executed in place if it cannot be submitted to the task queue.
     /// This function may return false if the `potentiallyProcessTheWorkInPlace` parameter is disabled and the task cannot be submitted.
+    /// Callers outside of the WorkerThreads block until the admission queue has space, but only for a bounded time. Afterward, it returns
+    /// false and the caller has to retry.
     virtual bool emitWork(
         QueryId,
         const std::shared_ptr<RunningQueryPlanNode>& target,
@@ -53,5 +55,8 @@ public:
     virtual void emitPipelineStart(QueryId, const std::shared_ptr<RunningQueryPlanNode>&, BaseTask::onComplete, BaseTask::onFailure) = 0;
     virtual void emitPendingPipelineStop(QueryId, std::shared_ptr<RunningQueryPlanNode>, BaseTask::onComplete, BaseTask::onFailure) = 0;
     virtual void emitPipelineStop(QueryId, std::unique_ptr<RunningQueryPlanNode>, BaseTask::onComplete, BaseTask::onFailure) = 0;
+
+    /// Number of tasks in the admission queue relative to its capacity. Sources reduce their inflight buffers if the queue fills up.
+    [[nodiscard]] virtual double getAdmissionQueueUtilization() const = 0;
 };
 }
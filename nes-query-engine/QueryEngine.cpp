@@ -35,9 +35,11 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/Execution/QueryStatus.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/QueryTerminationType.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/AtomicState.hpp>
+#include <Util/Numa.hpp>
 #include <Util/ThreadNaming.hpp>
 #include <fmt/format.h>
 #include <folly/MPMCQueue.h>
@@ -51,6 +53,7 @@
 #include <QueryEngineStatisticListener.hpp>
 #include <RunningQueryPlan.hpp>
 #include <Task.hpp>
+#include <WorkStealingTaskQueue.hpp>
 
 namespace NES
 {
@@ -110,6 +113,7 @@ public:
         std::unique_ptr<ExecutableQueryPlan> plan,
         const std::shared_ptr<AbstractQueryStatusListener>& listener,
         const std::shared_ptr<QueryEngineStatisticListener>& statistic,
+        std::shared_ptr<QueryMemoryQuota> memoryQuota,
         QueryLifetimeController& controller,
         WorkEmitter& emitter);
     QueryId registerQuery(std::unique_ptr<ExecutableQueryPlan>);
@@ -130,6 +134,7 @@ private:
 namespace detail
 {
 using Queue = folly::MPMCQueue<Task>;
+using LocalQueue = WorkStealingTaskQueue<Task>;
 }
 
 struct DefaultPEC final : PipelineExecutionContext
@@ -183,6 +188,10 @@ struct DefaultPEC final : PipelineExecutionContext
 class ThreadPool : public WorkEmitter, public QueryLifetimeController
 {
 public:
+    /// Non-WorkerThreads, i.e., sources, wait at most this long for space in the admission queue. Afterward, emitWork returns false, which
+    /// allows the source to check for a stop request before it retries.
+    static constexpr auto ADMISSION_QUEUE_WRITE_TIMEOUT = std::chrono::milliseconds(100);
+
     void addThread();
 
     /// This function is unsafe because it requires the lifetime of the RunningQueryPlanNode exceed the lifetime of the callback
@@ -261,7 +270,12 @@ public:
         if (WorkerThread::id == INVALID<WorkerThreadId>)
         {
             /// Non-WorkerThread
-            admissionQueue.blockingWrite(std::move(task));
+            if (not admissionQueue.tryWriteUntil(std::chrono::steady_clock::now() + ADMISSION_QUEUE_WRITE_TIMEOUT, std::move(task)))
+            {
+                node->pendingTasks.fetch_sub(1);
+                ENGINE_LOG_DEBUG("AdmissionQueue is full, could not write within {}ms", ADMISSION_QUEUE_WRITE_TIMEOUT.count());
+                return false;
+            }
             ENGINE_LOG_DEBUG("Task written to AdmissionQueue");
             return true;
         }
@@ -275,6 +289,10 @@ public:
 
             case PipelineExecutionContext::ContinuationPolicy::REPEAT:
             case PipelineExecutionContext::ContinuationPolicy::NEVER:
+                if (tryWriteLocal(task))
+                {
+                    return true;
+                }
                 if (not internalTaskQueue.tryWriteUntil(
                         std::chrono::high_resolution_clock::now() + std::chrono::seconds(1), std::move(task)))
                 {
@@ -331,18 +349,38 @@ public:
         addTaskOrDoNextTask(PendingPipelineStopTask{queryId, std::move(node), 0, std::move(complete), std::move(failure)});
     }
 
+    [[nodiscard]] double getAdmissionQueueUtilization() const override
+    {
+        /// The size of the MPMCQueue is negative, if there are more pending reads than writes
+        return static_cast<double>(std::max<ssize_t>(admissionQueue.size(), 0)) / static_cast<double>(admissionQueue.capacity());
+    }
+
     ThreadPool(
         std::shared_ptr<AbstractQueryStatusListener> listener,
         std::shared_ptr<QueryEngineStatisticListener> stats,
         std::shared_ptr<AbstractBufferProvider> bufferProvider,
         const size_t internalTaskQueueSize,
-        const size_t admissionQueueSize)
+        const size_t admissionQueueSize,
+        const TaskSchedulingMode schedulingMode,
+        const size_t maxNumberOfThreads,
+        const size_t localTaskQueueSize,
+        const bool pinToNumaNodes)
         : listener(std::move(listener))
         , statistic(std::move(std::move(stats)))
         , bufferProvider(std::move(bufferProvider))
         , admissionQueue(admissionQueueSize)
         , internalTaskQueue(internalTaskQueueSize)
+        , pinToNumaNodes(pinToNumaNodes)
     {
+        if (schedulingMode == TaskSchedulingMode::WORK_STEALING)
+        {
+            /// The local queues are created upfront, as thieves iterate over them concurrently to threads being added.
+            localTaskQueues.reserve(maxNumberOfThreads);
+            for (size_t i = 0; i < maxNumberOfThreads; ++i)
+            {
+                localTaskQueues.emplace_back(std::make_unique<detail::LocalQueue>(localTaskQueueSize));
+            }
+        }
     }
 
     /// Reserves the initial WorkerThreadId for the terminator thread, which is the thread which is calling shutdown.
@@ -355,6 +393,10 @@ public:
     struct WorkerThread
     {
         static thread_local WorkerThreadId id;
+        /// Local task queue of the current WorkerThread. Only set if the ThreadPool uses work stealing.
+        static thread_local detail::LocalQueue* localTaskQueue;
+        /// Index of the current WorkerThread into the ThreadPool's local task queues.
+        static thread_local size_t localTaskQueueIndex;
         /// Handler for different Pipeline Tasks
         /// Boolean return value indicates if the onComplete should be called
         bool operator()(const WorkTask& task) const;
@@ -390,9 +432,73 @@ private:
         }
     }
 
+    /// Writes the task into the local task queue of the calling WorkerThread. Fails if work stealing is disabled, the calling thread
+    /// does not own a local task queue (e.g., the terminator thread) or the local task queue is full.
+    /// The task is only moved from if the write succeeds.
+    static bool tryWriteLocal(Task& task)
+    {
+        return WorkerThread::localTaskQueue != nullptr && WorkerThread::localTaskQueue->tryPush(std::move(task));
+    }
+
+    /// Steals a task from the local task queue of another WorkerThread.
+    /// Victims are visited in order, starting with the WorkerThread after the thief, so that thieves spread across victims.
+    bool stealTask(Task& task)
+    {
+        if (WorkerThread::localTaskQueue == nullptr)
+        {
+            return false;
+        }
+        const auto numberOfQueues = localTaskQueues.size();
+        for (size_t offset = 1; offset < numberOfQueues; ++offset)
+        {
+            auto& victim = *localTaskQueues[(WorkerThread::localTaskQueueIndex + offset) % numberOfQueues];
+            if (victim.approximateSize() > 0 && victim.trySteal(task))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Picks the next task for the calling WorkerThread. Its own local task queue is preferred over the shared task queue.
+    /// Stealing from other WorkerThreads is the last resort.
+    bool readTask(Task& task)
+    {
+        if (WorkerThread::localTaskQueue != nullptr && WorkerThread::localTaskQueue->tryPop(task))
+        {
+            return true;
+        }
+        return internalTaskQueue.read(task) || stealTask(task);
+    }
+
+    /// Same as readTask, but uses the linearizable readIfNotEmpty to drain the shared task queue during termination.
+    bool readTaskIfNotEmpty(Task& task)
+    {
+        if (WorkerThread::localTaskQueue != nullptr && WorkerThread::localTaskQueue->tryPop(task))
+        {
+            return true;
+        }
+        return internalTaskQueue.readIfNotEmpty(task) || stealTask(task);
+    }
+
+    /// Number of tasks that are queued for the calling WorkerThread, including its local task queue.
+    [[nodiscard]] ssize_t numberOfQueuedTasks() const
+    {
+        auto queued = internalTaskQueue.size();
+        if (WorkerThread::localTaskQueue != nullptr)
+        {
+            queued += static_cast<ssize_t>(WorkerThread::localTaskQueue->approximateSize());
+        }
+        return queued;
+    }
+
     void addTaskOrDoItInPlace(Task&& task)
     {
         PRECONDITION(ThreadPool::WorkerThread::id != INVALID<WorkerThreadId>, "This should only be called from a worker thread");
+        if (tryWriteLocal(task))
+        {
+            return;
+        }
         if (not internalTaskQueue.write(std::move(task))) /// NOLINT no move will happen if tryWriteUntil has failed
         {
             doTaskInPlace(std::move(task)); /// NOLINT no move will happen
@@ -411,6 +517,10 @@ private:
             throw TooMuchWork("TaskQueue is always full. We have tried for {} times to write the task into the queue", stackLevel);
         }
 
+        if (tryWriteLocal(task))
+        {
+            return;
+        }
 
         if (not internalTaskQueue.writeIfNotFull(std::move(task))) /// NOLINT no move will happen if writeIfNotFull has failed
         {
@@ -433,6 +543,9 @@ private:
 
     detail::Queue admissionQueue;
     detail::Queue internalTaskQueue;
+    /// One local task queue per WorkerThread. Empty if the ThreadPool does not use work stealing.
+    std::vector<std::unique_ptr<detail::LocalQueue>> localTaskQueues;
+    bool pinToNumaNodes;
 
     /// Class Invariant: numberOfThreads == pool.size().
     /// We don't want to expose the vector directly to anyone, as this would introduce a race condition.
@@ -445,6 +558,8 @@ private:
 
 /// Marks every Thread which has not explicitly been created by the ThreadPool as a non-worker thread
 thread_local WorkerThreadId ThreadPool::WorkerThread::id = INVALID<WorkerThreadId>;
+thread_local detail::LocalQueue* ThreadPool::WorkerThread::localTaskQueue = nullptr;
+thread_local size_t ThreadPool::WorkerThread::localTaskQueueIndex = 0;
 
 bool ThreadPool::WorkerThread::operator()(const WorkTask& task) const
 {
@@ -458,6 +573,7 @@ bool ThreadPool::WorkerThread::operator()(const WorkTask& task) const
     if (auto pipeline = task.pipeline.lock())
     {
         ENGINE_LOG_DEBUG("Handle Task for {}-{}. Tuples: {}", task.queryId, pipeline->id, task.buf.getNumberOfTuples());
+        const QueryMemoryQuota::Scope memoryScope(pipeline->memoryQuota);
         DefaultPEC pec(
             pool.numberOfThreads(),
             WorkerThread::id,
@@ -507,6 +623,7 @@ bool ThreadPool::WorkerThread::operator()(const StartPipelineTask& startPipeline
     if (auto pipeline = startPipeline.pipeline.lock())
     {
         ENGINE_LOG_DEBUG("Setup Pipeline Task for {}-{}", startPipeline.queryId, pipeline->id);
+        const QueryMemoryQuota::Scope memoryScope(pipeline->memoryQuota);
         DefaultPEC pec(
             pool.numberOfThreads(),
             WorkerThread::id,
@@ -522,7 +639,8 @@ bool ThreadPool::WorkerThread::operator()(const StartPipelineTask& startPipeline
                 return false;
             });
         pipeline->stage->start(pec);
-        pool.statistic->onEvent(PipelineStart{WorkerThread::id, startPipeline.queryId, pipeline->id});
+        pool.statistic->onEvent(
+            PipelineStart{WorkerThread::id, startPipeline.queryId, pipeline->id, pipeline->stage->getCompilationCacheResult()});
         return true;
     }
 
@@ -573,6 +691,7 @@ bool ThreadPool::WorkerThread::operator()(PendingPipelineStopTask pendingPipelin
 bool ThreadPool::WorkerThread::operator()(const StopPipelineTask& stopPipelineTask) const
 {
     ENGINE_LOG_DEBUG("Stop Pipeline Task for {}-{}", stopPipelineTask.queryId, stopPipelineTask.pipeline->id);
+    const QueryMemoryQuota::Scope memoryScope(stopPipelineTask.pipeline->memoryQuota);
     DefaultPEC pec(
         pool.numberOfThreads(),
         WorkerThread::id,
@@ -619,7 +738,14 @@ bool ThreadPool::WorkerThread::operator()(StartQueryTask& startQuery) const
     ENGINE_LOG_INFO("Start Query Task for Query {}", startQuery.queryId);
     if (auto queryCatalog = startQuery.catalog.lock())
     {
-        queryCatalog->start(startQuery.queryId, std::move(startQuery.queryPlan), pool.listener, pool.statistic, pool, pool);
+        queryCatalog->start(
+            startQuery.queryId,
+            std::move(startQuery.queryPlan),
+            pool.listener,
+            pool.statistic,
+            std::move(startQuery.memoryQuota),
+            pool,
+            pool);
         pool.statistic->onEvent(QueryStart{WorkerThread::id, startQuery.queryId});
         return true;
     }
@@ -661,13 +787,34 @@ void ThreadPool::addThread()
         [this, id = numberOfThreads_++](const std::stop_token& stopToken)
         {
             WorkerThread::id = WorkerThreadId(WorkerThreadId::INITIAL + id);
+            if (!localTaskQueues.empty())
+            {
+                INVARIANT(
+                    static_cast<size_t>(id) < localTaskQueues.size(),
+                    "WorkerThread {} has no local task queue, only {} were created",
+                    id,
+                    localTaskQueues.size());
+                WorkerThread::localTaskQueue = localTaskQueues[id].get();
+                WorkerThread::localTaskQueueIndex = id;
+            }
             setThreadName(fmt::format("WorkerThread-{}", id));
+            if (pinToNumaNodes)
+            {
+                /// Pinned worker threads stay on one node, thus they mostly receive buffers from the node-local pool of a NUMA-aware
+                /// BufferManager.
+                const auto nodes = getNumaNodes();
+                const auto node = nodes[static_cast<size_t>(id) % nodes.size()];
+                if (pinCurrentThreadToNumaNode(node))
+                {
+                    ENGINE_LOG_INFO("WorkerThread {} pinned to NUMA node {}", id, node);
+                }
+            }
             WorkerThread worker{*this, false};
             while (!stopToken.stop_requested())
             {
                 Task task;
                 /// This timeout controls how often a thread needs to wake up from polling on the TaskQueue to check the stopToken
-                const auto shallPickTaskFromAdmissionQueue = internalTaskQueue.size() < ((static_cast<ssize_t>(numberOfThreads())) * 3);
+                const auto shallPickTaskFromAdmissionQueue = numberOfQueuedTasks() < ((static_cast<ssize_t>(numberOfThreads())) * 3);
                 if (shallPickTaskFromAdmissionQueue)
                 {
                     if (admissionQueue.read(task))
@@ -677,7 +824,7 @@ void ThreadPool::addThread()
                         addTaskOrDoItInPlace(std::move(task));
                     }
                 }
-                if (not internalTaskQueue.read(task))
+                if (not readTask(task))
                 {
                     continue;
                 }
@@ -700,7 +847,7 @@ void ThreadPool::addThread()
             while (true)
             {
                 Task task;
-                if (!internalTaskQueue.readIfNotEmpty(task))
+                if (!readTaskIfNotEmpty(task))
                 {
                     break;
                 }
@@ -728,10 +875,29 @@ QueryEngine::QueryEngine(
     : bufferManager(std::move(bm))
     , statusListener(std::move(listener))
     , statisticListener(std::move(statListener))
+    , queryMemoryLimits(
+          {.softLimitInBytes = config.querySoftMemoryLimitInBytes.getValue(),
+           .hardLimitInBytes = config.queryHardMemoryLimitInBytes.getValue()})
     , queryCatalog(std::make_shared<QueryCatalog>())
     , threadPool(std::make_unique<ThreadPool>(
-          statusListener, statisticListener, bufferManager, config.taskQueueSize.getValue(), config.admissionQueueSize.getValue()))
+          statusListener,
+          statisticListener,
+          bufferManager,
+          config.taskQueueSize.getValue(),
+          config.admissionQueueSize.getValue(),
+          config.taskSchedulingMode.getValue(),
+          config.numberOfWorkerThreads.getValue(),
+          config.localTaskQueueSize.getValue(),
+          config.pinWorkerThreadsToNumaNodes.getValue()))
 {
+    if (queryMemoryLimits.softLimitInBytes > 0 and queryMemoryLimits.hardLimitInBytes > 0
+        and queryMemoryLimits.softLimitInBytes > queryMemoryLimits.hardLimitInBytes)
+    {
+        throw InvalidConfigParameter(
+            "The soft memory limit per query ({}B) must not exceed the hard memory limit per query ({}B)",
+            queryMemoryLimits.softLimitInBytes,
+            queryMemoryLimits.hardLimitInBytes);
+    }
     for (size_t i = 0; i < config.numberOfWorkerThreads.getValue(); ++i)
     {
         threadPool->addThread();
@@ -748,8 +914,9 @@ void QueryEngine::stop(QueryId queryId)
 /// NOLINTNEXTLINE Intentionally non-const
 void QueryEngine::start(std::unique_ptr<ExecutableQueryPlan> executableQueryPlan)
 {
-    threadPool->admissionQueue.blockingWrite(
-        StartQueryTask{executableQueryPlan->queryId, std::move(executableQueryPlan), queryCatalog, {}, {}});
+    auto memoryQuota = bufferManager->createQueryMemoryQuota(executableQueryPlan->queryId, queryMemoryLimits);
+    threadPool->admissionQueue.blockingWrite(StartQueryTask{
+        executableQueryPlan->queryId, std::move(executableQueryPlan), queryCatalog, std::move(memoryQuota), {}, {}});
 }
 
 QueryEngine::~QueryEngine()
@@ -763,6 +930,7 @@ void QueryCatalog::start(
     std::unique_ptr<ExecutableQueryPlan> plan,
     const std::shared_ptr<AbstractQueryStatusListener>& listener,
     const std::shared_ptr<QueryEngineStatisticListener>& statistic,
+    std::shared_ptr<QueryMemoryQuota> memoryQuota,
     QueryLifetimeController& controller,
     WorkEmitter& emitter)
 {
@@ -870,7 +1038,8 @@ void QueryCatalog::start(
     this->queryStates.emplace(queryId, state);
     queryListener->state = state;
 
-    auto [runningQueryPlan, callback] = RunningQueryPlan::start(queryId, std::move(plan), controller, emitter, queryListener);
+    auto [runningQueryPlan, callback]
+        = RunningQueryPlan::start(queryId, std::move(plan), controller, emitter, queryListener, statistic, std::move(memoryQuota));
 
     if (state->transition([&](Reserved&&) { return Starting{std::move(runningQueryPlan)}; }))
     {
@@ -28,6 +28,7 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Sources/SourceHandle.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <absl/functional/any_invocable.h>
@@ -175,11 +176,13 @@ std::shared_ptr<RunningQueryPlanNode> RunningQueryPlanNode::create(
     std::unique_ptr<ExecutablePipelineStage> stage,
     std::function<void(Exception)> unregisterWithError,
     CallbackRef planRef,
-    CallbackRef setupCallback)
+    CallbackRef setupCallback,
+    std::shared_ptr<QueryMemoryQuota> memoryQuota)
 {
     auto node = std::shared_ptr<RunningQueryPlanNode>(
         new RunningQueryPlanNode(pipelineId, std::move(successors), std::move(stage), std::move(unregisterWithError), std::move(planRef)),
         RunningQueryPlanNodeDeleter{.emitter = emitter, .queryId = queryId});
+    node->memoryQuota = std::move(memoryQuota);
     emitter.emitPipelineStart(
         queryId,
         node,
@@ -213,7 +216,8 @@ std::
         std::function<void(Exception)> unregisterWithError,
         const CallbackRef& terminationCallbackRef,
         const CallbackRef& pipelineSetupCallbackRef,
-        WorkEmitter& emitter)
+        WorkEmitter& emitter,
+        const std::shared_ptr<QueryMemoryQuota>& memoryQuota)
 {
     std::vector<std::pair<std::unique_ptr<SourceHandle>, std::vector<std::shared_ptr<RunningQueryPlanNode>>>> sources;
     std::vector<std::weak_ptr<RunningQueryPlanNode>> pipelines;
@@ -238,7 +242,8 @@ std::
             std::move(pipeline->stage),
             unregisterWithError,
             terminationCallbackRef,
-            pipelineSetupCallbackRef);
+            pipelineSetupCallbackRef,
+            memoryQuota);
         pipelines.emplace_back(node);
         cache[pipeline] = std::move(node);
         return cache[pipeline];
@@ -262,7 +267,9 @@ std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> RunningQueryPlan::star
     std::unique_ptr<ExecutableQueryPlan> plan,
     QueryLifetimeController& controller,
     WorkEmitter& emitter,
-    std::shared_ptr<QueryLifetimeListener> listener)
+    std::shared_ptr<QueryLifetimeListener> listener,
+    std::shared_ptr<QueryEngineStatisticListener> statistic,
+    std::shared_ptr<QueryMemoryQuota> memoryQuota)
 {
     PRECONDITION(not plan->pipelines.empty(), "Cannot start an empty query plan");
     PRECONDITION(not plan->sources.empty(), "Cannot start a query plan without sources");
@@ -292,7 +299,8 @@ std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> RunningQueryPlan::star
         },
         terminationCallbackRef,
         pipelineSetupCallbackRef,
-        emitter);
+        emitter,
+        memoryQuota);
     internal.pipelines = std::move(pipelines);
 
 
@@ -306,6 +314,8 @@ std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> RunningQueryPlan::star
          listener = std::move(listener),
          &controller,
          &emitter,
+         statistic = std::move(statistic),
+         memoryQuota = std::move(memoryQuota),
          sources = std::move(sources)]() mutable
         {
             {
@@ -348,7 +358,9 @@ std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> RunningQueryPlan::star
                             },
                             [listener](const Exception& exception) { listener->onFailure(exception); },
                             controller,
-                            emitter));
+                            emitter,
+                            statistic,
+                            memoryQuota));
                 }
                 /// release lock
             }
@@ -23,12 +23,14 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <absl/functional/any_invocable.h>
 #include <folly/Synchronized.h>
 #include <ErrorHandling.hpp>
 #include <ExecutablePipelineStage.hpp>
 #include <ExecutableQueryPlan.hpp>
 #include <Interfaces.hpp>
+#include <QueryEngineStatisticListener.hpp>
 #include <RunningSource.hpp>
 
 namespace NES
@@ -122,7 +124,8 @@ struct RunningQueryPlanNode
         std::unique_ptr<ExecutablePipelineStage> stage,
         std::function<void(Exception)> unregisterWithError,
         CallbackRef planRef,
-        CallbackRef setupCallback);
+        CallbackRef setupCallback,
+        std::shared_ptr<QueryMemoryQuota> memoryQuota = nullptr);
 
 
     ~RunningQueryPlanNode();
@@ -152,6 +155,9 @@ struct RunningQueryPlanNode
 
     std::function<void(Exception)> unregisterWithError;
     CallbackRef planRef;
+
+    /// Buffers that worker threads allocate while executing this pipeline are charged to the quota of the query
+    std::shared_ptr<QueryMemoryQuota> memoryQuota;
 };
 
 struct QueryLifetimeListener
@@ -178,12 +184,16 @@ struct RunningQueryPlan
     /// The CallbackRef prevents the RunningQueryPlan from completing its setup:
     /// AS LONG AS THE CallbackRef IS ALIVE onRunning WILL NOT BE CALLED.
     /// The main purpose is to allow the owner of the RQP to release locks before the listeners can be called.
+    /// The optional statistic listener receives the backpressure statistics of the sources.
+    /// The optional memory quota is charged for all buffers that the pipelines allocate and the sources emit.
     static std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> start(
         QueryId queryId,
         std::unique_ptr<ExecutableQueryPlan> plan,
         QueryLifetimeController&,
         WorkEmitter&,
-        std::shared_ptr<QueryLifetimeListener>);
+        std::shared_ptr<QueryLifetimeListener>,
+        std::shared_ptr<QueryEngineStatisticListener> statistic = nullptr,
+        std::shared_ptr<QueryMemoryQuota> memoryQuota = nullptr);
 
     /// Stopping a RunningQueryPlan will:
     /// 1. Keep all callbacks alive. Eventually onDestruction will be called.
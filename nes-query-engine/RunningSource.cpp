@@ -16,23 +16,24 @@
 
 #include <algorithm>
 #include <chrono>
-#include <cstdint>
+#include <cstddef>
 #include <functional>
-#include <limits>
 #include <memory>
-#include <semaphore>
 #include <stop_token>
 #include <utility>
 #include <variant>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <Util/Overloaded.hpp>
 #include <EngineLogger.hpp>
 #include <ErrorHandling.hpp>
 #include <Interfaces.hpp>
 #include <PipelineExecutionContext.hpp>
+#include <QueryEngineStatisticListener.hpp>
 #include <RunningQueryPlan.hpp>
+#include <SourceCredits.hpp>
 
 namespace NES
 {
@@ -45,11 +46,19 @@ SourceReturnType::EmitFunction emitFunction(
     std::weak_ptr<RunningSource> source,
     std::vector<std::shared_ptr<RunningQueryPlanNode>> successors,
     QueryLifetimeController& controller,
-    WorkEmitter& emitter)
+    WorkEmitter& emitter,
+    std::shared_ptr<QueryEngineStatisticListener> statistic,
+    std::shared_ptr<QueryMemoryQuota> memoryQuota)
 {
-    auto availableBuffer = std::make_shared<std::counting_semaphore<>>(
-        std::min(numberOfInflightBuffers, static_cast<size_t>(std::numeric_limits<int32_t>::max())));
-    return [&controller, successors = std::move(successors), source, &emitter, queryId, availableBuffer = std::move(availableBuffer)](
+    auto credits = std::make_shared<SourceCredits>(std::max(numberOfInflightBuffers, SourceCredits::MIN_CREDITS));
+    return [&controller,
+            successors = std::move(successors),
+            source,
+            &emitter,
+            queryId,
+            credits = std::move(credits),
+            statistic = std::move(statistic),
+            memoryQuota = std::move(memoryQuota)](
                const OriginId sourceId,
                SourceReturnType::SourceReturnType event,
                const std::stop_token& stopToken) -> SourceReturnType::EmitResult
@@ -58,31 +67,43 @@ SourceReturnType::EmitFunction emitFunction(
             Overloaded{
                 [&](const SourceReturnType::Data& data)
                 {
+                    if (memoryQuota)
+                    {
+                        memoryQuota->adopt(data.buffer);
+                    }
                     for (const auto& successor : successors)
                     {
+                        /// Blocks until the successor tasks of this source returned a credit or the source wants to terminate
+                        if (not credits->acquire(stopToken))
                         {
-                            /// release the semaphore in case the source wants to terminate
-                            const std::stop_callback callback(stopToken, [&]() { availableBuffer->release(); });
-                            availableBuffer->acquire();
-                            if (stopToken.stop_requested())
+                            return SourceReturnType::EmitResult::STOP_REQUESTED;
+                        }
+                        auto releaseCredit
+                            = [credits, statistic, memoryQuota, &emitter, queryId, sourceId, emitted = std::chrono::steady_clock::now()]
+                        {
+                            const auto latency = std::chrono::steady_clock::now() - emitted;
+                            /// A query above its soft memory limit is treated like a congested engine, which shrinks the inflight buffers
+                            const auto utilization
+                                = (memoryQuota and memoryQuota->exceedsSoftLimit()) ? 1.0 : emitter.getAdmissionQueueUtilization();
+                            if (credits->release(latency, utilization) and statistic)
                             {
-                                return SourceReturnType::EmitResult::STOP_REQUESTED;
+                                const auto [limit, inflight, stallTime] = credits->getStatistics();
+                                statistic->onEvent(SourceCreditsUpdate{queryId, sourceId, limit, inflight, stallTime});
                             }
-                        }
-                        /// The admission queue might be full, we have to reattempt
+                        };
+                        /// The admission queue might be full. emitWork waits for space in the queue for a bounded time, which allows us to
+                        /// check for a stop request in between. The time the source waits for the admission queue is stall time as well.
+                        const auto emitStart = std::chrono::steady_clock::now();
                         while (not emitter.emitWork(
-                            queryId,
-                            successor,
-                            data.buffer,
-                            [availableBuffer] { availableBuffer->release(); },
-                            {},
-                            PipelineExecutionContext::ContinuationPolicy::NEVER))
+                            queryId, successor, data.buffer, releaseCredit, {}, PipelineExecutionContext::ContinuationPolicy::NEVER))
                         {
                             if (stopToken.stop_requested())
                             {
+                                credits->addStallTime(std::chrono::steady_clock::now() - emitStart);
                                 return SourceReturnType::EmitResult::STOP_REQUESTED;
                             }
                         }
+                        credits->addStallTime(std::chrono::steady_clock::now() - emitStart);
                         ENGINE_LOG_DEBUG("Source Emitted Data to successor: {}-{}", queryId, successor->id);
                     }
                     return SourceReturnType::EmitResult::SUCCESS;
@@ -127,13 +148,23 @@ std::shared_ptr<RunningSource> RunningSource::create(
     std::function<bool(std::vector<std::shared_ptr<RunningQueryPlanNode>>&&)> tryUnregister,
     std::function<void(Exception)> unregisterWithError,
     QueryLifetimeController& controller,
-    WorkEmitter& emitter)
+    WorkEmitter& emitter,
+    std::shared_ptr<QueryEngineStatisticListener> statistic,
+    std::shared_ptr<QueryMemoryQuota> memoryQuota)
 {
     const auto maxInflightBuffers = source->getRuntimeConfiguration().inflightBufferLimit;
     auto runningSource = std::shared_ptr<RunningSource>(
         new RunningSource(successors, std::move(source), std::move(tryUnregister), std::move(unregisterWithError)));
     ENGINE_LOG_DEBUG("Starting Running Source");
-    runningSource->source->start(emitFunction(queryId, maxInflightBuffers, runningSource, std::move(successors), controller, emitter));
+    runningSource->source->start(emitFunction(
+        queryId,
+        maxInflightBuffers,
+        runningSource,
+        std::move(successors),
+        controller,
+        emitter,
+        std::move(statistic),
+        std::move(memoryQuota)));
     return runningSource;
 }
 
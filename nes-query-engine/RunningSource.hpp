@@ -17,9 +17,11 @@
 #include <memory>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Sources/SourceHandle.hpp>
 #include <ErrorHandling.hpp>
 #include <Interfaces.hpp>
+#include <QueryEngineStatisticListener.hpp>
 
 namespace NES
 {
@@ -39,6 +41,9 @@ public:
     /// Creates and starts the underlying source implementation. As long as the RunningSource is kept alive the source will run,
     /// once the last reference to the RunningSource is destroyed the source is stopped.
     /// UnRegistering a source should not block, but it may not succeed (immediately), the tryUnregister
+    /// The number of inflight buffers adapts to the downstream load (see SourceCredits). Its statistics are reported to the statistic
+    /// listener.
+    /// Emitted buffers are charged to the optional memory quota. While the query exceeds its soft limit, the source is throttled.
     static std::shared_ptr<RunningSource> create(
         QueryId queryId,
         std::unique_ptr<SourceHandle> source,
@@ -46,7 +51,9 @@ public:
         std::function<bool(std::vector<std::shared_ptr<RunningQueryPlanNode>>&&)> tryUnregister,
         std::function<void(Exception)> unregisterWithError,
         QueryLifetimeController& controller,
-        WorkEmitter& emitter);
+        WorkEmitter& emitter,
+        std::shared_ptr<QueryEngineStatisticListener> statistic = nullptr,
+        std::shared_ptr<QueryMemoryQuota> memoryQuota = nullptr);
 
     RunningSource(const RunningSource& other) = delete;
     RunningSource& operator=(const RunningSource& other) = delete;
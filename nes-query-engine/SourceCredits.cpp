@@ -0,0 +1,99 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SourceCredits.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SourceCredits::SourceCredits(const size_t maxCredits, const std::chrono::nanoseconds reportInterval)
+    : maxCredits(maxCredits), reportInterval(reportInterval), limit(maxCredits)
+{
+    PRECONDITION(maxCredits >= MIN_CREDITS, "A source requires at least {} credit, but got {}", MIN_CREDITS, maxCredits);
+}
+
+bool SourceCredits::acquire(const std::stop_token& stopToken)
+{
+    std::unique_lock lock(mutex);
+    if (inflight >= limit)
+    {
+        const auto stallStart = std::chrono::steady_clock::now();
+        const auto acquired = creditAvailable.wait(lock, stopToken, [this] { return inflight < limit; });
+        stallTime += std::chrono::steady_clock::now() - stallStart;
+        if (not acquired)
+        {
+            return false;
+        }
+    }
+    ++inflight;
+    return true;
+}
+
+bool SourceCredits::release(const std::chrono::nanoseconds latency, const double admissionQueueUtilization)
+{
+    const std::scoped_lock lock(mutex);
+    INVARIANT(inflight > 0, "Released more credits than were acquired");
+    --inflight;
+
+    roundMinLatency = std::min(roundMinLatency, latency);
+    smoothedLatency = smoothedLatency.count() == 0 ? latency : smoothedLatency + ((latency - smoothedLatency) / LATENCY_SMOOTHING);
+    if (++completionsInRound < limit)
+    {
+        creditAvailable.notify_one();
+        return false;
+    }
+
+    /// The round is over
+    if (baseLatency != std::chrono::nanoseconds::max())
+    {
+        baseLatency += baseLatency / BASE_LATENCY_AGING;
+    }
+    baseLatency = std::min(baseLatency, roundMinLatency);
+    const auto congested = smoothedLatency > LATENCY_TOLERANCE * baseLatency
+        or admissionQueueUtilization > ADMISSION_QUEUE_CONGESTION_THRESHOLD;
+    const auto previousLimit = limit;
+    limit = congested ? std::max(MIN_CREDITS, limit / 2) : std::min(maxCredits, limit + 1);
+    completionsInRound = 0;
+    roundMinLatency = std::chrono::nanoseconds::max();
+    creditAvailable.notify_all();
+
+    const auto now = std::chrono::steady_clock::now();
+    if (limit != previousLimit or now - lastReport >= reportInterval)
+    {
+        lastReport = now;
+        return true;
+    }
+    return false;
+}
+
+void SourceCredits::addStallTime(const std::chrono::nanoseconds duration)
+{
+    const std::scoped_lock lock(mutex);
+    stallTime += duration;
+}
+
+SourceCredits::Statistics SourceCredits::getStatistics() const
+{
+    const std::scoped_lock lock(mutex);
+    return {.limit = limit, .inflight = inflight, .stallTime = stallTime};
+}
+
+}
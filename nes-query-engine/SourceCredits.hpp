@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+
+namespace NES
+{
+
+/// Credit-based backpressure for a single source. Every buffer that the source emits to a successor takes one credit, which is returned
+/// once the successor task completed. In contrast to a fixed number of credits, the limit adapts to the downstream load, similar to the
+/// additive increase/multiplicative decrease of TCP congestion control. Once per round, i.e., after `limit` completed tasks:
+/// - the limit is halved if the smoothed task latency exceeds LATENCY_TOLERANCE times the base latency or if the admission queue is
+///   congested, as further buffers would only wait in a queue.
+/// - the limit grows by one credit otherwise, until it reaches the configured maximum.
+/// The base latency is the lowest latency observed so far. It ages slowly, so that it follows a permanent change of the workload.
+/// A source without credits blocks on a condition variable and accumulates the time it stalled. The statistics are reported whenever the
+/// limit changes and at least every report interval, so that a source that stalls at a constant limit remains visible.
+class SourceCredits
+{
+public:
+    static constexpr size_t MIN_CREDITS = 1;
+    static constexpr int LATENCY_TOLERANCE = 3;
+    /// The weight of the latest latency in the exponentially weighted moving average is 1/LATENCY_SMOOTHING
+    static constexpr int LATENCY_SMOOTHING = 8;
+    /// The base latency grows by 1/BASE_LATENCY_AGING per round, unless a round observes a lower latency
+    static constexpr int BASE_LATENCY_AGING = 16;
+    static constexpr double ADMISSION_QUEUE_CONGESTION_THRESHOLD = 0.5;
+    static constexpr std::chrono::milliseconds DEFAULT_REPORT_INTERVAL{100};
+
+    struct Statistics
+    {
+        size_t limit;
+        size_t inflight;
+        std::chrono::nanoseconds stallTime;
+    };
+
+    /// Starts with the maximum number of credits, i.e., without congestion a source behaves as with a fixed limit of `maxCredits`
+    explicit SourceCredits(size_t maxCredits, std::chrono::nanoseconds reportInterval = DEFAULT_REPORT_INTERVAL);
+
+    /// Blocks until a credit is available. Returns false, if the stop token was triggered while waiting.
+    bool acquire(const std::stop_token& stopToken);
+
+    /// Returns a credit. The latency is the time between emitting the buffer and the completion of its task. The utilization of the
+    /// admission queue is its number of queued tasks relative to its capacity.
+    /// Returns true at the end of a round, if the limit changed or the last report is at least the report interval ago. The caller should
+    /// report the statistics then.
+    bool release(std::chrono::nanoseconds latency, double admissionQueueUtilization);
+
+    /// Accounts time that the source stalled outside of acquire, e.g., while it waited for space in the admission queue
+    void addStallTime(std::chrono::nanoseconds duration);
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable_any creditAvailable;
+    size_t maxCredits;
+    std::chrono::nanoseconds reportInterval;
+    std::chrono::steady_clock::time_point lastReport = std::chrono::steady_clock::now();
+    size_t limit;
+    size_t inflight = 0;
+    size_t completionsInRound = 0;
+    std::chrono::nanoseconds baseLatency = std::chrono::nanoseconds::max();
+    std::chrono::nanoseconds roundMinLatency = std::chrono::nanoseconds::max();
+    std::chrono::nanoseconds smoothedLatency{0};
+    std::chrono::nanoseconds stallTime{0};
+};
+
+}
@@ -21,6 +21,7 @@
 #include <variant>
 #include <Identifiers/Identifiers.hpp>
 #include <Identifiers/NESStrongType.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutableQueryPlan.hpp>
@@ -176,17 +177,20 @@ struct StartQueryTask : BaseTask
         QueryId queryId,
         std::unique_ptr<ExecutableQueryPlan> queryPlan,
         std::weak_ptr<QueryCatalog> catalog,
+        std::shared_ptr<QueryMemoryQuota> memoryQuota,
         std::function<void()> onCompletion,
         std::function<void(Exception)> onError)
         : BaseTask(std::move(queryId), std::move(onCompletion), std::move(onError))
         , queryPlan(std::move(queryPlan))
         , catalog(std::move(catalog))
+        , memoryQuota(std::move(memoryQuota))
     {
     }
 
     StartQueryTask() = default;
     std::unique_ptr<ExecutableQueryPlan> queryPlan;
     std::weak_ptr<QueryCatalog> catalog;
+    std::shared_ptr<QueryMemoryQuota> memoryQuota;
 };
 
 struct PendingPipelineStopTask : BaseTask
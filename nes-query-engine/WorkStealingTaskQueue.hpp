@@ -0,0 +1,89 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <folly/lang/Align.h>
+
+namespace NES
+{
+
+/// Bounded task queue which is owned by a single WorkerThread.
+/// The owner pushes to the back and pops from the front, which preserves the FIFO order of the shared task queue. This matters for
+/// tasks that re-emit themselves (e.g., the PendingPipelineStopTask) as a LIFO order would let them starve the tasks they wait for.
+/// Other WorkerThreads steal from the back, i.e., they take the work the owner would pick up last.
+/// Each operation holds the mutex only for a push or pop. In the common case only the owner touches the queue, which keeps the lock
+/// uncontended and the queue's cache lines local to the owner.
+template <typename T>
+class alignas(folly::hardware_destructive_interference_size) WorkStealingTaskQueue
+{
+public:
+    explicit WorkStealingTaskQueue(size_t capacity) : capacity(capacity) { }
+
+    /// Returns false if the queue is full. The value is only moved from if the push succeeds.
+    bool tryPush(T&& value)
+    {
+        const std::scoped_lock lock(mutex);
+        if (tasks.size() >= capacity)
+        {
+            return false;
+        }
+        tasks.push_back(std::move(value));
+        numberOfTasks.store(tasks.size(), std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Called by the owning WorkerThread
+    bool tryPop(T& value)
+    {
+        const std::scoped_lock lock(mutex);
+        if (tasks.empty())
+        {
+            return false;
+        }
+        value = std::move(tasks.front());
+        tasks.pop_front();
+        numberOfTasks.store(tasks.size(), std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Called by any other WorkerThread
+    bool trySteal(T& value)
+    {
+        const std::scoped_lock lock(mutex);
+        if (tasks.empty())
+        {
+            return false;
+        }
+        value = std::move(tasks.back());
+        tasks.pop_back();
+        numberOfTasks.store(tasks.size(), std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Allows thieves to skip empty queues without acquiring their lock. The value may be outdated by the time it is used.
+    [[nodiscard]] size_t approximateSize() const { return numberOfTasks.load(std::memory_order_relaxed); }
+
+private:
+    std::mutex mutex;
+    std::deque<T> tasks;
+    std::atomic<size_t> numberOfTasks{0};
+    size_t capacity;
+};
+}
@@ -0,0 +1,139 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <folly/MPMCQueue.h>
+#include <WorkStealingTaskQueue.hpp>
+
+/// This Benchmark compares the task throughput of the two TaskSchedulingModes of the QueryEngine's ThreadPool.
+/// Every iteration emulates a WorkerThread that emits a follow-up task (e.g., for a successor pipeline) and picks up the next task.
+/// With SHARED_QUEUE all threads contend on the same MPMC queue, with WORK_STEALING every thread mostly works on its own queue and
+/// only steals if its own queue runs empty.
+/// The payload mimics the size and move cost of a WorkTask: a reference to the pipeline and the completion callback.
+
+namespace
+{
+constexpr size_t SHARED_QUEUE_SIZE = 10000;
+constexpr size_t LOCAL_QUEUE_SIZE = 1024;
+
+struct BenchmarkTask
+{
+    size_t sequenceNumber = 0;
+    std::shared_ptr<size_t> pipeline;
+    std::function<void()> onComplete;
+};
+
+BenchmarkTask createTask(size_t sequenceNumber, const std::shared_ptr<size_t>& pipeline)
+{
+    return BenchmarkTask{sequenceNumber, pipeline, [pipeline] { benchmark::DoNotOptimize(*pipeline); }};
+}
+
+std::unique_ptr<folly::MPMCQueue<BenchmarkTask>> sharedQueue;
+std::vector<std::unique_ptr<NES::WorkStealingTaskQueue<BenchmarkTask>>> localQueues;
+std::shared_ptr<size_t> pipeline;
+}
+
+static void BM_SharedQueue(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        sharedQueue = std::make_unique<folly::MPMCQueue<BenchmarkTask>>(SHARED_QUEUE_SIZE);
+        pipeline = std::make_shared<size_t>(42);
+    }
+
+    size_t sequenceNumber = 0;
+    for (auto _ : state)
+    {
+        auto task = createTask(sequenceNumber++, pipeline);
+        if (not sharedQueue->write(std::move(task))) /// NOLINT no move will happen if the write has failed
+        {
+            task.onComplete();
+        }
+
+        BenchmarkTask next;
+        if (sharedQueue->read(next))
+        {
+            next.onComplete();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        sharedQueue.reset();
+        pipeline.reset();
+    }
+}
+
+static void BM_WorkStealing(benchmark::State& state)
+{
+    const auto numberOfThreads = static_cast<size_t>(state.threads());
+    const auto self = static_cast<size_t>(state.thread_index());
+    if (self == 0)
+    {
+        localQueues.clear();
+        for (size_t i = 0; i < numberOfThreads; ++i)
+        {
+            localQueues.emplace_back(std::make_unique<NES::WorkStealingTaskQueue<BenchmarkTask>>(LOCAL_QUEUE_SIZE));
+        }
+        pipeline = std::make_shared<size_t>(42);
+    }
+
+    size_t sequenceNumber = 0;
+    size_t stolenTasks = 0;
+    for (auto _ : state)
+    {
+        auto& localQueue = *localQueues[self];
+        auto task = createTask(sequenceNumber++, pipeline);
+        if (not localQueue.tryPush(std::move(task))) /// NOLINT no move will happen if the push has failed
+        {
+            task.onComplete();
+        }
+
+        BenchmarkTask next;
+        if (localQueue.tryPop(next))
+        {
+            next.onComplete();
+            continue;
+        }
+        for (size_t offset = 1; offset < numberOfThreads; ++offset)
+        {
+            auto& victim = *localQueues[(self + offset) % numberOfThreads];
+            if (victim.approximateSize() > 0 && victim.trySteal(next))
+            {
+                ++stolenTasks;
+                next.onComplete();
+                break;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["stolen"] = benchmark::Counter(static_cast<double>(stolenTasks), benchmark::Counter::kAvgThreads);
+
+    if (self == 0)
+    {
+        localQueues.clear();
+        pipeline.reset();
+    }
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_SharedQueue)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_WorkStealing)->ThreadRange(1, 64)->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -17,6 +17,7 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/AbstractQueryStatusListener.hpp>
 #include <Runtime/BufferManager.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <ExecutableQueryPlan.hpp>
 #include <QueryEngineConfiguration.hpp>
 #include <QueryEngineStatisticListener.hpp>
@@ -48,6 +49,8 @@ public:
     std::shared_ptr<BufferManager> bufferManager;
     std::shared_ptr<AbstractQueryStatusListener> statusListener;
     std::shared_ptr<QueryEngineStatisticListener> statisticListener;
+    /// Every started query accounts its buffers in a quota with these limits, see QueryMemoryQuota
+    QueryMemoryLimits queryMemoryLimits;
     std::shared_ptr<QueryCatalog> queryCatalog;
     std::unique_ptr<ThreadPool> threadPool;
 };
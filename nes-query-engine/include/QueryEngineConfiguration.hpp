@@ -14,16 +14,25 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include <Configurations/BaseConfiguration.hpp>
 #include <Configurations/BaseOption.hpp>
+#include <Configurations/Enums/EnumOption.hpp>
 #include <Configurations/ScalarOption.hpp>
 #include <Configurations/Validation/ConfigurationValidation.hpp>
+#include <fmt/format.h>
 
 namespace NES
 {
+enum class TaskSchedulingMode : uint8_t
+{
+    SHARED_QUEUE, /// All worker threads read from and write into a single bounded MPMC task queue
+    WORK_STEALING /// Every worker thread owns a local task queue for the work it emits. Idle worker threads steal from the others.
+};
+
 class QueryEngineConfiguration final : public BaseConfiguration
 {
     /// validators to prevent nonsensical values for the number of threads and task queue size
@@ -41,8 +50,40 @@ public:
         = {"task_queue_size", "10000", "Size of the bounded task queue used within the QueryEngine", {taskQueueSizeValidator()}};
     UIntOption admissionQueueSize
         = {"admission_queue_size", "1000", "Size of the bounded admission queue used within the QueryEngine", {taskQueueSizeValidator()}};
+    EnumOption<TaskSchedulingMode> taskSchedulingMode
+        = {"task_scheduling_mode",
+           TaskSchedulingMode::SHARED_QUEUE,
+           fmt::format("How tasks are distributed across worker threads: {}", enumPipeList<TaskSchedulingMode>())};
+    UIntOption localTaskQueueSize
+        = {"local_task_queue_size",
+           "1024",
+           "Size of the bounded per worker thread task queue. Only used if task_scheduling_mode is WORK_STEALING",
+           {taskQueueSizeValidator()}};
+    BoolOption pinWorkerThreadsToNumaNodes
+        = {"pin_worker_threads_to_numa_nodes",
+           "false",
+           "Distributes the worker threads round-robin across the NUMA nodes and restricts each worker thread to the cpus of its node"};
+    UIntOption querySoftMemoryLimitInBytes
+        = {"query_soft_memory_limit_in_bytes",
+           "0",
+           "Buffer memory per query above which the QueryEngine throttles the sources of the query. 0 disables the limit"};
+    UIntOption queryHardMemoryLimitInBytes
+        = {"query_hard_memory_limit_in_bytes",
+           "0",
+           "Buffer memory per query above which the QueryEngine fails the query. 0 disables the limit"};
 
 protected:
-    std::vector<BaseOption*> getOptions() override { return {&numberOfWorkerThreads, &taskQueueSize, &admissionQueueSize}; }
+    std::vector<BaseOption*> getOptions() override
+    {
+        return {
+            &numberOfWorkerThreads,
+            &taskQueueSize,
+            &admissionQueueSize,
+            &taskSchedulingMode,
+            &localTaskQueueSize,
+            &pinWorkerThreadsToNumaNodes,
+            &querySoftMemoryLimitInBytes,
+            &queryHardMemoryLimitInBytes};
+    }
 };
 }
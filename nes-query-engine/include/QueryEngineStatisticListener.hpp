@@ -18,6 +18,7 @@
 #include <variant>
 #include <Identifiers/Identifiers.hpp>
 #include <Identifiers/NESStrongType.hpp>
+#include <ExecutablePipelineStage.hpp>
 
 namespace NES
 {
@@ -119,12 +120,20 @@ struct QueryFail : EventBase
 
 struct PipelineStart : EventBase
 {
-    PipelineStart(WorkerThreadId threadId, QueryId queryId, PipelineId pipelineId)
-        : EventBase(threadId, queryId), pipelineId(pipelineId) { }
+    PipelineStart(
+        WorkerThreadId threadId,
+        QueryId queryId,
+        PipelineId pipelineId,
+        CompilationCacheResult compilationCacheResult = CompilationCacheResult::NOT_CACHED)
+        : EventBase(threadId, queryId), pipelineId(pipelineId), compilationCacheResult(compilationCacheResult)
+    {
+    }
 
     PipelineStart() = default;
 
     PipelineId pipelineId = INVALID<PipelineId>;
+    /// Allows listeners to count the hits and misses of the compiled pipeline cache
+    CompilationCacheResult compilationCacheResult = CompilationCacheResult::NOT_CACHED;
 };
 
 struct PipelineStop : EventBase
@@ -138,6 +147,29 @@ struct PipelineStop : EventBase
     PipelineId pipelineId = INVALID<PipelineId>;
 };
 
+/// Emitted whenever the adaptive backpressure changes the number of buffers a source may have in flight and periodically while the source
+/// runs, which reports the time the source stalled on missing credits or a full admission queue
+struct SourceCreditsUpdate : EventBase
+{
+    SourceCreditsUpdate(
+        QueryId queryId, OriginId originId, size_t credits, size_t numberOfInflightBuffers, std::chrono::nanoseconds stallTime)
+        : EventBase(INVALID<WorkerThreadId>, queryId)
+        , originId(originId)
+        , credits(credits)
+        , numberOfInflightBuffers(numberOfInflightBuffers)
+        , stallTime(stallTime)
+    {
+    }
+
+    SourceCreditsUpdate() = default;
+
+    OriginId originId = INVALID<OriginId>;
+    size_t credits{};
+    size_t numberOfInflightBuffers{};
+    /// Total time the source was blocked, because it had no credits left
+    std::chrono::nanoseconds stallTime{};
+};
+
 using Event = std::variant<
     TaskExecutionStart,
     TaskEmit,
@@ -148,7 +180,8 @@ using Event = std::variant<
     QueryStart,
     QueryStopRequest,
     QueryStop,
-    QueryFail>;
+    QueryFail,
+    SourceCreditsUpdate>;
 
 struct QueryEngineStatisticListener
 {
@@ -38,6 +38,7 @@ TEST_F(QueryEngineConfigurationTest, testConfigurationsDefault)
     const QueryEngineConfiguration defaultConfig;
     EXPECT_EQ(defaultConfig.taskQueueSize.getValue(), 10000);
     EXPECT_EQ(defaultConfig.numberOfWorkerThreads.getValue(), 4);
+    EXPECT_EQ(defaultConfig.taskSchedulingMode.getValue(), TaskSchedulingMode::SHARED_QUEUE);
 }
 
 TEST_F(QueryEngineConfigurationTest, testConfigurationsValidInput)
@@ -51,6 +52,30 @@ TEST_F(QueryEngineConfigurationTest, testConfigurationsValidInput)
     EXPECT_EQ(defaultConfig.numberOfWorkerThreads.getValue(), 2);
 }
 
+TEST_F(QueryEngineConfigurationTest, testConfigurationsWorkStealing)
+{
+    QueryEngineConfiguration defaultConfig;
+    defaultConfig.overwriteConfigWithCommandLineInput({{"task_scheduling_mode", "WORK_STEALING"}, {"local_task_queue_size", "64"}});
+
+    EXPECT_EQ(defaultConfig.taskSchedulingMode.getValue(), TaskSchedulingMode::WORK_STEALING);
+    EXPECT_EQ(defaultConfig.localTaskQueueSize.getValue(), 64);
+
+    QueryEngineConfiguration defaultConfig1;
+    EXPECT_ANY_THROW(defaultConfig1.overwriteConfigWithCommandLineInput({{"task_scheduling_mode", "ROUND_ROBIN"}}));
+}
+
+TEST_F(QueryEngineConfigurationTest, testConfigurationsQueryMemoryLimits)
+{
+    QueryEngineConfiguration defaultConfig;
+    EXPECT_EQ(defaultConfig.querySoftMemoryLimitInBytes.getValue(), 0);
+    EXPECT_EQ(defaultConfig.queryHardMemoryLimitInBytes.getValue(), 0);
+
+    defaultConfig.overwriteConfigWithCommandLineInput(
+        {{"query_soft_memory_limit_in_bytes", "1048576"}, {"query_hard_memory_limit_in_bytes", "4194304"}});
+    EXPECT_EQ(defaultConfig.querySoftMemoryLimitInBytes.getValue(), 1048576);
+    EXPECT_EQ(defaultConfig.queryHardMemoryLimitInBytes.getValue(), 4194304);
+}
+
 TEST_F(QueryEngineConfigurationTest, testConfigurationsBadInputNonString)
 {
     QueryEngineConfiguration defaultConfig;
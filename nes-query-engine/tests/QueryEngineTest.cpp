@@ -33,6 +33,7 @@
 #include <gtest/gtest.h>
 #include <BaseUnitTest.hpp>
 #include <ExecutableQueryPlan.hpp>
+#include <QueryEngineConfiguration.hpp>
 #include <QueryEngineStatisticListener.hpp>
 #include <QueryEngineTestingInfrastructure.hpp>
 #include <TestSource.hpp>
@@ -700,6 +701,77 @@ TEST_F(QueryEngineTest, ManyQueriesWithTwoSources)
     test.stop();
 }
 
+/// Same as ManyQueriesWithTwoSources, but the worker threads use local task queues and steal work from each other.
+TEST_F(QueryEngineTest, ManyQueriesWithTwoSourcesWorkStealing)
+{
+    constexpr size_t numberOfSources = 2;
+    constexpr size_t numberOfQueries = 10;
+
+    TestingHarness test(LARGE_NUMBER_OF_THREADS, NUMBER_OF_BUFFERS_PER_SOURCE * numberOfSources * numberOfQueries);
+    test.schedulingMode = TaskSchedulingMode::WORK_STEALING;
+
+    std::vector<QueryPlanBuilder::identifier_t> sources;
+    std::vector<QueryPlanBuilder::identifier_t> sinks;
+    std::vector<std::unique_ptr<ExecutableQueryPlan>> queryPlans;
+    for (size_t i = 0; i < numberOfQueries; i++)
+    {
+        auto builder = test.buildNewQuery();
+        auto source1 = builder.addSource();
+        auto source2 = builder.addSource();
+        sources.push_back(source1);
+        sources.push_back(source2);
+        sinks.push_back(builder.addSink({builder.addPipeline({source1, source2})}));
+        queryPlans.push_back(test.addNewQuery(std::move(builder)));
+    }
+
+    std::vector<std::shared_ptr<TestSourceControl>> sourcesCtrls;
+    std::vector<std::shared_ptr<TestSinkController>> sinkCtrls;
+
+    for (const auto& [index, _] : queryPlans | views::enumerate)
+    {
+        sourcesCtrls.push_back(test.sourceControls[sources[index * 2]]);
+        sourcesCtrls.push_back(test.sourceControls[sources[(index * 2) + 1]]);
+        sinkCtrls.push_back(test.sinkControls[sinks[index]]);
+        test.expectSourceTermination(QueryId(1 + index), sources[index * 2], QueryTerminationType::Graceful);
+        test.expectSourceTermination(QueryId(1 + index), sources[(index * 2) + 1], QueryTerminationType::Graceful);
+        test.expectQueryStatusEvents(QueryId(1 + index), {QueryState::Started, QueryState::Running, QueryState::Stopped});
+    }
+
+    test.start();
+    {
+        DataGenerator dataGenerator;
+        dataGenerator.start(sourcesCtrls);
+        auto queryIds = queryPlans
+            | std::views::transform(
+                            [&test](std::unique_ptr<ExecutableQueryPlan>& query) -> QueryId
+                            {
+                                auto queryId = query->queryId;
+                                test.startQuery(std::move(query));
+                                return queryId;
+                            })
+            | std::ranges::to<std::vector<QueryId>>();
+
+        for (auto queryId : queryIds)
+        {
+            ASSERT_TRUE(test.waitForQepRunning(queryId, DEFAULT_LONG_AWAIT_TIMEOUT));
+        }
+
+        sinkCtrls[0]->waitForNumberOfReceivedBuffersOrMore(2);
+        dataGenerator.stop();
+
+        for (auto queryId : queryIds)
+        {
+            ASSERT_TRUE(test.waitForQepTermination(queryId, DEFAULT_LONG_AWAIT_TIMEOUT));
+        }
+    }
+
+    for (const auto& testSourceControl : sourcesCtrls)
+    {
+        ASSERT_TRUE(testSourceControl->waitUntilDestroyed());
+    }
+    test.stop();
+}
+
 /// This test creates 10 QueryPlans (each with two sources one intermediate pipeline and a sink)
 /// The TestDataGenerator will emit a failure on the 0th source (for QueryId 1)
 /// We expect QueryId 1 to terminate without internal intervention and the query failed status to be emitted (likewise for the source)
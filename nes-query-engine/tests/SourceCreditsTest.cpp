@@ -0,0 +1,135 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <stop_token>
+#include <thread>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <SourceCredits.hpp>
+
+namespace NES::Testing
+{
+class SourceCreditsTest : public BaseUnitTest
+{
+protected:
+    static constexpr size_t MAX_CREDITS = 8;
+    static constexpr std::chrono::microseconds BASE_LATENCY{100};
+    /// Reports only if the limit changes, unless a test takes longer than an hour
+    static constexpr std::chrono::hours NO_PERIODIC_REPORT{1};
+
+    /// Acquires and releases one round of credits, i.e., as many credits as the current limit. Returns true, if the round is reported.
+    static bool completeRound(SourceCredits& credits, const std::chrono::nanoseconds latency, const double admissionQueueUtilization = 0.0)
+    {
+        const auto limit = credits.getStatistics().limit;
+        for (size_t i = 0; i < limit; ++i)
+        {
+            EXPECT_TRUE(credits.acquire(std::stop_token{}));
+        }
+        bool report = false;
+        for (size_t i = 0; i < limit; ++i)
+        {
+            report = credits.release(latency, admissionQueueUtilization);
+        }
+        return report;
+    }
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(SourceCreditsTest, keepsMaximumWithoutCongestion)
+{
+    SourceCredits credits(MAX_CREDITS, NO_PERIODIC_REPORT);
+    for (size_t round = 0; round < 10; ++round)
+    {
+        EXPECT_FALSE(completeRound(credits, BASE_LATENCY));
+    }
+    EXPECT_EQ(credits.getStatistics().limit, MAX_CREDITS);
+    EXPECT_EQ(credits.getStatistics().inflight, 0);
+}
+
+TEST_F(SourceCreditsTest, halvesOnHighLatencyAndRecoversAdditively)
+{
+    SourceCredits credits(MAX_CREDITS, NO_PERIODIC_REPORT);
+    completeRound(credits, BASE_LATENCY);
+
+    /// The smoothed latency needs a few completions to exceed the tolerance
+    while (credits.getStatistics().limit > SourceCredits::MIN_CREDITS)
+    {
+        completeRound(credits, 10 * BASE_LATENCY);
+    }
+    EXPECT_EQ(credits.getStatistics().limit, SourceCredits::MIN_CREDITS);
+
+    /// The smoothed latency decays over a few rounds, afterward every round adds one credit
+    while (not completeRound(credits, BASE_LATENCY))
+    {
+    }
+    for (size_t limit = SourceCredits::MIN_CREDITS + 1; limit < MAX_CREDITS; ++limit)
+    {
+        EXPECT_EQ(credits.getStatistics().limit, limit);
+        EXPECT_TRUE(completeRound(credits, BASE_LATENCY));
+    }
+    EXPECT_EQ(credits.getStatistics().limit, MAX_CREDITS);
+    EXPECT_FALSE(completeRound(credits, BASE_LATENCY));
+}
+
+TEST_F(SourceCreditsTest, halvesOnCongestedAdmissionQueue)
+{
+    SourceCredits credits(MAX_CREDITS, NO_PERIODIC_REPORT);
+    EXPECT_TRUE(completeRound(credits, BASE_LATENCY, 0.9));
+    EXPECT_EQ(credits.getStatistics().limit, MAX_CREDITS / 2);
+}
+
+TEST_F(SourceCreditsTest, blocksWithoutCreditsAndAccountsStallTime)
+{
+    SourceCredits credits(1);
+    ASSERT_TRUE(credits.acquire(std::stop_token{}));
+
+    auto blockedAcquire = std::async(std::launch::async, [&credits] { return credits.acquire(std::stop_token{}); });
+    EXPECT_EQ(blockedAcquire.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    credits.release(BASE_LATENCY, 0.0);
+    EXPECT_TRUE(blockedAcquire.get());
+    EXPECT_GT(credits.getStatistics().stallTime.count(), 0);
+}
+
+TEST_F(SourceCreditsTest, stopRequestWakesUpBlockedSource)
+{
+    SourceCredits credits(1);
+    ASSERT_TRUE(credits.acquire(std::stop_token{}));
+
+    std::stop_source stopSource;
+    auto blockedAcquire = std::async(std::launch::async, [&credits, token = stopSource.get_token()] { return credits.acquire(token); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    stopSource.request_stop();
+    EXPECT_FALSE(blockedAcquire.get());
+    EXPECT_EQ(credits.getStatistics().inflight, 1);
+}
+
+TEST_F(SourceCreditsTest, reportsPeriodicallyAtConstantLimit)
+{
+    SourceCredits credits(MAX_CREDITS, std::chrono::milliseconds(10));
+    EXPECT_FALSE(completeRound(credits, BASE_LATENCY));
+
+    /// A source that stalls at its maximum limit does not change the limit, but still reports its stall time
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    credits.addStallTime(std::chrono::milliseconds(20));
+    EXPECT_TRUE(completeRound(credits, BASE_LATENCY));
+    EXPECT_EQ(credits.getStatistics().limit, MAX_CREDITS);
+    EXPECT_EQ(credits.getStatistics().stallTime, std::chrono::milliseconds(20));
+    EXPECT_FALSE(completeRound(credits, BASE_LATENCY));
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
@@ -364,6 +364,7 @@ void TestingHarness::start()
     }
     QueryEngineConfiguration configuration{};
     configuration.numberOfWorkerThreads.setValue(numberOfThreads);
+    configuration.taskSchedulingMode.setValue(schedulingMode);
     qm = std::make_unique<QueryEngine>(configuration, this->statListener, this->status, this->bm);
 }
 
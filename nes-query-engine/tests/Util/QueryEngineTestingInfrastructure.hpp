@@ -58,6 +58,7 @@
 #include <Interfaces.hpp>
 #include <MemoryTestUtils.hpp>
 #include <QueryEngine.hpp>
+#include <QueryEngineConfiguration.hpp>
 #include <QueryEngineStatisticListener.hpp>
 #include <RunningQueryPlan.hpp>
 #include <Task.hpp>
@@ -118,6 +119,7 @@ struct ExpectStats
     STAT_TYPE(TaskExecutionComplete);
     STAT_TYPE(TaskExpired);
     STAT_TYPE(TaskEmit);
+    STAT_TYPE(SourceCreditsUpdate);
 
     explicit ExpectStats(std::shared_ptr<TestQueryStatisticListener> listener) : listener(std::move(listener))
     {
@@ -141,6 +143,8 @@ struct ExpectStats
             .WillRepeatedly(::testing::Invoke([](auto) { }));
         EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::QueryFail>(::testing::_)))
             .WillRepeatedly(::testing::Invoke([](auto) { }));
+        EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::SourceCreditsUpdate>(::testing::_)))
+            .WillRepeatedly(::testing::Invoke([](auto) { }));
     }
 
     template <typename... Args>
@@ -186,6 +190,7 @@ struct TestWorkEmitter : WorkEmitter
         (override));
     MOCK_METHOD(
         void, emitPipelineStop, (QueryId, std::unique_ptr<RunningQueryPlanNode>, BaseTask::onComplete, BaseTask::onFailure), (override));
+    MOCK_METHOD(double, getAdmissionQueueUtilization, (), (const, override));
 };
 
 struct TestQueryLifetimeController : QueryLifetimeController
@@ -421,6 +426,7 @@ struct TestingHarness
     std::shared_ptr<QueryStatusListener> status = std::make_shared<QueryStatusListener>();
     std::unique_ptr<QueryEngine> qm;
     size_t numberOfThreads;
+    TaskSchedulingMode schedulingMode = TaskSchedulingMode::SHARED_QUEUE;
 
     QueryId::Underlying queryIdCounter = INITIAL<QueryId>.getRawValue();
     QueryId::Underlying lastOriginIdCounter = INITIAL<OriginId>.getRawValue();
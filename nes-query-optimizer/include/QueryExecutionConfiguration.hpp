@@ -23,6 +23,8 @@
 #include <Configurations/Enums/EnumOption.hpp>
 #include <Configurations/ScalarOption.hpp>
 #include <Configurations/Validation/NumberValidation.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <SliceStore/SliceStoreProvider.hpp>
 #include <Util/ExecutionMode.hpp>
 
 namespace NES
@@ -32,6 +34,8 @@ static constexpr auto DEFAULT_NUMBER_OF_PARTITIONS_DATASTRUCTURES = 100;
 static constexpr auto DEFAULT_PAGED_VECTOR_SIZE = 1024;
 static constexpr auto DEFAULT_OPERATOR_BUFFER_SIZE = 4096;
 static constexpr auto DEFAULT_NUMBER_OF_RECORDS_PER_KEY = 10;
+static constexpr auto DEFAULT_NUMBER_OF_RADIX_PARTITIONS = 1;
+static constexpr auto DEFAULT_MIN_NUMBER_OF_TUPLES_PER_NLJ_TILE = 1024;
 
 enum class StreamJoinStrategy : uint8_t
 {
@@ -76,11 +80,52 @@ public:
            StreamJoinStrategy::OPTIMIZER_CHOOSES,
            "Join Strategy"
            "[NESTED_LOOP_JOIN|HASH_JOIN|OPTIMIZER_CHOOSES]."};
+    EnumOption<Nautilus::Interface::HashMapType> hashMapType
+        = {"hash_map_type",
+           Nautilus::Interface::HashMapType::CHAINED,
+           "Hash map implementation of the hash join and the windowed aggregation"
+           "[CHAINED|OPEN_ADDRESSING]."};
+    UIntOption numberOfRadixPartitions
+        = {"number_of_radix_partitions",
+           std::to_string(DEFAULT_NUMBER_OF_RADIX_PARTITIONS),
+           "Radix partitions of the hash join and windowed aggregation build. Each partition of a window is probed by its own task. "
+           "1 disables the partitioning.",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption minNumberOfTuplesPerNLJTile
+        = {"min_number_of_tuples_per_nlj_tile",
+           std::to_string(DEFAULT_MIN_NUMBER_OF_TUPLES_PER_NLJ_TILE),
+           "Minimal number of tuples per side of a nested loop join probe task. Each side of a window gets split into at most as many "
+           "tiles as worker threads. 0 disables the tiling.",
+           {std::make_shared<NumberValidation>()}};
+    EnumOption<SliceStoreType> sliceStoreType
+        = {"slice_store_type",
+           SliceStoreType::DEFAULT,
+           "Slice store of the window operators"
+           "[DEFAULT|LOCK_FREE]."};
+    UIntOption operatorStateMemoryBudget
+        = {"operator_state_memory_budget",
+           "0",
+           "Bytes of join state per operator that the watermark has passed but that still wait for their windows. Exceeding state gets "
+           "spilled to the spill directory. 0 disables the spilling.",
+           {std::make_shared<NumberValidation>()}};
+    StringOption spillDirectory = {"spill_directory", "/tmp", "Directory of the files that store the spilled operator state."};
 
 private:
     std::vector<BaseOption*> getOptions() override
     {
-        return {&executionMode, &pageSize, &numberOfPartitions, &joinStrategy, &numberOfRecordsPerKey, &operatorBufferSize};
+        return {
+            &executionMode,
+            &pageSize,
+            &numberOfPartitions,
+            &joinStrategy,
+            &hashMapType,
+            &numberOfRadixPartitions,
+            &minNumberOfTuplesPerNLJTile,
+            &sliceStoreType,
+            &numberOfRecordsPerKey,
+            &operatorBufferSize,
+            &operatorStateMemoryBudget,
+            &spillDirectory};
     }
 };
 
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <PhysicalPlan.hpp>
 #include <QueryExecutionConfiguration.hpp>
@@ -29,10 +31,24 @@ public:
         : defaultQueryExecution(std::move(defaultQueryExecution)) { };
     /// Takes the query plan as a logical plan and returns a fully physical plan
     [[nodiscard]] PhysicalPlan optimize(const LogicalPlan& plan) const;
+    /// Optimizes a single query without statistics of previous joins
     [[nodiscard]] static PhysicalPlan optimize(const LogicalPlan& plan, const QueryExecutionConfiguration& defaultQueryExecution);
 
+    /// The two steps of optimize(). The logical plan with the chosen implementations, e.g., the join types and the hash map sizes that
+    /// depend on the statistics of previous joins, determines the physical plan. Thus, it identifies the compiled code of the query.
+    [[nodiscard]] LogicalPlan decideImplementations(const LogicalPlan& plan) const;
+    [[nodiscard]] PhysicalPlan lower(const LogicalPlan& planWithImplementations) const;
+
 private:
+    [[nodiscard]] static LogicalPlan decideImplementations(
+        const LogicalPlan& plan,
+        const QueryExecutionConfiguration& defaultQueryExecution,
+        const std::shared_ptr<const JoinStatisticsStore>& joinStatistics);
+
     QueryExecutionConfiguration defaultQueryExecution;
+    /// The hash joins of the planned queries report the statistics of their inputs, which size the hash joins of later queries over the
+    /// same pair of inputs. The store lives as long as the optimizer, so that the statistics never leak into other optimizers.
+    std::shared_ptr<JoinStatisticsStore> joinStatistics = std::make_shared<JoinStatisticsStore>();
 };
 
 }
@@ -0,0 +1,78 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <typeinfo>
+#include <Traits/Trait.hpp>
+#include <SerializableTrait.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+/// Sizes of the hash maps of both inputs of a hash join, which the optimizer estimated from the statistics of previous hash joins over the
+/// same inputs. Without this trait, the hash join uses the sizes of the query execution configuration.
+struct HashJoinSizeTrait final : public TraitConcept
+{
+    struct HashMapSize
+    {
+        uint64_t numberOfBuckets;
+        uint64_t numberOfRecordsPerKey;
+
+        bool operator==(const HashMapSize& other) const = default;
+    };
+
+    HashMapSize leftSize;
+    HashMapSize rightSize;
+
+    HashJoinSizeTrait(const HashMapSize leftSize, const HashMapSize rightSize) : leftSize(leftSize), rightSize(rightSize) { }
+
+    [[nodiscard]] const std::type_info& getType() const override { return typeid(HashJoinSizeTrait); }
+
+    [[nodiscard]] SerializableTrait serialize() const override
+    {
+        SerializableTrait trait;
+        trait.set_trait_type(getType().name());
+        const auto addValue = [&trait](const std::string& name, const uint64_t value)
+        {
+            SerializableVariantDescriptor variant{};
+            variant.set_ulong_value(value);
+            (*trait.mutable_config())[name] = variant;
+        };
+        addValue("leftNumberOfBuckets", leftSize.numberOfBuckets);
+        addValue("leftNumberOfRecordsPerKey", leftSize.numberOfRecordsPerKey);
+        addValue("rightNumberOfBuckets", rightSize.numberOfBuckets);
+        addValue("rightNumberOfRecordsPerKey", rightSize.numberOfRecordsPerKey);
+        return trait;
+    }
+
+    bool operator==(const TraitConcept& other) const override
+    {
+        const auto casted = dynamic_cast<const HashJoinSizeTrait*>(&other);
+        if (casted == nullptr)
+        {
+            return false;
+        }
+        return leftSize == casted->leftSize and rightSize == casted->rightSize;
+    };
+
+    [[nodiscard]] size_t hash() const override
+    {
+        return std::hash<uint64_t>{}(leftSize.numberOfBuckets) ^ std::hash<uint64_t>{}(rightSize.numberOfBuckets);
+    }
+};
+}
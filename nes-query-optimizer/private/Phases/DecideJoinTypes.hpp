@@ -13,6 +13,10 @@
 */
 
 #pragma once
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Plans/LogicalPlan.hpp>
 
 #include <QueryExecutionConfiguration.hpp>
@@ -21,15 +25,27 @@ namespace NES
 {
 
 /// Decides what join implementation should be used. For now, we support HashJoin or a NestedLoopJoin
+/// If the optimizer chooses, we use the HashJoin for all supported join functions, unless the statistics of previous hash joins over the
+/// same pair of inputs in the given JoinStatisticsStore show that the windows contain so few records that the NestedLoopJoin is cheaper.
+/// If there are statistics for a HashJoin, we size its hash maps from the same statistics and store the sizes in a HashJoinSizeTrait.
+/// Thus, the returned plan determines the physical plan, even if running hash joins update the statistics in the meantime.
 class DecideJoinTypes
 {
 public:
-    explicit DecideJoinTypes(const StreamJoinStrategy joinStrategy) : joinStrategy(joinStrategy) { }
+    explicit DecideJoinTypes(
+        const StreamJoinStrategy joinStrategy,
+        std::shared_ptr<const JoinStatisticsStore> joinStatistics = nullptr,
+        const uint64_t numberOfRadixPartitions = 1)
+        : joinStrategy(joinStrategy), joinStatistics(std::move(joinStatistics)), numberOfRadixPartitions(numberOfRadixPartitions)
+    {
+    }
 
     LogicalPlan apply(const LogicalPlan& queryPlan);
 
 private:
     LogicalOperator apply(const LogicalOperator& logicalOperator);
     StreamJoinStrategy joinStrategy;
+    std::shared_ptr<const JoinStatisticsStore> joinStatistics;
+    uint64_t numberOfRadixPartitions;
 };
 }
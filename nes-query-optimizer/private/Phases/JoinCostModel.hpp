@@ -0,0 +1,50 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <Join/JoinStatisticsStore.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Traits/HashJoinSizeTrait.hpp>
+
+/// Estimates the costs of the join implementations and the size of the hash maps from the statistics that running hash joins reported to
+/// the JoinStatisticsStore of the optimizer. Without statistics for both inputs, the callers fall back to the shape of the join function
+/// and to the query execution configuration.
+namespace NES::JoinCostModel
+{
+
+/// Costs of inserting a record into a hash map and of probing it, relative to evaluating the join function for one pair of records
+constexpr double HASH_JOIN_COST_PER_RECORD = 16;
+constexpr uint64_t MAX_NUMBER_OF_BUCKETS = 1UL << 20;
+constexpr uint64_t MAX_NUMBER_OF_RECORDS_PER_KEY = 1024;
+
+using HashMapSize = HashJoinSizeTrait::HashMapSize;
+
+/// Returns the keys of the left and right input of the join in the JoinStatisticsStore
+std::array<std::string, 2> getStatisticsKeys(const JoinLogicalOperator& join);
+
+/// Returns the statistics of the left and right input of the join, if both are known
+std::optional<std::array<JoinInputStatistics, 2>> getStatistics(const JoinStatisticsStore& store, const JoinLogicalOperator& join);
+
+/// The nested loop join compares all pairs of records of a window, whereas the hash join touches each record once but at higher costs.
+/// Thus, the nested loop join is solely cheaper for windows with few records.
+bool isNestedLoopJoinCheaper(const std::array<JoinInputStatistics, 2>& statistics, uint64_t windowSizeInMs);
+
+/// Sizes the hash maps of one input so that the keys of one slice fit into the buckets and the records of one key into one page
+HashMapSize estimateHashMapSize(const JoinInputStatistics& statistics, uint64_t sliceSizeInMs, uint64_t numberOfRadixPartitions);
+}
@@ -13,11 +13,14 @@
 */
 
 #pragma once
+#include <memory>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <PhysicalPlan.hpp>
 #include <QueryExecutionConfiguration.hpp>
 
 namespace NES::LowerToPhysicalOperators
 {
-PhysicalPlan apply(const LogicalPlan& queryPlan, const QueryExecutionConfiguration& conf);
+PhysicalPlan
+apply(const LogicalPlan& queryPlan, const QueryExecutionConfiguration& conf, const std::shared_ptr<JoinStatisticsStore>& joinStatistics);
 }
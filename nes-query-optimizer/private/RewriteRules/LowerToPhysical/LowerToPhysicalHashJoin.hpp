@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <QueryExecutionConfiguration.hpp>
@@ -23,12 +25,17 @@ namespace NES
 {
 struct LowerToPhysicalHashJoin : AbstractRewriteRule
 {
-    explicit LowerToPhysicalHashJoin(QueryExecutionConfiguration conf) : conf(std::move(conf)) { }
+    explicit LowerToPhysicalHashJoin(QueryExecutionConfiguration conf, std::shared_ptr<JoinStatisticsStore> joinStatistics)
+        : conf(std::move(conf)), joinStatistics(std::move(joinStatistics))
+    {
+    }
 
     RewriteRuleResultSubgraph apply(LogicalOperator logicalOperator) override;
 
 private:
     QueryExecutionConfiguration conf;
+    /// The hash join reports the statistics of its inputs to this store. Without a store, it neither reads nor reports statistics.
+    std::shared_ptr<JoinStatisticsStore> joinStatistics;
 };
 
 }
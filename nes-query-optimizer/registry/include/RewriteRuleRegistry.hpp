@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <Join/JoinStatisticsStore.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Util/Registry.hpp>
 #include <QueryExecutionConfiguration.hpp>
@@ -28,6 +29,8 @@ using RewriteRuleRegistryReturnType = std::unique_ptr<AbstractRewriteRule>;
 struct RewriteRuleRegistryArguments
 {
     QueryExecutionConfiguration conf;
+    /// Statistics of the join inputs that the optimizer collects across the queries it plans
+    std::shared_ptr<JoinStatisticsStore> joinStatistics;
 };
 
 class RewriteRuleRegistry
@@ -14,6 +14,11 @@
 #include <Phases/DecideJoinTypes.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <ranges>
 #include <unordered_set>
 #include <vector>
@@ -24,12 +29,17 @@
 #include <Functions/FieldAccessLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Iterators/BFSIterator.hpp>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Phases/JoinCostModel.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Traits/HashJoinSizeTrait.hpp>
 #include <Traits/ImplementationTypeTrait.hpp>
 #include <Traits/Trait.hpp>
+#include <Util/Common.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
 #include <ErrorHandling.hpp>
 #include <QueryExecutionConfiguration.hpp>
 
@@ -75,6 +85,45 @@ bool shallUseHashJoin(const LogicalFunction& joinFunction)
 
     return true;
 }
+
+/// Returns the statistics of both inputs of the join, if running hash joins have reported them
+std::optional<std::array<JoinInputStatistics, 2>>
+getStatistics(const std::shared_ptr<const JoinStatisticsStore>& joinStatistics, const JoinLogicalOperator& joinOperator)
+{
+    if (joinStatistics == nullptr)
+    {
+        return std::nullopt;
+    }
+    return JoinCostModel::getStatistics(*joinStatistics, joinOperator);
+}
+
+/// Compares the costs of both join implementations, if there are statistics of both inputs
+bool isNestedLoopJoinCheaper(const std::optional<std::array<JoinInputStatistics, 2>>& statistics, const JoinLogicalOperator& joinOperator)
+{
+    const auto windowType = Util::as_if<Windowing::TimeBasedWindowType>(joinOperator.getWindowType());
+    if (not statistics.has_value() or windowType == nullptr)
+    {
+        return false;
+    }
+    return JoinCostModel::isNestedLoopJoinCheaper(*statistics, windowType->getSize().getTime());
+}
+
+/// Sizes the hash maps of both inputs of a hash join for the keys and records of one slice, if there are statistics of both inputs
+std::optional<HashJoinSizeTrait> estimateHashJoinSize(
+    const std::optional<std::array<JoinInputStatistics, 2>>& statistics,
+    const JoinLogicalOperator& joinOperator,
+    const uint64_t numberOfRadixPartitions)
+{
+    const auto windowType = Util::as_if<Windowing::TimeBasedWindowType>(joinOperator.getWindowType());
+    if (not statistics.has_value() or windowType == nullptr)
+    {
+        return std::nullopt;
+    }
+    const auto sliceSizeInMs = std::gcd(windowType->getSize().getTime(), windowType->getSlide().getTime());
+    return HashJoinSizeTrait{
+        JoinCostModel::estimateHashMapSize(statistics->at(0), sliceSizeInMs, numberOfRadixPartitions),
+        JoinCostModel::estimateHashMapSize(statistics->at(1), sliceSizeInMs, numberOfRadixPartitions)};
+}
 }
 
 LogicalPlan DecideJoinTypes::apply(const LogicalPlan& queryPlan)
@@ -89,16 +138,27 @@ LogicalOperator DecideJoinTypes::apply(const LogicalOperator& logicalOperator)
     const auto children = logicalOperator.getChildren()
         | std::views::transform([this](const LogicalOperator& child) { return apply(child); }) | std::ranges::to<std::vector>();
     auto traitSet = logicalOperator.getTraitSet();
-    std::erase_if(traitSet, [](const Trait& trait) { return trait.tryGet<ImplementationTypeTrait>().has_value(); });
+    std::erase_if(
+        traitSet,
+        [](const Trait& trait)
+        { return trait.tryGet<ImplementationTypeTrait>().has_value() or trait.tryGet<HashJoinSizeTrait>().has_value(); });
     if (const auto joinOperator = logicalOperator.tryGet<JoinLogicalOperator>())
     {
+        /// We read the statistics once, so that the implementation and the sizes of the join stem from the same statistics
+        const auto statistics = getStatistics(this->joinStatistics, *joinOperator);
         if (this->joinStrategy == StreamJoinStrategy::NESTED_LOOP_JOIN)
         {
             traitSet.insert(ImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
         }
-        else if (shallUseHashJoin(joinOperator->getJoinFunction()))
+        else if (
+            shallUseHashJoin(joinOperator->getJoinFunction())
+            and (this->joinStrategy == StreamJoinStrategy::HASH_JOIN or not isNestedLoopJoinCheaper(statistics, *joinOperator)))
         {
             traitSet.insert(ImplementationTypeTrait{JoinImplementation::HASH_JOIN});
+            if (const auto hashJoinSize = estimateHashJoinSize(statistics, *joinOperator, this->numberOfRadixPartitions))
+            {
+                traitSet.insert(hashJoinSize.value());
+            }
         }
         else
         {
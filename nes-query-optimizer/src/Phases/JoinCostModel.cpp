@@ -0,0 +1,88 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Phases/JoinCostModel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Join/JoinStatisticsStore.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+
+namespace NES::JoinCostModel
+{
+
+std::array<std::string, 2> getStatisticsKeys(const JoinLogicalOperator& join)
+{
+    const auto leftSchema = join.getLeftSchema();
+    std::vector<std::string> leftFieldNames;
+    std::vector<std::string> rightFieldNames;
+    for (const auto& function : BFSRange<LogicalFunction>(join.getJoinFunction()))
+    {
+        if (const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>())
+        {
+            auto& fieldNames = leftSchema.getFieldByName(fieldAccess->getFieldName()).has_value() ? leftFieldNames : rightFieldNames;
+            fieldNames.emplace_back(fieldAccess->getFieldName());
+        }
+    }
+    auto leftKey = JoinStatisticsStore::createInputKey(leftFieldNames, rightFieldNames);
+    auto rightKey = JoinStatisticsStore::createInputKey(std::move(rightFieldNames), std::move(leftFieldNames));
+    return {std::move(leftKey), std::move(rightKey)};
+}
+
+std::optional<std::array<JoinInputStatistics, 2>> getStatistics(const JoinStatisticsStore& store, const JoinLogicalOperator& join)
+{
+    const auto [leftKey, rightKey] = getStatisticsKeys(join);
+    const auto leftStatistics = store.get(leftKey);
+    const auto rightStatistics = store.get(rightKey);
+    if (not leftStatistics.has_value() or not rightStatistics.has_value())
+    {
+        return std::nullopt;
+    }
+    return std::array{*leftStatistics, *rightStatistics};
+}
+
+bool isNestedLoopJoinCheaper(const std::array<JoinInputStatistics, 2>& statistics, const uint64_t windowSizeInMs)
+{
+    const auto windowSize = static_cast<double>(windowSizeInMs);
+    const auto leftRecords = statistics[0].getNumberOfRecords(windowSize);
+    const auto rightRecords = statistics[1].getNumberOfRecords(windowSize);
+    return leftRecords * rightRecords < HASH_JOIN_COST_PER_RECORD * (leftRecords + rightRecords);
+}
+
+HashMapSize
+estimateHashMapSize(const JoinInputStatistics& statistics, const uint64_t sliceSizeInMs, const uint64_t numberOfRadixPartitions)
+{
+    const auto sliceSize = static_cast<double>(sliceSizeInMs);
+    const auto numberOfKeys = std::max(statistics.getNumberOfDistinctKeys(sliceSize), 1.0);
+    const auto numberOfRecords = std::max(statistics.getNumberOfRecords(sliceSize), 1.0);
+
+    /// Each radix partition has its own hash map and receives an equal share of the keys
+    const auto numberOfHashMaps = static_cast<double>(std::max<uint64_t>(numberOfRadixPartitions, 1));
+    const auto keysPerHashMap = static_cast<uint64_t>(std::ceil(numberOfKeys / numberOfHashMaps));
+    const auto recordsPerKey = static_cast<uint64_t>(std::ceil(numberOfRecords / numberOfKeys));
+    return {
+        .numberOfBuckets = std::bit_ceil(std::clamp<uint64_t>(keysPerHashMap, 1, MAX_NUMBER_OF_BUCKETS)),
+        .numberOfRecordsPerKey = std::clamp<uint64_t>(recordsPerKey, 1, MAX_NUMBER_OF_RECORDS_PER_KEY)};
+}
+}
@@ -19,6 +19,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
@@ -120,9 +121,12 @@ lowerOperatorRecursively(const LogicalOperator& logicalOperator, const RewriteRu
     return root;
 }
 
-PhysicalPlan apply(const LogicalPlan& queryPlan, const QueryExecutionConfiguration& conf) /// NOLINT
+PhysicalPlan apply(
+    const LogicalPlan& queryPlan,
+    const QueryExecutionConfiguration& conf,
+    const std::shared_ptr<JoinStatisticsStore>& joinStatistics) /// NOLINT
 {
-    const auto registryArgument = RewriteRuleRegistryArguments{conf};
+    const auto registryArgument = RewriteRuleRegistryArguments{.conf = conf, .joinStatistics = joinStatistics};
     std::vector<std::shared_ptr<PhysicalOperatorWrapper>> newRootOperators;
     newRootOperators.reserve(queryPlan.getRootOperators().size());
     for (const auto& logicalRoot : queryPlan.getRootOperators())
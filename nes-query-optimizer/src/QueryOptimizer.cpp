@@ -14,6 +14,8 @@
 
 #include <QueryOptimizer.hpp>
 
+#include <memory>
+#include <Join/JoinStatisticsStore.hpp>
 #include <Phases/DecideJoinTypes.hpp>
 #include <Phases/LowerToPhysicalOperators.hpp>
 #include <Plans/LogicalPlan.hpp>
@@ -23,16 +25,36 @@ namespace NES
 {
 PhysicalPlan QueryOptimizer::optimize(const LogicalPlan& plan) const
 {
-    return optimize(plan, defaultQueryExecution);
+    return lower(decideImplementations(plan));
 }
 
 PhysicalPlan QueryOptimizer::optimize(const LogicalPlan& plan, const QueryExecutionConfiguration& defaultQueryExecution)
+{
+    const auto joinStatistics = std::make_shared<JoinStatisticsStore>();
+    return LowerToPhysicalOperators::apply(
+        decideImplementations(plan, defaultQueryExecution, joinStatistics), defaultQueryExecution, joinStatistics);
+}
+
+LogicalPlan QueryOptimizer::decideImplementations(const LogicalPlan& plan) const
+{
+    return decideImplementations(plan, defaultQueryExecution, joinStatistics);
+}
+
+PhysicalPlan QueryOptimizer::lower(const LogicalPlan& planWithImplementations) const
+{
+    return LowerToPhysicalOperators::apply(planWithImplementations, defaultQueryExecution, joinStatistics);
+}
+
+LogicalPlan QueryOptimizer::decideImplementations(
+    const LogicalPlan& plan,
+    const QueryExecutionConfiguration& defaultQueryExecution,
+    const std::shared_ptr<const JoinStatisticsStore>& joinStatistics)
 {
     /// In the future, we will have a real rule matching engine / rule driver for our optimizer.
     /// For now, we just decide the join type (if one exists in the query) and lower to physical operators in a pure function.
-    DecideJoinTypes joinTypeDecider(defaultQueryExecution.joinStrategy);
-    const auto optimizedPlan = joinTypeDecider.apply(plan);
-    return LowerToPhysicalOperators::apply(optimizedPlan, defaultQueryExecution);
+    DecideJoinTypes joinTypeDecider(
+        defaultQueryExecution.joinStrategy, joinStatistics, defaultQueryExecution.numberOfRadixPartitions.getValue());
+    return joinTypeDecider.apply(plan);
 }
 
 }
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <tuple>
@@ -43,9 +44,13 @@
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Phases/JoinCostModel.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
-#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <Runtime/SpillStore.hpp>
+#include <SliceStore/SliceStoreProvider.hpp>
+#include <Traits/HashJoinSizeTrait.hpp>
+#include <Traits/Trait.hpp>
 #include <Util/Common.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Watermark/TimeFunction.hpp>
@@ -180,8 +185,11 @@ addMapOperators(const Schema& inputSchemaOfJoin, const std::vector<FieldNamesExt
     return {inputSchemaOfMap, mapPhysicalOperators};
 }
 
-HashMapOptions
-createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Schema& inputSchema, const QueryExecutionConfiguration& conf)
+HashMapOptions createHashMapOptions(
+    std::vector<FieldNamesExtension>& joinFieldExtensions,
+    Schema& inputSchema,
+    const QueryExecutionConfiguration& conf,
+    const std::optional<HashJoinSizeTrait::HashMapSize>& estimatedSize)
 {
     uint64_t keySize = 0;
     constexpr auto valueSize = sizeof(Nautilus::Interface::PagedVector);
@@ -201,8 +209,13 @@ createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Sche
         fieldKeyNames.emplace_back(fieldExtension.newName);
     }
 
+    /// Each worker thread has one hash map per radix partition. Thus, a hash map solely needs a fraction of the configured buckets.
+    /// If we know the number of keys from previous joins over the same input, we size the buckets accordingly.
     const auto pageSize = conf.pageSize.getValue();
-    const auto numberOfBuckets = conf.numberOfPartitions.getValue();
+    const auto numberOfRadixPartitions = std::max<uint64_t>(conf.numberOfRadixPartitions.getValue(), 1);
+    const auto numberOfBuckets = estimatedSize.has_value()
+        ? estimatedSize->numberOfBuckets
+        : std::max<uint64_t>(conf.numberOfPartitions.getValue() / numberOfRadixPartitions, 1);
     const auto entrySize = sizeof(Nautilus::Interface::ChainedHashMapEntry) + keySize + valueSize;
     const auto entriesPerPage = pageSize / entrySize;
 
@@ -219,7 +232,8 @@ createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Sche
         keySize,
         valueSize,
         pageSize,
-        numberOfBuckets};
+        numberOfBuckets,
+        conf.hashMapType.getValue()};
     return hashMapOptions;
 }
 }
@@ -249,19 +263,40 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
         = getJoinFieldExtensionsLeftRight(join.getLeftSchema(), join.getRightSchema(), logicalJoinFunction);
     auto [newLeftInputSchema, leftMapOperators] = addMapOperators(join.getLeftSchema(), leftJoinFields);
     auto [newRightInputSchema, rightMapOperators] = addMapOperators(join.getRightSchema(), rightJoinFields);
+
+    /// The sizes that the optimizer estimated from previous hash joins over the same inputs replace the configured guesses for the records
+    /// per key and buckets. We do not read the statistics here, as they might have changed since the optimizer decided the join type.
+    const auto numberOfRadixPartitions = std::max<uint64_t>(conf.numberOfRadixPartitions.getValue(), 1);
+    const auto hashJoinSize = getTrait<HashJoinSizeTrait>(logicalOperator.getTraitSet());
+    const auto leftEstimatedSize = hashJoinSize.transform([](const auto& size) { return size.leftSize; });
+    const auto rightEstimatedSize = hashJoinSize.transform([](const auto& size) { return size.rightSize; });
+    const auto leftRecordsPerKey
+        = leftEstimatedSize.has_value() ? leftEstimatedSize->numberOfRecordsPerKey : conf.numberOfRecordsPerKey.getValue();
+    const auto rightRecordsPerKey
+        = rightEstimatedSize.has_value() ? rightEstimatedSize->numberOfRecordsPerKey : conf.numberOfRecordsPerKey.getValue();
     auto leftMemoryProvider = Interface::MemoryProvider::TupleBufferMemoryProvider::create(
-        conf.numberOfRecordsPerKey.getValue() * newLeftInputSchema.getSizeOfSchemaInBytes(), newLeftInputSchema);
+        leftRecordsPerKey * newLeftInputSchema.getSizeOfSchemaInBytes(), newLeftInputSchema);
     auto rightMemoryProvider = Interface::MemoryProvider::TupleBufferMemoryProvider::create(
-        conf.numberOfRecordsPerKey.getValue() * newRightInputSchema.getSizeOfSchemaInBytes(), newRightInputSchema);
-    auto leftHashMapOptions = createHashMapOptions(leftJoinFields, newLeftInputSchema, conf);
-    auto rightHashMapOptions = createHashMapOptions(rightJoinFields, newRightInputSchema, conf);
+        rightRecordsPerKey * newRightInputSchema.getSizeOfSchemaInBytes(), newRightInputSchema);
+    auto leftHashMapOptions = createHashMapOptions(leftJoinFields, newLeftInputSchema, conf, leftEstimatedSize);
+    auto rightHashMapOptions = createHashMapOptions(rightJoinFields, newRightInputSchema, conf, rightEstimatedSize);
 
     /// Creating the left and right hash join build operator
     auto handlerId = getNextOperatorHandlerId();
     const HJBuildPhysicalOperator leftBuildOperator{
-        handlerId, JoinBuildSideType::Left, timeStampFieldLeft.toTimeFunction(), leftMemoryProvider, leftHashMapOptions};
+        handlerId,
+        JoinBuildSideType::Left,
+        timeStampFieldLeft.toTimeFunction(),
+        leftMemoryProvider,
+        leftHashMapOptions,
+        numberOfRadixPartitions};
     const HJBuildPhysicalOperator rightBuildOperator{
-        handlerId, JoinBuildSideType::Right, timeStampFieldRight.toTimeFunction(), rightMemoryProvider, rightHashMapOptions};
+        handlerId,
+        JoinBuildSideType::Right,
+        timeStampFieldRight.toTimeFunction(),
+        rightMemoryProvider,
+        rightHashMapOptions,
+        numberOfRadixPartitions};
 
     /// Creating the hash join probe
     auto joinSchema = JoinSchema(newLeftInputSchema, newRightInputSchema, outputSchema);
@@ -273,13 +308,24 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
         leftMemoryProvider,
         rightMemoryProvider,
         leftHashMapOptions,
-        rightHashMapOptions);
+        rightHashMapOptions,
+        numberOfRadixPartitions);
 
 
     /// Creating the hash join operator handler
     auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
-    auto handler = std::make_shared<HJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore));
+        = provideSliceStore(conf.sliceStoreType.getValue(), windowType->getSize().getTime(), windowType->getSlide().getTime());
+    auto handler = std::make_shared<HJOperatorHandler>(
+        inputOriginIds,
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        numberOfRadixPartitions,
+        joinStatistics,
+        JoinCostModel::getStatisticsKeys(join));
+    if (conf.operatorStateMemoryBudget.getValue() > 0)
+    {
+        handler->setSpilling(std::make_shared<FileSpillStore>(conf.spillDirectory.getValue()), conf.operatorStateMemoryBudget.getValue());
+    }
 
 
     /// Building operator wrapper for the two builds and the probe.
@@ -334,7 +380,7 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
 std::unique_ptr<AbstractRewriteRule>
 RewriteRuleGeneratedRegistrar::RegisterHashJoinRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
 {
-    return std::make_unique<LowerToPhysicalHashJoin>(argument.conf);
+    return std::make_unique<LowerToPhysicalHashJoin>(argument.conf, argument.joinStatistics);
 }
 
 }
@@ -36,7 +36,8 @@
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
-#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <Runtime/SpillStore.hpp>
+#include <SliceStore/SliceStoreProvider.hpp>
 #include <Util/Common.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Watermark/TimeFunction.hpp>
@@ -101,8 +102,13 @@ RewriteRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalOp
         = NLJProbePhysicalOperator(handlerId, joinFunction, join.getWindowMetaData(), joinSchema, leftMemoryProvider, rightMemoryProvider);
 
     auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
-    auto handler = std::make_shared<NLJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore));
+        = provideSliceStore(conf.sliceStoreType.getValue(), windowType->getSize().getTime(), windowType->getSlide().getTime());
+    auto handler = std::make_shared<NLJOperatorHandler>(
+        inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), conf.minNumberOfTuplesPerNLJTile.getValue());
+    if (conf.operatorStateMemoryBudget.getValue() > 0)
+    {
+        handler->setSpilling(std::make_shared<FileSpillStore>(conf.spillDirectory.getValue()), conf.operatorStateMemoryBudget.getValue());
+    }
 
     auto leftBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
         std::move(leftBuildOperator), leftInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
@@ -14,6 +14,7 @@
 
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalWindowedAggregation.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <numeric>
@@ -34,10 +35,11 @@
 #include <Nautilus/Interface/MemoryProvider/ColumnTupleBufferMemoryProvider.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/Aggregations/QuantileAggregationLogicalFunction.hpp>
 #include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
-#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/SliceStoreProvider.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
@@ -125,6 +127,10 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
             std::move(aggregationInputFunction),
             resultFieldIdentifier,
             memoryProvider);
+        if (const auto quantileDescriptor = std::dynamic_pointer_cast<QuantileAggregationLogicalFunction>(descriptor))
+        {
+            aggregationArguments.quantile = quantileDescriptor->getQuantile();
+        }
         if (auto aggregationPhysicalFunction
             = AggregationPhysicalFunctionRegistry::instance().create(std::string(name), std::move(aggregationArguments)))
         {
@@ -178,7 +184,9 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
         keySize += DataTypeProvider::provideDataType(loweredFunctionType.type).getSizeInBytes();
     }
     const auto entrySize = sizeof(Interface::ChainedHashMapEntry) + keySize + valueSize;
-    const auto numberOfBuckets = conf.numberOfPartitions.getValue();
+    /// Each radix partition has its own hash maps. Thus, we divide the buckets among the partitions, as the hash join does.
+    const auto numberOfRadixPartitions = std::max<uint64_t>(conf.numberOfRadixPartitions.getValue(), 1);
+    const auto numberOfBuckets = std::max<uint64_t>(conf.numberOfPartitions.getValue() / numberOfRadixPartitions, 1);
     const auto pageSize = conf.pageSize.getValue();
     const auto entriesPerPage = pageSize / entrySize;
 
@@ -198,13 +206,20 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
         keySize,
         valueSize,
         pageSize,
-        numberOfBuckets);
+        numberOfBuckets,
+        conf.hashMapType.getValue());
 
     auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
-    auto handler = std::make_shared<AggregationOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore));
-    auto build = AggregationBuildPhysicalOperator(handlerId, std::move(timeFunction), aggregationPhysicalFunctions, hashMapOptions);
-    auto probe = AggregationProbePhysicalOperator(hashMapOptions, aggregationPhysicalFunctions, handlerId, windowMetaData);
+        = provideSliceStore(conf.sliceStoreType.getValue(), windowType->getSize().getTime(), windowType->getSlide().getTime());
+    auto handler = std::make_shared<AggregationOperatorHandler>(
+        inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), numberOfRadixPartitions);
+    auto build = AggregationBuildPhysicalOperator(
+        handlerId, std::move(timeFunction), aggregationPhysicalFunctions, hashMapOptions, numberOfRadixPartitions);
+
+    /// Only for sliding windows, a slice belongs to multiple windows. Only then, caching the combined hash maps of a slice pays off.
+    const auto cacheSlicePartials = windowType->getSlide().getTime() < windowType->getSize().getTime();
+    auto probe
+        = AggregationProbePhysicalOperator(hashMapOptions, aggregationPhysicalFunctions, handlerId, windowMetaData, cacheSlicePartials);
 
     auto buildWrapper = std::make_shared<PhysicalOperatorWrapper>(
         build, newInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
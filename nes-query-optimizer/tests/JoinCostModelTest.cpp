@@ -0,0 +1,234 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Phases/JoinCostModel.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Join/JoinStatisticsStore.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Sinks/SinkLogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Phases/DecideJoinTypes.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <Traits/HashJoinSizeTrait.hpp>
+#include <Traits/ImplementationTypeTrait.hpp>
+#include <Traits/Trait.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Measures/TimeMeasure.hpp>
+#include <WindowTypes/Types/TumblingWindow.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <QueryExecutionConfiguration.hpp>
+
+namespace NES
+{
+
+class JoinCostModelTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("JoinCostModelTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup JoinCostModelTest class.");
+    }
+
+    static constexpr uint64_t WINDOW_SIZE_IN_MS = 1000;
+
+    /// Creates the join left$id = right$id over a tumbling window
+    static LogicalOperator createJoin()
+    {
+        const auto leftSchema = Schema{}.addField("left$id", DataType::Type::UINT64).addField("left$value", DataType::Type::UINT64);
+        const auto rightSchema = Schema{}.addField("right$id", DataType::Type::UINT64).addField("right$value", DataType::Type::UINT64);
+        const auto windowType = std::make_shared<Windowing::TumblingWindow>(
+            Windowing::TimeCharacteristic::createIngestionTime(), Windowing::TimeMeasure(WINDOW_SIZE_IN_MS));
+        return JoinLogicalOperator(
+                   EqualsLogicalFunction(FieldAccessLogicalFunction("left$id"), FieldAccessLogicalFunction("right$id")),
+                   windowType,
+                   JoinLogicalOperator::JoinType::INNER_JOIN)
+            .withInferredSchema({leftSchema, rightSchema});
+    }
+
+    /// Returns the join implementation that DecideJoinTypes chooses for the join
+    static JoinImplementation
+    decideJoinImplementation(const StreamJoinStrategy joinStrategy, const std::shared_ptr<const JoinStatisticsStore>& joinStatistics)
+    {
+        const auto plan = LogicalPlan(SinkLogicalOperator().withChildren({createJoin()}));
+        const auto planWithJoinTypes = DecideJoinTypes(joinStrategy, joinStatistics).apply(plan);
+        const auto join = planWithJoinTypes.getRootOperators().front().getChildren().front();
+        for (const auto& trait : join.getTraitSet())
+        {
+            if (const auto implementationType = trait.tryGet<ImplementationTypeTrait>())
+            {
+                return implementationType->implementationType;
+            }
+        }
+        ADD_FAILURE() << "The join has no implementation type";
+        return JoinImplementation::NESTED_LOOP_JOIN;
+    }
+
+    /// Reports the statistics of both inputs of the join to a new store
+    static std::shared_ptr<JoinStatisticsStore> createStore(const JoinInputStatistics& left, const JoinInputStatistics& right)
+    {
+        auto store = std::make_shared<JoinStatisticsStore>();
+        const auto [leftKey, rightKey] = JoinCostModel::getStatisticsKeys(createJoin().get<JoinLogicalOperator>());
+        store->update(leftKey, left);
+        store->update(rightKey, right);
+        return store;
+    }
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(JoinCostModelTest, statisticsKeysIdentifyTheInputAndTheInputItIsJoinedWith)
+{
+    const auto [leftKey, rightKey] = JoinCostModel::getStatisticsKeys(createJoin().get<JoinLogicalOperator>());
+    EXPECT_EQ(leftKey, JoinStatisticsStore::createInputKey({"left$id"}, {"right$id"}));
+    EXPECT_EQ(rightKey, JoinStatisticsStore::createInputKey({"right$id"}, {"left$id"}));
+}
+
+TEST_F(JoinCostModelTest, statisticsRequireBothInputsOfTheSameJoin)
+{
+    const auto join = createJoin().get<JoinLogicalOperator>();
+    JoinStatisticsStore store;
+    store.update(JoinStatisticsStore::createInputKey({"left$id"}, {"right$id"}), {.recordsPerSecond = 100, .distinctKeysPerSecond = 10});
+    EXPECT_FALSE(JoinCostModel::getStatistics(store, join).has_value());
+
+    /// Statistics of the right input in a join with another source do not apply
+    store.update(JoinStatisticsStore::createInputKey({"right$id"}, {"other$id"}), {.recordsPerSecond = 200, .distinctKeysPerSecond = 20});
+    EXPECT_FALSE(JoinCostModel::getStatistics(store, join).has_value());
+
+    store.update(JoinStatisticsStore::createInputKey({"right$id"}, {"left$id"}), {.recordsPerSecond = 300, .distinctKeysPerSecond = 30});
+    const auto statistics = JoinCostModel::getStatistics(store, join);
+    ASSERT_TRUE(statistics.has_value());
+    EXPECT_DOUBLE_EQ(statistics->at(0).recordsPerSecond, 100);
+    EXPECT_DOUBLE_EQ(statistics->at(1).recordsPerSecond, 300);
+}
+
+TEST_F(JoinCostModelTest, nestedLoopJoinIsCheaperForWindowsWithFewRecords)
+{
+    const JoinInputStatistics fewRecords{.recordsPerSecond = 10, .distinctKeysPerSecond = 10};
+    const JoinInputStatistics manyRecords{.recordsPerSecond = 10000, .distinctKeysPerSecond = 100};
+
+    /// 10 * 10 comparisons are cheaper than building and probing the hash maps for 20 records
+    EXPECT_TRUE(JoinCostModel::isNestedLoopJoinCheaper({fewRecords, fewRecords}, 1000));
+    EXPECT_FALSE(JoinCostModel::isNestedLoopJoinCheaper({manyRecords, manyRecords}, 1000));
+    /// A single small input already makes the comparisons cheaper: 10 * 10000 comparisons against hashing 10010 records
+    EXPECT_TRUE(JoinCostModel::isNestedLoopJoinCheaper({fewRecords, manyRecords}, 1000));
+    /// Larger windows contain more records, which makes the comparisons of all pairs of records more expensive
+    EXPECT_FALSE(JoinCostModel::isNestedLoopJoinCheaper({fewRecords, fewRecords}, 100000));
+}
+
+TEST_F(JoinCostModelTest, optimizerChoosesTheCheaperJoinImplementation)
+{
+    const JoinInputStatistics fewRecordsPerInput{.recordsPerSecond = 10, .distinctKeysPerSecond = 10};
+    const JoinInputStatistics manyRecordsPerInput{.recordsPerSecond = 10000, .distinctKeysPerSecond = 100};
+    const auto fewRecords = createStore(fewRecordsPerInput, fewRecordsPerInput);
+    const auto manyRecords = createStore(manyRecordsPerInput, manyRecordsPerInput);
+
+    EXPECT_EQ(decideJoinImplementation(StreamJoinStrategy::OPTIMIZER_CHOOSES, fewRecords), JoinImplementation::NESTED_LOOP_JOIN);
+    EXPECT_EQ(decideJoinImplementation(StreamJoinStrategy::OPTIMIZER_CHOOSES, manyRecords), JoinImplementation::HASH_JOIN);
+
+    /// Without statistics, the optimizer falls back to the shape of the join function
+    EXPECT_EQ(decideJoinImplementation(StreamJoinStrategy::OPTIMIZER_CHOOSES, nullptr), JoinImplementation::HASH_JOIN);
+    EXPECT_EQ(
+        decideJoinImplementation(StreamJoinStrategy::OPTIMIZER_CHOOSES, std::make_shared<JoinStatisticsStore>()),
+        JoinImplementation::HASH_JOIN);
+
+    /// Forced strategies ignore the statistics
+    EXPECT_EQ(decideJoinImplementation(StreamJoinStrategy::HASH_JOIN, fewRecords), JoinImplementation::HASH_JOIN);
+    EXPECT_EQ(decideJoinImplementation(StreamJoinStrategy::NESTED_LOOP_JOIN, manyRecords), JoinImplementation::NESTED_LOOP_JOIN);
+}
+
+TEST_F(JoinCostModelTest, hashMapsOfEachBuildSideAreSizedFromItsOwnStatistics)
+{
+    const auto store = createStore(
+        {.recordsPerSecond = 100000, .distinctKeysPerSecond = 10000}, {.recordsPerSecond = 1000, .distinctKeysPerSecond = 1000});
+    const auto statistics = JoinCostModel::getStatistics(*store, createJoin().get<JoinLogicalOperator>());
+    ASSERT_TRUE(statistics.has_value());
+
+    /// 10000 keys per slice are spread over four radix partitions and rounded up to the next power of two
+    const auto leftSize = JoinCostModel::estimateHashMapSize(statistics->at(0), 1000, 4);
+    EXPECT_EQ(leftSize.numberOfBuckets, 4096U);
+    EXPECT_EQ(leftSize.numberOfRecordsPerKey, 10U);
+
+    const auto rightSize = JoinCostModel::estimateHashMapSize(statistics->at(1), 1000, 4);
+    EXPECT_EQ(rightSize.numberOfBuckets, 256U);
+    EXPECT_EQ(rightSize.numberOfRecordsPerKey, 1U);
+
+    /// Shorter slices contain fewer keys
+    EXPECT_EQ(JoinCostModel::estimateHashMapSize(statistics->at(0), 100, 4).numberOfBuckets, 256U);
+}
+
+TEST_F(JoinCostModelTest, hashMapSizeIsBounded)
+{
+    const auto manyKeys = JoinCostModel::estimateHashMapSize({.recordsPerSecond = 1e12, .distinctKeysPerSecond = 1e12}, 1000, 1);
+    EXPECT_EQ(manyKeys.numberOfBuckets, JoinCostModel::MAX_NUMBER_OF_BUCKETS);
+    EXPECT_EQ(manyKeys.numberOfRecordsPerKey, 1U);
+
+    const auto manyRecordsPerKey = JoinCostModel::estimateHashMapSize({.recordsPerSecond = 1e12, .distinctKeysPerSecond = 1}, 1000, 1);
+    EXPECT_EQ(manyRecordsPerKey.numberOfBuckets, 1U);
+    EXPECT_EQ(manyRecordsPerKey.numberOfRecordsPerKey, JoinCostModel::MAX_NUMBER_OF_RECORDS_PER_KEY);
+
+    const auto noRecords = JoinCostModel::estimateHashMapSize({}, 1000, 0);
+    EXPECT_EQ(noRecords.numberOfBuckets, 1U);
+    EXPECT_EQ(noRecords.numberOfRecordsPerKey, 1U);
+}
+
+TEST_F(JoinCostModelTest, changedStatisticsChangeThePlanOfAResubmittedQuery)
+{
+    /// The compiled code of a query is cached for its plan with the decided implementations. Thus, once the statistics of running hash
+    /// joins change the join type or the sizes of the hash maps, a resubmitted query must get a different plan.
+    const auto store = std::make_shared<JoinStatisticsStore>();
+    const auto [leftKey, rightKey] = JoinCostModel::getStatisticsKeys(createJoin().get<JoinLogicalOperator>());
+    const auto submit = [&](const JoinInputStatistics& statistics)
+    {
+        store->clear();
+        store->update(leftKey, statistics);
+        store->update(rightKey, statistics);
+        const auto plan = LogicalPlan(SinkLogicalOperator().withChildren({createJoin()}));
+        return DecideJoinTypes(StreamJoinStrategy::OPTIMIZER_CHOOSES, store, 4).apply(plan);
+    };
+    const auto getJoinTraits = [](const LogicalPlan& plan) { return plan.getRootOperators().front().getChildren().front().getTraitSet(); };
+
+    const auto hashJoinPlan = submit({.recordsPerSecond = 10000, .distinctKeysPerSecond = 1000});
+    EXPECT_EQ(getTrait<ImplementationTypeTrait>(getJoinTraits(hashJoinPlan))->implementationType, JoinImplementation::HASH_JOIN);
+    const auto hashJoinSize = getTrait<HashJoinSizeTrait>(getJoinTraits(hashJoinPlan));
+    ASSERT_TRUE(hashJoinSize.has_value());
+    EXPECT_EQ(hashJoinSize->leftSize.numberOfBuckets, 256U);
+    EXPECT_EQ(hashJoinSize->rightSize.numberOfRecordsPerKey, 10U);
+    EXPECT_EQ(submit({.recordsPerSecond = 10000, .distinctKeysPerSecond = 1000}), hashJoinPlan);
+
+    /// The statistics flip the join type
+    const auto nestedLoopJoinPlan = submit({.recordsPerSecond = 10, .distinctKeysPerSecond = 10});
+    EXPECT_EQ(
+        getTrait<ImplementationTypeTrait>(getJoinTraits(nestedLoopJoinPlan))->implementationType, JoinImplementation::NESTED_LOOP_JOIN);
+    EXPECT_FALSE(getTrait<HashJoinSizeTrait>(getJoinTraits(nestedLoopJoinPlan)).has_value());
+    EXPECT_NE(nestedLoopJoinPlan, hashJoinPlan);
+
+    /// The statistics keep the join type but change the sizes of the hash maps
+    const auto largerHashJoinPlan = submit({.recordsPerSecond = 100000, .distinctKeysPerSecond = 10000});
+    EXPECT_EQ(getTrait<ImplementationTypeTrait>(getJoinTraits(largerHashJoinPlan))->implementationType, JoinImplementation::HASH_JOIN);
+    EXPECT_NE(largerHashJoinPlan, hashJoinPlan);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
@@ -0,0 +1,147 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <benchmark/benchmark.h>
+#include <ExecutionContext.hpp>
+
+/// This Benchmark compares creating a new arena for every task, as the CompiledExecutablePipelineStage did before, with reusing one arena
+/// per worker thread that gets reset after each task. The argument is the number of scratch bytes a task allocates in chunks of 64 bytes.
+/// We emulate the ArenaRef of the compiled code, which takes the memory from the arena and hands it out until it is used up.
+/// Besides the throughput, the benchmark reports the number of calls to the buffer manager per task.
+
+namespace
+{
+constexpr size_t NUMBER_OF_TASKS = 100 * 1000;
+constexpr size_t CHUNK_SIZE = 64;
+constexpr uint32_t BUFFER_SIZE = 4096;
+constexpr uint32_t NUMBER_OF_BUFFERS = 1024;
+
+/// Forwards to the buffer manager and counts the calls
+class CountingBufferProvider final : public NES::AbstractBufferProvider
+{
+public:
+    explicit CountingBufferProvider(std::shared_ptr<NES::BufferManager> bufferManager) : bufferManager(std::move(bufferManager)) { }
+
+    void destroy() override { bufferManager->destroy(); }
+
+    NES::BufferManagerType getBufferManagerType() const override { return bufferManager->getBufferManagerType(); }
+
+    size_t getBufferSize() const override { return bufferManager->getBufferSize(); }
+
+    size_t getNumOfPooledBuffers() const override { return bufferManager->getNumOfPooledBuffers(); }
+
+    size_t getNumOfUnpooledBuffers() const override { return bufferManager->getNumOfUnpooledBuffers(); }
+
+    NES::TupleBuffer getBufferBlocking() override
+    {
+        ++numberOfCalls;
+        return bufferManager->getBufferBlocking();
+    }
+
+    std::optional<NES::TupleBuffer> getBufferNoBlocking() override
+    {
+        ++numberOfCalls;
+        return bufferManager->getBufferNoBlocking();
+    }
+
+    std::optional<NES::TupleBuffer> getBufferWithTimeout(const std::chrono::milliseconds timeoutMs) override
+    {
+        ++numberOfCalls;
+        return bufferManager->getBufferWithTimeout(timeoutMs);
+    }
+
+    std::optional<NES::TupleBuffer> getUnpooledBuffer(const size_t bufferSize) override
+    {
+        ++numberOfCalls;
+        return bufferManager->getUnpooledBuffer(bufferSize);
+    }
+
+    uint64_t numberOfCalls = 0;
+
+private:
+    std::shared_ptr<NES::BufferManager> bufferManager;
+};
+
+/// Allocates the scratch memory of one task like the ArenaRef does
+void runTask(NES::Arena& arena, const size_t scratchBytes)
+{
+    int8_t* spacePointer = nullptr;
+    size_t availableSpace = 0;
+    for (size_t allocated = 0; allocated < scratchBytes; allocated += CHUNK_SIZE)
+    {
+        if (availableSpace < CHUNK_SIZE)
+        {
+            spacePointer = arena.allocateMemory(CHUNK_SIZE);
+            availableSpace = arena.lastAllocationSize;
+        }
+        *spacePointer = 1;
+        benchmark::DoNotOptimize(spacePointer);
+        spacePointer += CHUNK_SIZE;
+        availableSpace -= CHUNK_SIZE;
+    }
+}
+
+void reportCalls(benchmark::State& state, const CountingBufferProvider& bufferProvider)
+{
+    state.counters["BufferManagerCallsPerTask"]
+        = static_cast<double>(bufferProvider.numberOfCalls) / static_cast<double>(state.iterations() * NUMBER_OF_TASKS);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUMBER_OF_TASKS));
+}
+}
+
+static void BM_ArenaPerTask(benchmark::State& state)
+{
+    const auto scratchBytes = static_cast<size_t>(state.range(0));
+    const auto bufferProvider = std::make_shared<CountingBufferProvider>(NES::BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS));
+    for (auto _ : state)
+    {
+        for (size_t task = 0; task < NUMBER_OF_TASKS; ++task)
+        {
+            NES::Arena arena(bufferProvider);
+            runTask(arena, scratchBytes);
+        }
+    }
+    reportCalls(state, *bufferProvider);
+}
+
+static void BM_ReusedArena(benchmark::State& state)
+{
+    const auto scratchBytes = static_cast<size_t>(state.range(0));
+    const auto bufferProvider = std::make_shared<CountingBufferProvider>(NES::BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS));
+    for (auto _ : state)
+    {
+        NES::Arena arena(bufferProvider);
+        for (size_t task = 0; task < NUMBER_OF_TASKS; ++task)
+        {
+            runTask(arena, scratchBytes);
+            arena.reset();
+        }
+    }
+    reportCalls(state, *bufferProvider);
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_ArenaPerTask)->Arg(64)->Arg(1024)->Arg(16 * 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReusedArena)->Arg(64)->Arg(1024)->Arg(16 * 1024)->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
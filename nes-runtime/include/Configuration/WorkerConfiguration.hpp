@@ -44,6 +44,19 @@ public:
            "Number buffers in global buffer pool.",
            {std::make_shared<NumberValidation>()}};
 
+    /// Splits the global buffer pool into one pool per NUMA node. Buffers are served from the pool of the requesting thread's node first.
+    BoolOption numaAwareBufferManager
+        = {"numa_aware_buffer_manager",
+           "false",
+           "Allocates one buffer pool per NUMA node and serves buffers from the pool of the requesting thread's node first."};
+
+    /// Number of free buffers each thread may keep in a local cache in front of the global buffer pool. Reduces contention on the pool.
+    UIntOption bufferManagerThreadLocalCacheSize
+        = {"buffer_manager_thread_local_cache_size",
+           "0",
+           "Maximum number of free buffers cached per thread in front of the global buffer pool. 0 disables the caches.",
+           {std::make_shared<NumberValidation>()}};
+
     /// Configures the buffer size of individual TupleBuffers in bytes. This property has to be the same over a whole deployment.
     UIntOption bufferSizeInBytes
         = {"buffer_size_in_bytes",
@@ -52,6 +65,7 @@ public:
            {std::make_shared<NumberValidation>()}};
 
     /// Indicates how many buffers a single data source can allocate. This property controls the backpressure mechanism as a data source that can't allocate new records can't ingest more data.
+    /// The query engine lowers the number of inflight buffers of a source below this limit, if the downstream tasks cannot keep up.
     UIntOption defaultMaxInflightBuffers
         = {"default_max_inflight_buffers",
            "64",
@@ -59,11 +73,25 @@ public:
            "SourceDescriptor).",
            {std::make_shared<NumberValidation>()}};
 
+    /// Sources that support non-blocking reads (TCP, File) share a few I/O threads instead of running in a thread of their own.
+    UIntOption numberOfSourceIOThreads
+        = {"number_of_source_io_threads",
+           "0",
+           "Number of I/O threads that multiplex the sources that support non-blocking reads. 0 runs every source in its own thread.",
+           {std::make_shared<NumberValidation>()}};
+
     EnumOption<DumpMode> dumpQueryCompilationIntermediateRepresentations
         = {"dump_compilation_result",
            DumpMode::NONE,
            fmt::format("If and where to dump query compilation results: {}", enumPipeList<DumpMode>())};
 
+    /// Number of compiled pipelines kept in a process-wide cache. Resubmitting a query with the same plan reuses its compiled pipelines.
+    UIntOption compiledPipelineCacheSize
+        = {"compiled_pipeline_cache_size",
+           "0",
+           "Number of compiled pipelines that are kept for reuse by structurally equal queries. 0 disables the cache.",
+           {std::make_shared<NumberValidation>()}};
+
 private:
     std::vector<BaseOption*> getOptions() override
     {
@@ -71,9 +99,13 @@ private:
             &queryEngine,
             &defaultQueryExecution,
             &numberOfBuffersInGlobalBufferManager,
+            &numaAwareBufferManager,
+            &bufferManagerThreadLocalCacheSize,
             &defaultMaxInflightBuffers,
+            &numberOfSourceIOThreads,
             &bufferSizeInBytes,
-            &dumpQueryCompilationIntermediateRepresentations};
+            &dumpQueryCompilationIntermediateRepresentations,
+            &compiledPipelineCacheSize};
     }
 };
 }
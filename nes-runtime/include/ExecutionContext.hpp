@@ -46,21 +46,34 @@ using namespace Nautilus;
 /// The arena is a memory management system that provides memory to the operators during a pipeline invocation.
 /// As the memory is destroyed / returned to the arena after the pipeline invocation, the memory is not persistent and thus, it is not
 /// suitable for storing state across pipeline invocations. For storing state across pipeline invocations, the operator handler should be used.
+/// An arena can serve multiple consecutive pipeline invocations of the same worker thread. Calling reset() between two invocations makes
+/// its memory available again but keeps the buffers, so that most invocations do not need to request any buffer from the buffer provider.
 struct Arena
 {
     explicit Arena(std::shared_ptr<AbstractBufferProvider> bufferProvider) : bufferProvider(std::move(bufferProvider)) { }
 
-    /// Allocating memory by the buffer provider. There are three cases:
+    /// Allocating memory by the buffer provider. Afterward, lastAllocationSize contains the number of bytes that are available behind the
+    /// returned pointer. The caller may use all of them, as the next allocation starts in a new buffer. There are two cases:
     /// 1. The required size is larger than the buffer provider's buffer size. In this case, we allocate an unpooled buffer.
-    /// 2. The required size is larger than the last buffer size. In this case, we allocate a new buffer of fixed size.
-    /// 3. The required size is smaller than the last buffer size. In this case, we return the pointer to the address in the last buffer.
+    /// 2. Otherwise, we return the next fixed size buffer. We either reuse a buffer from a previous invocation or request a new one.
     int8_t* allocateMemory(size_t sizeInBytes);
 
+    /// Makes the memory of the arena available again. Returns the unpooled buffers and all fixed size buffers that have not been used since
+    /// the last reset, so that the arena shrinks to the working set of the last invocation.
+    /// If the buffer provider ran out of buffers since the last reset, the arena returns all of its buffers.
+    void reset();
+
+    /// Largest number of bytes allocated between two resets
+    [[nodiscard]] size_t getHighWaterMarkInBytes() const;
+
     std::shared_ptr<AbstractBufferProvider> bufferProvider;
     std::vector<TupleBuffer> fixedSizeBuffers;
     std::vector<TupleBuffer> unpooledBuffers;
     size_t lastAllocationSize{0};
-    size_t currentOffset{0};
+    size_t numberOfUsedFixedSizeBuffers{0};
+    size_t allocatedBytes{0};
+    size_t highWaterMarkInBytes{0};
+    bool underMemoryPressure{false};
 };
 
 /// Nautilus Wrapper for the Arena
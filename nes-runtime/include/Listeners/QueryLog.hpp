@@ -22,6 +22,7 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/AbstractQueryStatusListener.hpp>
 #include <Runtime/Execution/QueryStatus.hpp>
+#include <Runtime/QueryMemoryQuota.hpp>
 #include <Runtime/QueryTerminationType.hpp>
 #include <folly/Synchronized.h>
 #include <ErrorHandling.hpp>
@@ -35,6 +36,8 @@ struct QueryMetrics
     std::optional<std::chrono::system_clock::time_point> running;
     std::optional<std::chrono::system_clock::time_point> stop;
     std::optional<Exception> error;
+    /// Buffer memory that the query currently holds. Only present while the query or any of its buffers is alive.
+    std::optional<QueryMemoryUsage> memoryUsage;
 };
 
 /// Summary structure of the query log for a query
@@ -15,8 +15,11 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
+#include <Pipelines/CompiledPipelineCache.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <nautilus/Engine.hpp>
@@ -29,27 +32,41 @@ namespace NES
 class DumpHelper;
 
 /// A compiled executable pipeline stage uses nautilus-lib to compile a pipeline to a code snippet.
+/// If the stage has a fingerprint, it takes the compiled code from the CompiledPipelineCache.
 class CompiledExecutablePipelineStage final : public ExecutablePipelineStage
 {
 public:
     CompiledExecutablePipelineStage(
         std::shared_ptr<Pipeline> pipeline,
         std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandler,
-        nautilus::engine::Options options);
+        nautilus::engine::Options options,
+        std::optional<std::string> fingerprint = std::nullopt);
     void start(PipelineExecutionContext& pipelineExecutionContext) override;
     void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
     void stop(PipelineExecutionContext& pipelineExecutionContext) override;
+    [[nodiscard]] CompilationCacheResult getCompilationCacheResult() const override;
 
 protected:
     std::ostream& toString(std::ostream& os) const override;
 
 private:
-    [[nodiscard]] nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>
-    compilePipeline() const;
+    [[nodiscard]] CompiledPipelineCache::CompiledPipelineFunction compilePipeline() const;
+
+    [[nodiscard]] std::vector<OperatorHandlerId> getSortedOperatorHandlerIds() const;
+
+    /// Maps the operator handler ids, which the cached code has been compiled with, to the operator handlers of this stage
+    void setCompiledOperatorHandlers(const std::vector<OperatorHandlerId>& compiledOperatorHandlerIds);
+
     const nautilus::engine::Options options;
-    nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*> compiledPipelineFunction;
+    std::optional<std::string> fingerprint;
+    std::shared_ptr<CompiledPipelineCache::CompiledPipelineFunction> compiledPipelineFunction;
+    CompilationCacheResult compilationCacheResult = CompilationCacheResult::NOT_CACHED;
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+    /// Operator handlers by the ids that the compiled code refers to. They differ from operatorHandlers for code taken from the cache.
+    std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> compiledOperatorHandlers;
     std::shared_ptr<Pipeline> pipeline;
+    /// One arena per worker thread that is reused across the invocations of this pipeline, indexed by the WorkerThreadId
+    std::vector<std::unique_ptr<Arena>> workerArenas;
 };
 
 }
@@ -0,0 +1,100 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <nautilus/Engine.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Process-wide cache of compiled pipeline functions. Starting a query compiles each of its pipelines, which dominates the startup
+/// latency of short-running and repeatedly submitted queries. Pipelines are identified by a fingerprint that the query compiler derives
+/// from the normalized query plan, the position of the pipeline within the plan, and the compilation options.
+/// The compiled code refers to operator handlers by their OperatorHandlerId. Thus, each entry stores the ids of the operator handlers of
+/// the pipeline that has been compiled. Pipelines with the same fingerprint got their handlers assigned in the same order, which
+/// allows a pipeline taking the code from the cache to map the cached ids to its own handlers by their rank.
+/// Some operators pass a pointer to themselves into the compiled code. Therefore, each entry keeps the operators of the compiled pipeline.
+/// Concurrent requests for the same fingerprint compile the pipeline only once. The cache evicts the least recently used entry once it
+/// holds more than the configured number of entries. A capacity of 0 disables the cache.
+class CompiledPipelineCache
+{
+public:
+    using CompiledPipelineFunction = nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>;
+
+    struct Entry
+    {
+        std::shared_ptr<CompiledPipelineFunction> function;
+        /// Sorted ids of the operator handlers of the pipeline that has been compiled
+        std::vector<OperatorHandlerId> operatorHandlerIds;
+        /// Root operator of the pipeline that has been compiled. Keeps the operators alive, which the compiled code points to.
+        PhysicalOperator rootOperator;
+    };
+
+    struct Statistics
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    static CompiledPipelineCache& instance();
+
+    void setCapacity(size_t numberOfEntries);
+
+    /// Returns the entry for the fingerprint and true, if it was already in the cache. Otherwise, calls compile, stores its result,
+    /// and returns it together with false. If the cache is disabled, compile is called without touching the cache.
+    std::pair<std::shared_ptr<const Entry>, bool> getOrCompile(const std::string& fingerprint, const std::function<Entry()>& compile);
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+    void clear();
+
+private:
+    CompiledPipelineCache() = default;
+
+    struct CachedEntry
+    {
+        std::shared_future<std::shared_ptr<const Entry>> entry;
+        std::list<std::string>::iterator positionInLru;
+        /// Identifies the compilation that created the entry
+        uint64_t compilationId;
+    };
+
+    mutable std::mutex mutex;
+    size_t capacity = 0;
+    std::unordered_map<std::string, CachedEntry> entries;
+    /// Fingerprints from the most to the least recently used
+    std::list<std::string> lru;
+    Statistics statistics;
+    uint64_t nextCompilationId = 0;
+};
+
+}
@@ -13,9 +13,11 @@
 */
 #include <ExecutionContext.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
@@ -63,28 +65,43 @@ int8_t* Arena::allocateMemory(const size_t sizeInBytes)
         }
         unpooledBuffers.emplace_back(unpooledBufferOpt.value());
         lastAllocationSize = sizeInBytes;
+        allocatedBytes += sizeInBytes;
         return unpooledBuffers.back().getBuffer<int8_t>();
     }
 
-    if (fixedSizeBuffers.empty())
-    {
-        fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
-        lastAllocationSize = bufferProvider->getBufferSize();
-        return fixedSizeBuffers.back().getBuffer();
-    }
-
     /// Case 2
-    if (lastAllocationSize < currentOffset + sizeInBytes)
+    if (numberOfUsedFixedSizeBuffers == fixedSizeBuffers.size())
     {
-        fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
+        /// Failing to get a buffer without blocking tells us that the buffer provider is running out of buffers
+        auto buffer = bufferProvider->getBufferNoBlocking();
+        if (not buffer.has_value())
+        {
+            underMemoryPressure = true;
+            buffer = bufferProvider->getBufferBlocking();
+        }
+        fixedSizeBuffers.emplace_back(std::move(buffer.value()));
     }
+    auto& nextBuffer = fixedSizeBuffers[numberOfUsedFixedSizeBuffers++];
+    lastAllocationSize = nextBuffer.getBufferSize();
+    allocatedBytes += lastAllocationSize;
+    return nextBuffer.getBuffer();
+}
 
-    /// Case 3
-    auto& lastBuffer = fixedSizeBuffers.back();
-    lastAllocationSize = lastBuffer.getBufferSize();
-    auto* const result = lastBuffer.getBuffer() + currentOffset;
-    currentOffset += sizeInBytes;
-    return result;
+void Arena::reset()
+{
+    const auto numberOfRetainedBuffers = underMemoryPressure ? 0 : numberOfUsedFixedSizeBuffers;
+    fixedSizeBuffers.erase(fixedSizeBuffers.begin() + static_cast<std::ptrdiff_t>(numberOfRetainedBuffers), fixedSizeBuffers.end());
+    unpooledBuffers.clear();
+    highWaterMarkInBytes = std::max(highWaterMarkInBytes, allocatedBytes);
+    numberOfUsedFixedSizeBuffers = 0;
+    allocatedBytes = 0;
+    lastAllocationSize = 0;
+    underMemoryPressure = false;
+}
+
+size_t Arena::getHighWaterMarkInBytes() const
+{
+    return std::max(highWaterMarkInBytes, allocatedBytes);
 }
 
 nautilus::val<int8_t*> ArenaRef::allocateMemory(const nautilus::val<size_t>& sizeInBytes)
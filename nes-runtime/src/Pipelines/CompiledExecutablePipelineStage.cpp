@@ -13,18 +13,26 @@
 */
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <ranges>
+#include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <cpptrace/from_current.hpp>
 #include <fmt/format.h>
 #include <nautilus/val_ptr.hpp>
 #include <Engine.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
 #include <Pipeline.hpp>
@@ -36,9 +44,10 @@ namespace NES
 CompiledExecutablePipelineStage::CompiledExecutablePipelineStage(
     std::shared_ptr<Pipeline> pipeline,
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers,
-    nautilus::engine::Options options)
+    nautilus::engine::Options options,
+    std::optional<std::string> fingerprint)
     : options(std::move(options))
-    , compiledPipelineFunction(nullptr)
+    , fingerprint(std::move(fingerprint))
     , operatorHandlers(std::move(operatorHandlers))
     , pipeline(std::move(pipeline))
 {
@@ -47,13 +56,27 @@ CompiledExecutablePipelineStage::CompiledExecutablePipelineStage(
 void CompiledExecutablePipelineStage::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
     /// we call the compiled pipeline function with an input buffer and the execution context
-    pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
-    Arena arena(pipelineExecutionContext.getBufferManager());
-    compiledPipelineFunction(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+    pipelineExecutionContext.setOperatorHandlers(compiledOperatorHandlers);
+    const auto workerThreadId = pipelineExecutionContext.getId().getRawValue();
+    if (workerThreadId >= workerArenas.size())
+    {
+        /// Worker threads that did not exist when the pipeline was started get a fresh arena per invocation
+        Arena arena(pipelineExecutionContext.getBufferManager());
+        (*compiledPipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+        return;
+    }
+
+    /// Only the worker thread itself accesses its arena. Thus, we do not need to synchronize the access.
+    auto& arena = workerArenas[workerThreadId];
+    if (arena == nullptr)
+    {
+        arena = std::make_unique<Arena>(pipelineExecutionContext.getBufferManager());
+    }
+    (*compiledPipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), arena.get());
+    arena->reset();
 }
 
-nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>
-CompiledExecutablePipelineStage::compilePipeline() const
+CompiledPipelineCache::CompiledPipelineFunction CompiledExecutablePipelineStage::compilePipeline() const
 {
     CPPTRACE_TRY
     {
@@ -88,6 +111,24 @@ void CompiledExecutablePipelineStage::stop(PipelineExecutionContext& pipelineExe
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
     pipeline->getRootOperator().terminate(ctx);
+
+    for (const auto& [workerThreadId, workerArena] : std::views::enumerate(workerArenas))
+    {
+        if (workerArena != nullptr)
+        {
+            NES_DEBUG(
+                "Arena of worker thread {} in pipeline {} had a high-water mark of {} bytes",
+                workerThreadId,
+                pipeline->getPipelineId(),
+                workerArena->getHighWaterMarkInBytes());
+        }
+    }
+    workerArenas.clear();
+}
+
+CompilationCacheResult CompiledExecutablePipelineStage::getCompilationCacheResult() const
+{
+    return compilationCacheResult;
 }
 
 std::ostream& CompiledExecutablePipelineStage::toString(std::ostream& os) const
@@ -101,7 +142,52 @@ void CompiledExecutablePipelineStage::start(PipelineExecutionContext& pipelineEx
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
     pipeline->getRootOperator().setup(ctx);
-    compiledPipelineFunction = this->compilePipeline();
+    workerArenas.clear();
+    workerArenas.resize(pipelineExecutionContext.getNumberOfWorkerThreads());
+
+    if (not fingerprint.has_value())
+    {
+        compiledPipelineFunction = std::make_shared<CompiledPipelineCache::CompiledPipelineFunction>(this->compilePipeline());
+        compiledOperatorHandlers = operatorHandlers;
+        return;
+    }
+
+    const auto [entry, hit] = CompiledPipelineCache::instance().getOrCompile(
+        *fingerprint,
+        [&]
+        {
+            return CompiledPipelineCache::Entry{
+                std::make_shared<CompiledPipelineCache::CompiledPipelineFunction>(this->compilePipeline()),
+                getSortedOperatorHandlerIds(),
+                pipeline->getRootOperator()};
+        });
+    compiledPipelineFunction = entry->function;
+    compilationCacheResult = hit ? CompilationCacheResult::HIT : CompilationCacheResult::MISS;
+    setCompiledOperatorHandlers(entry->operatorHandlerIds);
+}
+
+std::vector<OperatorHandlerId> CompiledExecutablePipelineStage::getSortedOperatorHandlerIds() const
+{
+    auto operatorHandlerIds = operatorHandlers | std::views::keys | std::ranges::to<std::vector>();
+    std::ranges::sort(operatorHandlerIds);
+    return operatorHandlerIds;
+}
+
+void CompiledExecutablePipelineStage::setCompiledOperatorHandlers(const std::vector<OperatorHandlerId>& compiledOperatorHandlerIds)
+{
+    INVARIANT(
+        compiledOperatorHandlerIds.size() == operatorHandlers.size(),
+        "The compiled code of pipeline {} expects {} operator handlers, but the pipeline has {}",
+        pipeline->getPipelineId(),
+        compiledOperatorHandlerIds.size(),
+        operatorHandlers.size());
+
+    /// Both, the compiled and our operator handler ids, are sorted. Thus, the i-th compiled id refers to our i-th operator handler.
+    compiledOperatorHandlers.clear();
+    for (const auto& [compiledId, id] : std::views::zip(compiledOperatorHandlerIds, getSortedOperatorHandlerIds()))
+    {
+        compiledOperatorHandlers.emplace(compiledId, operatorHandlers.at(id));
+    }
 }
 
 }
@@ -0,0 +1,119 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pipelines/CompiledPipelineCache.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <Util/Logger/Logger.hpp>
+
+namespace NES
+{
+
+CompiledPipelineCache& CompiledPipelineCache::instance()
+{
+    static CompiledPipelineCache cache;
+    return cache;
+}
+
+void CompiledPipelineCache::setCapacity(const size_t numberOfEntries)
+{
+    const std::scoped_lock lock(mutex);
+    capacity = numberOfEntries;
+    while (lru.size() > capacity)
+    {
+        entries.erase(lru.back());
+        lru.pop_back();
+        ++statistics.evictions;
+    }
+}
+
+std::pair<std::shared_ptr<const CompiledPipelineCache::Entry>, bool>
+CompiledPipelineCache::getOrCompile(const std::string& fingerprint, const std::function<Entry()>& compile)
+{
+    std::promise<std::shared_ptr<const Entry>> compiledEntry;
+    uint64_t compilationId = 0;
+    {
+        std::unique_lock lock(mutex);
+        if (capacity == 0)
+        {
+            lock.unlock();
+            return {std::make_shared<const Entry>(compile()), false};
+        }
+
+        if (const auto it = entries.find(fingerprint); it != entries.end())
+        {
+            ++statistics.hits;
+            lru.splice(lru.begin(), lru, it->second.positionInLru);
+            const auto cachedEntry = it->second.entry;
+            lock.unlock();
+            /// Waits, if another thread is still compiling the pipeline, and rethrows its error, if the compilation failed
+            return {cachedEntry.get(), true};
+        }
+
+        ++statistics.misses;
+        compilationId = nextCompilationId++;
+        lru.push_front(fingerprint);
+        entries.emplace(fingerprint, CachedEntry{compiledEntry.get_future().share(), lru.begin(), compilationId});
+        if (lru.size() > capacity)
+        {
+            NES_DEBUG("Evicting the compiled pipeline {} from the cache", lru.back());
+            entries.erase(lru.back());
+            lru.pop_back();
+            ++statistics.evictions;
+        }
+    }
+
+    /// We compile outside the lock, as compiling a pipeline takes up to several hundred milliseconds
+    try
+    {
+        auto entry = std::make_shared<const Entry>(compile());
+        compiledEntry.set_value(entry);
+        return {std::move(entry), false};
+    }
+    catch (...) /// NOLINT(no-raw-catch-all)
+    {
+        compiledEntry.set_exception(std::current_exception());
+        /// The failed compilation must not stay in the cache. If the entry has been evicted and replaced in the meantime, the entry
+        /// belongs to another compilation and we keep it.
+        const std::scoped_lock lock(mutex);
+        if (const auto it = entries.find(fingerprint); it != entries.end() and it->second.compilationId == compilationId)
+        {
+            lru.erase(it->second.positionInLru);
+            entries.erase(it);
+        }
+        throw;
+    }
+}
+
+CompiledPipelineCache::Statistics CompiledPipelineCache::getStatistics() const
+{
+    const std::scoped_lock lock(mutex);
+    return statistics;
+}
+
+void CompiledPipelineCache::clear()
+{
+    const std::scoped_lock lock(mutex);
+    entries.clear();
+    lru.clear();
+}
+
+}
@@ -18,6 +18,7 @@
 #include <utility>
 #include <Configuration/WorkerConfiguration.hpp>
 #include <Listeners/QueryLog.hpp>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Sources/SourceProvider.hpp>
@@ -34,13 +35,19 @@ NodeEngineBuilder::NodeEngineBuilder(const WorkerConfiguration& workerConfigurat
 
 std::unique_ptr<NodeEngine> NodeEngineBuilder::build()
 {
-    auto bufferManager = BufferManager::create(
-        workerConfiguration.bufferSizeInBytes.getValue(), workerConfiguration.numberOfBuffersInGlobalBufferManager.getValue());
+    const auto bufferSize = workerConfiguration.bufferSizeInBytes.getValue();
+    const auto numberOfBuffers = workerConfiguration.numberOfBuffersInGlobalBufferManager.getValue();
+    const auto cacheCapacity = workerConfiguration.bufferManagerThreadLocalCacheSize.getValue();
+    auto bufferManager = workerConfiguration.numaAwareBufferManager.getValue()
+        ? BufferManager::createNumaAware(bufferSize, numberOfBuffers, BufferManager::DEFAULT_ALIGNMENT, cacheCapacity)
+        : BufferManager::create(
+              bufferSize, numberOfBuffers, std::make_shared<NesDefaultMemoryAllocator>(), BufferManager::DEFAULT_ALIGNMENT, cacheCapacity);
     auto queryLog = std::make_shared<QueryLog>();
 
     auto queryEngine = std::make_unique<QueryEngine>(workerConfiguration.queryEngine, statisticsListener, queryLog, bufferManager);
 
-    auto sourceProvider = std::make_unique<SourceProvider>(workerConfiguration.defaultMaxInflightBuffers.getValue(), bufferManager);
+    auto sourceProvider = std::make_unique<SourceProvider>(
+        workerConfiguration.defaultMaxInflightBuffers.getValue(), bufferManager, workerConfiguration.numberOfSourceIOThreads.getValue());
 
     return std::make_unique<NodeEngine>(
         std::move(bufferManager), statisticsListener, std::move(queryLog), std::move(queryEngine), std::move(sourceProvider));
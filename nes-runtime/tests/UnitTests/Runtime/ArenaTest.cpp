@@ -0,0 +1,108 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ExecutionContext.hpp>
+
+namespace NES
+{
+
+class ArenaTest : public ::testing::Test
+{
+protected:
+    static constexpr uint32_t BUFFER_SIZE = 1024;
+    static constexpr uint32_t NUMBER_OF_BUFFERS = 4;
+
+    void SetUp() override { bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS); }
+
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(ArenaTest, reusesBuffersAfterReset)
+{
+    Arena arena(bufferManager);
+    auto* const firstMemory = arena.allocateMemory(16);
+    EXPECT_EQ(arena.lastAllocationSize, BUFFER_SIZE);
+    auto* const secondMemory = arena.allocateMemory(16);
+    EXPECT_NE(firstMemory, secondMemory);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 2);
+
+    /// The next invocation gets the same memory without requesting buffers from the buffer manager
+    arena.reset();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 2);
+    EXPECT_EQ(arena.allocateMemory(16), firstMemory);
+    EXPECT_EQ(arena.allocateMemory(16), secondMemory);
+    EXPECT_EQ(arena.getHighWaterMarkInBytes(), 2 * BUFFER_SIZE);
+}
+
+TEST_F(ArenaTest, shrinksToWorkingSetOfLastInvocation)
+{
+    Arena arena(bufferManager);
+    arena.allocateMemory(16);
+    arena.allocateMemory(16);
+    arena.allocateMemory(2 * BUFFER_SIZE);
+    EXPECT_EQ(arena.lastAllocationSize, 2 * BUFFER_SIZE);
+    arena.reset();
+    EXPECT_EQ(arena.unpooledBuffers.size(), 0);
+    EXPECT_EQ(arena.fixedSizeBuffers.size(), 2);
+
+    arena.allocateMemory(16);
+    arena.reset();
+    EXPECT_EQ(arena.fixedSizeBuffers.size(), 1);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 1);
+    EXPECT_EQ(arena.getHighWaterMarkInBytes(), 4 * BUFFER_SIZE);
+}
+
+TEST_F(ArenaTest, releasesAllBuffersUnderMemoryPressure)
+{
+    Arena arena(bufferManager);
+    arena.allocateMemory(16);
+    arena.reset();
+    EXPECT_EQ(arena.fixedSizeBuffers.size(), 1);
+
+    /// Other operators hold all remaining buffers. The arena needs a second buffer and waits until one of them gets released.
+    std::vector<TupleBuffer> heldBuffers;
+    for (uint32_t i = 0; i < NUMBER_OF_BUFFERS - 1; ++i)
+    {
+        heldBuffers.emplace_back(bufferManager->getBufferBlocking());
+    }
+    {
+        const std::jthread releasingThread(
+            [&heldBuffers]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                heldBuffers.pop_back();
+            });
+        arena.allocateMemory(16);
+        arena.allocateMemory(16);
+    }
+    EXPECT_TRUE(arena.underMemoryPressure);
+
+    arena.reset();
+    EXPECT_TRUE(arena.fixedSizeBuffers.empty());
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 2);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
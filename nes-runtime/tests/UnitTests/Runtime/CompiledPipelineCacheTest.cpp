@@ -0,0 +1,159 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Identifiers/Identifiers.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
+#include <PhysicalOperator.hpp>
+
+namespace NES
+{
+
+class CompiledPipelineCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        CompiledPipelineCache::instance().clear();
+        CompiledPipelineCache::instance().setCapacity(2);
+        statisticsBefore = CompiledPipelineCache::instance().getStatistics();
+    }
+
+    void TearDown() override
+    {
+        CompiledPipelineCache::instance().clear();
+        CompiledPipelineCache::instance().setCapacity(0);
+    }
+
+    /// Instead of compiling, we count the calls and return an entry without a function
+    auto compile()
+    {
+        return [this]
+        {
+            ++numberOfCompilations;
+            return CompiledPipelineCache::Entry{nullptr, {OperatorHandlerId(3), OperatorHandlerId(7)}, PhysicalOperator()};
+        };
+    }
+
+    [[nodiscard]] uint64_t getHits() const { return CompiledPipelineCache::instance().getStatistics().hits - statisticsBefore.hits; }
+
+    [[nodiscard]] uint64_t getMisses() const { return CompiledPipelineCache::instance().getStatistics().misses - statisticsBefore.misses; }
+
+    std::atomic<uint64_t> numberOfCompilations{0};
+    CompiledPipelineCache::Statistics statisticsBefore;
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(CompiledPipelineCacheTest, hitAfterMiss)
+{
+    auto& cache = CompiledPipelineCache::instance();
+    const auto [firstEntry, firstHit] = cache.getOrCompile("pipeline", compile());
+    const auto [secondEntry, secondHit] = cache.getOrCompile("pipeline", compile());
+    EXPECT_FALSE(firstHit);
+    EXPECT_TRUE(secondHit);
+    EXPECT_EQ(firstEntry, secondEntry);
+    EXPECT_EQ(secondEntry->operatorHandlerIds, (std::vector{OperatorHandlerId(3), OperatorHandlerId(7)}));
+    EXPECT_EQ(numberOfCompilations, 1);
+    EXPECT_EQ(getHits(), 1);
+    EXPECT_EQ(getMisses(), 1);
+}
+
+TEST_F(CompiledPipelineCacheTest, disabledCacheAlwaysCompiles)
+{
+    auto& cache = CompiledPipelineCache::instance();
+    cache.setCapacity(0);
+    EXPECT_FALSE(cache.getOrCompile("pipeline", compile()).second);
+    EXPECT_FALSE(cache.getOrCompile("pipeline", compile()).second);
+    EXPECT_EQ(numberOfCompilations, 2);
+    EXPECT_EQ(getHits(), 0);
+    EXPECT_EQ(getMisses(), 0);
+}
+
+TEST_F(CompiledPipelineCacheTest, evictsLeastRecentlyUsedPipeline)
+{
+    auto& cache = CompiledPipelineCache::instance();
+    cache.getOrCompile("first", compile());
+    cache.getOrCompile("second", compile());
+    /// Using the first pipeline again makes the second one the least recently used
+    EXPECT_TRUE(cache.getOrCompile("first", compile()).second);
+    cache.getOrCompile("third", compile());
+
+    EXPECT_TRUE(cache.getOrCompile("first", compile()).second);
+    EXPECT_FALSE(cache.getOrCompile("second", compile()).second);
+    EXPECT_EQ(numberOfCompilations, 4);
+}
+
+TEST_F(CompiledPipelineCacheTest, failedCompilationIsNotCached)
+{
+    auto& cache = CompiledPipelineCache::instance();
+    EXPECT_THROW(
+        cache.getOrCompile(
+            "pipeline", []() -> CompiledPipelineCache::Entry { throw std::runtime_error("Could not query compile pipeline"); }),
+        std::runtime_error);
+    EXPECT_FALSE(cache.getOrCompile("pipeline", compile()).second);
+    EXPECT_EQ(numberOfCompilations, 1);
+}
+
+TEST_F(CompiledPipelineCacheTest, failedCompilationKeepsEntryOfOtherCompilation)
+{
+    auto& cache = CompiledPipelineCache::instance();
+    EXPECT_THROW(
+        cache.getOrCompile(
+            "pipeline",
+            [&]() -> CompiledPipelineCache::Entry
+            {
+                /// While the compilation is in progress, its entry is evicted and another compilation of the pipeline succeeds
+                cache.getOrCompile("first", compile());
+                cache.getOrCompile("second", compile());
+                EXPECT_FALSE(cache.getOrCompile("pipeline", compile()).second);
+                throw std::runtime_error("Could not query compile pipeline");
+            }),
+        std::runtime_error);
+    EXPECT_TRUE(cache.getOrCompile("pipeline", compile()).second);
+    EXPECT_EQ(numberOfCompilations, 3);
+}
+
+TEST_F(CompiledPipelineCacheTest, concurrentRequestsCompileOnce)
+{
+    constexpr uint64_t numberOfThreads = 8;
+    std::vector<std::shared_ptr<const CompiledPipelineCache::Entry>> entries(numberOfThreads);
+    {
+        std::vector<std::jthread> threads;
+        for (uint64_t threadId = 0; threadId < numberOfThreads; ++threadId)
+        {
+            threads.emplace_back([&, threadId]
+                                 { entries[threadId] = CompiledPipelineCache::instance().getOrCompile("pipeline", compile()).first; });
+        }
+    }
+
+    EXPECT_EQ(numberOfCompilations, 1);
+    EXPECT_EQ(getMisses(), 1);
+    EXPECT_EQ(getHits(), numberOfThreads - 1);
+    for (const auto& entry : entries)
+    {
+        EXPECT_EQ(entry, entries[0]);
+    }
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
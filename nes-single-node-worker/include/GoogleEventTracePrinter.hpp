@@ -71,14 +71,16 @@ private:
         Query,
         Pipeline,
         Task,
-        System
+        System,
+        Source
     };
 
     enum class Phase : int
     {
         Begin,
         End,
-        Instant
+        Instant,
+        Counter
     };
 
     static uint64_t timestampToMicroseconds(const std::chrono::system_clock::time_point& timestamp);
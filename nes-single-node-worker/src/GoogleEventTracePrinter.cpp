@@ -32,6 +32,7 @@
 #include <Util/ThreadNaming.hpp>
 #include <fmt/format.h>
 #include <folly/MPMCQueue.h>
+#include <magic_enum/magic_enum.hpp>
 #include <nlohmann/json.hpp>
 #include <nlohmann/json_fwd.hpp>
 #include <QueryEngineStatisticListener.hpp>
@@ -67,6 +68,9 @@ nlohmann::json GoogleEventTracePrinter::createTraceEvent(
         case Category::System:
             event["cat"] = "system";
             break;
+        case Category::Source:
+            event["cat"] = "source";
+            break;
     }
 
     /// Convert phase enum to string
@@ -81,6 +85,9 @@ nlohmann::json GoogleEventTracePrinter::createTraceEvent(
         case Phase::Instant:
             event["ph"] = "i";
             break;
+        case Phase::Counter:
+            event["ph"] = "C";
+            break;
     }
 
     event["ts"] = timestamp;
@@ -257,6 +264,7 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
                 {
                     auto args = nlohmann::json::object();
                     args["pipeline_id"] = pipelineStart.pipelineId.getRawValue();
+                    args["compilation_cache"] = std::string(magic_enum::enum_name(pipelineStart.compilationCacheResult));
 
                     auto traceEvent = createTraceEvent(
                         fmt::format("Pipeline {} (Query {})", pipelineStart.pipelineId, pipelineStart.queryId),
@@ -387,6 +395,25 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
 
                     /// Remove from active tasks if present
                     activeTasks.erase(taskExpired.taskId);
+                },
+                [&](const SourceCreditsUpdate& creditsUpdate)
+                {
+                    /// Counter events are plotted as a graph per source over the runtime of the query
+                    auto args = nlohmann::json::object();
+                    args["credits"] = creditsUpdate.credits;
+                    args["inflight_buffers"] = creditsUpdate.numberOfInflightBuffers;
+                    args["stall_time_ms"] = std::chrono::duration_cast<std::chrono::milliseconds>(creditsUpdate.stallTime).count();
+
+                    auto traceEvent = createTraceEvent(
+                        fmt::format("Source {} (Query {})", creditsUpdate.originId, creditsUpdate.queryId),
+                        Category::Source,
+                        Phase::Counter,
+                        timestampToMicroseconds(creditsUpdate.timestamp),
+                        0,
+                        args);
+                    traceEvent["tid"] = 0; /// Counters are not bound to a thread
+
+                    emit(traceEvent);
                 }},
             event);
     }
@@ -149,7 +149,7 @@ grpc::Status GRPCServer::RequestQueryStatus(grpc::ServerContext* context, const
         reply->set_queryid(queryId.getRawValue());
         if (const auto queryStatus = delegate.getQueryStatus(queryId); queryStatus.has_value())
         {
-            const auto& [start, running, stop, error] = queryStatus->metrics;
+            const auto& [start, running, stop, error, memoryUsage] = queryStatus->metrics;
             reply->set_state(static_cast<::QueryState>(queryStatus->state));
 
             if (start.has_value())
@@ -178,6 +178,15 @@ grpc::Status GRPCServer::RequestQueryStatus(grpc::ServerContext* context, const
                 errorProto->set_code(error->code());
                 errorProto->set_location(std::string{error->where()->filename} + ":" + std::to_string(error->where()->line.value_or(0)));
             }
+
+            if (memoryUsage.has_value())
+            {
+                auto* memoryUsageProto = reply->mutable_metrics()->mutable_memoryusage();
+                memoryUsageProto->set_usedbytes(memoryUsage->usedBytes);
+                memoryUsageProto->set_peakusedbytes(memoryUsage->peakUsedBytes);
+                memoryUsageProto->set_softlimitinbytes(memoryUsage->limits.softLimitInBytes);
+                memoryUsageProto->set_hardlimitinbytes(memoryUsage->limits.hardLimitInBytes);
+            }
             return grpc::Status::OK;
         }
         return {grpc::NOT_FOUND, "Query does not exist"};
@@ -16,19 +16,27 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <unistd.h>
 #include <Identifiers/Identifiers.hpp>
 #include <Identifiers/NESStrongType.hpp>
 #include <Listeners/QueryLog.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Runtime/BufferManager.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Serialization/QueryPlanSerializationUtil.hpp>
 #include <Util/PlanRenderer.hpp>
 #include <Util/Pointers.hpp>
 #include <cpptrace/from_current.hpp>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <CompositeStatisticListener.hpp>
 #include <ErrorHandling.hpp>
 #include <GoogleEventTracePrinter.hpp>
@@ -39,6 +47,47 @@
 namespace NES
 {
 
+namespace
+{
+/// Derives the fingerprint of a query plan, which identifies its compiled pipelines in the CompiledPipelineCache.
+/// The operator ids are renumbered in the order of serialization and the query id is left out. Thus, resubmitting the same query yields
+/// the same fingerprint. As the worker configuration influences the lowering of the plan, it is part of the fingerprint, too.
+/// The plan must contain the implementations that the optimizer decided, as these depend on the statistics of previous queries.
+std::string fingerprintQueryPlan(const LogicalPlan& plan, const std::string& workerConfiguration)
+{
+    auto serializedPlan = QueryPlanSerializationUtil::serializeQueryPlan(plan);
+    serializedPlan.clear_queryid();
+    std::unordered_map<uint64_t, uint64_t> normalizedOperatorIds;
+    const auto normalize = [&](const uint64_t operatorId)
+    { return normalizedOperatorIds.try_emplace(operatorId, normalizedOperatorIds.size()).first->second; };
+    for (auto& serializedOperator : *serializedPlan.mutable_operators())
+    {
+        serializedOperator.set_operator_id(normalize(serializedOperator.operator_id()));
+    }
+    for (auto& serializedOperator : *serializedPlan.mutable_operators())
+    {
+        for (auto& childId : *serializedOperator.mutable_children_ids())
+        {
+            childId = normalize(childId);
+        }
+    }
+    for (auto& rootOperatorId : *serializedPlan.mutable_rootoperatorids())
+    {
+        rootOperatorId = normalize(rootOperatorId);
+    }
+
+    /// The operator configurations are protobuf maps, whose order is only deterministic if requested explicitly
+    std::string fingerprint;
+    {
+        google::protobuf::io::StringOutputStream stringStream(&fingerprint);
+        google::protobuf::io::CodedOutputStream codedStream(&stringStream);
+        codedStream.SetSerializationDeterministic(true);
+        serializedPlan.SerializeToCodedStream(&codedStream);
+    }
+    return fingerprint + workerConfiguration;
+}
+}
+
 SingleNodeWorker::~SingleNodeWorker() = default;
 SingleNodeWorker::SingleNodeWorker(SingleNodeWorker&& other) noexcept = default;
 SingleNodeWorker& SingleNodeWorker::operator=(SingleNodeWorker&& other) noexcept = default;
@@ -58,6 +107,7 @@ SingleNodeWorker::SingleNodeWorker(const SingleNodeWorkerConfiguration& configur
 
     optimizer = std::make_unique<QueryOptimizer>(configuration.workerConfiguration.defaultQueryExecution);
     compiler = std::make_unique<QueryCompilation::QueryCompiler>();
+    CompiledPipelineCache::instance().setCapacity(configuration.workerConfiguration.compiledPipelineCacheSize.getValue());
 
     if (configuration.workerConfiguration.bufferSizeInBytes.getValue()
         < configuration.workerConfiguration.defaultQueryExecution.operatorBufferSize.getValue())
@@ -78,10 +128,17 @@ std::expected<QueryId, Exception> SingleNodeWorker::registerQuery(LogicalPlan pl
     CPPTRACE_TRY
     {
         plan.setQueryId(QueryId(queryIdCounter++));
-        auto queryPlan = optimizer->optimize(plan);
+        const auto planWithImplementations = optimizer->decideImplementations(plan);
+        std::optional<std::string> planFingerprint;
+        if (configuration.workerConfiguration.compiledPipelineCacheSize.getValue() > 0)
+        {
+            planFingerprint = fingerprintQueryPlan(planWithImplementations, configuration.workerConfiguration.toString());
+        }
+        auto queryPlan = optimizer->lower(planWithImplementations);
         listener->onEvent(SubmitQuerySystemEvent{queryPlan.getQueryId(), explain(plan, ExplainVerbosity::Debug)});
         auto request = std::make_unique<QueryCompilation::QueryCompilationRequest>(queryPlan);
         request->dumpCompilationResult = configuration.workerConfiguration.dumpQueryCompilationIntermediateRepresentations.getValue();
+        request->planFingerprint = std::move(planFingerprint);
         auto result = compiler->compileQuery(std::move(request));
         INVARIANT(result, "expected successfull query compilation or exception, but got nothing");
         return nodeEngine->registerCompiledQueryPlan(std::move(result));
@@ -147,6 +204,7 @@ std::expected<LocalQueryStatus, Exception> SingleNodeWorker::getQueryStatus(Quer
         {
             return std::unexpected{QueryNotFound("{}", queryId)};
         }
+        status->metrics.memoryUsage = nodeEngine->getBufferManager()->getQueryMemoryUsage(queryId);
         return status.value();
     }
     CPPTRACE_CATCH(...)
@@ -0,0 +1,109 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Sinks/BatchedFileWriter.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark compares how writing formatted buffers to a file scales with the number of worker threads. The argument is the number
+/// of worker threads, which write 4 GiB in total. The locked stream emulates the default mode of the FileSink, which writes and flushes
+/// every buffer under a lock that all worker threads share. The batched writer stages the buffers per worker thread and writes them
+/// from a single writer thread.
+
+namespace
+{
+constexpr size_t TOTAL_BYTES = 4UL * 1024 * 1024 * 1024;
+constexpr size_t FORMATTED_BUFFER_SIZE = 64 * 1024;
+constexpr size_t FLUSH_SIZE_IN_BYTES = 1024 * 1024;
+
+std::filesystem::path getOutputFilePath()
+{
+    return std::filesystem::temp_directory_path() / "file-sink-write-benchmark.csv";
+}
+
+/// Runs the write function on each worker thread, until all worker threads together have written TOTAL_BYTES
+template <typename WriteFunction>
+void runWorkers(const size_t numberOfWorkerThreads, const WriteFunction& write)
+{
+    const std::string formattedBuffer(FORMATTED_BUFFER_SIZE, 'x');
+    const auto buffersPerWorker = TOTAL_BYTES / FORMATTED_BUFFER_SIZE / numberOfWorkerThreads;
+    std::vector<std::jthread> workerThreads;
+    for (size_t workerThreadId = 0; workerThreadId < numberOfWorkerThreads; ++workerThreadId)
+    {
+        workerThreads.emplace_back(
+            [&, workerThreadId]
+            {
+                for (size_t i = 0; i < buffersPerWorker; ++i)
+                {
+                    write(workerThreadId, formattedBuffer);
+                }
+            });
+    }
+}
+}
+
+static void BM_LockedStream(benchmark::State& state)
+{
+    const auto numberOfWorkerThreads = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::mutex mutex;
+        std::ofstream stream(getOutputFilePath(), std::ofstream::binary | std::ofstream::trunc);
+        runWorkers(
+            numberOfWorkerThreads,
+            [&](size_t, const std::string& formattedBuffer)
+            {
+                const std::scoped_lock lock(mutex);
+                stream.write(formattedBuffer.c_str(), static_cast<int64_t>(formattedBuffer.size()));
+                stream.flush();
+            });
+        stream.close();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * TOTAL_BYTES));
+    std::filesystem::remove(getOutputFilePath());
+}
+
+static void BM_BatchedWriter(benchmark::State& state)
+{
+    const auto numberOfWorkerThreads = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        NES::BatchedFileWriter writer(
+            getOutputFilePath(),
+            false,
+            "",
+            numberOfWorkerThreads,
+            {.flushSizeInBytes = FLUSH_SIZE_IN_BYTES, .flushInterval = std::chrono::milliseconds(100), .rollingFileSizeInBytes = 0});
+        runWorkers(
+            numberOfWorkerThreads,
+            [&](const size_t workerThreadId, const std::string& formattedBuffer) { writer.write(workerThreadId, formattedBuffer); });
+        writer.close();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * TOTAL_BYTES));
+    std::filesystem::remove(getOutputFilePath());
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_LockedStream)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BatchedWriter)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
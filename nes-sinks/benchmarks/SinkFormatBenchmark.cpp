@@ -0,0 +1,101 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/CSVFormat.hpp>
+#include <SinksParsing/Format.hpp>
+#include <SinksParsing/JSONFormat.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark measures how fast the sink formats fill a buffer of a result-heavy query, which has integer, float, and text fields.
+/// The formats append to an output string that is reused across buffers, as the FileSink does.
+
+namespace
+{
+constexpr uint32_t BUFFER_SIZE = 64 * 1024;
+
+NES::Schema createSchema()
+{
+    return NES::Schema()
+        .addField("id", NES::DataType::Type::UINT64)
+        .addField("value", NES::DataType::Type::INT32)
+        .addField("price", NES::DataType::Type::FLOAT64)
+        .addField("name", NES::DataType::Type::VARSIZED);
+}
+
+/// Fills the buffer with as many tuples of the schema as fit into it
+NES::TupleBuffer createFilledBuffer(const NES::Schema& schema, NES::BufferManager& bufferManager)
+{
+    auto buffer = bufferManager.getBufferBlocking();
+    const auto tupleSize = schema.getSizeOfSchemaInBytes();
+    const auto numberOfTuples = BUFFER_SIZE / tupleSize;
+    for (uint64_t i = 0; i < numberOfTuples; ++i)
+    {
+        auto* tuple = buffer.getBuffer<char>() + (i * tupleSize);
+        const auto value = static_cast<int32_t>(i * 7919);
+        const auto price = static_cast<double>(i) * 1.25;
+        const auto name = NES::writeVarSizedData(buffer, "name-" + std::to_string(i), bufferManager).value();
+        std::memcpy(tuple, &i, sizeof(i));
+        std::memcpy(tuple + sizeof(i), &value, sizeof(value));
+        std::memcpy(tuple + sizeof(i) + sizeof(value), &price, sizeof(price));
+        std::memcpy(tuple + sizeof(i) + sizeof(value) + sizeof(price), &name, sizeof(name));
+    }
+    buffer.setNumberOfTuples(numberOfTuples);
+    return buffer;
+}
+
+void formatBuffers(benchmark::State& state, const NES::Format& format, const NES::TupleBuffer& buffer)
+{
+    std::string output;
+    for (auto _ : state)
+    {
+        output.clear();
+        format.appendFormattedBuffer(buffer, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * buffer.getNumberOfTuples()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * output.size()));
+}
+}
+
+static void BM_FormatCSV(benchmark::State& state)
+{
+    const auto schema = createSchema();
+    const auto bufferManager = NES::BufferManager::create(BUFFER_SIZE, 16);
+    const auto buffer = createFilledBuffer(schema, *bufferManager);
+    formatBuffers(state, NES::CSVFormat(schema), buffer);
+}
+
+static void BM_FormatJSON(benchmark::State& state)
+{
+    const auto schema = createSchema();
+    const auto bufferManager = NES::BufferManager::create(BUFFER_SIZE, 16);
+    const auto buffer = createFilledBuffer(schema, *bufferManager);
+    formatBuffers(state, NES::JSONFormat(schema), buffer);
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_FormatCSV);
+BENCHMARK(BM_FormatJSON);
+/// Run the benchmark
+BENCHMARK_MAIN();
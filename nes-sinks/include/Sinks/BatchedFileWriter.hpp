@@ -0,0 +1,110 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <gtest/gtest_prod.h>
+
+namespace NES
+{
+
+/// Writes the output of many worker threads to a file without serializing the workers on a shared file stream.
+/// Each worker appends to a staging buffer of its own. Once a staging buffer holds flushSizeInBytes, the worker hands it over to a
+/// single writer thread, which writes all handed over staging buffers with one vectored write. The writer thread additionally collects
+/// the content of all staging buffers every flushInterval, so that the output of slow queries shows up in the file in time.
+/// If rollingFileSizeInBytes is not zero, the writer continues in a new file <filePath>.<n> once the current file exceeds that size.
+/// Every file starts with the fileHeader.
+class BatchedFileWriter
+{
+public:
+    struct FlushPolicy
+    {
+        size_t flushSizeInBytes;
+        std::chrono::milliseconds flushInterval;
+        size_t rollingFileSizeInBytes;
+    };
+
+    /// Opens the file and starts the writer thread. Throws CannotOpenSink, if the file cannot be opened.
+    BatchedFileWriter(std::string filePath, bool append, std::string fileHeader, size_t numberOfStagingBuffers, FlushPolicy flushPolicy);
+    ~BatchedFileWriter();
+
+    BatchedFileWriter(const BatchedFileWriter&) = delete;
+    BatchedFileWriter& operator=(const BatchedFileWriter&) = delete;
+    BatchedFileWriter(BatchedFileWriter&&) = delete;
+    BatchedFileWriter& operator=(BatchedFileWriter&&) = delete;
+
+    /// Appends the data to the staging buffer. The data of a single call is written to the file contiguously.
+    /// Throws CannotWriteSink, if the writer thread failed to write previous data.
+    void write(size_t stagingBufferIdx, std::string_view data);
+
+    /// Writes all remaining data, stops the writer thread, and closes the file. Throws CannotWriteSink, if any write failed.
+    void close();
+
+private:
+    /// Stalls the writer thread on a staging buffer to fill the pending batches
+    FRIEND_TEST(BatchedFileWriterTest, writeBlocksWhileTheWriterThreadFallsBehind);
+    /// Stalls the writer thread on a staging buffer, while a batch is handed over and the next one is staged
+    FRIEND_TEST(BatchedFileWriterTest, flushIntervalKeepsTheOrderOfHandedOverAndStagedData);
+
+    /// Aligned to a cache line, as different workers append to neighboring staging buffers concurrently
+    struct alignas(64) StagingBuffer
+    {
+        std::mutex mutex;
+        std::string data;
+    };
+
+    /// Passes a full staging buffer to the writer thread and returns an empty string, which reuses the memory of a written one.
+    /// Blocks, if the writer thread falls behind by more than two staging buffers per worker.
+    std::string handOver(std::string&& batch);
+    void runWriter(const std::stop_token& stopToken);
+    /// Takes the data of all staging buffers, preceded by the batches that were handed over before it, to keep the order of each worker
+    std::vector<std::string> collectStagingBuffers();
+    void writeBatches(std::vector<std::string>& batches);
+    void openFile(bool append);
+    void closeFile();
+
+    std::string filePath;
+    std::string fileHeader;
+    FlushPolicy flushPolicy;
+
+    size_t numberOfStagingBuffers;
+    std::unique_ptr<StagingBuffer[]> stagingBuffers; /// NOLINT(modernize-avoid-c-arrays)
+
+    std::mutex writerMutex;
+    std::condition_variable_any writerCondition;
+    std::condition_variable_any handOverCondition;
+    std::vector<std::string> pendingBatches;
+    std::vector<std::string> writtenBatches;
+    std::exception_ptr writeError;
+
+    /// Only accessed by the writer thread, and by close() after it has been stopped
+    int fileDescriptor = -1;
+    size_t fileOffset = 0;
+    size_t numberOfRolledFiles = 0;
+
+    std::jthread writerThread;
+};
+
+}
@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -25,6 +27,7 @@
 #include <Configurations/Descriptor.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sinks/BatchedFileWriter.hpp>
 #include <Sinks/Sink.hpp>
 #include <Sinks/SinkDescriptor.hpp>
 #include <SinksParsing/CSVFormat.hpp>
@@ -35,6 +38,8 @@
 namespace NES
 {
 /// A sink that writes formatted TupleBuffers to arbitrary files.
+/// Per default, every buffer is written and flushed to the file under a lock that all worker threads share. In the batched write mode,
+/// the workers stage their formatted buffers and a BatchedFileWriter writes them to the file according to the configured flush policy.
 class FileSink final : public Sink
 {
 public:
@@ -63,6 +68,8 @@ private:
     bool isOpen;
     std::unique_ptr<Format> formatter;
     folly::Synchronized<std::ofstream> outputFileStream;
+    std::optional<BatchedFileWriter::FlushPolicy> batchedWritePolicy;
+    std::unique_ptr<BatchedFileWriter> batchedFileWriter;
 };
 
 /// Todo #355 : combine configuration with source configuration (get rid of duplicated code)
@@ -76,10 +83,38 @@ struct ConfigParametersFile
         "append",
         false,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(APPEND, config); }};
+    /// Stages the formatted buffers per worker thread and writes them from a single writer thread without a flush per buffer
+    static inline const DescriptorConfig::ConfigParameter<bool> BATCHED_WRITE{
+        "batched_write",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(BATCHED_WRITE, config); }};
+    /// Number of bytes a worker thread stages, before it hands them to the writer thread (only for batched writes)
+    static inline const DescriptorConfig::ConfigParameter<size_t> FLUSH_SIZE_IN_BYTES{
+        "flush_size_in_bytes",
+        1024 * 1024,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FLUSH_SIZE_IN_BYTES, config); }};
+    /// Maximum time staged bytes wait for the writer thread (only for batched writes)
+    static inline const DescriptorConfig::ConfigParameter<size_t> FLUSH_INTERVAL_MS{
+        "flush_interval_ms",
+        100,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FLUSH_INTERVAL_MS, config); }};
+    /// Continues in a new file <file_path>.<n>, once a file exceeds this size. Zero disables rolling files (only for batched writes).
+    static inline const DescriptorConfig::ConfigParameter<size_t> ROLLING_FILE_SIZE_IN_BYTES{
+        "rolling_file_size_in_bytes",
+        0,
+        [](const std::unordered_map<std::string, std::string>& config)
+        { return DescriptorConfig::tryGet(ROLLING_FILE_SIZE_IN_BYTES, config); }};
 
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
         = DescriptorConfig::createConfigParameterContainerMap(
-            SinkDescriptor::parameterMap, SinkDescriptor::FILE_PATH, INPUT_FORMAT, APPEND);
+            SinkDescriptor::parameterMap,
+            SinkDescriptor::FILE_PATH,
+            INPUT_FORMAT,
+            APPEND,
+            BATCHED_WRITE,
+            FLUSH_SIZE_IN_BYTES,
+            FLUSH_INTERVAL_MS,
+            ROLLING_FILE_SIZE_IN_BYTES);
 };
 
 }
@@ -20,9 +20,9 @@
 #include <string>
 #include <vector>
 
-#include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/FieldFormatter.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <fmt/core.h>
 #include <fmt/ostream.h>
@@ -33,24 +33,20 @@ namespace NES
 class CSVFormat : public Format
 {
 public:
-    /// Stores precalculated offsets based on the input schema.
+    /// Stores the precalculated plan to format tuples of the input schema, i.e., the offset, prefix, and format function of each field.
     /// The CSVFormat class constructs the formatting context during its construction and stores it as a member to speed up
     /// the actual formatting.
     struct FormattingContext
     {
         size_t schemaSizeInBytes{};
-        std::vector<size_t> offsets;
-        std::vector<DataType> physicalTypes;
+        std::vector<FieldFormatter> fieldFormatters;
     };
 
     explicit CSVFormat(const Schema& schema);
     explicit CSVFormat(const Schema& schema, bool escapeStrings);
 
-    /// Return formatted content of TupleBuffer, contains timestamp if specified in config.
-    [[nodiscard]] std::string getFormattedBuffer(const TupleBuffer& inputBuffer) const override;
-
-    /// Reads a TupleBuffer and uses the supplied 'schema' to format it to CSV. Returns result as a string.
-    [[nodiscard]] std::string tupleBufferToFormattedCSVString(TupleBuffer tbuffer, const FormattingContext& formattingContext) const;
+    /// Reads a TupleBuffer and uses the supplied 'schema' to format it to CSV. Appends the result to the output.
+    void appendFormattedBuffer(const TupleBuffer& inputBuffer, std::string& output) const override;
 
     std::ostream& toString(std::ostream& os) const override { return os << *this; }
 
@@ -58,7 +54,6 @@ public:
 
 private:
     FormattingContext formattingContext;
-    bool escapeStrings;
 };
 
 }
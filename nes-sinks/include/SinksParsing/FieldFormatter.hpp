@@ -0,0 +1,52 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <DataTypes/DataType.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Appends the textual representation of the field to the output without allocating intermediate strings.
+/// The representation is the same as the one of DataType::formattedBytesToString. Variable sized data is read from the child buffers
+/// of the tuple buffer.
+using AppendFieldFunction = void (*)(std::string& output, const char* field, const TupleBuffer& tupleBuffer);
+
+/// Precomputed step of the plan that a format follows to format each tuple of a schema
+struct FieldFormatter
+{
+    size_t offsetInTuple;
+    /// Text in front of the field, e.g., the separator to the previous field
+    std::string prefix;
+    AppendFieldFunction appendField;
+    bool quoted;
+};
+
+AppendFieldFunction getAppendFieldFunction(const DataType& dataType);
+
+/// Formats each tuple of the buffer by following the field formatters and terminates each tuple with the tupleSuffix
+void appendFormattedTuples(
+    std::string& output,
+    const TupleBuffer& tupleBuffer,
+    size_t tupleSizeInBytes,
+    std::span<const FieldFormatter> fieldFormatters,
+    std::string_view tupleSuffix);
+
+}
@@ -51,7 +51,15 @@ public:
     }
 
     /// Return formatted content of TupleBuffer, contains timestamp if specified in config.
-    [[nodiscard]] virtual std::string getFormattedBuffer(const TupleBuffer& inputBuffer) const = 0;
+    [[nodiscard]] std::string getFormattedBuffer(const TupleBuffer& inputBuffer) const
+    {
+        std::string formatted;
+        appendFormattedBuffer(inputBuffer, formatted);
+        return formatted;
+    }
+
+    /// Appends the formatted content of the TupleBuffer to the output. Reusing the output across buffers avoids allocations.
+    virtual void appendFormattedBuffer(const TupleBuffer& inputBuffer, std::string& output) const = 0;
 
     virtual std::ostream& toString(std::ostream&) const = 0;
 
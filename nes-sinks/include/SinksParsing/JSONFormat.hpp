@@ -19,9 +19,9 @@
 #include <ostream>
 #include <string>
 #include <vector>
-#include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/FieldFormatter.hpp>
 
 namespace NES
 {
@@ -29,24 +29,19 @@ namespace NES
 class JSONFormat : public Format
 {
 public:
-    /// Stores precalculated offsets based on the input schema.
+    /// Stores the precalculated plan to format tuples of the input schema, i.e., the offset, prefix, and format function of each field.
     /// The JSONFormat class constructs the formatting context during its construction and stores it as a member to speed up
     /// the actual formatting.
     struct FormattingContext
     {
         size_t schemaSizeInBytes{};
-        std::vector<size_t> offsets;
-        std::vector<std::string> names;
-        std::vector<DataType> physicalTypes;
+        std::vector<FieldFormatter> fieldFormatters;
     };
 
     explicit JSONFormat(const Schema& schema);
 
-    /// Return formatted content of TupleBuffer, contains timestamp if specified in config.
-    [[nodiscard]] std::string getFormattedBuffer(const TupleBuffer& inputBuffer) const override;
-
-    /// Reads a TupleBuffer and uses the supplied 'schema' to format it to JSON. Returns result as a string.
-    static std::string tupleBufferToFormattedJSONString(TupleBuffer tbuffer, const FormattingContext& formattingContext);
+    /// Reads a TupleBuffer and uses the supplied 'schema' to format it to JSON. Appends the result to the output.
+    void appendFormattedBuffer(const TupleBuffer& inputBuffer, std::string& output) const override;
 
     std::ostream& toString(std::ostream& os) const override { return os << *this; }
 
@@ -0,0 +1,315 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sinks/BatchedFileWriter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// pwritev may write fewer bytes than requested. We continue with the remaining bytes until all iovecs have been written.
+void writeFully(const int fileDescriptor, std::span<iovec> iovecs, size_t offset, const std::string_view filePath)
+{
+    while (not iovecs.empty())
+    {
+        const auto bytesWritten = pwritev(fileDescriptor, iovecs.data(), static_cast<int>(iovecs.size()), static_cast<off_t>(offset));
+        if (bytesWritten < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw CannotWriteSink("Could not write to {}: {}", filePath, std::strerror(errno));
+        }
+        offset += static_cast<size_t>(bytesWritten);
+        auto remainingBytes = static_cast<size_t>(bytesWritten);
+        while (not iovecs.empty() and remainingBytes >= iovecs.front().iov_len)
+        {
+            remainingBytes -= iovecs.front().iov_len;
+            iovecs = iovecs.subspan(1);
+        }
+        if (remainingBytes > 0)
+        {
+            iovecs.front().iov_base = static_cast<char*>(iovecs.front().iov_base) + remainingBytes;
+            iovecs.front().iov_len -= remainingBytes;
+        }
+    }
+}
+}
+
+BatchedFileWriter::BatchedFileWriter(
+    std::string filePath, const bool append, std::string fileHeader, const size_t numberOfStagingBuffers, const FlushPolicy flushPolicy)
+    : filePath(std::move(filePath))
+    , fileHeader(std::move(fileHeader))
+    , flushPolicy(flushPolicy)
+    , numberOfStagingBuffers(std::max<size_t>(numberOfStagingBuffers, 1))
+    , stagingBuffers(std::make_unique<StagingBuffer[]>(this->numberOfStagingBuffers)) /// NOLINT(modernize-avoid-c-arrays)
+{
+    PRECONDITION(flushPolicy.flushSizeInBytes > 0, "The flush size must be larger than zero");
+    openFile(append);
+    writerThread = std::jthread([this](const std::stop_token& stopToken) { runWriter(stopToken); });
+}
+
+BatchedFileWriter::~BatchedFileWriter()
+{
+    try
+    {
+        close();
+    }
+    catch (...) /// NOLINT(no-raw-catch-all)
+    {
+        tryLogCurrentException();
+    }
+}
+
+void BatchedFileWriter::write(const size_t stagingBufferIdx, const std::string_view data)
+{
+    auto& stagingBuffer = stagingBuffers[stagingBufferIdx % numberOfStagingBuffers];
+    const std::scoped_lock lock(stagingBuffer.mutex);
+    stagingBuffer.data.append(data);
+    if (stagingBuffer.data.size() >= flushPolicy.flushSizeInBytes)
+    {
+        stagingBuffer.data = handOver(std::move(stagingBuffer.data));
+    }
+}
+
+void BatchedFileWriter::close()
+{
+    if (not writerThread.joinable())
+    {
+        return;
+    }
+    writerThread.request_stop();
+    writerThread.join();
+
+    /// All workers have finished writing and the writer thread has been stopped. Thus, we can access the batches without the lock.
+    auto batches = std::move(pendingBatches);
+    std::ranges::move(collectStagingBuffers(), std::back_inserter(batches));
+    try
+    {
+        if (not writeError)
+        {
+            writeBatches(batches);
+        }
+    }
+    catch (...) /// NOLINT(no-raw-catch-all)
+    {
+        writeError = std::current_exception();
+    }
+    closeFile();
+    if (writeError)
+    {
+        std::rethrow_exception(writeError);
+    }
+}
+
+std::string BatchedFileWriter::handOver(std::string&& batch)
+{
+    std::unique_lock lock(writerMutex);
+    handOverCondition.wait(lock, [this] { return writeError or pendingBatches.size() < 2 * numberOfStagingBuffers; });
+    if (writeError)
+    {
+        std::rethrow_exception(writeError);
+    }
+    pendingBatches.emplace_back(std::move(batch));
+    std::string emptyBatch;
+    if (not writtenBatches.empty())
+    {
+        emptyBatch = std::move(writtenBatches.back());
+        writtenBatches.pop_back();
+    }
+    lock.unlock();
+    writerCondition.notify_one();
+    return emptyBatch;
+}
+
+void BatchedFileWriter::runWriter(const std::stop_token& stopToken)
+{
+    while (not stopToken.stop_requested())
+    {
+        std::vector<std::string> batches;
+        {
+            std::unique_lock lock(writerMutex);
+            writerCondition.wait_for(lock, stopToken, flushPolicy.flushInterval, [this] { return not pendingBatches.empty(); });
+            batches.swap(pendingBatches);
+        }
+        handOverCondition.notify_all();
+
+        /// The flush interval passed without a full staging buffer. Thus, we write whatever the workers have staged so far.
+        if (batches.empty() and not stopToken.stop_requested())
+        {
+            batches = collectStagingBuffers();
+        }
+
+        try
+        {
+            writeBatches(batches);
+        }
+        catch (...) /// NOLINT(no-raw-catch-all)
+        {
+            {
+                const std::scoped_lock lock(writerMutex);
+                writeError = std::current_exception();
+            }
+            handOverCondition.notify_all();
+            return;
+        }
+
+        const std::scoped_lock lock(writerMutex);
+        for (auto& batch : batches)
+        {
+            if (writtenBatches.size() < numberOfStagingBuffers and batch.capacity() >= flushPolicy.flushSizeInBytes)
+            {
+                batch.clear();
+                writtenBatches.emplace_back(std::move(batch));
+            }
+        }
+    }
+}
+
+std::vector<std::string> BatchedFileWriter::collectStagingBuffers()
+{
+    std::vector<std::string> batches;
+    for (size_t i = 0; i < numberOfStagingBuffers; ++i)
+    {
+        const std::scoped_lock stagingLock(stagingBuffers[i].mutex);
+        /// A worker hands over its full staging buffer while holding the lock of the staging buffer. Thus, all earlier batches of this
+        /// worker are pending now and must be written before its staged data. We lock in the same order as write() and handOver().
+        {
+            const std::scoped_lock writerLock(writerMutex);
+            std::ranges::move(pendingBatches, std::back_inserter(batches));
+            pendingBatches.clear();
+        }
+        if (not stagingBuffers[i].data.empty())
+        {
+            batches.emplace_back(std::exchange(stagingBuffers[i].data, {}));
+        }
+    }
+    handOverCondition.notify_all();
+    return batches;
+}
+
+void BatchedFileWriter::writeBatches(std::vector<std::string>& batches)
+{
+    std::vector<iovec> iovecs;
+    iovecs.reserve(std::min<size_t>(batches.size(), IOV_MAX));
+    size_t bytesInIovecs = 0;
+    const auto writeIovecs = [&]
+    {
+        writeFully(fileDescriptor, iovecs, fileOffset, filePath);
+        fileOffset += bytesInIovecs;
+        iovecs.clear();
+        bytesInIovecs = 0;
+    };
+
+    for (auto& batch : batches)
+    {
+        if (batch.empty())
+        {
+            continue;
+        }
+        /// We roll over only if the current file contains data. Thus, a batch larger than the rolling size gets a file of its own.
+        const auto bytesInFile = fileOffset + bytesInIovecs;
+        if (flushPolicy.rollingFileSizeInBytes != 0 and bytesInFile > fileHeader.size()
+            and bytesInFile + batch.size() > flushPolicy.rollingFileSizeInBytes)
+        {
+            writeIovecs();
+            closeFile();
+            ++numberOfRolledFiles;
+            openFile(false);
+        }
+        if (iovecs.size() == IOV_MAX)
+        {
+            writeIovecs();
+        }
+        iovecs.emplace_back(iovec{.iov_base = batch.data(), .iov_len = batch.size()});
+        bytesInIovecs += batch.size();
+    }
+    writeIovecs();
+}
+
+void BatchedFileWriter::openFile(const bool append)
+{
+    const auto currentFilePath = numberOfRolledFiles == 0 ? filePath : fmt::format("{}.{}", filePath, numberOfRolledFiles);
+    const auto flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC);
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    fileDescriptor = ::open(currentFilePath.c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fileDescriptor < 0)
+    {
+        throw CannotOpenSink("Could not open output file; filePathOutput={}: {}", currentFilePath, std::strerror(errno));
+    }
+
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        const auto error = errno;
+        closeFile();
+        throw CannotOpenSink("Could not determine the size of output file; filePathOutput={}: {}", currentFilePath, std::strerror(error));
+    }
+    fileOffset = static_cast<size_t>(fileStatus.st_size);
+    NES_DEBUG("Opened output file {} at offset {}", currentFilePath, fileOffset);
+
+    /// Write the header to the file, if it is empty
+    if (fileOffset == 0 and not fileHeader.empty())
+    {
+        std::array header{iovec{.iov_base = fileHeader.data(), .iov_len = fileHeader.size()}};
+        try
+        {
+            writeFully(fileDescriptor, header, fileOffset, currentFilePath);
+        }
+        catch (...) /// NOLINT(no-raw-catch-all)
+        {
+            closeFile();
+            throw;
+        }
+        fileOffset = fileHeader.size();
+    }
+}
+
+void BatchedFileWriter::closeFile()
+{
+    if (fileDescriptor >= 0)
+    {
+        ::close(fileDescriptor);
+        fileDescriptor = -1;
+    }
+}
+
+}
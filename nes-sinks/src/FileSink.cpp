@@ -14,6 +14,7 @@
 
 #include <Sinks/FileSink.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -26,6 +27,7 @@
 
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sinks/BatchedFileWriter.hpp>
 #include <Sinks/Sink.hpp>
 #include <Sinks/SinkDescriptor.hpp>
 #include <SinksParsing/CSVFormat.hpp>
@@ -47,6 +49,14 @@ FileSink::FileSink(const SinkDescriptor& sinkDescriptor)
     , isAppend(sinkDescriptor.getFromConfig(ConfigParametersFile::APPEND))
     , isOpen(false)
 {
+    if (sinkDescriptor.getFromConfig(ConfigParametersFile::BATCHED_WRITE))
+    {
+        batchedWritePolicy = BatchedFileWriter::FlushPolicy{
+            .flushSizeInBytes = sinkDescriptor.getFromConfig(ConfigParametersFile::FLUSH_SIZE_IN_BYTES),
+            .flushInterval = std::chrono::milliseconds(sinkDescriptor.getFromConfig(ConfigParametersFile::FLUSH_INTERVAL_MS)),
+            .rollingFileSizeInBytes = sinkDescriptor.getFromConfig(ConfigParametersFile::ROLLING_FILE_SIZE_IN_BYTES)};
+    }
+
     switch (const auto inputFormat = sinkDescriptor.getFromConfig(ConfigParametersFile::INPUT_FORMAT))
     {
         case InputFormat::CSV:
@@ -62,13 +72,27 @@ FileSink::FileSink(const SinkDescriptor& sinkDescriptor)
 
 std::ostream& FileSink::toString(std::ostream& str) const
 {
-    str << fmt::format("FileSink(filePathOutput: {}, isAppend: {})", outputFilePath, isAppend);
+    str << fmt::format(
+        "FileSink(filePathOutput: {}, isAppend: {}, isBatched: {})", outputFilePath, isAppend, batchedWritePolicy.has_value());
     return str;
 }
 
-void FileSink::start(PipelineExecutionContext&)
+void FileSink::start(PipelineExecutionContext& pipelineExecutionContext)
 {
     NES_DEBUG("Setting up file sink: {}", *this);
+    if (batchedWritePolicy.has_value())
+    {
+        /// Every worker thread gets a staging buffer of its own
+        batchedFileWriter = std::make_unique<BatchedFileWriter>(
+            outputFilePath,
+            isAppend,
+            formatter->getFormattedSchema(),
+            pipelineExecutionContext.getNumberOfWorkerThreads(),
+            batchedWritePolicy.value());
+        isOpen = true;
+        return;
+    }
+
     auto stream = outputFileStream.wlock();
     /// Remove an existing file unless the isAppend mode is isAppend.
     if (!isAppend)
@@ -104,14 +128,22 @@ void FileSink::start(PipelineExecutionContext&)
     }
 }
 
-void FileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext&)
+void FileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
     PRECONDITION(inputTupleBuffer, "Invalid input buffer in FileSink.");
     PRECONDITION(isOpen, "Sink was not opened");
 
     {
-        auto fBuffer = formatter->getFormattedBuffer(inputTupleBuffer);
+        /// Each worker thread formats into the same string for all buffers, which saves allocating the string for every buffer
+        thread_local std::string fBuffer;
+        fBuffer.clear();
+        formatter->appendFormattedBuffer(inputTupleBuffer, fBuffer);
         NES_TRACE("Writing tuples to file sink; filePathOutput={}, fBuffer={}", outputFilePath, fBuffer);
+        if (batchedFileWriter)
+        {
+            batchedFileWriter->write(pipelineExecutionContext.getId().getRawValue(), fBuffer);
+        }
+        else
         {
             auto wlocked = outputFileStream.wlock();
             wlocked->write(fBuffer.c_str(), static_cast<long>(fBuffer.size()));
@@ -123,6 +155,13 @@ void FileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionCon
 void FileSink::stop(PipelineExecutionContext&)
 {
     NES_DEBUG("Closing file sink, filePathOutput={}", outputFilePath);
+    if (batchedFileWriter)
+    {
+        /// Writes the remaining staged buffers
+        batchedFileWriter->close();
+        batchedFileWriter.reset();
+        return;
+    }
     auto stream = outputFileStream.wlock();
     stream->flush();
     stream->close();
@@ -15,19 +15,14 @@
 #include <SinksParsing/CSVFormat.hpp>
 
 #include <cstddef>
-#include <cstdint>
 #include <ostream>
-#include <ranges>
-#include <span>
-#include <sstream>
 #include <string>
+#include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
-#include <MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/FieldFormatter.hpp>
 #include <SinksParsing/Format.hpp>
 #include <fmt/format.h>
-#include <fmt/ranges.h>
-#include <magic_enum/magic_enum.hpp>
 #include <ErrorHandling.hpp>
 
 namespace NES
@@ -36,52 +31,26 @@ CSVFormat::CSVFormat(const Schema& schema) : CSVFormat(schema, false)
 {
 }
 
-CSVFormat::CSVFormat(const Schema& pSchema, const bool escapeStrings) : Format(pSchema), escapeStrings(escapeStrings)
+CSVFormat::CSVFormat(const Schema& pSchema, const bool escapeStrings) : Format(pSchema)
 {
     PRECONDITION(schema.getNumberOfFields() != 0, "Formatter expected a non-empty schema");
     size_t offset = 0;
     for (const auto& field : schema.getFields())
     {
         const auto physicalType = field.dataType;
-        formattingContext.offsets.push_back(offset);
+        formattingContext.fieldFormatters.emplace_back(FieldFormatter{
+            .offsetInTuple = offset,
+            .prefix = formattingContext.fieldFormatters.empty() ? "" : ",",
+            .appendField = getAppendFieldFunction(physicalType),
+            .quoted = escapeStrings and physicalType.type == DataType::Type::VARSIZED});
         offset += physicalType.getSizeInBytes();
-        formattingContext.physicalTypes.emplace_back(physicalType);
     }
     formattingContext.schemaSizeInBytes = schema.getSizeOfSchemaInBytes();
 }
 
-std::string CSVFormat::getFormattedBuffer(const TupleBuffer& inputBuffer) const
+void CSVFormat::appendFormattedBuffer(const TupleBuffer& inputBuffer, std::string& output) const
 {
-    return tupleBufferToFormattedCSVString(inputBuffer, formattingContext);
-}
-
-std::string CSVFormat::tupleBufferToFormattedCSVString(TupleBuffer tbuffer, const FormattingContext& formattingContext) const
-{
-    std::stringstream ss;
-    const auto numberOfTuples = tbuffer.getNumberOfTuples();
-    const auto buffer = std::span(tbuffer.getBuffer<char>(), numberOfTuples * formattingContext.schemaSizeInBytes);
-    for (size_t i = 0; i < numberOfTuples; i++)
-    {
-        auto tuple = buffer.subspan(i * formattingContext.schemaSizeInBytes, formattingContext.schemaSizeInBytes);
-        auto fields = std::views::iota(static_cast<size_t>(0), formattingContext.offsets.size())
-            | std::views::transform(
-                          [&formattingContext, &tuple, &tbuffer, copyOfEscapeStrings = escapeStrings](const auto& index)
-                          {
-                              const auto physicalType = formattingContext.physicalTypes[index];
-                              if (physicalType.type == DataType::Type::VARSIZED)
-                              {
-                                  auto childIdx = *reinterpret_cast<const uint32_t*>(&tuple[formattingContext.offsets[index]]);
-                                  if (copyOfEscapeStrings)
-                                  {
-                                      return "\"" + readVarSizedData(tbuffer, childIdx) + "\"";
-                                  }
-                                  return readVarSizedData(tbuffer, childIdx);
-                              }
-                              return physicalType.formattedBytesToString(&tuple[formattingContext.offsets[index]]);
-                          });
-        ss << fmt::format("{}\n", fmt::join(fields, ","));
-    }
-    return ss.str();
+    appendFormattedTuples(output, inputBuffer, formattingContext.schemaSizeInBytes, formattingContext.fieldFormatters, "\n");
 }
 
 std::ostream& operator<<(std::ostream& out, const CSVFormat& format)
@@ -0,0 +1,173 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SinksParsing/FieldFormatter.hpp>
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename T>
+T readField(const char* field)
+{
+    T value;
+    std::memcpy(&value, field, sizeof(T));
+    return value;
+}
+
+template <std::integral T>
+void appendInteger(std::string& output, const char* field, const TupleBuffer&)
+{
+    std::array<char, std::numeric_limits<T>::digits10 + 3> formatted{};
+    const auto [end, errorCode] = std::to_chars(formatted.begin(), formatted.end(), readField<T>(field));
+    INVARIANT(errorCode == std::errc{}, "Formatted integer does not fit into {} bytes", formatted.size());
+    output.append(formatted.data(), end);
+}
+
+/// Formats floats with six decimal places and removes trailing zeros, but keeps at least one decimal place, like Util::formatFloat
+template <std::floating_point T>
+void appendFloat(std::string& output, const char* field, const TupleBuffer&)
+{
+    constexpr int decimalPlaces = 6;
+    std::array<char, std::numeric_limits<T>::max_exponent10 + decimalPlaces + 4> formatted{};
+    const auto [end, errorCode]
+        = std::to_chars(formatted.begin(), formatted.end(), readField<T>(field), std::chars_format::fixed, decimalPlaces);
+    INVARIANT(errorCode == std::errc{}, "Formatted float does not fit into {} bytes", formatted.size());
+
+    const std::string_view formattedView(formatted.data(), end);
+    const auto decimalPos = formattedView.find('.');
+    if (decimalPos == std::string_view::npos)
+    {
+        output.append(formattedView);
+        return;
+    }
+    const auto lastNonZero = formattedView.find_last_not_of('0');
+    output.append(formattedView.substr(0, lastNonZero == decimalPos ? decimalPos + 2 : lastNonZero + 1));
+}
+
+void appendBoolean(std::string& output, const char* field, const TupleBuffer&)
+{
+    output.push_back(readField<bool>(field) ? '1' : '0');
+}
+
+void appendChar(std::string& output, const char* field, const TupleBuffer&)
+{
+    output.push_back(*field);
+}
+
+/// The field contains the index of the child buffer that stores the length of the text followed by the text
+void appendVarSized(std::string& output, const char* field, const TupleBuffer& tupleBuffer)
+{
+    const auto childBuffer = tupleBuffer.loadChildBuffer(readField<uint32_t>(field));
+    const auto textLength = *childBuffer.getBuffer<uint32_t>();
+    output.append(childBuffer.getBuffer<char>() + sizeof(uint32_t), textLength);
+}
+
+/// The field contains the length of the text followed by the text
+void appendInlineVarSized(std::string& output, const char* field, const TupleBuffer&)
+{
+    output.append(field + sizeof(uint32_t), readField<uint32_t>(field));
+}
+
+void appendUndefined(std::string& output, const char*, const TupleBuffer&)
+{
+    output.append("invalid physical type");
+}
+}
+
+AppendFieldFunction getAppendFieldFunction(const DataType& dataType)
+{
+    switch (dataType.type)
+    {
+        case DataType::Type::INT8:
+            return appendInteger<int8_t>;
+        case DataType::Type::UINT8:
+            return appendInteger<uint8_t>;
+        case DataType::Type::INT16:
+            return appendInteger<int16_t>;
+        case DataType::Type::UINT16:
+            return appendInteger<uint16_t>;
+        case DataType::Type::INT32:
+            return appendInteger<int32_t>;
+        case DataType::Type::UINT32:
+            return appendInteger<uint32_t>;
+        case DataType::Type::INT64:
+            return appendInteger<int64_t>;
+        case DataType::Type::UINT64:
+            return appendInteger<uint64_t>;
+        case DataType::Type::FLOAT32:
+            return appendFloat<float>;
+        case DataType::Type::FLOAT64:
+            return appendFloat<double>;
+        case DataType::Type::BOOLEAN:
+            return appendBoolean;
+        case DataType::Type::CHAR:
+            return appendChar;
+        case DataType::Type::VARSIZED:
+            return appendVarSized;
+        case DataType::Type::VARSIZED_POINTER_REP:
+            return appendInlineVarSized;
+        case DataType::Type::UNDEFINED:
+            return appendUndefined;
+    }
+    std::unreachable();
+}
+
+void appendFormattedTuples(
+    std::string& output,
+    const TupleBuffer& tupleBuffer,
+    const size_t tupleSizeInBytes,
+    const std::span<const FieldFormatter> fieldFormatters,
+    const std::string_view tupleSuffix)
+{
+    const auto numberOfTuples = tupleBuffer.getNumberOfTuples();
+    const auto tuples = std::span(tupleBuffer.getBuffer<char>(), numberOfTuples * tupleSizeInBytes);
+    for (size_t i = 0; i < numberOfTuples; ++i)
+    {
+        const auto tuple = tuples.subspan(i * tupleSizeInBytes, tupleSizeInBytes);
+        for (const auto& fieldFormatter : fieldFormatters)
+        {
+            output.append(fieldFormatter.prefix);
+            if (fieldFormatter.quoted)
+            {
+                output.push_back('"');
+            }
+            fieldFormatter.appendField(output, &tuple[fieldFormatter.offsetInTuple], tupleBuffer);
+            if (fieldFormatter.quoted)
+            {
+                output.push_back('"');
+            }
+        }
+        output.append(tupleSuffix);
+    }
+}
+
+}
@@ -15,18 +15,14 @@
 #include <SinksParsing/JSONFormat.hpp>
 
 #include <cstddef>
-#include <cstdint>
 #include <iostream>
-#include <ranges>
-#include <span>
-#include <sstream>
 #include <string>
+#include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
-#include <MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/FieldFormatter.hpp>
 #include <SinksParsing/Format.hpp>
 #include <fmt/format.h>
-#include <fmt/ranges.h>
 #include <ErrorHandling.hpp>
 
 namespace NES
@@ -39,45 +35,19 @@ JSONFormat::JSONFormat(const Schema& pSchema) : Format(pSchema)
     for (const auto& field : schema.getFields())
     {
         const auto physicalType = field.dataType;
-        formattingContext.offsets.push_back(offset);
+        formattingContext.fieldFormatters.emplace_back(FieldFormatter{
+            .offsetInTuple = offset,
+            .prefix = fmt::format(R"({}"{}":)", formattingContext.fieldFormatters.empty() ? "{" : ",", field.name),
+            .appendField = getAppendFieldFunction(physicalType),
+            .quoted = physicalType.type == DataType::Type::VARSIZED});
         offset += physicalType.getSizeInBytes();
-        formattingContext.physicalTypes.emplace_back(physicalType);
-        formattingContext.names.emplace_back(field.name);
     }
     formattingContext.schemaSizeInBytes = schema.getSizeOfSchemaInBytes();
 }
 
-std::string JSONFormat::getFormattedBuffer(const TupleBuffer& inputBuffer) const
+void JSONFormat::appendFormattedBuffer(const TupleBuffer& inputBuffer, std::string& output) const
 {
-    return tupleBufferToFormattedJSONString(inputBuffer, formattingContext);
-}
-
-std::string JSONFormat::tupleBufferToFormattedJSONString(TupleBuffer tbuffer, const FormattingContext& formattingContext)
-{
-    std::stringstream ss;
-    auto numberOfTuples = tbuffer.getNumberOfTuples();
-    auto buffer = std::span(tbuffer.getBuffer<char>(), numberOfTuples * formattingContext.schemaSizeInBytes);
-    for (size_t i = 0; i < numberOfTuples; i++)
-    {
-        auto tuple = buffer.subspan(i * formattingContext.schemaSizeInBytes, formattingContext.schemaSizeInBytes);
-        auto fields
-            = std::views::iota(static_cast<size_t>(0), formattingContext.offsets.size())
-            | std::views::transform(
-                  [&](const auto& index)
-                  {
-                      auto type = formattingContext.physicalTypes[index];
-                      auto offset = formattingContext.offsets[index];
-                      if (type.type == DataType::Type::VARSIZED)
-                      {
-                          auto childIdx = *std::bit_cast<const uint32_t*>(&tuple[offset]);
-                          return fmt::format(R"("{}":"{}")", formattingContext.names.at(index), readVarSizedData(tbuffer, childIdx));
-                      }
-                      return fmt::format("\"{}\":{}", formattingContext.names.at(index), type.formattedBytesToString(&tuple[offset]));
-                  });
-
-        ss << fmt::format("{{{}}}\n", fmt::join(fields, ","));
-    }
-    return ss.str();
+    appendFormattedTuples(output, inputBuffer, formattingContext.schemaSizeInBytes, formattingContext.fieldFormatters, "}\n");
 }
 
 std::ostream& operator<<(std::ostream& out, const JSONFormat& format)
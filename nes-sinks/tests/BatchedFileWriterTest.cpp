@@ -0,0 +1,399 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sinks/BatchedFileWriter.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/FileSink.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <TestTaskQueue.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+namespace
+{
+constexpr std::chrono::milliseconds DEFAULT_TIMEOUT = std::chrono::milliseconds(5000);
+/// Disables the flush interval for tests that only write full staging buffers
+constexpr std::chrono::milliseconds NO_FLUSH_INTERVAL = std::chrono::hours(1);
+/// Writing to /dev/full fails with ENOSPC, which lets us test the error handling of the writer thread
+constexpr std::string_view FULL_DEVICE = "/dev/full";
+}
+
+class BatchedFileWriterTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("BatchedFileWriterTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup BatchedFileWriterTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        testDirectory = std::filesystem::temp_directory_path()
+            / fmt::format("BatchedFileWriterTest-{}", ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(testDirectory);
+        std::filesystem::create_directories(testDirectory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDirectory);
+        BaseUnitTest::TearDown();
+    }
+
+    static std::string readFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    /// Polls the file until it has the expected content, since the writer thread writes it asynchronously
+    static bool waitForFileContent(const std::filesystem::path& path, const std::string& expectedContent)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            if (readFile(path) == expectedContent)
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    std::filesystem::path testDirectory;
+};
+
+TEST_F(BatchedFileWriterTest, writesHeaderAndDataOfAllWorkersOnClose)
+{
+    constexpr size_t numberOfWorkers = 4;
+    constexpr size_t numberOfRecordsPerWorker = 1000;
+    const auto filePath = testDirectory / "output.csv";
+    BatchedFileWriter writer(
+        filePath,
+        false,
+        "header\n",
+        numberOfWorkers,
+        {.flushSizeInBytes = 64, .flushInterval = NO_FLUSH_INTERVAL, .rollingFileSizeInBytes = 0});
+    {
+        std::vector<std::jthread> workers;
+        for (size_t worker = 0; worker < numberOfWorkers; ++worker)
+        {
+            workers.emplace_back(
+                [&writer, worker]
+                {
+                    for (size_t record = 0; record < numberOfRecordsPerWorker; ++record)
+                    {
+                        writer.write(worker, fmt::format("{},{}\n", worker, record));
+                    }
+                });
+        }
+    }
+    writer.close();
+
+    /// The writer preserves the order of the records of each worker and writes every record contiguously
+    auto content = readFile(filePath);
+    ASSERT_TRUE(content.starts_with("header\n"));
+    content.erase(0, std::string_view("header\n").size());
+    std::vector<size_t> nextRecordOfWorker(numberOfWorkers, 0);
+    std::istringstream lines(content);
+    for (std::string line; std::getline(lines, line);)
+    {
+        const auto separator = line.find(',');
+        ASSERT_NE(separator, std::string::npos) << line;
+        const auto worker = std::stoul(line.substr(0, separator));
+        ASSERT_LT(worker, numberOfWorkers);
+        EXPECT_EQ(std::stoul(line.substr(separator + 1)), nextRecordOfWorker[worker]);
+        ++nextRecordOfWorker[worker];
+    }
+    EXPECT_EQ(nextRecordOfWorker, std::vector<size_t>(numberOfWorkers, numberOfRecordsPerWorker));
+}
+
+TEST_F(BatchedFileWriterTest, appendsToExistingFileWithoutHeader)
+{
+    const auto filePath = testDirectory / "output.csv";
+    std::ofstream(filePath) << "header\nexisting\n";
+    BatchedFileWriter writer(
+        filePath, true, "header\n", 1, {.flushSizeInBytes = 1024, .flushInterval = NO_FLUSH_INTERVAL, .rollingFileSizeInBytes = 0});
+    writer.write(0, "appended\n");
+    writer.close();
+    EXPECT_EQ(readFile(filePath), "header\nexisting\nappended\n");
+}
+
+TEST_F(BatchedFileWriterTest, rollsOverIntoNewFilesThatStartWithTheHeader)
+{
+    /// Every file fits the header (7 bytes) and two records (10 bytes each), as a third record would exceed the rolling size
+    const auto filePath = testDirectory / "output.csv";
+    BatchedFileWriter writer(
+        filePath, false, "header\n", 1, {.flushSizeInBytes = 10, .flushInterval = NO_FLUSH_INTERVAL, .rollingFileSizeInBytes = 35});
+    for (size_t record = 0; record < 10; ++record)
+    {
+        writer.write(0, fmt::format("{:09}\n", record));
+    }
+    writer.close();
+
+    EXPECT_EQ(readFile(filePath), "header\n000000000\n000000001\n");
+    for (size_t rolledFile = 1; rolledFile < 5; ++rolledFile)
+    {
+        const auto rolledFilePath = fmt::format("{}.{}", filePath.string(), rolledFile);
+        EXPECT_EQ(readFile(rolledFilePath), fmt::format("header\n{:09}\n{:09}\n", 2 * rolledFile, (2 * rolledFile) + 1));
+    }
+    EXPECT_FALSE(std::filesystem::exists(fmt::format("{}.5", filePath.string())));
+}
+
+TEST_F(BatchedFileWriterTest, rollsOverBeforeBatchesLargerThanTheRollingSize)
+{
+    /// A batch that exceeds the rolling size on its own gets a file of its own
+    const auto filePath = testDirectory / "output.csv";
+    BatchedFileWriter writer(
+        filePath, false, "header\n", 1, {.flushSizeInBytes = 1, .flushInterval = NO_FLUSH_INTERVAL, .rollingFileSizeInBytes = 16});
+    writer.write(0, "small\n");
+    writer.write(0, "a batch larger than the rolling size\n");
+    writer.write(0, "small\n");
+    writer.close();
+
+    EXPECT_EQ(readFile(filePath), "header\nsmall\n");
+    EXPECT_EQ(readFile(fmt::format("{}.1", filePath.string())), "header\na batch larger than the rolling size\n");
+    EXPECT_EQ(readFile(fmt::format("{}.2", filePath.string())), "header\nsmall\n");
+}
+
+TEST_F(BatchedFileWriterTest, flushesStagedDataAfterTheFlushInterval)
+{
+    /// The staged data never reaches the flush size, thus only the flush interval writes it before the writer is closed
+    const auto filePath = testDirectory / "output.csv";
+    BatchedFileWriter writer(
+        filePath,
+        false,
+        "header\n",
+        2,
+        {.flushSizeInBytes = 1024 * 1024, .flushInterval = std::chrono::milliseconds(10), .rollingFileSizeInBytes = 0});
+    EXPECT_EQ(readFile(filePath), "header\n");
+    writer.write(0, "first\n");
+    writer.write(1, "second\n");
+    EXPECT_TRUE(waitForFileContent(filePath, "header\nfirst\nsecond\n")) << readFile(filePath);
+
+    writer.write(1, "third\n");
+    EXPECT_TRUE(waitForFileContent(filePath, "header\nfirst\nsecond\nthird\n")) << readFile(filePath);
+    writer.close();
+    EXPECT_EQ(readFile(filePath), "header\nfirst\nsecond\nthird\n");
+}
+
+TEST_F(BatchedFileWriterTest, writeBlocksWhileTheWriterThreadFallsBehind)
+{
+    constexpr size_t numberOfStagingBuffers = 2;
+    constexpr size_t maxNumberOfPendingBatches = 2 * numberOfStagingBuffers;
+    constexpr size_t numberOfRecords = 10;
+    const auto filePath = testDirectory / "output.csv";
+    BatchedFileWriter writer(
+        filePath,
+        false,
+        "header\n",
+        numberOfStagingBuffers,
+        {.flushSizeInBytes = 4, .flushInterval = std::chrono::milliseconds(1), .rollingFileSizeInBytes = 0});
+
+    /// After the first flush interval without pending batches, the writer thread collects the staging buffers and blocks on the lock of the
+    /// second staging buffer, while the worker only writes to the first one.
+    std::unique_lock stallWriterThread(writer.stagingBuffers[1].mutex);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::atomic<size_t> numberOfCompletedWrites{0};
+    std::jthread worker(
+        [&]
+        {
+            for (size_t record = 0; record < numberOfRecords; ++record)
+            {
+                writer.write(0, fmt::format("{:03}\n", record));
+                ++numberOfCompletedWrites;
+            }
+        });
+
+    /// Every write hands over a full staging buffer. Once the pending batches are full, the worker must wait for the writer thread.
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+    while (numberOfCompletedWrites < maxNumberOfPendingBatches and std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(numberOfCompletedWrites, maxNumberOfPendingBatches);
+    {
+        const std::scoped_lock lock(writer.writerMutex);
+        EXPECT_EQ(writer.pendingBatches.size(), maxNumberOfPendingBatches);
+    }
+    EXPECT_EQ(readFile(filePath), "header\n");
+
+    stallWriterThread.unlock();
+    worker.join();
+    EXPECT_EQ(numberOfCompletedWrites, numberOfRecords);
+    writer.close();
+
+    std::string expectedContent = "header\n";
+    for (size_t record = 0; record < numberOfRecords; ++record)
+    {
+        expectedContent += fmt::format("{:03}\n", record);
+    }
+    EXPECT_EQ(readFile(filePath), expectedContent);
+}
+
+TEST_F(BatchedFileWriterTest, flushIntervalKeepsTheOrderOfHandedOverAndStagedData)
+{
+    const auto filePath = testDirectory / "output.csv";
+    BatchedFileWriter writer(
+        filePath,
+        false,
+        "header\n",
+        2,
+        {.flushSizeInBytes = 4, .flushInterval = std::chrono::milliseconds(1), .rollingFileSizeInBytes = 0});
+
+    /// After the first flush interval without pending batches, the writer thread collects the staging buffers and blocks on the lock of the
+    /// second staging buffer. Meanwhile, we write to the second staging buffer like write() does: we hand over a full staging buffer and
+    /// stage the next record, before the writer thread gets the lock.
+    {
+        auto& stagingBuffer = writer.stagingBuffers[1];
+        const std::scoped_lock stallWriterThread(stagingBuffer.mutex);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        stagingBuffer.data.append("000\n");
+        stagingBuffer.data = writer.handOver(std::move(stagingBuffer.data));
+        stagingBuffer.data.append("001\n");
+    }
+
+    /// The handed over record must be written before the staged one
+    EXPECT_TRUE(waitForFileContent(filePath, "header\n000\n001\n")) << readFile(filePath);
+    writer.close();
+    EXPECT_EQ(readFile(filePath), "header\n000\n001\n");
+}
+
+TEST_F(BatchedFileWriterTest, writeErrorOfTheWriterThreadSurfacesInWriteAndClose)
+{
+    if (not std::filesystem::exists(FULL_DEVICE))
+    {
+        GTEST_SKIP() << FULL_DEVICE << " does not exist";
+    }
+    /// Without a header, opening the file succeeds and the first write of the writer thread fails
+    BatchedFileWriter writer(
+        std::string(FULL_DEVICE), false, "", 1, {.flushSizeInBytes = 1, .flushInterval = NO_FLUSH_INTERVAL, .rollingFileSizeInBytes = 0});
+    bool writeFailed = false;
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+    while (not writeFailed and std::chrono::steady_clock::now() < deadline)
+    {
+        try
+        {
+            writer.write(0, "data\n");
+        }
+        catch (const Exception& exception)
+        {
+            EXPECT_EQ(exception.code(), ErrorCode::CannotWriteSink);
+            writeFailed = true;
+        }
+    }
+    EXPECT_TRUE(writeFailed);
+    ASSERT_EXCEPTION_ERRORCODE(writer.close(), ErrorCode::CannotWriteSink);
+    /// Closing again, e.g., in the destructor, does not throw anymore
+    writer.close();
+}
+
+TEST_F(BatchedFileWriterTest, failingHeaderWriteThrowsOnConstruction)
+{
+    if (not std::filesystem::exists(FULL_DEVICE))
+    {
+        GTEST_SKIP() << FULL_DEVICE << " does not exist";
+    }
+    const BatchedFileWriter::FlushPolicy flushPolicy{
+        .flushSizeInBytes = 1, .flushInterval = NO_FLUSH_INTERVAL, .rollingFileSizeInBytes = 0};
+    ASSERT_EXCEPTION_ERRORCODE(
+        const BatchedFileWriter writer(std::string(FULL_DEVICE), false, "header\n", 1, flushPolicy), ErrorCode::CannotWriteSink);
+}
+
+TEST_F(BatchedFileWriterTest, fileSinkThrowsWriteErrorOfTheWriterThread)
+{
+    if (not std::filesystem::exists(FULL_DEVICE))
+    {
+        GTEST_SKIP() << FULL_DEVICE << " does not exist";
+    }
+    /// The first rolled file links to /dev/full. Thus, writing the header of the first rolled file fails in the writer thread.
+    const auto filePath = testDirectory / "output.csv";
+    std::filesystem::create_symlink(FULL_DEVICE, fmt::format("{}.1", filePath.string()));
+
+    const auto schema = Schema{}.addField("id", DataType::Type::UINT64);
+    const auto sinkDescriptor = SinkCatalog{}.addSinkDescriptor(
+        "batchedFileSink",
+        schema,
+        FileSink::NAME,
+        {{"file_path", filePath.string()},
+         {"input_format", "CSV"},
+         {"batched_write", "true"},
+         {"flush_size_in_bytes", "1"},
+         {"flush_interval_ms", "3600000"},
+         {"rolling_file_size_in_bytes", "1"}});
+    ASSERT_TRUE(sinkDescriptor.has_value());
+    FileSink sink(sinkDescriptor.value());
+
+    const auto bufferManager = BufferManager::create();
+    TestPipelineExecutionContext pipelineExecutionContext(bufferManager, std::make_shared<std::vector<std::vector<TupleBuffer>>>(1));
+    sink.start(pipelineExecutionContext);
+
+    auto buffer = bufferManager->getBufferBlocking();
+    buffer.getBuffer<uint64_t>()[0] = 42;
+    buffer.setNumberOfTuples(1);
+    bool executeFailed = false;
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+    while (not executeFailed and std::chrono::steady_clock::now() < deadline)
+    {
+        try
+        {
+            sink.execute(buffer, pipelineExecutionContext);
+        }
+        catch (const Exception& exception)
+        {
+            EXPECT_EQ(exception.code(), ErrorCode::CannotWriteSink);
+            executeFailed = true;
+        }
+    }
+    EXPECT_TRUE(executeFailed);
+    ASSERT_EXCEPTION_ERRORCODE(sink.stop(pipelineExecutionContext), ErrorCode::CannotWriteSink);
+    /// The first file holds the first buffer, as it did not exceed the rolling size before
+    EXPECT_EQ(readFile(filePath), "id:UINT64\n42\n");
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <optional>
 #include <stop_token>
 #include <string>
 #include <Runtime/TupleBuffer.hpp>
@@ -24,9 +26,23 @@
 namespace NES
 {
 
+/// Configures how the 'SourceIOPool' ingests from a source that supports non-blocking reads.
+struct NonBlockingReadConfiguration
+{
+    /// The SourceIOPool emits a partially filled TupleBuffer at the latest after this interval. Zero only emits full TupleBuffers.
+    std::chrono::milliseconds flushInterval{0};
+};
+
+struct NonBlockingFillResult
+{
+    size_t numberOfBytes;
+    bool endOfStream;
+};
+
 /// Source is the interface for all sources that read data into TupleBuffers.
 /// 'SourceThread' creates TupleBuffers and uses 'Source' to fill.
 /// When 'fillTupleBuffer()' returns successfully, 'SourceThread' creates a new Task using the filled TupleBuffer.
+/// Sources that support non-blocking reads can instead be served by one of the few threads of the 'SourceIOPool'.
 class Source
 {
 public:
@@ -37,6 +53,21 @@ public:
     /// @return the number of bytes read
     virtual size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) = 0;
 
+    /// Returns true, if 'fillTupleBuffer()' replaces the TupleBuffer with one that wraps memory of the source without copying it,
+    /// e.g., a region of a memory-mapped file. The 'SourceThread' then passes an empty TupleBuffer instead of one of its buffer provider.
+    [[nodiscard]] virtual bool providesTupleBuffers() const { return false; }
+
+    /// Returns a configuration, if the source implements 'fillTupleBufferNonBlocking()'.
+    [[nodiscard]] virtual std::optional<NonBlockingReadConfiguration> getNonBlockingReadConfiguration() const { return std::nullopt; }
+
+    /// Returns a file descriptor that becomes readable once new data is available. Called after 'open()'.
+    /// Sources without such a file descriptor, e.g., regular files, are always ready to read.
+    [[nodiscard]] virtual std::optional<int> getReadinessFileDescriptor() const { return std::nullopt; }
+
+    /// Reads the data that is available without blocking into the TupleBuffer, starting at the offset.
+    /// The source signals the end of the stream once it has no more data, i.e., the SourceIOPool never calls it afterward.
+    virtual NonBlockingFillResult fillTupleBufferNonBlocking(TupleBuffer& tupleBuffer, size_t offset);
+
     /// If applicable, opens a connection, e.g., a socket connection to get ready for data consumption.
     virtual void open() = 0;
     /// If applicable, closes a connection, e.g., a socket connection.
@@ -29,6 +29,7 @@ namespace NES
 
 /// Hides SourceThread implementation.
 class SourceThread;
+class SourceIOPool;
 
 struct SourceRuntimeConfiguration
 {
@@ -47,7 +48,8 @@ public:
         OriginId originId, /// Todo #241: Rethink use of originId for sources, use new identifier for unique identification.
         SourceRuntimeConfiguration configuration,
         std::shared_ptr<AbstractBufferProvider> bufferPool,
-        std::unique_ptr<Source> sourceImplementation);
+        std::unique_ptr<Source> sourceImplementation,
+        std::shared_ptr<SourceIOPool> ioPool = nullptr);
 
     ~SourceHandle();
 
@@ -26,15 +26,18 @@ namespace NES
 
 /// Takes a SourceDescriptor and in exchange returns a SourceHandle.
 /// The SourceThread spawns an independent thread for data ingestion and it manages the pipeline and task logic.
+/// If the SourceProvider has source I/O threads, sources that support non-blocking reads share these threads instead.
 /// The Source is owned by the SourceThread. The Source ingests bytes from an interface (TCP, CSV, ..) and writes the bytes to a TupleBuffer.
 class SourceProvider
 {
     size_t defaultMaxInflightBuffers;
     std::shared_ptr<AbstractBufferProvider> bufferPool;
+    std::shared_ptr<SourceIOPool> ioPool;
 
 public:
-    /// Constructor that can be configured with various options
-    SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool);
+    /// Constructor that can be configured with various options. Zero source I/O threads run every source in a thread of its own.
+    SourceProvider(
+        size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool, size_t numberOfSourceIOThreads = 0);
 
     /// Returning a shared pointer, because sources may be shared by multiple executable query plans (qeps).
     [[nodiscard]] std::unique_ptr<SourceHandle> lower(OriginId originId, const SourceDescriptor& sourceDescriptor) const;
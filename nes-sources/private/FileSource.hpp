@@ -32,6 +32,10 @@
 namespace NES
 {
 
+/// Reads a CSV or native file. By default, the source copies the file into the TupleBuffers of its buffer provider.
+/// In memory-mapped mode, the source maps the file and hands out page-aligned regions of the mapping as TupleBuffers without copying them.
+/// Thus, the pages are read from disk, while the input formatter tasks of multiple worker threads format the regions in parallel.
+/// The regions get consecutive sequence numbers, so the SequenceShredder stitches tuples that span region boundaries as usual.
 class FileSource final : public Source
 {
 public:
@@ -47,6 +51,14 @@ public:
 
     size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
 
+    /// In memory-mapped mode, 'fillTupleBuffer()' replaces the TupleBuffer with the next region of the mapping.
+    [[nodiscard]] bool providesTupleBuffers() const override;
+
+    /// A regular file is always ready to read. Thus, the source has no readiness file descriptor.
+    /// Memory-mapped files do not read at all, thus, they do not need the SourceIOPool.
+    [[nodiscard]] std::optional<NonBlockingReadConfiguration> getNonBlockingReadConfiguration() const override;
+    NonBlockingFillResult fillTupleBufferNonBlocking(TupleBuffer& tupleBuffer, size_t offset) override;
+
     /// Open file socket.
     void open() override;
     /// Close file socket.
@@ -58,9 +70,18 @@ public:
     [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
 
 private:
+    /// Unmaps the file, once the source and all TupleBuffers that wrap its regions are released
+    struct MemoryMappedFile;
+
+    size_t fillTupleBufferFromMemoryMappedFile(TupleBuffer& tupleBuffer);
+
     std::ifstream inputFile;
     std::string filePath;
     std::atomic<size_t> totalNumBytesRead;
+    bool memoryMapped;
+    size_t regionSizeInBytes;
+    std::shared_ptr<MemoryMappedFile> memoryMappedFile;
+    size_t offsetOfNextRegion = 0;
 };
 
 struct ConfigParametersCSV
@@ -70,8 +91,20 @@ struct ConfigParametersCSV
         std::nullopt,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILEPATH, config); }};
 
+    /// Maps the file into memory and emits regions of it without copying them
+    static inline const DescriptorConfig::ConfigParameter<bool> MEMORY_MAPPED{
+        "memory_mapped",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(MEMORY_MAPPED, config); }};
+    /// Size of the regions that a memory-mapped source emits, rounded up to a multiple of the page size (only for memory-mapped files)
+    static inline const DescriptorConfig::ConfigParameter<size_t> REGION_SIZE_IN_BYTES{
+        "region_size_in_bytes",
+        1024 * 1024,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(REGION_SIZE_IN_BYTES, config); }};
+
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH);
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SourceDescriptor::parameterMap, FILEPATH, MEMORY_MAPPED, REGION_SIZE_IN_BYTES);
 };
 
 }
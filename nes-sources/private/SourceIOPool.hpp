@@ -0,0 +1,70 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stop_token>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceReturnType.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+
+/// The SourceIOPool multiplexes the sources that support non-blocking reads over a few I/O threads, instead of one thread per source.
+/// Each I/O thread waits via epoll until one of its sources becomes readable and then reads the available data into the current
+/// TupleBuffer of the source. It emits a TupleBuffer once it is full, once its flush interval passed, or at the end of the stream.
+/// Sources without a readiness file descriptor, e.g., regular files, are always ready. The I/O thread reads at most one TupleBuffer of
+/// each source per iteration, so that no source starves the others.
+/// If the buffer pool has no free TupleBuffer, the I/O thread stops watching the source and retries after RETRY_INTERVAL.
+/// IMPORTANT: The emit function blocks, if a source reached its limit of inflight buffers. This blocks all sources of the same I/O thread.
+class SourceIOPool
+{
+public:
+    static constexpr auto RETRY_INTERVAL = std::chrono::milliseconds(10);
+
+    explicit SourceIOPool(size_t numberOfThreads);
+    ~SourceIOPool();
+
+    SourceIOPool(const SourceIOPool& other) = delete;
+    SourceIOPool(SourceIOPool&& other) noexcept = delete;
+    SourceIOPool& operator=(const SourceIOPool& other) = delete;
+    SourceIOPool& operator=(SourceIOPool&& other) noexcept = delete;
+
+    /// Hands the source to one of the I/O threads, which opens it and ingests from it until the end of the stream, a failure, or until a
+    /// stop is requested via the stopToken. The returned future is fulfilled after the source was closed. Afterward, the pool does not
+    /// access the source anymore.
+    [[nodiscard]] std::future<SourceImplementationTermination> add(
+        OriginId originId,
+        Source& source,
+        std::shared_ptr<AbstractBufferProvider> bufferProvider,
+        SourceReturnType::EmitFunction&& emitFunction,
+        const std::stop_token& stopToken);
+
+private:
+    class IOThread;
+
+    std::vector<std::unique_ptr<IOThread>> ioThreads;
+    std::atomic<size_t> nextIOThread{0};
+};
+
+}
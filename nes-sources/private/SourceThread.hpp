@@ -46,7 +46,15 @@ struct SourceImplementationTermination
     }
 };
 
+class SourceIOPool;
+
+namespace detail
+{
+void addBufferMetaData(OriginId originId, SequenceNumber sequenceNumber, TupleBuffer& buffer);
+}
+
 /// The sourceThread starts a detached thread that runs 'runningRoutine()' upon calling 'start()'.
+/// If an I/O pool is given and the source supports non-blocking reads, the sourceThread hands the source to the pool instead.
 /// The runningRoutine orchestrates data ingestion until an end of stream (EOS) or a failure happens.
 /// The data source emits tasks into the TaskQueue when buffers are full, a timeout was hit, or a flush happens.
 /// The data source can call 'addEndOfStream()' from the QueryManager to stop a query via a reconfiguration message.
@@ -59,7 +67,11 @@ public:
     explicit SourceThread(
         OriginId originId, /// Todo #241: Rethink use of originId for sources, use new identifier for unique identification.
         std::shared_ptr<AbstractBufferProvider> bufferManager,
-        std::unique_ptr<Source> sourceImplementation);
+        std::unique_ptr<Source> sourceImplementation,
+        std::shared_ptr<SourceIOPool> ioPool = nullptr);
+
+    /// Waits until the I/O pool closed the source. A thread is joined by the jthread destructor.
+    ~SourceThread();
 
     SourceThread() = delete;
     SourceThread(const SourceThread& other) = delete;
@@ -92,6 +104,9 @@ protected:
     std::atomic_bool started;
 
     std::jthread thread;
+    std::shared_ptr<SourceIOPool> ioPool;
+    /// Stops the source, if it is served by the I/O pool
+    std::stop_source ioStopSource;
     std::future<SourceImplementationTermination> terminationFuture;
 
     /// Runs in detached thread and kills thread when finishing.
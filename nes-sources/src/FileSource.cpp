@@ -14,22 +14,32 @@
 
 #include <FileSource.hpp>
 
+#include <algorithm>
 #include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <format>
 #include <fstream>
 #include <ios>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <fcntl.h>
+#include <unistd.h>
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <SystestSources/SourceTypes.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <ErrorHandling.hpp>
 #include <FileDataRegistry.hpp>
 #include <InlineDataRegistry.hpp>
@@ -39,33 +49,158 @@
 namespace NES
 {
 
-FileSource::FileSource(const SourceDescriptor& sourceDescriptor) : filePath(sourceDescriptor.getFromConfig(ConfigParametersCSV::FILEPATH))
+struct FileSource::MemoryMappedFile
 {
+    MemoryMappedFile(uint8_t* address, const size_t size) : address(address), size(size) { }
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+
+    ~MemoryMappedFile()
+    {
+        if (size != 0)
+        {
+            munmap(address, size);
+        }
+    }
+
+    uint8_t* address;
+    size_t size;
+};
+
+FileSource::FileSource(const SourceDescriptor& sourceDescriptor)
+    : filePath(sourceDescriptor.getFromConfig(ConfigParametersCSV::FILEPATH))
+    , memoryMapped(sourceDescriptor.getFromConfig(ConfigParametersCSV::MEMORY_MAPPED))
+{
+    /// Regions start at page boundaries, thus, the kernel can read ahead each region independently of the others
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto regionSize = std::max(sourceDescriptor.getFromConfig(ConfigParametersCSV::REGION_SIZE_IN_BYTES), size_t{1});
+    this->regionSizeInBytes = ((regionSize + pageSize - 1) / pageSize) * pageSize;
+    if (this->regionSizeInBytes > std::numeric_limits<uint32_t>::max())
+    {
+        throw InvalidConfigParameter(
+            "The region size of {} bytes exceeds the maximum size of a TupleBuffer: {}", regionSize, std::numeric_limits<uint32_t>::max());
+    }
 }
 
 void FileSource::open()
 {
     const auto realCSVPath = std::unique_ptr<char, decltype(std::free)*>{realpath(this->filePath.c_str(), nullptr), std::free};
-    this->inputFile = std::ifstream(realCSVPath.get(), std::ios::binary);
-    if (not this->inputFile)
+    if (not this->memoryMapped)
+    {
+        this->inputFile = std::ifstream(realCSVPath.get(), std::ios::binary);
+        if (not this->inputFile)
+        {
+            throw InvalidConfigParameter("Could not determine absolute pathname: {} - {}", this->filePath.c_str(), std::strerror(errno));
+        }
+        return;
+    }
+
+    if (not realCSVPath)
     {
         throw InvalidConfigParameter("Could not determine absolute pathname: {} - {}", this->filePath.c_str(), std::strerror(errno));
     }
+    const int fileDescriptor = ::open(realCSVPath.get(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        throw CannotOpenSource("Could not open file {}: {}", this->filePath, std::strerror(errno));
+    }
+    /// The mapping stays valid after closing the file descriptor
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) == -1)
+    {
+        const auto error = errno;
+        ::close(fileDescriptor);
+        throw CannotOpenSource("Could not determine the size of file {}: {}", this->filePath, std::strerror(error));
+    }
+    const auto fileSize = static_cast<size_t>(fileStatus.st_size);
+    void* address = nullptr;
+    if (fileSize != 0)
+    {
+        address = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    }
+    const auto error = errno;
+    ::close(fileDescriptor);
+    if (address == MAP_FAILED)
+    {
+        throw CannotOpenSource("Could not map file {} into memory: {}", this->filePath, std::strerror(error));
+    }
+    /// The source hands out the regions in order. Thus, the kernel should read ahead aggressively and may drop pages behind.
+    if (fileSize != 0)
+    {
+        madvise(address, fileSize, MADV_SEQUENTIAL);
+    }
+    this->memoryMappedFile = std::make_shared<MemoryMappedFile>(static_cast<uint8_t*>(address), fileSize);
+    this->offsetOfNextRegion = 0;
 }
 
 void FileSource::close()
 {
     this->inputFile.close();
+    /// TupleBuffers that are still in flight keep the mapping alive
+    this->memoryMappedFile.reset();
+}
+
+bool FileSource::providesTupleBuffers() const
+{
+    return this->memoryMapped;
+}
+
+size_t FileSource::fillTupleBufferFromMemoryMappedFile(TupleBuffer& tupleBuffer)
+{
+    PRECONDITION(this->memoryMappedFile != nullptr, "The memory-mapped FileSource must be opened before filling TupleBuffers");
+    if (this->offsetOfNextRegion >= this->memoryMappedFile->size)
+    {
+        return 0;
+    }
+    auto* const region = this->memoryMappedFile->address + this->offsetOfNextRegion;
+    const auto numBytesInRegion = std::min(this->regionSizeInBytes, this->memoryMappedFile->size - this->offsetOfNextRegion);
+    tupleBuffer = TupleBuffer::wrapMemory(region, static_cast<uint32_t>(numBytesInRegion), this->memoryMappedFile);
+    this->offsetOfNextRegion += numBytesInRegion;
+
+    /// Starts reading the following region from disk, while the input formatter processes the current one
+    if (this->offsetOfNextRegion < this->memoryMappedFile->size)
+    {
+        const auto numBytesInNextRegion = std::min(this->regionSizeInBytes, this->memoryMappedFile->size - this->offsetOfNextRegion);
+        madvise(region + numBytesInRegion, numBytesInNextRegion, MADV_WILLNEED);
+    }
+    this->totalNumBytesRead += numBytesInRegion;
+    return numBytesInRegion;
 }
 
 size_t FileSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
 {
+    if (this->memoryMapped)
+    {
+        return fillTupleBufferFromMemoryMappedFile(tupleBuffer);
+    }
     this->inputFile.read(tupleBuffer.getBuffer<char>(), static_cast<std::streamsize>(tupleBuffer.getBufferSize()));
     const auto numBytesRead = this->inputFile.gcount();
     this->totalNumBytesRead += numBytesRead;
     return numBytesRead;
 }
 
+std::optional<NonBlockingReadConfiguration> FileSource::getNonBlockingReadConfiguration() const
+{
+    if (this->memoryMapped)
+    {
+        return std::nullopt;
+    }
+    return NonBlockingReadConfiguration{};
+}
+
+NonBlockingFillResult FileSource::fillTupleBufferNonBlocking(TupleBuffer& tupleBuffer, const size_t offset)
+{
+    /// Reading a regular file does not wait for new data. Thus, the read returns less bytes than requested only at the end of the file.
+    const auto numBytesRequested = tupleBuffer.getBufferSize() - offset;
+    this->inputFile.read(tupleBuffer.getBuffer<char>() + offset, static_cast<std::streamsize>(numBytesRequested));
+    const auto numBytesRead = static_cast<size_t>(this->inputFile.gcount());
+    this->totalNumBytesRead += numBytesRead;
+    return {.numberOfBytes = numBytesRead, .endOfStream = numBytesRead < numBytesRequested};
+}
+
 DescriptorConfig::Config FileSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
 {
     return DescriptorConfig::validateAndFormat<ConfigParametersCSV>(std::move(config), NAME);
@@ -73,7 +208,11 @@ DescriptorConfig::Config FileSource::validateAndFormat(std::unordered_map<std::s
 
 std::ostream& FileSource::toString(std::ostream& str) const
 {
-    str << std::format("\nFileSource(filepath: {}, totalNumBytesRead: {})", this->filePath, this->totalNumBytesRead.load());
+    str << std::format(
+        "\nFileSource(filepath: {}, memoryMapped: {}, totalNumBytesRead: {})",
+        this->filePath,
+        this->memoryMapped,
+        this->totalNumBytesRead.load());
     return str;
 }
 
@@ -13,10 +13,18 @@
 */
 #include <Sources/Source.hpp>
 
+#include <cstddef>
 #include <ostream>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
 
 namespace NES
 {
+NonBlockingFillResult Source::fillTupleBufferNonBlocking(TupleBuffer&, size_t)
+{
+    throw NotImplemented("The source does not support non-blocking reads");
+}
+
 std::ostream& operator<<(std::ostream& out, const Source& source)
 {
     return source.toString(out);
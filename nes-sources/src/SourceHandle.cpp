@@ -23,6 +23,7 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
+#include <SourceIOPool.hpp>
 #include <SourceThread.hpp>
 
 namespace NES
@@ -31,10 +32,12 @@ SourceHandle::SourceHandle(
     OriginId originId,
     SourceRuntimeConfiguration configuration,
     std::shared_ptr<AbstractBufferProvider> bufferPool,
-    std::unique_ptr<Source> sourceImplementation)
+    std::unique_ptr<Source> sourceImplementation,
+    std::shared_ptr<SourceIOPool> ioPool)
     : configuration(std::move(configuration))
 {
-    this->sourceThread = std::make_unique<SourceThread>(std::move(originId), std::move(bufferPool), std::move(sourceImplementation));
+    this->sourceThread = std::make_unique<SourceThread>(
+        std::move(originId), std::move(bufferPool), std::move(sourceImplementation), std::move(ioPool));
 }
 
 SourceHandle::~SourceHandle() = default;
@@ -0,0 +1,437 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SourceIOPool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceReturnType.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <fmt/format.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <ErrorHandling.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr size_t MAX_EVENTS_PER_WAIT = 64;
+
+/// Per-source state of the I/O thread
+struct RegisteredSource
+{
+    OriginId originId;
+    Source& source; ///NOLINT The SourceThread keeps the source alive until the termination promise is fulfilled
+    std::shared_ptr<AbstractBufferProvider> bufferProvider;
+    SourceReturnType::EmitFunction emit;
+    std::stop_token stopToken;
+    std::chrono::milliseconds flushInterval{0};
+    std::promise<SourceImplementationTermination> termination{};
+    std::unique_ptr<std::stop_callback<std::function<void()>>> wakeUpOnStop = nullptr;
+    std::optional<int> readinessFileDescriptor = std::nullopt;
+
+    std::optional<TupleBuffer> buffer = std::nullopt;
+    size_t numberOfBytesInBuffer = 0;
+    std::chrono::steady_clock::time_point flushDeadline{};
+    SequenceNumber::Underlying nextSequenceNumber = SequenceNumber::INITIAL;
+    bool waitingForBuffer = false;
+    bool finished = false;
+};
+}
+
+class SourceIOPool::IOThread
+{
+public:
+    explicit IOThread(size_t threadIdx);
+    ~IOThread();
+
+    IOThread(const IOThread& other) = delete;
+    IOThread(IOThread&& other) noexcept = delete;
+    IOThread& operator=(const IOThread& other) = delete;
+    IOThread& operator=(IOThread&& other) noexcept = delete;
+
+    void add(std::unique_ptr<RegisteredSource> source);
+
+private:
+    void run(const std::stop_token& stopToken);
+    void wakeUp() const;
+    void admitAddedSources();
+    [[nodiscard]] int getTimeoutInMs() const;
+
+    void ingest(RegisteredSource& source);
+    void emitBuffer(RegisteredSource& source);
+    void setWaitingForBuffer(RegisteredSource& source, bool waitingForBuffer) const;
+    void finish(RegisteredSource& source, SourceImplementationTermination result) const;
+    void fail(RegisteredSource& source, const std::exception& exception, bool wasOpened) const;
+    void closeSource(RegisteredSource& source) const;
+
+    size_t threadIdx;
+    int epollFileDescriptor;
+    /// Wakes up the I/O thread from epoll_wait, if sources were added or requested to stop
+    int wakeUpFileDescriptor;
+
+    std::mutex addedSourcesMutex;
+    std::vector<std::unique_ptr<RegisteredSource>> addedSources;
+    /// Only accessed by the I/O thread
+    std::vector<std::unique_ptr<RegisteredSource>> sources;
+
+    std::jthread thread;
+};
+
+SourceIOPool::IOThread::IOThread(const size_t threadIdx)
+    : threadIdx(threadIdx), epollFileDescriptor(epoll_create1(EPOLL_CLOEXEC)), wakeUpFileDescriptor(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+{
+    if (epollFileDescriptor < 0 or wakeUpFileDescriptor < 0)
+    {
+        throw CannotOpenSource("Could not create the I/O thread of the source I/O pool: {}", std::strerror(errno));
+    }
+    /// The wake-up file descriptor is the only one that is registered without a source
+    epoll_event event{.events = EPOLLIN, .data = {.ptr = nullptr}};
+    if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, wakeUpFileDescriptor, &event) < 0)
+    {
+        throw CannotOpenSource("Could not register the wake-up file descriptor with epoll: {}", std::strerror(errno));
+    }
+    thread = std::jthread([this](const std::stop_token& stopToken) { run(stopToken); });
+}
+
+SourceIOPool::IOThread::~IOThread()
+{
+    thread.request_stop();
+    wakeUp();
+    thread.join();
+    ::close(wakeUpFileDescriptor);
+    ::close(epollFileDescriptor);
+}
+
+void SourceIOPool::IOThread::add(std::unique_ptr<RegisteredSource> source)
+{
+    {
+        const std::scoped_lock lock(addedSourcesMutex);
+        addedSources.emplace_back(std::move(source));
+    }
+    wakeUp();
+}
+
+void SourceIOPool::IOThread::wakeUp() const
+{
+    constexpr uint64_t increment = 1;
+    /// If the counter of the eventfd would overflow, the I/O thread has not yet consumed the previous wake-ups and wakes up anyway
+    [[maybe_unused]] const auto written = ::write(wakeUpFileDescriptor, &increment, sizeof(increment));
+}
+
+void SourceIOPool::IOThread::admitAddedSources()
+{
+    std::vector<std::unique_ptr<RegisteredSource>> newSources;
+    {
+        const std::scoped_lock lock(addedSourcesMutex);
+        newSources.swap(addedSources);
+    }
+
+    for (auto& newSource : newSources)
+    {
+        auto& source = *newSource;
+        sources.emplace_back(std::move(newSource));
+        source.wakeUpOnStop = std::make_unique<std::stop_callback<std::function<void()>>>(source.stopToken, [this] { wakeUp(); });
+        try
+        {
+            source.source.open();
+        }
+        catch (const std::exception& exception)
+        {
+            fail(source, exception, false);
+            continue;
+        }
+
+        source.readinessFileDescriptor = source.source.getReadinessFileDescriptor();
+        if (source.readinessFileDescriptor.has_value())
+        {
+            epoll_event event{.events = EPOLLIN, .data = {.ptr = &source}};
+            if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, *source.readinessFileDescriptor, &event) < 0)
+            {
+                /// epoll does not support regular files, as they are always readable. Thus, we treat them as such.
+                if (errno != EPERM)
+                {
+                    fail(source, CannotOpenSource("Could not register the source with epoll: {}", std::strerror(errno)), true);
+                    continue;
+                }
+                source.readinessFileDescriptor.reset();
+            }
+        }
+        NES_DEBUG("Source {} is served by I/O thread {}", source.originId, threadIdx);
+    }
+}
+
+int SourceIOPool::IOThread::getTimeoutInMs() const
+{
+    const auto now = std::chrono::steady_clock::now();
+    auto timeout = std::chrono::milliseconds::max();
+    for (const auto& source : sources)
+    {
+        if (source->finished)
+        {
+            continue;
+        }
+        if (source->waitingForBuffer)
+        {
+            timeout = std::min<std::chrono::milliseconds>(timeout, RETRY_INTERVAL);
+        }
+        else if (not source->readinessFileDescriptor.has_value())
+        {
+            return 0;
+        }
+        if (source->numberOfBytesInBuffer > 0 and source->flushInterval.count() > 0)
+        {
+            const auto untilFlush = std::chrono::ceil<std::chrono::milliseconds>(source->flushDeadline - now);
+            timeout = std::min(timeout, std::max(untilFlush, std::chrono::milliseconds(0)));
+        }
+    }
+    return timeout == std::chrono::milliseconds::max() ? -1 : static_cast<int>(timeout.count());
+}
+
+void SourceIOPool::IOThread::run(const std::stop_token& stopToken)
+{
+    setThreadName(fmt::format("SourceIO-{}", threadIdx));
+    std::array<epoll_event, MAX_EVENTS_PER_WAIT> events{};
+    while (not stopToken.stop_requested())
+    {
+        admitAddedSources();
+
+        const auto numberOfEvents = epoll_wait(epollFileDescriptor, events.data(), events.size(), getTimeoutInMs());
+        if (numberOfEvents < 0 and errno != EINTR)
+        {
+            NES_ERROR("I/O thread {} failed to wait for its sources: {}", threadIdx, std::strerror(errno));
+        }
+        for (const auto& event : std::span(events).first(static_cast<size_t>(std::max(numberOfEvents, 0))))
+        {
+            if (event.data.ptr == nullptr)
+            {
+                uint64_t numberOfWakeUps = 0;
+                [[maybe_unused]] const auto numberOfReadBytes = ::read(wakeUpFileDescriptor, &numberOfWakeUps, sizeof(numberOfWakeUps));
+                continue;
+            }
+            ingest(*static_cast<RegisteredSource*>(event.data.ptr));
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& source : sources)
+        {
+            /// Sources that are always ready or wait for a TupleBuffer do not get an event
+            if (not source->readinessFileDescriptor.has_value() or source->waitingForBuffer)
+            {
+                ingest(*source);
+            }
+            if (not source->finished and source->numberOfBytesInBuffer > 0 and source->flushInterval.count() > 0
+                and source->flushDeadline <= now)
+            {
+                emitBuffer(*source);
+            }
+            if (not source->finished and source->stopToken.stop_requested())
+            {
+                closeSource(*source);
+                finish(*source, {SourceImplementationTermination::StopRequested});
+            }
+        }
+        std::erase_if(sources, [](const auto& source) { return source->finished; });
+    }
+
+    /// The pool shuts down. As every SourceThread keeps the pool alive, there should not be any sources left.
+    for (const auto& source : sources)
+    {
+        if (not source->finished)
+        {
+            closeSource(*source);
+            finish(*source, {SourceImplementationTermination::StopRequested});
+        }
+    }
+    const std::scoped_lock lock(addedSourcesMutex);
+    for (const auto& source : addedSources)
+    {
+        finish(*source, {SourceImplementationTermination::StopRequested});
+    }
+}
+
+void SourceIOPool::IOThread::ingest(RegisteredSource& source)
+{
+    if (source.finished or source.stopToken.stop_requested())
+    {
+        return;
+    }
+
+    try
+    {
+        if (not source.buffer.has_value())
+        {
+            source.buffer = source.bufferProvider->getBufferNoBlocking();
+            setWaitingForBuffer(source, not source.buffer.has_value());
+            if (not source.buffer.has_value())
+            {
+                return;
+            }
+            source.numberOfBytesInBuffer = 0;
+        }
+
+        const auto [numberOfBytes, endOfStream] = source.source.fillTupleBufferNonBlocking(*source.buffer, source.numberOfBytesInBuffer);
+        if (source.numberOfBytesInBuffer == 0 and numberOfBytes > 0)
+        {
+            source.flushDeadline = std::chrono::steady_clock::now() + source.flushInterval;
+        }
+        source.numberOfBytesInBuffer += numberOfBytes;
+        if (source.numberOfBytesInBuffer == source.buffer->getBufferSize() or (endOfStream and source.numberOfBytesInBuffer > 0))
+        {
+            emitBuffer(source);
+        }
+
+        if (endOfStream)
+        {
+            closeSource(source);
+            if (not source.stopToken.stop_requested())
+            {
+                source.emit(source.originId, SourceReturnType::EoS{}, source.stopToken);
+            }
+            finish(source, {SourceImplementationTermination::EndOfStream});
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        fail(source, exception, true);
+    }
+}
+
+void SourceIOPool::IOThread::emitBuffer(RegisteredSource& source)
+{
+    auto buffer = std::move(*source.buffer);
+    source.buffer.reset();
+    /// The source read in raw bytes, thus we don't know the number of tuples yet.
+    /// The InputFormatterTask expects that the source set the number of bytes this way and uses it to determine the number of tuples.
+    buffer.setNumberOfTuples(std::exchange(source.numberOfBytesInBuffer, 0));
+    detail::addBufferMetaData(source.originId, SequenceNumber(source.nextSequenceNumber++), buffer);
+    /// If the emit function returns STOP_REQUESTED, the stop token is set and the main loop closes the source
+    source.emit(source.originId, SourceReturnType::Data{std::move(buffer)}, source.stopToken);
+}
+
+void SourceIOPool::IOThread::setWaitingForBuffer(RegisteredSource& source, const bool waitingForBuffer) const
+{
+    if (source.waitingForBuffer == waitingForBuffer)
+    {
+        return;
+    }
+    source.waitingForBuffer = waitingForBuffer;
+    if (source.readinessFileDescriptor.has_value())
+    {
+        /// As epoll is level-triggered, watching a readable source that we cannot read from would wake up the I/O thread continuously
+        epoll_event event{.events = waitingForBuffer ? 0U : static_cast<uint32_t>(EPOLLIN), .data = {.ptr = &source}};
+        epoll_ctl(epollFileDescriptor, EPOLL_CTL_MOD, *source.readinessFileDescriptor, &event);
+    }
+}
+
+void SourceIOPool::IOThread::closeSource(RegisteredSource& source) const
+{
+    if (source.readinessFileDescriptor.has_value())
+    {
+        epoll_ctl(epollFileDescriptor, EPOLL_CTL_DEL, *source.readinessFileDescriptor, nullptr);
+        source.readinessFileDescriptor.reset();
+    }
+    source.buffer.reset();
+    source.numberOfBytesInBuffer = 0;
+    try
+    {
+        source.source.close();
+    }
+    catch (...)
+    {
+        tryLogCurrentException();
+    }
+}
+
+void SourceIOPool::IOThread::finish(RegisteredSource& source, const SourceImplementationTermination result) const
+{
+    source.finished = true;
+    source.wakeUpOnStop.reset();
+    /// Afterward, the SourceThread may destroy the source
+    source.termination.set_value(result);
+}
+
+void SourceIOPool::IOThread::fail(RegisteredSource& source, const std::exception& exception, const bool wasOpened) const
+{
+    if (wasOpened)
+    {
+        closeSource(source);
+    }
+    auto ingestionException = RunningRoutineFailure(exception.what());
+    source.finished = true;
+    source.wakeUpOnStop.reset();
+    source.termination.set_exception(std::make_exception_ptr(ingestionException));
+    source.emit(source.originId, SourceReturnType::Error{std::move(ingestionException)}, source.stopToken);
+}
+
+SourceIOPool::SourceIOPool(const size_t numberOfThreads)
+{
+    PRECONDITION(numberOfThreads > 0, "The source I/O pool requires at least one thread");
+    ioThreads.reserve(numberOfThreads);
+    for (size_t threadIdx = 0; threadIdx < numberOfThreads; ++threadIdx)
+    {
+        ioThreads.emplace_back(std::make_unique<IOThread>(threadIdx));
+    }
+}
+
+SourceIOPool::~SourceIOPool() = default;
+
+std::future<SourceImplementationTermination> SourceIOPool::add(
+    OriginId originId,
+    Source& source,
+    std::shared_ptr<AbstractBufferProvider> bufferProvider,
+    SourceReturnType::EmitFunction&& emitFunction,
+    const std::stop_token& stopToken)
+{
+    const auto configuration = source.getNonBlockingReadConfiguration();
+    PRECONDITION(configuration.has_value(), "Only sources that support non-blocking reads can be added to the source I/O pool");
+
+    auto registeredSource = std::make_unique<RegisteredSource>(RegisteredSource{
+        .originId = originId,
+        .source = source,
+        .bufferProvider = std::move(bufferProvider),
+        .emit = std::move(emitFunction),
+        .stopToken = stopToken,
+        .flushInterval = configuration->flushInterval});
+    auto termination = registeredSource->termination.get_future();
+    ioThreads.at(nextIOThread++ % ioThreads.size())->add(std::move(registeredSource));
+    return termination;
+}
+
+}
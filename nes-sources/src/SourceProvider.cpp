@@ -22,13 +22,17 @@
 #include <Sources/SourceDescriptor.hpp>
 #include <Sources/SourceHandle.hpp>
 #include <ErrorHandling.hpp>
+#include <SourceIOPool.hpp>
 #include <SourceRegistry.hpp>
 
 namespace NES
 {
 
-SourceProvider::SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool)
-    : defaultMaxInflightBuffers(defaultMaxInflightBuffers), bufferPool(std::move(bufferPool))
+SourceProvider::SourceProvider(
+    size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool, const size_t numberOfSourceIOThreads)
+    : defaultMaxInflightBuffers(defaultMaxInflightBuffers)
+    , bufferPool(std::move(bufferPool))
+    , ioPool(numberOfSourceIOThreads > 0 ? std::make_shared<SourceIOPool>(numberOfSourceIOThreads) : nullptr)
 {
 }
 
@@ -45,7 +49,7 @@ std::unique_ptr<SourceHandle> SourceProvider::lower(OriginId originId, const Sou
             : defaultMaxInflightBuffers;
         SourceRuntimeConfiguration runtimeConfig{maxInflightBuffers};
 
-        return std::make_unique<SourceHandle>(std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source.value()));
+        return std::make_unique<SourceHandle>(std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source.value()), ioPool);
     }
     throw UnknownSourceType("unknown source descriptor type: {}", sourceDescriptor.getSourceType());
 }
@@ -37,17 +37,33 @@
 #include <cpptrace/from_current.hpp>
 #include <fmt/format.h>
 #include <ErrorHandling.hpp>
+#include <SourceIOPool.hpp>
 
 namespace NES
 {
 
 SourceThread::SourceThread(
-    OriginId originId, std::shared_ptr<AbstractBufferProvider> poolProvider, std::unique_ptr<Source> sourceImplementation)
-    : originId(originId), localBufferManager(std::move(poolProvider)), sourceImplementation(std::move(sourceImplementation))
+    OriginId originId,
+    std::shared_ptr<AbstractBufferProvider> poolProvider,
+    std::unique_ptr<Source> sourceImplementation,
+    std::shared_ptr<SourceIOPool> ioPool)
+    : originId(originId)
+    , localBufferManager(std::move(poolProvider))
+    , sourceImplementation(std::move(sourceImplementation))
+    , ioPool(std::move(ioPool))
 {
     PRECONDITION(this->localBufferManager, "Invalid buffer manager");
 }
 
+SourceThread::~SourceThread()
+{
+    ioStopSource.request_stop();
+    if (not thread.joinable() and terminationFuture.valid())
+    {
+        terminationFuture.wait();
+    }
+}
+
 namespace detail
 {
 void addBufferMetaData(OriginId originId, SequenceNumber sequenceNumber, TupleBuffer& buffer)
@@ -118,7 +134,7 @@ dataSourceThreadRoutine(const std::stop_token& stopToken, Source& source, Abstra
         ///    The thread exits with `EndOfStream`
         /// 4. Failure. The fillTupleBuffer method will throw an exception, the exception is propagted to the SourceThread via the return promise.
         ///    The thread exists with an exception
-        auto emptyBuffer = bufferProvider.getBufferBlocking();
+        auto emptyBuffer = source.providesTupleBuffers() ? TupleBuffer{} : bufferProvider.getBufferBlocking();
         const auto numReadBytes = source.fillTupleBuffer(emptyBuffer, stopToken);
 
         if (numReadBytes != 0)
@@ -189,6 +205,13 @@ bool SourceThread::start(SourceReturnType::EmitFunction&& emitFunction)
     }
 
     NES_DEBUG("Starting source with originId: {}", originId);
+    if (ioPool and sourceImplementation->getNonBlockingReadConfiguration().has_value())
+    {
+        this->terminationFuture
+            = ioPool->add(originId, *sourceImplementation, localBufferManager, std::move(emitFunction), ioStopSource.get_token());
+        return true;
+    }
+
     std::promise<SourceImplementationTermination> terminationPromise;
     this->terminationFuture = terminationPromise.get_future();
 
@@ -209,6 +232,7 @@ void SourceThread::stop()
 
     NES_DEBUG("SourceThread  {} : stop source", originId);
     thread.request_stop();
+    ioStopSource.request_stop();
     {
         auto deletedOnScopeExit = std::move(thread);
     }
@@ -229,6 +253,7 @@ SourceReturnType::TryStopResult SourceThread::tryStop(std::chrono::milliseconds
     PRECONDITION(thread.get_id() != std::this_thread::get_id(), "DataSrc Thread should never request the source termination");
     NES_DEBUG("SourceThread  {} : attempting to stop source", originId);
     thread.request_stop();
+    ioStopSource.request_stop();
 
     try
     {
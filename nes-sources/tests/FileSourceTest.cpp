@@ -0,0 +1,258 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <FileSource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+namespace NES
+{
+
+class FileSourceTest : public Testing::BaseUnitTest
+{
+public:
+    size_t pageSize = getpagesize();
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("FileSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup FileSourceTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        testFilePath = std::filesystem::temp_directory_path()
+            / fmt::format("FileSourceTest-{}.csv", ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        auto schema = Schema{};
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(testFilePath);
+        BaseUnitTest::TearDown();
+    }
+
+    void writeTestFile(const std::string_view content) const
+    {
+        std::ofstream file(testFilePath, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    /// Creates and opens a memory-mapped FileSource for the test file
+    std::unique_ptr<FileSource> openMemoryMappedFileSource(const size_t regionSizeInBytes)
+    {
+        const auto sourceDescriptor = sourceCatalog.addPhysicalSource(
+            *logicalSource,
+            FileSource::NAME,
+            {{"file_path", testFilePath.string()}, {"memory_mapped", "true"}, {"region_size_in_bytes", std::to_string(regionSizeInBytes)}},
+            ParserConfig{});
+        EXPECT_TRUE(sourceDescriptor.has_value());
+        auto fileSource = std::make_unique<FileSource>(sourceDescriptor.value());
+        EXPECT_TRUE(fileSource->providesTupleBuffers());
+        EXPECT_FALSE(fileSource->getNonBlockingReadConfiguration().has_value());
+        fileSource->open();
+        return fileSource;
+    }
+
+    /// Fills TupleBuffers until the source reaches the end of the file and returns the emitted regions
+    static std::vector<TupleBuffer> readAllRegions(FileSource& fileSource)
+    {
+        const std::stop_source stopSource;
+        std::vector<TupleBuffer> regions;
+        while (true)
+        {
+            TupleBuffer region;
+            const auto numBytesRead = fileSource.fillTupleBuffer(region, stopSource.get_token());
+            if (numBytesRead == 0)
+            {
+                return regions;
+            }
+            EXPECT_EQ(region.getBufferSize(), numBytesRead);
+            regions.emplace_back(std::move(region));
+        }
+    }
+
+    static std::string_view contentOf(const TupleBuffer& region)
+    {
+        return {region.getBuffer<char>(), region.getBufferSize()};
+    }
+
+    /// Creates a file content of the given size that does not repeat within a page, so that misplaced regions change the content
+    static std::string createFileContent(const size_t sizeInBytes)
+    {
+        std::string content;
+        content.reserve(sizeInBytes);
+        for (size_t position = 0; position < sizeInBytes; ++position)
+        {
+            content.push_back(static_cast<char>('a' + ((position * 7 + position / 26) % 26)));
+        }
+        return content;
+    }
+
+    std::filesystem::path testFilePath;
+    SourceCatalog sourceCatalog;
+    std::optional<LogicalSource> logicalSource;
+};
+
+TEST_F(FileSourceTest, slicesFileIntoPageAlignedRegions)
+{
+    const auto fileContent = createFileContent(3 * pageSize);
+    writeTestFile(fileContent);
+    const auto fileSource = openMemoryMappedFileSource(pageSize);
+
+    const auto regions = readAllRegions(*fileSource);
+    ASSERT_EQ(regions.size(), 3U);
+    for (size_t regionIdx = 0; regionIdx < regions.size(); ++regionIdx)
+    {
+        EXPECT_EQ(regions[regionIdx].getBufferSize(), pageSize);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(regions[regionIdx].getBuffer<char>()) % pageSize, 0U);
+        EXPECT_EQ(contentOf(regions[regionIdx]), std::string_view(fileContent).substr(regionIdx * pageSize, pageSize));
+    }
+    /// The regions are consecutive slices of a single mapping, thus, the source does not copy them
+    EXPECT_EQ(regions[1].getBuffer<char>(), regions[0].getBuffer<char>() + pageSize);
+    EXPECT_EQ(regions[2].getBuffer<char>(), regions[1].getBuffer<char>() + pageSize);
+
+    /// The source keeps returning zero bytes at the end of the file
+    TupleBuffer region;
+    EXPECT_EQ(fileSource->fillTupleBuffer(region, std::stop_source().get_token()), 0U);
+    fileSource->close();
+}
+
+TEST_F(FileSourceTest, roundsRegionSizeUpToMultipleOfPageSize)
+{
+    const auto fileContent = createFileContent(4 * pageSize);
+    writeTestFile(fileContent);
+    const auto fileSource = openMemoryMappedFileSource(pageSize + 1);
+
+    const auto regions = readAllRegions(*fileSource);
+    ASSERT_EQ(regions.size(), 2U);
+    EXPECT_EQ(contentOf(regions[0]), std::string_view(fileContent).substr(0, 2 * pageSize));
+    EXPECT_EQ(contentOf(regions[1]), std::string_view(fileContent).substr(2 * pageSize));
+    fileSource->close();
+}
+
+TEST_F(FileSourceTest, emptyFileEmitsNoRegion)
+{
+    writeTestFile("");
+    const auto fileSource = openMemoryMappedFileSource(pageSize);
+
+    TupleBuffer region;
+    EXPECT_EQ(fileSource->fillTupleBuffer(region, std::stop_source().get_token()), 0U);
+    EXPECT_EQ(region.getBuffer(), nullptr);
+    fileSource->close();
+}
+
+TEST_F(FileSourceTest, lastRegionContainsRemainderOfFile)
+{
+    const auto fileSize = (2 * pageSize) + 123;
+    const auto fileContent = createFileContent(fileSize);
+    writeTestFile(fileContent);
+    const auto fileSource = openMemoryMappedFileSource(pageSize);
+
+    const auto regions = readAllRegions(*fileSource);
+    ASSERT_EQ(regions.size(), 3U);
+    EXPECT_EQ(regions[0].getBufferSize(), pageSize);
+    EXPECT_EQ(regions[1].getBufferSize(), pageSize);
+    EXPECT_EQ(regions[2].getBufferSize(), 123U);
+    EXPECT_EQ(contentOf(regions[2]), std::string_view(fileContent).substr(2 * pageSize));
+    fileSource->close();
+}
+
+TEST_F(FileSourceTest, recordsSpanningTwoRegions)
+{
+    /// Records of 7 bytes do not divide the page size. Thus, records span the boundaries between the regions.
+    constexpr size_t recordSize = 7;
+    const auto numberOfRecords = ((3 * pageSize) / recordSize) + 1;
+    std::string fileContent;
+    for (size_t recordIdx = 0; recordIdx < numberOfRecords; ++recordIdx)
+    {
+        fileContent += fmt::format("{:06}\n", recordIdx);
+    }
+    writeTestFile(fileContent);
+    auto fileSource = openMemoryMappedFileSource(pageSize);
+    const auto regions = readAllRegions(*fileSource);
+    ASSERT_EQ(regions.size(), 4U);
+
+    /// The regions outlive the source, as the input formatter stitches records only after the source emitted the following region
+    fileSource->close();
+    fileSource.reset();
+
+    for (size_t regionIdx = 1; regionIdx < regions.size(); ++regionIdx)
+    {
+        const auto previousRegion = contentOf(regions[regionIdx - 1]);
+        const auto currentRegion = contentOf(regions[regionIdx]);
+        const auto suffixOfPreviousRegion = previousRegion.substr(previousRegion.rfind('\n') + 1);
+        const auto prefixOfCurrentRegion = currentRegion.substr(0, currentRegion.find('\n') + 1);
+        ASSERT_FALSE(suffixOfPreviousRegion.empty()) << "No record spans the boundary before region " << regionIdx;
+
+        /// The partial records at the end of a region and at the start of the next region form the record at the boundary
+        const auto recordIdx = (regionIdx * pageSize) / recordSize;
+        EXPECT_EQ(std::string(suffixOfPreviousRegion) + std::string(prefixOfCurrentRegion), fmt::format("{:06}\n", recordIdx));
+    }
+
+    std::string concatenatedRegions;
+    for (const auto& region : regions)
+    {
+        concatenatedRegions += contentOf(region);
+    }
+    EXPECT_EQ(concatenatedRegions, fileContent);
+}
+
+TEST_F(FileSourceTest, reopeningStartsAtTheBeginningOfTheFile)
+{
+    const auto fileContent = createFileContent(pageSize + 1);
+    writeTestFile(fileContent);
+    const auto fileSource = openMemoryMappedFileSource(pageSize);
+    EXPECT_EQ(readAllRegions(*fileSource).size(), 2U);
+    fileSource->close();
+
+    fileSource->open();
+    const auto regions = readAllRegions(*fileSource);
+    ASSERT_EQ(regions.size(), 2U);
+    EXPECT_EQ(contentOf(regions[0]), std::string_view(fileContent).substr(0, pageSize));
+    fileSource->close();
+}
+
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+/// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,320 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <Generator.hpp>
+#include <GeneratorFields.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+namespace
+{
+constexpr uint64_t SEED = 42;
+
+/// Reads the value of the field at the given offset of the tuple in the native row layout
+template <typename T>
+T readValue(const std::vector<int8_t>& buffer, const size_t tupleIdx, const size_t tupleSizeInBytes, const size_t offsetOfField)
+{
+    T value{};
+    std::memcpy(&value, buffer.data() + (tupleIdx * tupleSizeInBytes) + offsetOfField, sizeof(T));
+    return value;
+}
+
+/// Generates a column of the field into a buffer whose tuples are larger than the field, to check that the field respects the stride
+template <typename T>
+std::vector<T> generateColumn(GeneratorFields::BaseGeneratorField& field, const size_t numberOfTuples, std::default_random_engine& randEng)
+{
+    constexpr size_t padding = 3;
+    const auto tupleSizeInBytes = field.getSizeInBytes() + padding;
+    std::vector<int8_t> buffer(numberOfTuples * tupleSizeInBytes, -1);
+    field.generate(buffer.data() + padding, numberOfTuples, tupleSizeInBytes, randEng);
+
+    std::vector<T> values;
+    for (size_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+    {
+        for (size_t paddingIdx = 0; paddingIdx < padding; ++paddingIdx)
+        {
+            EXPECT_EQ(buffer[(tupleIdx * tupleSizeInBytes) + paddingIdx], -1) << "The field overwrote the padding of tuple " << tupleIdx;
+        }
+        values.push_back(readValue<T>(buffer, tupleIdx, tupleSizeInBytes, padding));
+    }
+    return values;
+}
+}
+
+class GeneratorTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("GeneratorTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup GeneratorTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    void TearDown() override { BaseUnitTest::TearDown(); }
+
+    /// Generates tuples in batches of batchSize until the generator stops and returns the number of generated tuples
+    static size_t generateUntilStop(Generator& generator, const size_t batchSize)
+    {
+        std::vector<int8_t> buffer(batchSize * generator.getTupleSizeInBytes());
+        size_t numberOfTuples = 0;
+        while (not generator.shouldStop())
+        {
+            const auto numberOfTuplesInBatch = generator.generateTuples(buffer.data(), batchSize);
+            EXPECT_GT(numberOfTuplesInBatch, 0U);
+            numberOfTuples += numberOfTuplesInBatch;
+        }
+        return numberOfTuples;
+    }
+
+    /// Generates rows in text mode until the generator stops and returns the number of generated rows
+    static size_t generateTextUntilStop(Generator& generator)
+    {
+        std::stringstream rows;
+        size_t numberOfRows = 0;
+        while (not generator.shouldStop())
+        {
+            generator.generateTuple(rows);
+            ++numberOfRows;
+        }
+        return numberOfRows;
+    }
+};
+
+TEST_F(GeneratorTest, uniformFieldGeneratesValuesInClosedRange)
+{
+    std::default_random_engine randEng(SEED);
+    GeneratorFields::UniformField int16Field("UNIFORM INT16 -5 5");
+    EXPECT_EQ(int16Field.getSizeInBytes(), sizeof(int16_t));
+    const auto int16Values = generateColumn<int16_t>(int16Field, 1000, randEng);
+    EXPECT_EQ(std::ranges::min(int16Values), -5);
+    EXPECT_EQ(std::ranges::max(int16Values), 5);
+
+    /// The standard library has no uniform distribution for 8-bit types
+    GeneratorFields::UniformField uint8Field("UNIFORM UINT8 250 255");
+    const auto uint8Values = generateColumn<uint8_t>(uint8Field, 1000, randEng);
+    EXPECT_EQ(std::ranges::min(uint8Values), 250);
+    EXPECT_EQ(std::ranges::max(uint8Values), 255);
+
+    GeneratorFields::UniformField float64Field("UNIFORM FLOAT64 0.5 1.5");
+    for (const auto value : generateColumn<double>(float64Field, 1000, randEng))
+    {
+        EXPECT_GE(value, 0.5);
+        EXPECT_LE(value, 1.5);
+    }
+}
+
+TEST_F(GeneratorTest, uniformFieldValidation)
+{
+    EXPECT_NO_THROW(GeneratorFields::UniformField::validate("UNIFORM INT64 -10 10"));
+    EXPECT_NO_THROW(GeneratorFields::UniformField::validate("UNIFORM UINT32 7 7"));
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::UniformField::validate("UNIFORM INT64 -10"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::UniformField::validate("UNIFORM VARSIZED 0 10"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::UniformField::validate("UNIFORM UINT8 0 256"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::UniformField::validate("UNIFORM INT32 10 -10"), ErrorCode::InvalidConfigParameter);
+}
+
+TEST_F(GeneratorTest, zipfFieldGeneratesSkewedKeysInRange)
+{
+    constexpr size_t numberOfKeys = 10;
+    constexpr size_t numberOfTuples = 100000;
+    std::default_random_engine randEng(SEED);
+    GeneratorFields::ZipfField zipfField("ZIPF UINT32 10 1.0");
+    EXPECT_EQ(zipfField.getSizeInBytes(), sizeof(uint32_t));
+
+    std::vector<size_t> frequencies(numberOfKeys, 0);
+    for (const auto key : generateColumn<uint32_t>(zipfField, numberOfTuples, randEng))
+    {
+        ASSERT_LT(key, numberOfKeys);
+        ++frequencies[key];
+    }
+    /// Key k has a probability of 1 / ((k + 1) * H_10) with H_10 ~ 2.929. Thus, the frequencies must decrease with the key.
+    EXPECT_NEAR(static_cast<double>(frequencies[0]) / numberOfTuples, 1.0 / 2.929, 0.01);
+    EXPECT_NEAR(static_cast<double>(frequencies[9]) / numberOfTuples, 1.0 / (10 * 2.929), 0.01);
+    EXPECT_GT(frequencies[0], frequencies[1]);
+    EXPECT_GT(frequencies[1], frequencies[4]);
+    EXPECT_GT(frequencies[4], frequencies[9]);
+}
+
+TEST_F(GeneratorTest, zipfFieldWithExponentZeroGeneratesUniformKeys)
+{
+    constexpr size_t numberOfKeys = 4;
+    constexpr size_t numberOfTuples = 100000;
+    std::default_random_engine randEng(SEED);
+    GeneratorFields::ZipfField zipfField("ZIPF INT64 4 0");
+    std::vector<size_t> frequencies(numberOfKeys, 0);
+    for (const auto key : generateColumn<int64_t>(zipfField, numberOfTuples, randEng))
+    {
+        ASSERT_GE(key, 0);
+        ASSERT_LT(key, numberOfKeys);
+        ++frequencies[key];
+    }
+    for (const auto frequency : frequencies)
+    {
+        EXPECT_NEAR(static_cast<double>(frequency) / numberOfTuples, 0.25, 0.01);
+    }
+}
+
+TEST_F(GeneratorTest, zipfFieldValidation)
+{
+    EXPECT_NO_THROW(GeneratorFields::ZipfField::validate("ZIPF UINT64 1000 1.2"));
+    EXPECT_NO_THROW(GeneratorFields::ZipfField::validate("ZIPF INT32 1 0"));
+    EXPECT_NO_THROW(GeneratorFields::ZipfField::validate("ZIPF UINT32 16777216 1"));
+    /// Wrong number of parameters
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 1000"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 1000 1.2 3"), ErrorCode::InvalidConfigParameter);
+    /// Types that cannot represent the keys
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF FLOAT64 1000 1.2"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT8 100 1.2"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UNKNOWN 100 1.2"), ErrorCode::InvalidConfigParameter);
+    /// The number of keys must be in [1, 2^24]
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 0 1.2"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 16777217 1.2"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 -1 1.2"), ErrorCode::InvalidConfigParameter);
+    /// The exponent must be a non-negative number
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 1000 -0.5"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::ZipfField::validate("ZIPF UINT64 1000 steep"), ErrorCode::InvalidConfigParameter);
+}
+
+TEST_F(GeneratorTest, eventTimeFieldLagsBehindStreamPositionByAtMostMaxOutOfOrderness)
+{
+    constexpr uint64_t start = 1000;
+    constexpr uint64_t step = 10;
+    constexpr uint64_t maxOutOfOrderness = 50;
+    std::default_random_engine randEng(SEED);
+    GeneratorFields::EventTimeField eventTimeField("EVENT_TIME UINT64 1000 10 50");
+    EXPECT_EQ(eventTimeField.getSizeInBytes(), sizeof(uint64_t));
+
+    const auto timestamps = generateColumn<uint64_t>(eventTimeField, 1000, randEng);
+    bool foundOutOfOrderTimestamp = false;
+    for (size_t tupleIdx = 0; tupleIdx < timestamps.size(); ++tupleIdx)
+    {
+        const auto streamPosition = start + (tupleIdx * step);
+        EXPECT_LE(timestamps[tupleIdx], streamPosition);
+        EXPECT_GE(timestamps[tupleIdx], std::max(start, streamPosition - maxOutOfOrderness));
+        foundOutOfOrderTimestamp |= tupleIdx > 0 and timestamps[tupleIdx] < timestamps[tupleIdx - 1];
+    }
+    EXPECT_EQ(timestamps.front(), start);
+    EXPECT_TRUE(foundOutOfOrderTimestamp);
+
+    /// Without out-of-orderness, the timestamps advance by exactly one step, continuing from the previous column
+    GeneratorFields::EventTimeField inOrderField("EVENT_TIME INT64 0 5 0");
+    const auto firstColumn = generateColumn<int64_t>(inOrderField, 3, randEng);
+    const auto secondColumn = generateColumn<int64_t>(inOrderField, 2, randEng);
+    EXPECT_EQ(firstColumn, std::vector<int64_t>({0, 5, 10}));
+    EXPECT_EQ(secondColumn, std::vector<int64_t>({15, 20}));
+}
+
+TEST_F(GeneratorTest, eventTimeFieldValidation)
+{
+    EXPECT_NO_THROW(GeneratorFields::EventTimeField::validate("EVENT_TIME UINT64 0 1 0"));
+    EXPECT_NO_THROW(GeneratorFields::EventTimeField::validate("EVENT_TIME INT64 1000 10 500"));
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::EventTimeField::validate("EVENT_TIME UINT64 0 1"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::EventTimeField::validate("EVENT_TIME UINT32 0 1 0"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::EventTimeField::validate("EVENT_TIME UINT64 -1 1 0"), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(GeneratorFields::EventTimeField::validate("EVENT_TIME UINT64 0 x 0"), ErrorCode::InvalidConfigParameter);
+}
+
+TEST_F(GeneratorTest, generateTuplesWritesPackedRowLayout)
+{
+    /// The row layout packs the fields in the order of the schema: 8 + 1 + 4 + 8 bytes
+    constexpr size_t numberOfTuples = 100;
+    Generator generator(
+        SEED, GeneratorStop::NONE, "SEQUENCE UINT64 0 1000 1\nUNIFORM INT8 -3 3\nZIPF UINT32 10 1\nEVENT_TIME UINT64 500 2 0");
+    const auto tupleSizeInBytes = generator.getTupleSizeInBytes();
+    ASSERT_EQ(tupleSizeInBytes, 21U);
+
+    std::vector<int8_t> buffer(numberOfTuples * tupleSizeInBytes);
+    ASSERT_EQ(generator.generateTuples(buffer.data(), numberOfTuples), numberOfTuples);
+    for (size_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+    {
+        EXPECT_EQ(readValue<uint64_t>(buffer, tupleIdx, tupleSizeInBytes, 0), tupleIdx);
+        const auto uniformValue = readValue<int8_t>(buffer, tupleIdx, tupleSizeInBytes, 8);
+        EXPECT_GE(uniformValue, -3);
+        EXPECT_LE(uniformValue, 3);
+        EXPECT_LT(readValue<uint32_t>(buffer, tupleIdx, tupleSizeInBytes, 9), 10U);
+        EXPECT_EQ(readValue<uint64_t>(buffer, tupleIdx, tupleSizeInBytes, 13), 500 + (2 * tupleIdx));
+    }
+    EXPECT_FALSE(generator.shouldStop());
+}
+
+TEST_F(GeneratorTest, stopsAtTheEndOfAllSequences)
+{
+    /// The first sequence generates 0..9 and the second 0, 5, ..., 20. With ALL, the generator stops after the longer sequence.
+    constexpr std::string_view schema = "SEQUENCE UINT64 0 10 1\nSEQUENCE UINT64 0 25 5\nUNIFORM UINT64 0 100";
+    for (const size_t batchSize : {1, 3, 10, 1000})
+    {
+        Generator generator(SEED, GeneratorStop::ALL, schema);
+        EXPECT_EQ(generateUntilStop(generator, batchSize), 10U) << "batch size " << batchSize;
+    }
+    Generator textGenerator(SEED, GeneratorStop::ALL, schema);
+    EXPECT_EQ(generateTextUntilStop(textGenerator), 10U);
+
+    /// The last tuple contains the last value of the longer sequence, while the shorter sequence stays at its end
+    Generator generator(SEED, GeneratorStop::ALL, schema);
+    std::vector<int8_t> buffer(1000 * generator.getTupleSizeInBytes());
+    ASSERT_EQ(generator.generateTuples(buffer.data(), 1000), 10U);
+    EXPECT_EQ(readValue<uint64_t>(buffer, 9, generator.getTupleSizeInBytes(), 0), 9U);
+    EXPECT_EQ(readValue<uint64_t>(buffer, 9, generator.getTupleSizeInBytes(), 8), 25U);
+    EXPECT_TRUE(generator.shouldStop());
+}
+
+TEST_F(GeneratorTest, stopsAtTheEndOfTheFirstSequence)
+{
+    /// With ONE, the generator stops after the shorter sequence generated its five values
+    constexpr std::string_view schema = "SEQUENCE UINT64 0 10 1\nSEQUENCE UINT64 0 25 5\nUNIFORM UINT64 0 100";
+    for (const size_t batchSize : {1, 2, 5, 1000})
+    {
+        Generator generator(SEED, GeneratorStop::ONE, schema);
+        EXPECT_EQ(generateUntilStop(generator, batchSize), 5U) << "batch size " << batchSize;
+    }
+    Generator textGenerator(SEED, GeneratorStop::ONE, schema);
+    EXPECT_EQ(generateTextUntilStop(textGenerator), 5U);
+
+    Generator generator(SEED, GeneratorStop::ONE, schema);
+    std::vector<int8_t> buffer(1000 * generator.getTupleSizeInBytes());
+    ASSERT_EQ(generator.generateTuples(buffer.data(), 1000), 5U);
+    EXPECT_EQ(readValue<uint64_t>(buffer, 4, generator.getTupleSizeInBytes(), 0), 4U);
+    EXPECT_EQ(readValue<uint64_t>(buffer, 4, generator.getTupleSizeInBytes(), 8), 20U);
+    EXPECT_TRUE(generator.shouldStop());
+}
+
+TEST_F(GeneratorTest, generatesAllRequestedTuplesWithoutStop)
+{
+    Generator generator(SEED, GeneratorStop::NONE, "SEQUENCE UINT64 0 10 1");
+    std::vector<int8_t> buffer(100 * generator.getTupleSizeInBytes());
+    EXPECT_EQ(generator.generateTuples(buffer.data(), 100), 100U);
+    /// The sequence stays at its end
+    EXPECT_EQ(readValue<uint64_t>(buffer, 99, generator.getTupleSizeInBytes(), 0), 10U);
+    EXPECT_FALSE(generator.shouldStop());
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
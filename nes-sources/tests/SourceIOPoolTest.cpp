@@ -0,0 +1,227 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceReturnType.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <SourceIOPool.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+namespace
+{
+constexpr size_t BUFFER_SIZE = 64;
+constexpr auto TIMEOUT = std::chrono::seconds(1);
+
+/// Reads from the read end of a pipe, which, like a socket, becomes readable once new data arrives
+class PipeSource final : public Source
+{
+public:
+    PipeSource(const int readFileDescriptor, const std::chrono::milliseconds flushInterval)
+        : readFileDescriptor(readFileDescriptor), flushInterval(flushInterval)
+    {
+    }
+
+    size_t fillTupleBuffer(TupleBuffer&, const std::stop_token&) override { return 0; }
+
+    [[nodiscard]] std::optional<NonBlockingReadConfiguration> getNonBlockingReadConfiguration() const override
+    {
+        return NonBlockingReadConfiguration{.flushInterval = flushInterval};
+    }
+
+    [[nodiscard]] std::optional<int> getReadinessFileDescriptor() const override { return readFileDescriptor; }
+
+    NonBlockingFillResult fillTupleBufferNonBlocking(TupleBuffer& tupleBuffer, const size_t offset) override
+    {
+        const auto numberOfBytes = ::read(readFileDescriptor, tupleBuffer.getBuffer() + offset, tupleBuffer.getBufferSize() - offset);
+        if (numberOfBytes < 0)
+        {
+            return {.numberOfBytes = 0, .endOfStream = false};
+        }
+        return {.numberOfBytes = static_cast<size_t>(numberOfBytes), .endOfStream = numberOfBytes == 0};
+    }
+
+    void open() override { fcntl(readFileDescriptor, F_SETFL, O_NONBLOCK); }
+
+    void close() override { ::close(readFileDescriptor); }
+
+protected:
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override { return str << "PipeSource"; }
+
+private:
+    int readFileDescriptor;
+    std::chrono::milliseconds flushInterval;
+};
+
+/// Records the number of bytes of each emitted TupleBuffer and whether the source emitted an end of stream
+struct RecordingEmitFunction
+{
+    SourceReturnType::EmitResult operator()(const OriginId, SourceReturnType::SourceReturnType event, const std::stop_token&)
+    {
+        const std::scoped_lock lock(mutex);
+        if (const auto* data = std::get_if<SourceReturnType::Data>(&event))
+        {
+            emittedBytes.push_back(data->buffer.getNumberOfTuples());
+            sequenceNumbers.push_back(data->buffer.getSequenceNumber());
+        }
+        endOfStream |= std::holds_alternative<SourceReturnType::EoS>(event);
+        changed.notify_all();
+        return SourceReturnType::EmitResult::SUCCESS;
+    }
+
+    bool waitForEmits(const size_t numberOfEmits)
+    {
+        std::unique_lock lock(mutex);
+        return changed.wait_for(lock, TIMEOUT, [&] { return emittedBytes.size() >= numberOfEmits; });
+    }
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<size_t> emittedBytes;
+    std::vector<SequenceNumber> sequenceNumbers;
+    bool endOfStream = false;
+};
+
+SourceReturnType::EmitFunction emitTo(RecordingEmitFunction& recorder)
+{
+    return [&recorder](const OriginId originId, SourceReturnType::SourceReturnType event, const std::stop_token& stopToken)
+    { return recorder(originId, std::move(event), stopToken); };
+}
+
+struct Pipe
+{
+    Pipe() { EXPECT_EQ(pipe(fileDescriptors.data()), 0); }
+
+    void write(const size_t numberOfBytes) const
+    {
+        const std::string data(numberOfBytes, 'x');
+        EXPECT_EQ(::write(fileDescriptors[1], data.data(), data.size()), static_cast<ssize_t>(numberOfBytes));
+    }
+
+    void closeWriteEnd() const { ::close(fileDescriptors[1]); }
+
+    std::array<int, 2> fileDescriptors{};
+};
+}
+
+class SourceIOPoolTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SourceIOPoolTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup SourceIOPoolTest test class.");
+    }
+
+    void SetUp() override { Testing::BaseUnitTest::SetUp(); }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 1024);
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(SourceIOPoolTest, servesMoreSourcesThanThreads)
+{
+    constexpr size_t numberOfSources = 16;
+    const auto ioPool = std::make_shared<SourceIOPool>(2);
+    std::array<Pipe, numberOfSources> pipes;
+    std::array<RecordingEmitFunction, numberOfSources> recorders;
+    std::vector<std::unique_ptr<SourceThread>> sourceThreads;
+    for (size_t sourceIdx = 0; sourceIdx < numberOfSources; ++sourceIdx)
+    {
+        sourceThreads.emplace_back(std::make_unique<SourceThread>(
+            OriginId(sourceIdx + 1),
+            bufferManager,
+            std::make_unique<PipeSource>(pipes.at(sourceIdx).fileDescriptors[0], std::chrono::milliseconds(0)),
+            ioPool));
+        EXPECT_TRUE(sourceThreads.back()->start(emitTo(recorders.at(sourceIdx))));
+    }
+
+    /// Each source emits two full TupleBuffers and the remaining bytes at the end of the stream
+    for (size_t sourceIdx = 0; sourceIdx < numberOfSources; ++sourceIdx)
+    {
+        pipes.at(sourceIdx).write((2 * BUFFER_SIZE) + sourceIdx + 1);
+        pipes.at(sourceIdx).closeWriteEnd();
+    }
+    for (size_t sourceIdx = 0; sourceIdx < numberOfSources; ++sourceIdx)
+    {
+        auto& recorder = recorders.at(sourceIdx);
+        ASSERT_TRUE(recorder.waitForEmits(3));
+        sourceThreads.at(sourceIdx).reset();
+        EXPECT_EQ(recorder.emittedBytes, (std::vector<size_t>{BUFFER_SIZE, BUFFER_SIZE, sourceIdx + 1}));
+        EXPECT_EQ(recorder.sequenceNumbers, (std::vector{SequenceNumber(1), SequenceNumber(2), SequenceNumber(3)}));
+        EXPECT_TRUE(recorder.endOfStream);
+    }
+}
+
+TEST_F(SourceIOPoolTest, flushesPartialBufferAfterFlushInterval)
+{
+    const auto ioPool = std::make_shared<SourceIOPool>(1);
+    const Pipe pipe;
+    RecordingEmitFunction recorder;
+    SourceThread sourceThread(
+        INITIAL<OriginId>, bufferManager, std::make_unique<PipeSource>(pipe.fileDescriptors[0], std::chrono::milliseconds(10)), ioPool);
+    EXPECT_TRUE(sourceThread.start(emitTo(recorder)));
+
+    pipe.write(10);
+    ASSERT_TRUE(recorder.waitForEmits(1));
+    EXPECT_EQ(recorder.emittedBytes, std::vector<size_t>{10});
+
+    /// Stopping the source does not emit an end of stream
+    sourceThread.stop();
+    EXPECT_FALSE(recorder.endOfStream);
+    pipe.closeWriteEnd();
+}
+
+TEST_F(SourceIOPoolTest, stopDoesNotEmitPartialBuffer)
+{
+    const auto ioPool = std::make_shared<SourceIOPool>(1);
+    const Pipe pipe;
+    RecordingEmitFunction recorder;
+    SourceThread sourceThread(
+        INITIAL<OriginId>, bufferManager, std::make_unique<PipeSource>(pipe.fileDescriptors[0], std::chrono::milliseconds(0)), ioPool);
+    EXPECT_TRUE(sourceThread.start(emitTo(recorder)));
+
+    pipe.write(BUFFER_SIZE + 10);
+    ASSERT_TRUE(recorder.waitForEmits(1));
+    EXPECT_EQ(sourceThread.tryStop(std::chrono::milliseconds(1000)), SourceReturnType::TryStopResult::SUCCESS);
+    EXPECT_EQ(recorder.emittedBytes, std::vector<size_t>{BUFFER_SIZE});
+    EXPECT_FALSE(recorder.endOfStream);
+    pipe.closeWriteEnd();
+}
+
+/// NOLINTEND(readability-magic-numbers)
+}
@@ -52,6 +52,7 @@
 #include <Operators/Windows/Aggregations/MaxAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MedianAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MinAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/QuantileAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/SumAggregationLogicalFunction.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
@@ -845,6 +846,22 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
             helpers.top().windowAggs.push_back(
                 MedianAggregationLogicalFunction::create(helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>()));
             break;
+        case AntlrSQLLexer::QUANTILE: {
+            if (helpers.top().functionBuilder.empty() or helpers.top().constantBuilder.empty())
+            {
+                throw InvalidQuerySyntax("Quantile requires a field and a constant quantile as arguments at {}", context->getText());
+            }
+            const auto quantile = Util::from_chars<double>(helpers.top().constantBuilder.back());
+            if (not quantile.has_value() or not(0 <= *quantile and *quantile <= 1))
+            {
+                throw InvalidQuerySyntax(
+                    "Quantile must be a number in [0, 1], but got {} at {}", helpers.top().constantBuilder.back(), context->getText());
+            }
+            helpers.top().constantBuilder.pop_back();
+            helpers.top().windowAggs.push_back(QuantileAggregationLogicalFunction::create(
+                helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>(), quantile.value()));
+            break;
+        }
         default:
             /// Check if the function is a constructor for a datatype
             if (const auto dataType = DataTypeProvider::tryProvideDataType(funcName); dataType.has_value())